@@ -45,6 +45,9 @@ enum class Opcode : uint8_t {
     STORE16     = 0x25, ///< 스택의 주소에 2바이트 저장
     STORE32     = 0x26, ///< 스택의 주소에 4바이트 저장
     STORE64     = 0x27, ///< 스택의 주소에 8바이트 저장
+    MEMCPY      = 0x28, ///< 블록 복사: dst, src, len을 꺼내 [src, src+len)을 [dst, dst+len)에 복사 (겹쳐도 됨)
+    MEMSET      = 0x29, ///< 블록 채우기: dst, value, len을 꺼내 [dst, dst+len)을 value의 하위 1바이트로 채움
+    MEMCMP      = 0x2A, ///< 블록 비교: a, b, len을 꺼내 비교 결과(-1/0/1)를 푸시
     
     // Control Flow Operations
     JMP         = 0x30, ///< 무조건 점프 (상대적, ±2바이트 오프셋)
@@ -56,12 +59,19 @@ enum class Opcode : uint8_t {
     JLE         = 0x36, ///< 작거나 같으면 점프
     
     // Function Operations
-    CALL        = 0x40, ///< 함수 호출 (반환 주소 푸시)
-    RET         = 0x41, ///< 함수에서 반환
+    CALL        = 0x40, ///< 함수 호출 (반환 주소/이전 BP로 프레임을 만들고 BP 설정)
+    RET         = 0x41, ///< 함수에서 반환 (반환값을 남기고 프레임과 인자 imm8개 제거)
+    LDLOC       = 0x42, ///< BP 기준 지역 변수 슬롯 imm8 값을 푸시
+    STLOC       = 0x43, ///< 값을 팝해 BP 기준 지역 변수 슬롯 imm8에 저장
+    LDARG       = 0x44, ///< BP 기준 인자 슬롯 imm8 값을 푸시
+    TAILCALL    = 0x45, ///< 현재 프레임을 재사용해 함수 호출 (새 인자 수 imm8, 현재 함수 인자 수 imm8)
     
     // Memory Allocation
     ALLOC       = 0x50, ///< 힙에 메모리 할당, 주소를 스택에 푸시
     FREE        = 0x51, ///< 이전에 할당된 메모리 해제
+    ARENA_BEGIN = 0x52, ///< 새 아레나 열기 (중첩 가능)
+    ARENA_ALLOC = 0x53, ///< 가장 안쪽 아레나에서 할당, 주소를 스택에 푸시 (포인터 증가만 함)
+    ARENA_RESET = 0x54, ///< 가장 안쪽 아레나를 닫고 그 안의 할당을 한 번에 해제
     
     // Host Interface
     HOSTCALL    = 0x60, ///< 호스트 함수 호출
@@ -71,6 +81,16 @@ enum class Opcode : uint8_t {
     HALT        = 0xFF, ///< VM 실행 중지
 };
 
+/**
+ * @brief 바이트코드 모듈 명령어 집합 종류
+ * 
+ * 패키지의 모듈 헤더에 기록되어 Loader가 실행 엔진을 선택하는 데 사용
+ */
+enum class BytecodeIsa : uint8_t {
+    Stack       = 0x00, ///< Opcode 스택 기반 바이트코드 (Interpreter)
+    Register    = 0x01, ///< RegOpcode 3-주소 레지스터 코드 (RegisterInterpreter)
+};
+
 /**
  * @brief 명령어별 오퍼랜드 크기 정보
  * 
@@ -128,6 +148,9 @@ inline OpcodeInfo GetOpcodeInfo(Opcode op)
         case Opcode::STORE16:   return {0, false, "STORE16"};
         case Opcode::STORE32:   return {0, false, "STORE32"};
         case Opcode::STORE64:   return {0, false, "STORE64"};
+        case Opcode::MEMCPY:    return {0, false, "MEMCPY"};    // 스택에서 dst, src, len 가져옴
+        case Opcode::MEMSET:    return {0, false, "MEMSET"};    // 스택에서 dst, value, len 가져옴
+        case Opcode::MEMCMP:    return {0, false, "MEMCMP"};    // 스택에서 a, b, len 가져옴
         
         // Control Flow Operations
         case Opcode::JMP:       return {2, true, "JMP"};
@@ -140,11 +163,18 @@ inline OpcodeInfo GetOpcodeInfo(Opcode op)
         
         // Function Operations
         case Opcode::CALL:      return {0, true, "CALL"};     // 스택에서 주소 가져옴
-        case Opcode::RET:       return {0, true, "RET"};
+        case Opcode::RET:       return {1, true, "RET"};      // 1바이트 인자 수
+        case Opcode::LDLOC:     return {1, false, "LDLOC"};   // 1바이트 지역 변수 인덱스
+        case Opcode::STLOC:     return {1, false, "STLOC"};
+        case Opcode::LDARG:     return {1, false, "LDARG"};   // 1바이트 인자 인덱스
+        case Opcode::TAILCALL:  return {2, true, "TAILCALL"}; // 새 인자 수, 현재 함수 인자 수 (각 1바이트)
         
         // Memory Allocation
         case Opcode::ALLOC:     return {0, false, "ALLOC"};   // 스택에서 크기 가져옴
         case Opcode::FREE:      return {0, false, "FREE"};
+        case Opcode::ARENA_BEGIN: return {0, false, "ARENA_BEGIN"};
+        case Opcode::ARENA_ALLOC: return {0, false, "ARENA_ALLOC"}; // 스택에서 크기 가져옴
+        case Opcode::ARENA_RESET: return {0, false, "ARENA_RESET"};
         
         // Host Interface
         case Opcode::HOSTCALL:  return {1, false, "HOSTCALL"}; // 1바이트 함수 ID
@@ -0,0 +1,144 @@
+#pragma once
+#include <cstdint>
+
+namespace DarkMatterVM {
+namespace Engine {
+
+/**
+ * @brief 레지스터 VM 명령어 집합
+ *
+ * 모든 명령어는 8바이트 고정 길이: op | a | b | c | ext(4바이트)
+ * - a: 결과를 쓸 레지스터
+ * - b, c: RK 오퍼랜드 (0x00~0x7F 레지스터, 0x80~0xFF 상수 풀 인덱스 + 0x80)
+ * - ext: 분기 목적지(명령어 인덱스), LOADK 상수 인덱스, HOSTCALL 함수 ID, MEMCPY/MEMSET/MEMCMP 길이 RK 오퍼랜드
+ *
+ * 값은 대응하는 스택 Opcode와 같게 맞춤
+ */
+enum class RegOpcode : uint8_t {
+    TRAP        = 0x00, ///< 코드 끝 표시, 실행 시 오류
+    MOVE        = 0x01, ///< R[a] = RK(b)
+    LOADK       = 0x02, ///< R[a] = K[ext]
+
+    // Arithmetic / Bitwise: R[a] = RK(b) op RK(c)
+    ADD         = 0x10,
+    SUB         = 0x11,
+    MUL         = 0x12,
+    DIV         = 0x13,
+    MOD         = 0x14,
+    AND         = 0x15,
+    OR          = 0x16,
+    XOR         = 0x17,
+    NOT         = 0x18, ///< R[a] = ~RK(b)
+    SHL         = 0x19,
+    SHR         = 0x1A,
+
+    // Memory: LOADn R[a] = mem[RK(b)], STOREn mem[RK(b)] = RK(c)
+    LOAD8       = 0x20,
+    LOAD16      = 0x21,
+    LOAD32      = 0x22,
+    LOAD64      = 0x23,
+    STORE8      = 0x24,
+    STORE16     = 0x25,
+    STORE32     = 0x26,
+    STORE64     = 0x27,
+
+    // Bulk Memory: 길이는 RK(ext 하위 1바이트)
+    MEMCPY      = 0x28, ///< memmove(RK(b), RK(c), RK(ext))
+    MEMSET      = 0x29, ///< memset(RK(b), RK(c), RK(ext))
+    MEMCMP      = 0x2A, ///< R[a] = memcmp(RK(b), RK(c), RK(ext)) (-1/0/1)
+
+    // Control Flow: 목적지는 ext (명령어 인덱스)
+    JMP         = 0x30,
+    JZ          = 0x31, ///< RK(b) == 0 이면 점프
+    JNZ         = 0x32, ///< RK(b) != 0 이면 점프
+    JG          = 0x33, ///< RK(b) > RK(c) 이면 점프
+    JL          = 0x34,
+    JGE         = 0x35,
+    JLE         = 0x36,
+
+    // Memory Allocation
+    ALLOC       = 0x50, ///< R[a] = alloc(RK(b))
+    FREE        = 0x51, ///< free(RK(b))
+    ARENA_BEGIN = 0x52, ///< 새 아레나 열기
+    ARENA_ALLOC = 0x53, ///< R[a] = arena_alloc(RK(b))
+    ARENA_RESET = 0x54, ///< 가장 안쪽 아레나 닫기
+
+    // Host Interface
+    HOSTCALL    = 0x60, ///< 호스트 함수 ext 호출, 인자 RK(b)
+
+    // System
+    HALT        = 0xFF, ///< a != 0 이면 RK(b)를 반환 값으로 설정 후 중지
+};
+
+/**
+ * @brief 레지스터 VM 명령어 (8바이트 고정)
+ */
+struct RegInstruction {
+    uint8_t op;     ///< RegOpcode
+    uint8_t a;      ///< 결과 레지스터
+    uint8_t b;      ///< RK 오퍼랜드 1
+    uint8_t c;      ///< RK 오퍼랜드 2
+    uint32_t ext;   ///< 분기 목적지 / 상수 인덱스 / 호스트 함수 ID / 블록 길이 RK
+};
+
+/// RK 오퍼랜드에서 상수 풀을 가리키는 비트
+constexpr uint8_t kRegConstantFlag = 0x80;
+
+/// 프레임당 레지스터 수 상한 (RK 인코딩 범위)
+constexpr uint32_t kMaxRegisters = 0x80;
+
+/// RK 오퍼랜드로 바로 참조할 수 있는 상수 수 (그 이상은 LOADK로 적재)
+constexpr uint32_t kMaxRKConstants = 0x80;
+
+/**
+ * @brief 레지스터 명령어 니모닉 조회 (디스어셈블리용)
+ */
+inline const char* GetRegOpcodeMnemonic(RegOpcode op)
+{
+    switch (op)
+    {
+        case RegOpcode::TRAP:       return "TRAP";
+        case RegOpcode::MOVE:       return "MOVE";
+        case RegOpcode::LOADK:      return "LOADK";
+        case RegOpcode::ADD:        return "ADD";
+        case RegOpcode::SUB:        return "SUB";
+        case RegOpcode::MUL:        return "MUL";
+        case RegOpcode::DIV:        return "DIV";
+        case RegOpcode::MOD:        return "MOD";
+        case RegOpcode::AND:        return "AND";
+        case RegOpcode::OR:         return "OR";
+        case RegOpcode::XOR:        return "XOR";
+        case RegOpcode::NOT:        return "NOT";
+        case RegOpcode::SHL:        return "SHL";
+        case RegOpcode::SHR:        return "SHR";
+        case RegOpcode::LOAD8:      return "LOAD8";
+        case RegOpcode::LOAD16:     return "LOAD16";
+        case RegOpcode::LOAD32:     return "LOAD32";
+        case RegOpcode::LOAD64:     return "LOAD64";
+        case RegOpcode::STORE8:     return "STORE8";
+        case RegOpcode::STORE16:    return "STORE16";
+        case RegOpcode::STORE32:    return "STORE32";
+        case RegOpcode::STORE64:    return "STORE64";
+        case RegOpcode::MEMCPY:     return "MEMCPY";
+        case RegOpcode::MEMSET:     return "MEMSET";
+        case RegOpcode::MEMCMP:     return "MEMCMP";
+        case RegOpcode::JMP:        return "JMP";
+        case RegOpcode::JZ:         return "JZ";
+        case RegOpcode::JNZ:        return "JNZ";
+        case RegOpcode::JG:         return "JG";
+        case RegOpcode::JL:         return "JL";
+        case RegOpcode::JGE:        return "JGE";
+        case RegOpcode::JLE:        return "JLE";
+        case RegOpcode::ALLOC:      return "ALLOC";
+        case RegOpcode::FREE:       return "FREE";
+        case RegOpcode::ARENA_BEGIN: return "ARENA_BEGIN";
+        case RegOpcode::ARENA_ALLOC: return "ARENA_ALLOC";
+        case RegOpcode::ARENA_RESET: return "ARENA_RESET";
+        case RegOpcode::HOSTCALL:   return "HOSTCALL";
+        case RegOpcode::HALT:       return "HALT";
+        default:                    return "INVALID";
+    }
+}
+
+} // namespace Engine
+} // namespace DarkMatterVM
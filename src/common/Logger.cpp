@@ -49,6 +49,11 @@ void Logger::SetLevel(LogLevel level)
 	_currentLevel = level;
 }
 
+LogLevel Logger::GetLevel() 
+{
+	return _currentLevel;
+}
+
 void Logger::Debug(const std::string& component, const std::string& message) 
 {
 	Log(LogLevel::DEBUG, component, message);
@@ -4,6 +4,37 @@
 #include <fstream>
 #include <iostream>
 
+/**
+ * @brief 추적 로그(DMVM_TRACE_DEBUG/DMVM_TRACE_INFO) 포함 여부
+ * 
+ * 1이면 로그 레벨로 실행 중 거르고, 빌드 옵션으로 0을 지정하면 추적 로그 코드를 모두 제거
+ */
+#ifndef DMVM_TRACE
+#define DMVM_TRACE 1
+#endif
+
+/**
+ * @brief 레벨이 켜져 있을 때만 메시지 식을 평가하는 로그 매크로
+ * 
+ * 명령어/메모리 접근마다 지나가는 경로에서 사용 (꺼져 있으면 문자열을 만들지 않고 비교 한 번만 함)
+ */
+#define DMVM_LOG(level, component, message) \
+	do \
+	{ \
+		if (::DarkMatterVM::Logger::IsEnabled(level)) \
+		{ \
+			::DarkMatterVM::Logger::Log(level, component, message); \
+		} \
+	} while (0)
+
+#if DMVM_TRACE
+#define DMVM_TRACE_DEBUG(component, message) DMVM_LOG(::DarkMatterVM::LogLevel::DEBUG, component, message)
+#define DMVM_TRACE_INFO(component, message) DMVM_LOG(::DarkMatterVM::LogLevel::INFO, component, message)
+#else
+#define DMVM_TRACE_DEBUG(component, message) do { } while (0)
+#define DMVM_TRACE_INFO(component, message) do { } while (0)
+#endif
+
 namespace DarkMatterVM 
 {
 
@@ -38,6 +69,13 @@ public:
 	
 	static void SetLevel(LogLevel level);
 	
+	static LogLevel GetLevel();
+	
+	/**
+	 * @brief 해당 레벨 로그가 출력되는지 여부 (메시지를 만들기 전에 확인)
+	 */
+	static bool IsEnabled(LogLevel level) { return level >= _currentLevel; }
+	
 	static void Debug(const std::string& component, const std::string& message);
 	
 	static void Info(const std::string& component, const std::string& message);
@@ -50,7 +88,6 @@ public:
 	
 	static void Cleanup();
 	
-private:
 	/**
 	 * @brief 로그 메시지 출력
 	 * 
@@ -60,6 +97,7 @@ private:
 	 */
 	static void Log(LogLevel level, const std::string& component, const std::string& message);
 	
+private:
 	/// 현재 로그 레벨
 	static LogLevel _currentLevel;
 	
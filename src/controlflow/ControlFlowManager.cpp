@@ -1,12 +1,28 @@
 #include "ControlFlowManager.h"
+#include <algorithm>
 #include <stdexcept>
+#include <string>
 
 namespace DarkMatterVM::ControlFlow {
 
-ControlFlowManager::ControlFlowManager(Memory::MemoryManager& mem)
+namespace
+{
+
+// 호출 스택을 처음 만들 때 크기 (재귀가 없으면 늘리지 않음)
+constexpr size_t kInitialFrames = 64;
+
+} // namespace
+
+ControlFlowManager::ControlFlowManager(Memory::MemoryManager& mem, size_t maxDepth)
     : _memoryManager(mem)
     , _currentBP(0)
-{}
+    , _maxDepth(maxDepth)
+{
+    if (maxDepth == 0)
+    {
+        throw std::invalid_argument("ControlFlowManager: max depth must be positive");
+    }
+}
 
 // 무조건 분기 처리
 void ControlFlowManager::Jump(size_t& ip, int16_t rel) const 
@@ -33,26 +49,100 @@ void ControlFlowManager::JNZ(size_t& ip, int16_t rel, uint64_t value) const
 }
 
 // 함수 호출
-void ControlFlowManager::Call(size_t& ip, int16_t rel) 
+void ControlFlowManager::Call(size_t& ip, size_t target) 
 {
-    // CALL 다음 명령 위치를 리턴 주소로 저장
-    size_t returnIP = ip;
-    // 스택 프레임: [returnIP] → [oldBP]
-    _memoryManager.EnterStackFrame(_currentBP, returnIP);
-    // 새 BP는 스택 포인터 위치
+    // 배열이 찼거나 (최대 깊이를 줄였으면 배열이 남아 있어도) 최대 깊이에 닿았을 때만 분기
+    if (_depth == _frames.size() || _depth == _maxDepth)
+    {
+        _Grow();
+    }
+
+    // 호출 스택: [returnIP, oldBP] (VM 스택에는 아무것도 쌓지 않음)
+    _frames[_depth++] = {ip, _currentBP, target};
+    // 새 BP는 인자를 모두 푸시한 뒤(호출 직전)의 스택 포인터
     _currentBP = _memoryManager.GetStackPointer();
-    // IP를 호출 대상 블록으로 이동
-    ip = static_cast<size_t>(returnIP + rel);
+    // IP를 호출 대상으로 이동
+    ip = target;
 }
 
 // 함수 반환
-void ControlFlowManager::Ret(size_t& ip) 
+void ControlFlowManager::Ret(size_t& ip, uint8_t argumentCount) 
+{
+    // 프레임 밖이거나 BP 아래로 반환값이 없으면 프레임을 정리할 수 없음
+    if (_depth == 0 || _memoryManager.GetStackPointer() >= _currentBP)
+    {
+        throw std::runtime_error("ControlFlowManager: RET without an active frame or return value");
+    }
+
+    uint64_t result = _memoryManager.PopStack();
+
+    // 지역 변수, 남은 피연산자, 인자를 버리고 반환값을 남김
+    _memoryManager.SetStackPointer(_currentBP + static_cast<size_t>(argumentCount) * sizeof(uint64_t));
+    _memoryManager.PushStack(result);
+
+    const CallFrame& frame = _frames[--_depth];
+    _currentBP = frame.basePointer;
+    ip = frame.returnAddress;
+}
+
+// 꼬리 호출
+void ControlFlowManager::TailCall(size_t& ip, size_t target, uint8_t argumentCount, uint8_t parameterCount) 
+{
+    const size_t stackPointer = _memoryManager.GetStackPointer();
+    const size_t argumentBytes = static_cast<size_t>(argumentCount) * sizeof(uint64_t);
+    if (_depth == 0 || stackPointer > _currentBP || argumentBytes > _currentBP - stackPointer)
+    {
+        throw std::runtime_error("ControlFlowManager: TAILCALL without an active frame or arguments");
+    }
+
+    // 새 인자의 끝을 현재 인자의 끝에 맞춰 옮기고 지역 변수와 남은 피연산자를 버린 뒤 같은 호출 스택 항목으로 새 함수 진입
+    const size_t frameBase = _currentBP + static_cast<size_t>(parameterCount) * sizeof(uint64_t) - argumentBytes;
+    _memoryManager.MoveStackTopSlots(frameBase, argumentCount);
+    _currentBP = frameBase;
+    _frames[_depth - 1].entry = target;
+    ip = target;
+}
+
+void ControlFlowManager::Reset()
+{
+    _depth = 0;
+    _currentBP = 0;
+}
+
+void ControlFlowManager::Restore(size_t basePointer, std::span<const CallFrame> frames)
+{
+    if (frames.size() > _maxDepth)
+    {
+        throw std::runtime_error("ControlFlowManager: call stack deeper than max depth");
+    }
+
+    if (_frames.size() < frames.size())
+    {
+        _frames.resize(frames.size());
+    }
+    std::copy(frames.begin(), frames.end(), _frames.begin());
+    _depth = frames.size();
+    _currentBP = basePointer;
+}
+
+void ControlFlowManager::SetMaxDepth(size_t maxDepth)
 {
-    size_t oldBP, returnIP;
-    _memoryManager.LeaveStackFrame(oldBP, returnIP);
-    _currentBP = oldBP;
-    ip = returnIP;
+    if (maxDepth == 0 || maxDepth < _depth)
+    {
+        throw std::invalid_argument("ControlFlowManager: invalid max depth");
+    }
+
+    _maxDepth = maxDepth;
 }
 
+void ControlFlowManager::_Grow()
+{
+    if (_depth >= _maxDepth)
+    {
+        throw std::runtime_error("ControlFlowManager: call stack overflow (max depth " + std::to_string(_maxDepth) + ")");
+    }
+
+    _frames.resize(std::min(std::max(_frames.size() * 2, kInitialFrames), _maxDepth));
+}
 
 } // namespace DarkMatterVM::ControlFlow
@@ -2,24 +2,45 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <span>
+#include <vector>
 #include "../Memory/MemoryManager.h"
 #include "FrameLayout.h"
 
 namespace DarkMatterVM::ControlFlow {
 
+/**
+ * @brief 호출 스택 항목 (CALL 한 번)
+ */
+struct CallFrame
+{
+    size_t returnAddress;   ///< 반환 주소 (CALL 다음 명령어 오프셋)
+    size_t basePointer;     ///< 호출자의 베이스 포인터 (RET이 복원)
+    size_t entry;           ///< 호출된 함수 시작 오프셋
+};
+
 /**
  * @brief 런타임 제어 흐름 관리
  *
  * CALL/RET, JMP, 조건 분기 등을 처리하고,
  * 스택 프레임을 MemoryManager와 FrameLayout에 따라 관리합니다.
+ *
+ * 반환 주소와 이전 BP는 VM 스택이 아닌 전용 호출 스택(연속 배열)에 두므로
+ * 피연산자 스택에는 인자, 지역 변수, 피연산자만 쌓이고 바이트코드가 반환 주소를 읽거나 덮어쓸 수 없음
  */
 class ControlFlowManager 
 {
 public:
     /**
-     * @param mem  스택·힙 메모리 관리 객체
+     * @brief 기본 최대 호출 깊이
      */
-    explicit ControlFlowManager(Memory::MemoryManager& mem);
+    static constexpr size_t kDefaultMaxDepth = 16 * 1024;
+
+    /**
+     * @param mem       스택·힙 메모리 관리 객체
+     * @param maxDepth  최대 호출 깊이
+     */
+    explicit ControlFlowManager(Memory::MemoryManager& mem, size_t maxDepth = kDefaultMaxDepth);
 
     /// 무조건 분기
     void Jump(size_t& ip, int16_t rel) const;
@@ -31,23 +52,92 @@ public:
 
     /**
      * @brief 함수 호출 (CALL)
-     * @param ip   다음 실행할 명령어의 주소 (CALL 다음 위치)
-     * @param rel  상대 오프셋
+     *
+     * 호출 스택에 반환 주소와 현재 BP를 넣고 BP를 호출 직전 스택 포인터(인자 바로 아래)로 옮김
+     *
+     * @param ip      호출 전: 반환 주소 (CALL 다음 위치), 호출 후: 함수 시작 주소
+     * @param target  함수 시작 주소
+     * @throw std::runtime_error 최대 호출 깊이를 넘을 때
      */
-    void Call(size_t& ip, int16_t rel);
+    void Call(size_t& ip, size_t target);
 
     /**
      * @brief 함수 반환 (RET)
-     * @param ip  복원된 리턴 주소를 여기에 기록
+     *
+     * 반환값을 팝하고 지역 변수와 남은 피연산자, 인자 argumentCount개를 걷어낸 뒤 반환값을 다시 푸시하고 BP 복원
+     *
+     * @param ip             복원된 리턴 주소를 여기에 기록
+     * @param argumentCount  호출자가 푸시한 인자 수
+     * @throw std::runtime_error 활성 프레임이나 반환값이 없을 때
+     */
+    void Ret(size_t& ip, uint8_t argumentCount);
+
+    /**
+     * @brief 꼬리 호출 (TAILCALL): 현재 프레임을 재사용해 호출
+     *
+     * 스택 최상위의 새 인자 argumentCount개를 현재 인자 자리(끝을 맞춤)로 옮기고 지역 변수와 남은 피연산자를 버린 뒤
+     * 호출 스택 깊이는 그대로 두고 현재 프레임의 함수 시작 주소만 바꿈. 호출된 함수의 RET argumentCount가
+     * 원래 호출자가 푸시한 인자까지 걷어내므로 호출자에게는 이 함수가 RET parameterCount로 반환한 것과 같음
+     *
+     * @param ip              호출 후: 함수 시작 주소
+     * @param target          함수 시작 주소
+     * @param argumentCount   새로 푸시한 인자 수
+     * @param parameterCount  현재 함수가 받은 인자 수 (현재 프레임의 RET 인자 수)
+     * @throw std::runtime_error 활성 프레임이 없거나 현재 프레임 안에 새 인자가 없을 때
+     */
+    void TailCall(size_t& ip, size_t target, uint8_t argumentCount, uint8_t parameterCount);
+
+    /**
+     * @brief 호출 스택을 비우고 프레임 밖(BP = 0)으로 되돌림
      */
-    void Ret(size_t& ip);
+    void Reset();
+
+    /**
+     * @brief 호출 스택과 BP를 통째로 바꿈 (스냅샷 복원)
+     *
+     * @param basePointer  현재 프레임의 BP
+     * @param frames       바깥쪽 호출부터의 프레임
+     * @throw std::runtime_error 프레임 수가 최대 호출 깊이를 넘을 때
+     */
+    void Restore(size_t basePointer, std::span<const CallFrame> frames);
 
     /// 현재 프레임의 베이스 포인터 조회
     size_t GetBasePointer() const { return _currentBP; }
 
+    /**
+     * @brief 현재 호출 스택 (0번이 가장 바깥 호출, 마지막이 현재 함수)
+     *
+     * 복사 없이 내부 배열을 그대로 보여 주므로 프로파일러가 실행 중 VM 호출 스택을 훑을 때 사용
+     */
+    std::span<const CallFrame> GetCallStack() const { return {_frames.data(), _depth}; }
+
+    /// 현재 호출 깊이
+    size_t GetDepth() const { return _depth; }
+
+    /// 최대 호출 깊이
+    size_t GetMaxDepth() const { return _maxDepth; }
+
+    /**
+     * @brief 최대 호출 깊이 설정
+     *
+     * @param maxDepth 최대 호출 깊이 (1 이상, 현재 깊이 이상)
+     * @throw std::invalid_argument 범위를 벗어날 때
+     */
+    void SetMaxDepth(size_t maxDepth);
+
 private:
+    /**
+     * @brief 호출 스택 배열을 두 배로 늘림 (최대 깊이까지, 이미 충분하면 그대로)
+     *
+     * @throw std::runtime_error 이미 최대 깊이일 때
+     */
+    void _Grow();
+
     Memory::MemoryManager& _memoryManager;
     size_t                 _currentBP = 0;
+    std::vector<CallFrame> _frames;         ///< 호출 스택 (앞쪽 _depth개가 유효, 줄일 때는 크기를 유지)
+    size_t                 _depth = 0;
+    size_t                 _maxDepth;
 };
 
 } // namespace DarkMatterVM::ControlFlow
@@ -9,17 +9,29 @@ size_t FrameLayout::GetLocalVarAddress(size_t frameBase, size_t varIndex) {
     // 8바이트 단위
     constexpr size_t WordSize = sizeof(uint64_t);
 
-    // overflow 방지
-    if (varIndex > (std::numeric_limits<size_t>::max() - LocalAreaOffset - frameBase) / WordSize) 
+    // underflow 방지 (슬롯이 스택 세그먼트 시작 위에 있어야 함)
+    if (frameBase < LocalAreaOffset || varIndex >= (frameBase - LocalAreaOffset) / WordSize) 
     {
         throw std::overflow_error("FrameLayout: local variable index overflow");
     }
 
-    return frameBase + LocalAreaOffset + varIndex * WordSize;
+    return frameBase - LocalAreaOffset - (varIndex + 1) * WordSize;
     // address = frameBase
-    //     + LocalAreaOffset        // 헤더 크기
-    //     + varIndex * 8           // varIndex번째 로컬 변수
+    //     - LocalAreaOffset        // 헤더 크기
+    //     - (varIndex + 1) * 8     // varIndex번째 로컬 변수 (스택은 아래로 자람)
+
+}
+
+size_t FrameLayout::GetArgumentAddress(size_t frameBase, size_t argIndex) {
+    constexpr size_t WordSize = sizeof(uint64_t);
+
+    // overflow 방지
+    if (argIndex > (std::numeric_limits<size_t>::max() - frameBase) / WordSize) 
+    {
+        throw std::overflow_error("FrameLayout: argument index overflow");
+    }
 
+    return frameBase + argIndex * WordSize;
 }
 
 } // namespace DarkMatterVM::ControlFlow
@@ -9,42 +9,45 @@ namespace DarkMatterVM::ControlFlow
 /**
  * @brief 스택 프레임 레이아웃 정의
  *
+ * 스택은 아래(낮은 주소)로 자라므로 오프셋은 프레임 베이스에서 아래쪽으로 잰 거리이며,
+ * 오프셋 o의 슬롯은 [frameBase - o - 8, frameBase - o) 구간
+ *
+ * 반환 주소와 이전 베이스 포인터는 ControlFlowManager의 호출 스택(CallFrame)에 두므로 VM 스택의 프레임에는 헤더가 없음
+ *
  * ┌────────────────────────────┐
- * │ ... 이전 프레임 데이터 ... │
- * ├────────────────────────────┤
- * │ return address  (8 bytes)  │  ← frameBase + ReturnAddressOffset
+ * │   인자[1] (8 bytes)        │  ← frameBase + 8
+ * │   인자[0] (8 bytes)        │  ← frameBase (호출자가 마지막에 푸시한 인자)
  * ├────────────────────────────┤
- * │ old base pointer (8 bytes) │  ← frameBase + BasePointerOffset
- * ├────────────────────────────┤
- * │  로컬 변수 영역 시작      │  ← frameBase + LocalAreaOffset
- * ├────────────────────────────┤
- * │   로컬[0] (8 bytes)        │
+ * │   로컬[0] (8 bytes)        │  ← frameBase - LocalAreaOffset - 8
  * │   로컬[1] (8 bytes)        │
  * │   …                        │
+ * ├────────────────────────────┤
+ * │   피연산자 스택            │
  * └────────────────────────────┘
  */
 class FrameLayout 
 {
 public:
-    /// 리턴 주소 오프셋 (프레임 베이스에서)
-    static constexpr size_t ReturnAddressOffset = 0;
-
-    /// 이전 베이스 포인터 오프셋
-    static constexpr size_t BasePointerOffset = ReturnAddressOffset + sizeof(uint64_t);
-
-    /// 로컬 변수 영역 시작 오프셋
-    static constexpr size_t LocalAreaOffset = BasePointerOffset + sizeof(uint64_t);
-
-    /// 프레임 헤더 전체 크기 (로컬 변수 시작까지)
-    static constexpr size_t HeaderSize = LocalAreaOffset;
+    /// 로컬 변수 영역 시작 오프셋 (VM 스택의 프레임 헤더 크기, 헤더는 호출 스택에 있으므로 0)
+    static constexpr size_t LocalAreaOffset = 0;
 
     /**
-     * @brief 이 프레임에서 varIndex번째 로컬 변수의 절대 주소 계산
-     * @param frameBase  스택 프레임 베이스(새 BP)
-     * @param varIndex   로컬 변수 인덱스 (0부터)
-     * @return 메모리 상의 주소 (frameBase + LocalAreaOffset + varIndex*8)
+     * @brief 이 프레임에서 varIndex번째 로컬 변수의 스택 주소 계산
+     * @param frameBase  스택 프레임 베이스(BP, 호출 직전의 스택 포인터)
+     * @param varIndex   로컬 변수 인덱스 (0부터, 함수 진입 후 먼저 푸시한 슬롯이 0)
+     * @return 스택 세그먼트 오프셋 (frameBase - LocalAreaOffset - (varIndex+1)*8)
+     * @throw std::overflow_error 프레임 베이스 아래로 슬롯이 들어갈 공간이 없을 때
      */
     static size_t GetLocalVarAddress(size_t frameBase, size_t varIndex);
+
+    /**
+     * @brief 이 프레임에서 argIndex번째 인자의 스택 주소 계산
+     * @param frameBase  스택 프레임 베이스(BP)
+     * @param argIndex   인자 인덱스 (0부터, 호출자가 마지막에 푸시한 인자가 0)
+     * @return 스택 세그먼트 오프셋 (frameBase + argIndex*8)
+     * @throw std::overflow_error 주소 계산이 넘칠 때
+     */
+    static size_t GetArgumentAddress(size_t frameBase, size_t argIndex);
 };
 
 } // namespace DarkMatterVM::ControlFlow
@@ -9,14 +9,20 @@ namespace DarkMatterVM {
 namespace Engine {
 
 // 정적 멤버 변수 초기화
-const std::unordered_map<uint8_t, Interpreter::OpcodeHandler> Interpreter::_opcodeHandlers = 
-    Interpreter::_InitializeOpcodeHandlers();
+const std::array<Interpreter::OpcodeHandler, 256> Interpreter::_dispatchTable = 
+    Interpreter::_BuildDispatchTable();
 
 Interpreter::Interpreter(size_t codeSize, size_t stackSize, size_t heapSize)
-    : _ip(0), _running(false), _returnValue(0)
+    : _ip(0)
+    , _memoryManager(std::make_unique<Memory::MemoryManager>(codeSize, stackSize, heapSize))
+    , _running(false)
+    , _returnValue(0)
+    , _controlFlow(*_memoryManager)
 {
-    // 메모리 관리자 생성
-    _memoryManager = std::make_unique<Memory::MemoryManager>(codeSize, stackSize, heapSize);
+    _codeSegment = &_memoryManager->GetSegment(Memory::MemorySegmentType::CODE);
+    _stackSegment = &_memoryManager->GetSegment(Memory::MemorySegmentType::STACK);
+    _heapSegment = &_memoryManager->GetSegment(Memory::MemorySegmentType::HEAP);
+    _heapVirtualBase = _memoryManager->GetBaseAddress(Memory::MemorySegmentType::HEAP);
 }
 
 void Interpreter::LoadBytecode(const uint8_t* bytecode, size_t size)
@@ -35,12 +41,63 @@ void Interpreter::LoadBytecode(const uint8_t* bytecode, size_t size)
             plain[i] = bytecode[i + 2] ^ key;
         }
         Logger::Info("Interpreter", "암호화된 바이트코드 감지 → key=0x" + std::to_string(key) + ", 길이=" + std::to_string(plain.size()));
-        _memoryManager->InitializeCode(plain.data(), plain.size());
+        _LoadPlainCode(plain.data(), plain.size());
     }
     else
     {
         // 암호화 안 됨
-        _memoryManager->InitializeCode(bytecode, size);
+        _LoadPlainCode(bytecode, size);
+    }
+}
+
+void Interpreter::_LoadPlainCode(const uint8_t* code, size_t size)
+{
+    _memoryManager->InitializeCode(code, size);
+    _codeSize = size;
+    
+    // 명령어 스트림을 한 번만 디코딩 (Threaded 핸들러 배열은 다음 실행 시 재구성)
+    _stream.Decode(_codeSegment->GetData(), _codeSize, _superinstructionsEnabled);
+    _threadedHandlersValid = false;
+    _jitValid = false;
+    _tieredJitValid = false;
+    
+    // 레인 실행 대상 여부 (ExecuteBatch에서 사용)
+    _lanes.Analyze(code, size);
+    
+    // 스택 깊이/분기 목적지 검증 (통과하면 Execute()가 검사 생략 루프 사용)
+    _verifier.Verify(code, size);
+}
+
+void Interpreter::_LoadSharedCode(const Interpreter& source)
+{
+    _memoryManager->ShareCode(*source._memoryManager);
+    _codeSize = source._codeSize;
+    
+    // 디코딩/분석 결과는 원본 설정 기준이므로 슈퍼명령어 설정도 함께 맞춤
+    _superinstructionsEnabled = source._superinstructionsEnabled;
+    _stream = source._stream;
+    _lanes = source._lanes;
+    _lanes.ResetStats();
+    _verifier = source._verifier;
+    _threadedHandlersValid = false;
+    _jitValid = false;
+    _tieredJitValid = false;
+}
+
+void Interpreter::SetSuperinstructionsEnabled(bool enabled)
+{
+    if (_superinstructionsEnabled == enabled)
+    {
+        return;
+    }
+    
+    _superinstructionsEnabled = enabled;
+    
+    // 로드된 코드가 있으면 새 설정으로 다시 디코딩
+    if (_stream.GetCount() > 0)
+    {
+        _stream.Decode(_codeSegment->GetData(), _codeSize, _superinstructionsEnabled);
+        _threadedHandlersValid = false;
     }
 }
 
@@ -55,9 +112,20 @@ void Interpreter::Reset()
     // 반환 값 초기화
     _returnValue = 0;
     
+    // 호출 스택을 비우고 프레임 밖에서 시작
+    _controlFlow.Reset();
+    
     // 스택 포인터 초기화 (스택 세그먼트 크기로 설정)
-    auto& stackSegment = _memoryManager->GetSegment(Memory::MemorySegmentType::STACK);
-    _memoryManager->SetStackPointer(stackSegment.GetSize());
+    // 빈 스택이 된 인스턴스는 다른 스레드로 넘어갈 수 있으므로 소유 스레드도 잊음 (풀 반납, 배치 작업 스레드)
+    _memoryManager->GetStackMemory().Reset(_stackSegment->GetSize());
+}
+
+size_t Interpreter::Recycle()
+{
+    size_t scrubbed = _memoryManager->ScrubDirty();
+    Reset();
+    
+    return scrubbed;
 }
 
 int Interpreter::Execute(size_t startAddress)
@@ -68,14 +136,290 @@ int Interpreter::Execute(size_t startAddress)
     // 실행 플래그 설정
     _running = true;
     
-    // 바이트코드 실행 루프
-    while (_running) 
+    // 검증된 코드는 진입 위치가 검증 기준(0번지)과 같을 때만 검사 생략 루프로 (가드 페이지 스택도 같은 조건)
+    if (startAddress == 0 && ((_verificationEnabled && _verifier.IsVerified()) || IsStackGuarded()) &&
+        (_executionMode == ExecutionMode::Portable || _executionMode == ExecutionMode::Threaded))
+    {
+        return _ExecuteVerified();
+    }
+    
+    if (IsThreadedDispatchSupported() && _executionMode == ExecutionMode::Threaded)
+    {
+        return _ExecuteThreaded();
+    }
+    
+    if (_executionMode == ExecutionMode::StackCached)
+    {
+        return _ExecuteStackCached();
+    }
+    
+    if (IsJitSupported() && _executionMode == ExecutionMode::Jit)
+    {
+        return _ExecuteJit();
+    }
+    
+    if (IsJitSupported() && _executionMode == ExecutionMode::Tiered)
     {
-        if (!Step()) 
+        return _ExecuteTiered();
+    }
+    
+    return _ExecutePortable();
+}
+
+int Interpreter::_ExecutePortable()
+{
+    uint32_t pc = _stream.GetIndex(_ip);
+    if (pc == InstructionStream::kNoIndex)
+    {
+        return _ExecuteBytecode();
+    }
+    
+    const uint8_t* opcodes = _stream.GetOpcodes();
+    const uint64_t* immediates = _stream.GetImmediates();
+    const uint32_t* targets = _stream.GetTargets();
+    const uint32_t* nextOffsets = _stream.GetNextOffsets();
+    
+    try 
+    {
+        while (true) 
         {
-            break;
+            // 스트림 opcode는 Opcode와 FusedOpcode 값을 함께 쓰므로 원래 바이트 값으로 분기
+            switch (opcodes[pc]) 
+            {
+                case static_cast<uint8_t>(Opcode::PUSH8):
+                case static_cast<uint8_t>(Opcode::PUSH16):
+                case static_cast<uint8_t>(Opcode::PUSH32):
+                case static_cast<uint8_t>(Opcode::PUSH64):
+                    _memoryManager->PushStack(immediates[pc]);
+                    break;
+                case static_cast<uint8_t>(Opcode::POP):       _Handle_POP(); break;
+                case static_cast<uint8_t>(Opcode::DUP):       _Handle_DUP(); break;
+                case static_cast<uint8_t>(Opcode::SWAP):      _Handle_SWAP(); break;
+                
+                case static_cast<uint8_t>(Opcode::ADD):       _Handle_ADD(); break;
+                case static_cast<uint8_t>(Opcode::SUB):       _Handle_SUB(); break;
+                case static_cast<uint8_t>(Opcode::MUL):       _Handle_MUL(); break;
+                case static_cast<uint8_t>(Opcode::DIV):       _Handle_DIV(); break;
+                case static_cast<uint8_t>(Opcode::MOD):       _Handle_MOD(); break;
+                
+                case static_cast<uint8_t>(Opcode::AND):       _Handle_AND(); break;
+                case static_cast<uint8_t>(Opcode::OR):        _Handle_OR(); break;
+                case static_cast<uint8_t>(Opcode::XOR):       _Handle_XOR(); break;
+                case static_cast<uint8_t>(Opcode::NOT):       _Handle_NOT(); break;
+                case static_cast<uint8_t>(Opcode::SHL):       _Handle_SHL(); break;
+                case static_cast<uint8_t>(Opcode::SHR):       _Handle_SHR(); break;
+                
+                case static_cast<uint8_t>(Opcode::LOAD8):     _Handle_LOAD8(); break;
+                case static_cast<uint8_t>(Opcode::LOAD16):    _Handle_LOAD16(); break;
+                case static_cast<uint8_t>(Opcode::LOAD32):    _Handle_LOAD32(); break;
+                case static_cast<uint8_t>(Opcode::LOAD64):    _Handle_LOAD64(); break;
+                case static_cast<uint8_t>(Opcode::STORE8):    _Handle_STORE8(); break;
+                case static_cast<uint8_t>(Opcode::STORE16):   _Handle_STORE16(); break;
+                case static_cast<uint8_t>(Opcode::STORE32):   _Handle_STORE32(); break;
+                case static_cast<uint8_t>(Opcode::STORE64):   _Handle_STORE64(); break;
+                case static_cast<uint8_t>(Opcode::MEMCPY):    _Handle_MEMCPY(); break;
+                case static_cast<uint8_t>(Opcode::MEMSET):    _Handle_MEMSET(); break;
+                case static_cast<uint8_t>(Opcode::MEMCMP):    _Handle_MEMCMP(); break;
+                
+                // 분기 목적지는 디코딩 시점에 명령어 인덱스로 변환되어 있음
+                case static_cast<uint8_t>(Opcode::JMP):
+                    pc = targets[pc];
+                    continue;
+                case static_cast<uint8_t>(Opcode::JZ):
+                    if (_memoryManager->PopStack() == 0) 
+                    {
+                        pc = targets[pc];
+                        continue;
+                    }
+                    break;
+                case static_cast<uint8_t>(Opcode::JNZ):
+                    if (_memoryManager->PopStack() != 0) 
+                    {
+                        pc = targets[pc];
+                        continue;
+                    }
+                    break;
+                case static_cast<uint8_t>(Opcode::JG):
+                case static_cast<uint8_t>(Opcode::JL):
+                case static_cast<uint8_t>(Opcode::JGE):
+                case static_cast<uint8_t>(Opcode::JLE):
+                {
+                    uint64_t b = _memoryManager->PopStack();
+                    uint64_t a = _memoryManager->PopStack();
+                    
+                    bool taken = false;
+                    switch (static_cast<Opcode>(opcodes[pc])) 
+                    {
+                        case Opcode::JG:    taken = a > b; break;
+                        case Opcode::JL:    taken = a < b; break;
+                        case Opcode::JGE:   taken = a >= b; break;
+                        default:            taken = a <= b; break;
+                    }
+                    
+                    if (taken) 
+                    {
+                        pc = targets[pc];
+                        continue;
+                    }
+                    break;
+                }
+                
+                // 동적 목적지: 명령어 경계가 아니면 바이트 단위 실행으로 전환
+                case static_cast<uint8_t>(Opcode::CALL):
+                {
+                    uint64_t targetAddress = _memoryManager->PopStack();
+                    _ip = nextOffsets[pc];
+                    _controlFlow.Call(_ip, static_cast<size_t>(targetAddress));
+                    
+                    uint32_t targetIndex = _stream.GetIndex(_ip);
+                    if (targetIndex == InstructionStream::kNoIndex) 
+                    {
+                        return _ExecuteBytecode();
+                    }
+                    
+                    pc = targetIndex;
+                    continue;
+                }
+                case static_cast<uint8_t>(Opcode::RET):
+                {
+                    _controlFlow.Ret(_ip, static_cast<uint8_t>(immediates[pc]));
+                    
+                    uint32_t returnIndex = _stream.GetIndex(_ip);
+                    if (returnIndex == InstructionStream::kNoIndex) 
+                    {
+                        return _ExecuteBytecode();
+                    }
+                    
+                    pc = returnIndex;
+                    continue;
+                }
+                case static_cast<uint8_t>(Opcode::TAILCALL):
+                {
+                    uint64_t targetAddress = _memoryManager->PopStack();
+                    _controlFlow.TailCall(_ip, static_cast<size_t>(targetAddress),
+                                          static_cast<uint8_t>(immediates[pc]), static_cast<uint8_t>(immediates[pc] >> 8));
+                    
+                    uint32_t targetIndex = _stream.GetIndex(_ip);
+                    if (targetIndex == InstructionStream::kNoIndex) 
+                    {
+                        return _ExecuteBytecode();
+                    }
+                    
+                    pc = targetIndex;
+                    continue;
+                }
+                
+                // BP 기준 프레임 슬롯
+                case static_cast<uint8_t>(Opcode::LDLOC):
+                    _memoryManager->PushStackSlot(_LocalAddress(static_cast<uint8_t>(immediates[pc])));
+                    break;
+                case static_cast<uint8_t>(Opcode::STLOC):
+                    _memoryManager->PopStackSlot(_LocalAddress(static_cast<uint8_t>(immediates[pc])));
+                    break;
+                case static_cast<uint8_t>(Opcode::LDARG):
+                    _memoryManager->PushStackSlot(_ArgumentAddress(static_cast<uint8_t>(immediates[pc])));
+                    break;
+                
+                case static_cast<uint8_t>(Opcode::ALLOC):     _Handle_ALLOC(); break;
+                case static_cast<uint8_t>(Opcode::FREE):      _Handle_FREE(); break;
+                case static_cast<uint8_t>(Opcode::ARENA_BEGIN): _Handle_ARENA_BEGIN(); break;
+                case static_cast<uint8_t>(Opcode::ARENA_ALLOC): _Handle_ARENA_ALLOC(); break;
+                case static_cast<uint8_t>(Opcode::ARENA_RESET): _Handle_ARENA_RESET(); break;
+                
+                case static_cast<uint8_t>(Opcode::HOSTCALL):  _HostCall(static_cast<uint8_t>(immediates[pc])); break;
+                case static_cast<uint8_t>(Opcode::THREAD):    _Handle_THREAD(); break;
+                
+                case static_cast<uint8_t>(Opcode::HALT):
+                    _Handle_HALT();
+                    _ip = nextOffsets[pc];
+                    return 0;
+                
+                // 슈퍼명령어: 폴스루 시 묶인 명령어 수만큼 건너뜀
+                case static_cast<uint8_t>(FusedOpcode::LOADVAR):
+                    _memoryManager->PushStack(_Load64(immediates[pc]));
+                    pc += GetFusedLength(FusedOpcode::LOADVAR);
+                    continue;
+                case static_cast<uint8_t>(FusedOpcode::STOREVAR):
+                    _Store64(immediates[pc], _memoryManager->PopStack());
+                    pc += GetFusedLength(FusedOpcode::STOREVAR);
+                    continue;
+                case static_cast<uint8_t>(FusedOpcode::ADDI):
+                    _memoryManager->PushStack(_memoryManager->PopStack() + immediates[pc]);
+                    pc += GetFusedLength(FusedOpcode::ADDI);
+                    continue;
+                case static_cast<uint8_t>(FusedOpcode::SUBI):
+                    _memoryManager->PushStack(_memoryManager->PopStack() - immediates[pc]);
+                    pc += GetFusedLength(FusedOpcode::SUBI);
+                    continue;
+                case static_cast<uint8_t>(FusedOpcode::PUSH_JZ):
+                    if (immediates[pc] == 0) 
+                    {
+                        pc = targets[pc];
+                        continue;
+                    }
+                    pc += GetFusedLength(FusedOpcode::PUSH_JZ);
+                    continue;
+                case static_cast<uint8_t>(FusedOpcode::DUP_JNZ):
+                    if (_memoryManager->PeekStack() != 0) 
+                    {
+                        pc = targets[pc];
+                        continue;
+                    }
+                    pc += GetFusedLength(FusedOpcode::DUP_JNZ);
+                    continue;
+                
+                // InstructionStream::kExitOpcode
+                default:
+                    _ip = static_cast<size_t>(immediates[pc]);
+                    return _ExecuteBytecode();
+            }
+            
+            ++pc;
+        }
+    }
+    catch (const Memory::MemoryAccessException& e) 
+    {
+        _ip = nextOffsets[pc];
+        std::cerr << "메모리 접근 오류: " << e.what() << std::endl;
+        _running = false;
+
+        return -1;
+    }
+    catch (const std::exception& e) 
+    {
+        _ip = nextOffsets[pc];
+        std::cerr << "VM 실행 오류: " << e.what() << std::endl;
+        _running = false;
+
+        return -1;
+    }
+}
+
+int Interpreter::_ExecuteBytecode()
+{
+    // 바이트코드 실행 루프 (예외 처리는 루프 바깥에서 한 번만)
+    try 
+    {
+        while (_running) 
+        {
+            uint8_t opcode = _FetchByte();
+            (this->*_dispatchTable[opcode])();
         }
     }
+    catch (const Memory::MemoryAccessException& e) 
+    {
+        std::cerr << "메모리 접근 오류: " << e.what() << std::endl;
+        _running = false;
+
+        return -1;
+    }
+    catch (const std::exception& e) 
+    {
+        std::cerr << "VM 실행 오류: " << e.what() << std::endl;
+        _running = false;
+
+        return -1;
+    }
     
     return 0; // 성공적으로 실행 완료
 }
@@ -92,19 +436,10 @@ bool Interpreter::Step()
         // 명령어 가져오기 (fetch)
         uint8_t opcode = _FetchByte();
         
-        // 핸들러 찾기 (decode)
-        auto it = _opcodeHandlers.find(opcode);
-        if (it == _opcodeHandlers.end()) 
-        {
-            std::stringstream ss;
-            ss << "알 수 없는 명령어: 0x" << std::hex << static_cast<int>(opcode);
-            throw std::runtime_error(ss.str());
-        }
-        
-        // 명령어 실행 (execute)
-        it->second(this);
+        // 디스패치 테이블로 바로 실행 (decode + execute)
+        (this->*_dispatchTable[opcode])();
         
-        return true;
+        return _running;
     }
     catch (const Memory::MemoryAccessException& e) 
     {
@@ -134,15 +469,13 @@ void Interpreter::DumpState() const
 
 void Interpreter::PushParameter(uint64_t value)
 {
-    //Todo
-    _memoryManager->PopStack();
-    //_memoryManager->PopStack(value);
+    _memoryManager->PushStack(value);
 }
 
 uint8_t Interpreter::_FetchByte()
 {
     // 현재 IP 위치에서 바이트 읽기
-    auto& codeSegment = _memoryManager->GetSegment(Memory::MemorySegmentType::CODE);
+    auto& codeSegment = *_codeSegment;
     uint8_t byte = codeSegment.ReadByte(_ip);
     
     // IP 증가
@@ -154,7 +487,7 @@ uint8_t Interpreter::_FetchByte()
 int16_t Interpreter::_FetchInt16()
 {
     // 현재 IP 위치에서 2바이트 읽기
-    auto& codeSegment = _memoryManager->GetSegment(Memory::MemorySegmentType::CODE);
+    auto& codeSegment = *_codeSegment;
     int16_t value = static_cast<int16_t>(codeSegment.ReadUInt16(_ip));
     
     // IP 증가
@@ -166,7 +499,7 @@ int16_t Interpreter::_FetchInt16()
 int32_t Interpreter::_FetchInt32()
 {
     // 현재 IP 위치에서 4바이트 읽기
-    auto& codeSegment = _memoryManager->GetSegment(Memory::MemorySegmentType::CODE);
+    auto& codeSegment = *_codeSegment;
     int32_t value = static_cast<int32_t>(codeSegment.ReadUInt32(_ip));
     
     // IP 증가
@@ -178,7 +511,7 @@ int32_t Interpreter::_FetchInt32()
 int64_t Interpreter::_FetchInt64()
 {
     // 현재 IP 위치에서 8바이트 읽기
-    auto& codeSegment = _memoryManager->GetSegment(Memory::MemorySegmentType::CODE);
+    auto& codeSegment = *_codeSegment;
     int64_t value = static_cast<int64_t>(codeSegment.ReadUInt64(_ip));
     
     // IP 증가
@@ -187,67 +520,80 @@ int64_t Interpreter::_FetchInt64()
     return value;
 }
 
-std::unordered_map<uint8_t, Interpreter::OpcodeHandler> Interpreter::_InitializeOpcodeHandlers()
+std::array<Interpreter::OpcodeHandler, 256> Interpreter::_BuildDispatchTable()
 {
-    std::unordered_map<uint8_t, OpcodeHandler> handlers;
+    std::array<OpcodeHandler, 256> handlers;
+    
+    // 정의되지 않은 opcode는 모두 트랩 핸들러로
+    handlers.fill(&Interpreter::_Handle_INVALID);
     
     // 스택 연산
-    handlers[static_cast<uint8_t>(Opcode::PUSH8)] = [](Interpreter* interpreter) { interpreter->_Handle_PUSH8(); };
-    handlers[static_cast<uint8_t>(Opcode::PUSH16)] = [](Interpreter* interpreter) { interpreter->_Handle_PUSH16(); };
-    handlers[static_cast<uint8_t>(Opcode::PUSH32)] = [](Interpreter* interpreter) { interpreter->_Handle_PUSH32(); };
-    handlers[static_cast<uint8_t>(Opcode::PUSH64)] = [](Interpreter* interpreter) { interpreter->_Handle_PUSH64(); };
-    handlers[static_cast<uint8_t>(Opcode::POP)] = [](Interpreter* interpreter) { interpreter->_Handle_POP(); };
-    handlers[static_cast<uint8_t>(Opcode::DUP)] = [](Interpreter* interpreter) { interpreter->_Handle_DUP(); };
-    handlers[static_cast<uint8_t>(Opcode::SWAP)] = [](Interpreter* interpreter) { interpreter->_Handle_SWAP(); };
+    handlers[static_cast<uint8_t>(Opcode::PUSH8)] = &Interpreter::_Handle_PUSH8;
+    handlers[static_cast<uint8_t>(Opcode::PUSH16)] = &Interpreter::_Handle_PUSH16;
+    handlers[static_cast<uint8_t>(Opcode::PUSH32)] = &Interpreter::_Handle_PUSH32;
+    handlers[static_cast<uint8_t>(Opcode::PUSH64)] = &Interpreter::_Handle_PUSH64;
+    handlers[static_cast<uint8_t>(Opcode::POP)] = &Interpreter::_Handle_POP;
+    handlers[static_cast<uint8_t>(Opcode::DUP)] = &Interpreter::_Handle_DUP;
+    handlers[static_cast<uint8_t>(Opcode::SWAP)] = &Interpreter::_Handle_SWAP;
     
     // 산술 연산
-    handlers[static_cast<uint8_t>(Opcode::ADD)] = [](Interpreter* interpreter) { interpreter->_Handle_ADD(); };
-    handlers[static_cast<uint8_t>(Opcode::SUB)] = [](Interpreter* interpreter) { interpreter->_Handle_SUB(); };
-    handlers[static_cast<uint8_t>(Opcode::MUL)] = [](Interpreter* interpreter) { interpreter->_Handle_MUL(); };
-    handlers[static_cast<uint8_t>(Opcode::DIV)] = [](Interpreter* interpreter) { interpreter->_Handle_DIV(); };
-    handlers[static_cast<uint8_t>(Opcode::MOD)] = [](Interpreter* interpreter) { interpreter->_Handle_MOD(); };
+    handlers[static_cast<uint8_t>(Opcode::ADD)] = &Interpreter::_Handle_ADD;
+    handlers[static_cast<uint8_t>(Opcode::SUB)] = &Interpreter::_Handle_SUB;
+    handlers[static_cast<uint8_t>(Opcode::MUL)] = &Interpreter::_Handle_MUL;
+    handlers[static_cast<uint8_t>(Opcode::DIV)] = &Interpreter::_Handle_DIV;
+    handlers[static_cast<uint8_t>(Opcode::MOD)] = &Interpreter::_Handle_MOD;
     
     // 비트 연산
-    handlers[static_cast<uint8_t>(Opcode::AND)] = [](Interpreter* interpreter) { interpreter->_Handle_AND(); };
-    handlers[static_cast<uint8_t>(Opcode::OR)] = [](Interpreter* interpreter) { interpreter->_Handle_OR(); };
-    handlers[static_cast<uint8_t>(Opcode::XOR)] = [](Interpreter* interpreter) { interpreter->_Handle_XOR(); };
-    handlers[static_cast<uint8_t>(Opcode::NOT)] = [](Interpreter* interpreter) { interpreter->_Handle_NOT(); };
-    handlers[static_cast<uint8_t>(Opcode::SHL)] = [](Interpreter* interpreter) { interpreter->_Handle_SHL(); };
-    handlers[static_cast<uint8_t>(Opcode::SHR)] = [](Interpreter* interpreter) { interpreter->_Handle_SHR(); };
+    handlers[static_cast<uint8_t>(Opcode::AND)] = &Interpreter::_Handle_AND;
+    handlers[static_cast<uint8_t>(Opcode::OR)] = &Interpreter::_Handle_OR;
+    handlers[static_cast<uint8_t>(Opcode::XOR)] = &Interpreter::_Handle_XOR;
+    handlers[static_cast<uint8_t>(Opcode::NOT)] = &Interpreter::_Handle_NOT;
+    handlers[static_cast<uint8_t>(Opcode::SHL)] = &Interpreter::_Handle_SHL;
+    handlers[static_cast<uint8_t>(Opcode::SHR)] = &Interpreter::_Handle_SHR;
     
     // 메모리 연산
-    handlers[static_cast<uint8_t>(Opcode::LOAD8)] = [](Interpreter* interpreter) { interpreter->_Handle_LOAD8(); };
-    handlers[static_cast<uint8_t>(Opcode::LOAD16)] = [](Interpreter* interpreter) { interpreter->_Handle_LOAD16(); };
-    handlers[static_cast<uint8_t>(Opcode::LOAD32)] = [](Interpreter* interpreter) { interpreter->_Handle_LOAD32(); };
-    handlers[static_cast<uint8_t>(Opcode::LOAD64)] = [](Interpreter* interpreter) { interpreter->_Handle_LOAD64(); };
-    handlers[static_cast<uint8_t>(Opcode::STORE8)] = [](Interpreter* interpreter) { interpreter->_Handle_STORE8(); };
-    handlers[static_cast<uint8_t>(Opcode::STORE16)] = [](Interpreter* interpreter) { interpreter->_Handle_STORE16(); };
-    handlers[static_cast<uint8_t>(Opcode::STORE32)] = [](Interpreter* interpreter) { interpreter->_Handle_STORE32(); };
-    handlers[static_cast<uint8_t>(Opcode::STORE64)] = [](Interpreter* interpreter) { interpreter->_Handle_STORE64(); };
+    handlers[static_cast<uint8_t>(Opcode::LOAD8)] = &Interpreter::_Handle_LOAD8;
+    handlers[static_cast<uint8_t>(Opcode::LOAD16)] = &Interpreter::_Handle_LOAD16;
+    handlers[static_cast<uint8_t>(Opcode::LOAD32)] = &Interpreter::_Handle_LOAD32;
+    handlers[static_cast<uint8_t>(Opcode::LOAD64)] = &Interpreter::_Handle_LOAD64;
+    handlers[static_cast<uint8_t>(Opcode::STORE8)] = &Interpreter::_Handle_STORE8;
+    handlers[static_cast<uint8_t>(Opcode::STORE16)] = &Interpreter::_Handle_STORE16;
+    handlers[static_cast<uint8_t>(Opcode::STORE32)] = &Interpreter::_Handle_STORE32;
+    handlers[static_cast<uint8_t>(Opcode::STORE64)] = &Interpreter::_Handle_STORE64;
+    handlers[static_cast<uint8_t>(Opcode::MEMCPY)] = &Interpreter::_Handle_MEMCPY;
+    handlers[static_cast<uint8_t>(Opcode::MEMSET)] = &Interpreter::_Handle_MEMSET;
+    handlers[static_cast<uint8_t>(Opcode::MEMCMP)] = &Interpreter::_Handle_MEMCMP;
     
     // 제어 흐름
-    handlers[static_cast<uint8_t>(Opcode::JMP)] = [](Interpreter* interpreter) { interpreter->_Handle_JMP(); };
-    handlers[static_cast<uint8_t>(Opcode::JZ)] = [](Interpreter* interpreter) { interpreter->_Handle_JZ(); };
-    handlers[static_cast<uint8_t>(Opcode::JNZ)] = [](Interpreter* interpreter) { interpreter->_Handle_JNZ(); };
-    handlers[static_cast<uint8_t>(Opcode::JG)] = [](Interpreter* interpreter) { interpreter->_Handle_JG(); };
-    handlers[static_cast<uint8_t>(Opcode::JL)] = [](Interpreter* interpreter) { interpreter->_Handle_JL(); };
-    handlers[static_cast<uint8_t>(Opcode::JGE)] = [](Interpreter* interpreter) { interpreter->_Handle_JGE(); };
-    handlers[static_cast<uint8_t>(Opcode::JLE)] = [](Interpreter* interpreter) { interpreter->_Handle_JLE(); };
+    handlers[static_cast<uint8_t>(Opcode::JMP)] = &Interpreter::_Handle_JMP;
+    handlers[static_cast<uint8_t>(Opcode::JZ)] = &Interpreter::_Handle_JZ;
+    handlers[static_cast<uint8_t>(Opcode::JNZ)] = &Interpreter::_Handle_JNZ;
+    handlers[static_cast<uint8_t>(Opcode::JG)] = &Interpreter::_Handle_JG;
+    handlers[static_cast<uint8_t>(Opcode::JL)] = &Interpreter::_Handle_JL;
+    handlers[static_cast<uint8_t>(Opcode::JGE)] = &Interpreter::_Handle_JGE;
+    handlers[static_cast<uint8_t>(Opcode::JLE)] = &Interpreter::_Handle_JLE;
     
     // 함수 호출
-    handlers[static_cast<uint8_t>(Opcode::CALL)] = [](Interpreter* interpreter) { interpreter->_Handle_CALL(); };
-    handlers[static_cast<uint8_t>(Opcode::RET)] = [](Interpreter* interpreter) { interpreter->_Handle_RET(); };
+    handlers[static_cast<uint8_t>(Opcode::CALL)] = &Interpreter::_Handle_CALL;
+    handlers[static_cast<uint8_t>(Opcode::RET)] = &Interpreter::_Handle_RET;
+    handlers[static_cast<uint8_t>(Opcode::TAILCALL)] = &Interpreter::_Handle_TAILCALL;
+    handlers[static_cast<uint8_t>(Opcode::LDLOC)] = &Interpreter::_Handle_LDLOC;
+    handlers[static_cast<uint8_t>(Opcode::STLOC)] = &Interpreter::_Handle_STLOC;
+    handlers[static_cast<uint8_t>(Opcode::LDARG)] = &Interpreter::_Handle_LDARG;
     
     // 힙 관리
-    handlers[static_cast<uint8_t>(Opcode::ALLOC)] = [](Interpreter* interpreter) { interpreter->_Handle_ALLOC(); };
-    handlers[static_cast<uint8_t>(Opcode::FREE)] = [](Interpreter* interpreter) { interpreter->_Handle_FREE(); };
+    handlers[static_cast<uint8_t>(Opcode::ALLOC)] = &Interpreter::_Handle_ALLOC;
+    handlers[static_cast<uint8_t>(Opcode::FREE)] = &Interpreter::_Handle_FREE;
+    handlers[static_cast<uint8_t>(Opcode::ARENA_BEGIN)] = &Interpreter::_Handle_ARENA_BEGIN;
+    handlers[static_cast<uint8_t>(Opcode::ARENA_ALLOC)] = &Interpreter::_Handle_ARENA_ALLOC;
+    handlers[static_cast<uint8_t>(Opcode::ARENA_RESET)] = &Interpreter::_Handle_ARENA_RESET;
     
     // 호스트 인터페이스
-    handlers[static_cast<uint8_t>(Opcode::HOSTCALL)] = [](Interpreter* interpreter) { interpreter->_Handle_HOSTCALL(); };
-    handlers[static_cast<uint8_t>(Opcode::THREAD)] = [](Interpreter* interpreter) { interpreter->_Handle_THREAD(); };
+    handlers[static_cast<uint8_t>(Opcode::HOSTCALL)] = &Interpreter::_Handle_HOSTCALL;
+    handlers[static_cast<uint8_t>(Opcode::THREAD)] = &Interpreter::_Handle_THREAD;
     
     // 시스템
-    handlers[static_cast<uint8_t>(Opcode::HALT)] = [](Interpreter* interpreter) { interpreter->_Handle_HALT(); };
+    handlers[static_cast<uint8_t>(Opcode::HALT)] = &Interpreter::_Handle_HALT;
     
     return handlers;
 }
@@ -430,7 +776,7 @@ void Interpreter::_Handle_LOAD8()
     uint64_t address = _memoryManager->PopStack();
     
     // 힙 메모리에서 바이트 읽기
-    auto& heapSegment = _memoryManager->GetSegment(Memory::MemorySegmentType::HEAP);
+    auto& heapSegment = *_heapSegment;
     uint8_t value = heapSegment.ReadByte(static_cast<size_t>(address));
     
     // 결과를 스택에 푸시
@@ -446,7 +792,7 @@ void Interpreter::_Handle_STORE8()
     uint64_t address = _memoryManager->PopStack();
     
     // 힙 메모리에 바이트 쓰기
-    auto& heapSegment = _memoryManager->GetSegment(Memory::MemorySegmentType::HEAP);
+    auto& heapSegment = *_heapSegment;
     heapSegment.WriteByte(static_cast<size_t>(address), static_cast<uint8_t>(value));
 }
 
@@ -498,7 +844,7 @@ void Interpreter::_Handle_JNZ()
 void Interpreter::_Handle_HALT()
 {
     // 마지막 스택 값을 반환 값으로 설정 (있는 경우)
-    if (_memoryManager->GetStackPointer() < _memoryManager->GetSegment(Memory::MemorySegmentType::STACK).GetSize()) 
+    if (_memoryManager->GetStackPointer() < _stackSegment->GetSize()) 
     {
         _returnValue = _memoryManager->PopStack();
     }
@@ -513,7 +859,7 @@ void Interpreter::_Handle_LOAD16()
     uint64_t address = _memoryManager->PopStack();
     
     // 힙 메모리에서 2바이트 읽기
-    auto& heapSegment = _memoryManager->GetSegment(Memory::MemorySegmentType::HEAP);
+    auto& heapSegment = *_heapSegment;
     uint16_t value = heapSegment.ReadUInt16(static_cast<size_t>(address));
     
     // 결과를 스택에 푸시
@@ -526,7 +872,7 @@ void Interpreter::_Handle_LOAD32()
     uint64_t address = _memoryManager->PopStack();
     
     // 힙 메모리에서 4바이트 읽기
-    auto& heapSegment = _memoryManager->GetSegment(Memory::MemorySegmentType::HEAP);
+    auto& heapSegment = *_heapSegment;
     uint32_t value = heapSegment.ReadUInt32(static_cast<size_t>(address));
     
     // 결과를 스택에 푸시
@@ -538,15 +884,18 @@ void Interpreter::_Handle_LOAD64()
     // 주소를 스택에서 가져옴
     uint64_t address = _memoryManager->PopStack();
     
-    Logger::Info("Interpreter", "LOAD64: 주소 0x" + std::to_string(address) + "에서 8바이트 읽기 시도");
-    
+    // 결과를 스택에 푸시
+    _memoryManager->PushStack(_Load64(address));
+}
+
+uint64_t Interpreter::_Load64(uint64_t address)
+{
     // 주소에 맞는 세그먼트에서 8바이트 읽기
     uint64_t value = _memoryManager->ReadUInt64(static_cast<size_t>(address));
     
-    Logger::Info("Interpreter", "LOAD64: 읽은 값 = " + std::to_string(value));
+    DMVM_TRACE_DEBUG("Interpreter", "LOAD64: 주소 0x" + std::to_string(address) + ", 값 = " + std::to_string(value));
     
-    // 결과를 스택에 푸시
-    _memoryManager->PushStack(value);
+    return value;
 }
 
 void Interpreter::_Handle_STORE16()
@@ -558,7 +907,7 @@ void Interpreter::_Handle_STORE16()
     uint64_t address = _memoryManager->PopStack();
     
     // 힙 메모리에 2바이트 쓰기
-    auto& heapSegment = _memoryManager->GetSegment(Memory::MemorySegmentType::HEAP);
+    auto& heapSegment = *_heapSegment;
     heapSegment.WriteUInt16(static_cast<size_t>(address), static_cast<uint16_t>(value));
 }
 
@@ -571,7 +920,7 @@ void Interpreter::_Handle_STORE32()
     uint64_t address = _memoryManager->PopStack();
     
     // 힙 메모리에 4바이트 쓰기
-    auto& heapSegment = _memoryManager->GetSegment(Memory::MemorySegmentType::HEAP);
+    auto& heapSegment = *_heapSegment;
     heapSegment.WriteUInt32(static_cast<size_t>(address), static_cast<uint32_t>(value));
 }
 
@@ -583,12 +932,45 @@ void Interpreter::_Handle_STORE64()
     // 주소를 스택에서 가져옴
     uint64_t address = _memoryManager->PopStack();
     
-    Logger::Info("Interpreter", "STORE64: 주소 0x" + std::to_string(address) + "에 값 " + std::to_string(value) + " 쓰기 시도");
+    _Store64(address, value);
+}
+
+void Interpreter::_Store64(uint64_t address, uint64_t value)
+{
+    DMVM_TRACE_DEBUG("Interpreter", "STORE64: 주소 0x" + std::to_string(address) + ", 값 = " + std::to_string(value));
     
     // 주소에 맞는 세그먼트에 8바이트 쓰기
     _memoryManager->WriteUInt64(static_cast<size_t>(address), value);
+}
+
+void Interpreter::_Handle_MEMCPY()
+{
+    // 길이, 원본, 대상 순으로 꺼냄 (푸시 순서는 dst, src, len)
+    uint64_t size = _memoryManager->PopStack();
+    uint64_t source = _memoryManager->PopStack();
+    uint64_t destination = _memoryManager->PopStack();
+    
+    _memoryManager->CopyMemory(static_cast<size_t>(destination), static_cast<size_t>(source), static_cast<size_t>(size));
+}
+
+void Interpreter::_Handle_MEMSET()
+{
+    uint64_t size = _memoryManager->PopStack();
+    uint64_t value = _memoryManager->PopStack();
+    uint64_t destination = _memoryManager->PopStack();
+    
+    _memoryManager->FillMemory(static_cast<size_t>(destination), static_cast<uint8_t>(value), static_cast<size_t>(size));
+}
+
+void Interpreter::_Handle_MEMCMP()
+{
+    uint64_t size = _memoryManager->PopStack();
+    uint64_t second = _memoryManager->PopStack();
+    uint64_t first = _memoryManager->PopStack();
     
-    Logger::Info("Interpreter", "STORE64: 쓰기 완료");
+    // -1은 2의 보수로 푸시
+    int result = _memoryManager->CompareMemory(static_cast<size_t>(first), static_cast<size_t>(second), static_cast<size_t>(size));
+    _memoryManager->PushStack(static_cast<uint64_t>(static_cast<int64_t>(result)));
 }
 
 void Interpreter::_Handle_JG()
@@ -668,20 +1050,46 @@ void Interpreter::_Handle_CALL()
     // 호출할 함수 주소를 스택에서 가져오기 (동적 함수 호출 지원)
     uint64_t targetAddress = _memoryManager->PopStack();
     
-    // 현재 명령어 포인터를 스택에 저장 (반환 주소)
-    _memoryManager->PushStack(_ip);
-    
-    // 함수 주소로 점프
-    _ip = static_cast<size_t>(targetAddress);
+    // 현재 명령어 포인터(반환 주소)를 호출 스택에 넣고 함수 주소로 점프
+    _controlFlow.Call(_ip, static_cast<size_t>(targetAddress));
 }
 
 void Interpreter::_Handle_RET()
 {
-    // 반환 주소를 스택에서 가져옴
-    uint64_t returnAddress = _memoryManager->PopStack();
+    // 호출자가 푸시한 인자 수
+    uint8_t argumentCount = _FetchByte();
+    
+    // 프레임을 정리하고 반환 주소로 점프
+    _controlFlow.Ret(_ip, argumentCount);
+}
+
+void Interpreter::_Handle_TAILCALL()
+{
+    // 새 인자 수, 현재 함수가 받은 인자 수
+    uint8_t argumentCount = _FetchByte();
+    uint8_t parameterCount = _FetchByte();
+    uint64_t targetAddress = _memoryManager->PopStack();
     
-    // 반환 주소로 점프
-    _ip = static_cast<size_t>(returnAddress);
+    // 현재 프레임을 새 인자로 덮어쓰고 함수 주소로 점프 (호출 스택 깊이 유지)
+    _controlFlow.TailCall(_ip, static_cast<size_t>(targetAddress), argumentCount, parameterCount);
+}
+
+void Interpreter::_Handle_LDLOC()
+{
+    uint8_t index = _FetchByte();
+    _memoryManager->PushStackSlot(_LocalAddress(index));
+}
+
+void Interpreter::_Handle_STLOC()
+{
+    uint8_t index = _FetchByte();
+    _memoryManager->PopStackSlot(_LocalAddress(index));
+}
+
+void Interpreter::_Handle_LDARG()
+{
+    uint8_t index = _FetchByte();
+    _memoryManager->PushStackSlot(_ArgumentAddress(index));
 }
 
 void Interpreter::_Handle_ALLOC()
@@ -705,11 +1113,31 @@ void Interpreter::_Handle_FREE()
     _memoryManager->Free(static_cast<size_t>(address));
 }
 
+void Interpreter::_Handle_ARENA_BEGIN()
+{
+    _memoryManager->GetArenaMemory().Begin();
+}
+
+void Interpreter::_Handle_ARENA_ALLOC()
+{
+    // 할당할 크기를 스택에서 가져와 가장 안쪽 아레나에서 할당 (주소 형식은 ALLOC과 같음)
+    uint64_t size = _memoryManager->PopStack();
+    _memoryManager->PushStack(_memoryManager->GetArenaMemory().Allocate(static_cast<size_t>(size)));
+}
+
+void Interpreter::_Handle_ARENA_RESET()
+{
+    _memoryManager->GetArenaMemory().Reset();
+}
+
 void Interpreter::_Handle_HOSTCALL()
 {
     // 호스트 함수 ID를 1바이트로 가져옴
-    uint8_t functionId = _FetchByte();
-    
+    _HostCall(_FetchByte());
+}
+
+void Interpreter::_HostCall(uint8_t functionId)
+{
     // 현재는 구현이 간단하므로 기본적인 호스트 함수만 지원
     // 실제 구현에서는 호스트 함수 테이블을 사용하여 확장 가능
     switch (functionId) 
@@ -731,6 +1159,18 @@ void Interpreter::_Handle_HOSTCALL()
     }
 }
 
+void Interpreter::_Handle_INVALID()
+{
+    // _ip는 이미 opcode 다음을 가리키고 있음
+    size_t opcodeAddress = _ip - 1;
+    uint8_t opcode = _codeSegment->ReadByte(opcodeAddress);
+    
+    std::stringstream ss;
+    ss << "알 수 없는 명령어: 0x" << std::hex << static_cast<int>(opcode) 
+       << " (위치 0x" << opcodeAddress << ")";
+    throw std::runtime_error(ss.str());
+}
+
 void Interpreter::_Handle_THREAD()
 {
     // 현재는 단일 스레드 실행만 지원
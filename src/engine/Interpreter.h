@@ -3,15 +3,69 @@
 #include <cstdint>
 #include <vector>
 #include <memory>
-#include <unordered_map>
-#include <functional>
+#include <array>
+#include <span>
 #include <controlflow/ControlFlowManager.h>
+#include <memory/ArenaMemory.h>
+#include <memory/HeapMemory.h>
 #include <memory/MemoryManager.h>
+#include <memory/MemorySnapshot.h>
+#include <memory/StackGuard.h>
+#include <memory/StackMemory.h>
 #include <Opcodes.h>
+#include "decoder/InstructionStream.h"
+#include "jit/JitCompiler.h"
+#include "simd/LaneExecutor.h"
+#include "verifier/BytecodeVerifier.h"
+
+/**
+ * @brief Direct-threaded(computed goto) 디스패치 지원 여부
+ * 
+ * GCC/Clang의 labels-as-values 확장이 있을 때만 1
+ * 빌드 옵션으로 0을 지정하면 GCC/Clang에서도 비활성화 가능
+ */
+#ifndef DMVM_THREADED_DISPATCH
+#if defined(__GNUC__) || defined(__clang__)
+#define DMVM_THREADED_DISPATCH 1
+#else
+#define DMVM_THREADED_DISPATCH 0
+#endif
+#endif
 
 namespace DarkMatterVM {
+namespace Tests {
+class EngineBenchmark;
+} // namespace Tests
+
 namespace Engine {
 
+class InterpreterPool;
+
+/**
+ * @brief 인터프리터 실행 모드
+ */
+enum class ExecutionMode : uint8_t
+{
+    Portable,   ///< 사전 디코딩된 명령어 스트림 + switch 루프 (모든 컴파일러)
+    Threaded,   ///< 명령어 스트림 + computed goto (GCC/Clang 전용, 미지원 시 Portable로 대체)
+    StackCached,///< 명령어 스트림 + switch 루프, 스택 최상위 두 슬롯을 지역 변수에 캐싱
+    Jit,        ///< 기본 블록을 x86-64 기계어로 컴파일하여 실행 (Linux x86-64 전용, 미지원 시 Portable로 대체)
+    Tiered      ///< 바이트 단위 인터프리터로 시작해 뜨거운 루프/함수만 Jit으로 컴파일 (미지원 시 Portable로 대체)
+};
+
+/**
+ * @brief Tiered 모드 티어 전환 통계
+ */
+struct TieringStats
+{
+    uint32_t backEdgeThreshold = 0;     ///< 루프 헤더 컴파일 기준 (뒤로 가는 분기 횟수)
+    uint32_t callThreshold = 0;         ///< 함수 컴파일 기준 (CALL 횟수)
+    uint64_t tierUpCount = 0;           ///< 기계어로 컴파일된 영역 수
+    uint64_t jitEntryCount = 0;         ///< 기계어 진입 횟수
+    uint64_t interpreterNanoseconds = 0;///< 인터프리터(티어 0)에서 보낸 시간
+    uint64_t jitNanoseconds = 0;        ///< 기계어(티어 1)에서 보낸 시간
+};
+
 /**
  * @brief VM Interpreter 클래스
  * 
@@ -51,17 +105,110 @@ public:
      */
     void Reset();
     
+    /**
+     * @brief 재사용을 위한 초기화
+     * 
+     * Reset()에 더해 스택/힙에서 지난 실행들이 쓴 구간만 0으로 되돌리고 힙 할당 정보를 비움
+     * 로드된 코드와 디코딩 결과는 유지하므로 새 인스턴스를 만드는 것과 같은 상태를 쓴 양에 비례한 비용으로 얻음
+     * (Jit/Tiered 모드로 실행한 뒤에는 기계어가 직접 쓴 범위를 알 수 없어 세그먼트 전체를 지움)
+     * 
+     * @return size_t 지운 바이트 수
+     */
+    size_t Recycle();
+    
     /**
      * @brief 바이트코드 실행
      * 
+     * Step()을 거치지 않고 실행 모드에 맞는 루프로 실행
+     * 예외 처리는 루프 전체에 한 번만 설정
+     * 
      * @param startAddress 시작 주소 (기본 0)
-     * @return int 실행 결과 코드
+     * @return int 실행 결과 코드 (0: 정상 종료, -1: 실행 오류)
      */
     int Execute(size_t startAddress = 0);
     
+    /**
+     * @brief 실행 모드 설정
+     * 
+     * 빌드가 Threaded 모드를 지원하지 않으면 Execute()는 Portable 루프로 실행
+     * 
+     * @param mode 실행 모드
+     */
+    void SetExecutionMode(ExecutionMode mode) { _executionMode = mode; }
+    
+    /**
+     * @brief 설정된 실행 모드 조회
+     * 
+     * @return ExecutionMode 실행 모드
+     */
+    ExecutionMode GetExecutionMode() const { return _executionMode; }
+    
+    /**
+     * @brief 명령어 스트림 슈퍼명령어 합치기 설정 (기본 활성화)
+     * 
+     * 이미 로드된 코드가 있으면 스트림을 다시 디코딩
+     * 
+     * @param enabled 활성화 여부
+     */
+    void SetSuperinstructionsEnabled(bool enabled);
+    
+    /**
+     * @brief 슈퍼명령어 합치기 활성화 여부
+     */
+    bool IsSuperinstructionsEnabled() const { return _superinstructionsEnabled; }
+    
+    /**
+     * @brief 현재 빌드에서 Threaded 모드 사용 가능 여부
+     * 
+     * @return bool DMVM_THREADED_DISPATCH 활성화 여부
+     */
+    static constexpr bool IsThreadedDispatchSupported() { return DMVM_THREADED_DISPATCH != 0; }
+    
+    /**
+     * @brief 현재 빌드에서 Jit 모드 사용 가능 여부
+     * 
+     * @return bool DMVM_JIT 활성화 여부
+     */
+    static constexpr bool IsJitSupported() { return JitCompiler::IsSupported(); }
+    
+    /**
+     * @brief Jit 모드 컴파일 결과 (컴파일된 블록 수, 기계어 크기 조회용)
+     * 
+     * Jit 모드로 처음 Execute()할 때 컴파일되며 그 전에는 비어 있음
+     */
+    const JitCompiler& GetJitCompiler() const { return _jit; }
+    
+    /**
+     * @brief Tiered 모드 컴파일 기준 설정
+     * 
+     * 뒤로 가는 JMP/Jcc의 목적지(루프 헤더)나 CALL 목적지가 기준 횟수에 도달하면
+     * 그 지점부터 닿는 블록들을 컴파일하고, 실행 중인 프레임은 다음 진입 시 기계어로 전환됨
+     * 
+     * @param backEdgeThreshold 루프 헤더 기준 (0이면 루프로는 컴파일하지 않음)
+     * @param callThreshold 함수 기준 (0이면 호출로는 컴파일하지 않음)
+     */
+    void SetTierUpThresholds(uint32_t backEdgeThreshold, uint32_t callThreshold);
+    
+    /**
+     * @brief Tiered 모드 통계 (LoadBytecode 이후 누적)
+     */
+    const TieringStats& GetTieringStats() const { return _tieringStats; }
+    
+    /**
+     * @brief Tiered 모드 시간/횟수 통계 초기화 (컴파일된 코드와 카운터는 유지)
+     */
+    void ResetTieringStats();
+    
+    /**
+     * @brief Tiered 모드에서 지금까지 컴파일된 영역
+     */
+    const JitCompiler& GetTieredCompiler() const { return _tieredJit; }
+    
     /**
      * @brief 단일 명령어 실행 (디버깅 용)
      * 
+     * Execute()와 같은 디스패치 테이블을 사용하지만 명령어마다 예외를 처리하므로 느림
+     * 
      * @return bool 계속 실행 가능한지 여부
      */
     bool Step();
@@ -74,10 +221,163 @@ public:
     /**
      * @brief 파라미터 푸시
      * 
+     * Reset() 또는 LoadBytecode() 뒤, Execute() 전에 호출 (나중에 푸시한 값이 스택 최상위)
+     * 
      * @param value 푸시할 64비트 값
      */
     void PushParameter(uint64_t value);
     
+    /**
+     * @brief 로드된 코드를 인자 묶음마다 한 번씩 실행
+     * 
+     * 코드는 이미 로드/디코딩된 것을 그대로 쓰고, 실행 사이에는 Reset()으로 IP와 스택만 초기화
+     * (힙은 초기화하지 않으므로 실행 간에 누적됨)
+     * 실행마다 args에서 argc개를 앞에서부터 PushParameter()한 뒤 Execute()
+     * 코드가 레인 실행 대상이면(IsLaneParallelEligible) 입력 LaneExecutor::kLaneCount개씩 SIMD 레인으로 실행
+     * 
+     * threadCount가 2 이상이면 실행 범위를 나누어 작업 스레드마다 같은 크기의 인스턴스를 만들고
+     * 코드 세그먼트와 디코딩 결과를 공유하고 실행 설정을 복사해 병렬 실행 (현재 인스턴스도 첫 구간을 실행)
+     * 
+     * @param args 인자 배열 (크기 = argc × 실행 횟수)
+     * @param argc 실행 한 번의 인자 수
+     * @param results 실행별 반환 값 (크기 = 실행 횟수, 실패한 실행은 0)
+     * @param threadCount 실행 스레드 수 (0 또는 1이면 현재 스레드에서 순차 실행)
+     * @return int 실행 결과 코드 (0: 모두 정상, -1: 실패한 실행이 있거나 배열 크기가 맞지 않음)
+     */
+    int ExecuteBatch(std::span<const uint64_t> args, size_t argc, std::span<uint64_t> results, size_t threadCount = 1);
+    
+    /**
+     * @brief 로드된 코드가 SIMD 레인 실행 대상인지 여부 (LoadBytecode 시점에 검사)
+     * 
+     * 스택/산술/논리/비교 분기/HALT만으로 이루어진 코드면 ExecuteBatch()가
+     * 입력 LaneExecutor::kLaneCount개를 한 번에 실행
+     */
+    bool IsLaneParallelEligible() const { return _lanes.IsEligible(); }
+    
+    /**
+     * @brief ExecuteBatch()의 SIMD 레인 실행 사용 여부 (기본 사용)
+     */
+    void SetLaneParallelEnabled(bool enabled) { _laneParallelEnabled = enabled; }
+    
+    /**
+     * @brief SIMD 레인 실행기 (통계 조회용)
+     */
+    const LaneExecutor& GetLaneExecutor() const { return _lanes; }
+    
+    /**
+     * @brief 로드된 코드가 로드 시점 검증을 통과했는지 여부
+     * 
+     * 통과한 코드는 Portable/Threaded 모드에서 0번지부터 실행할 때, 진입 시 스택 범위를
+     * 한 번만 확인하고 명령어마다 스택 검사를 하지 않는 루프로 실행
+     */
+    bool IsVerified() const { return _verifier.IsVerified(); }
+    
+    /**
+     * @brief 검증 결과 (실패 사유, 필요한 스택 깊이 조회용)
+     */
+    const BytecodeVerifier& GetVerifier() const { return _verifier; }
+    
+    /**
+     * @brief 검증된 코드의 검사 생략 실행 사용 여부 (기본 사용)
+     * 
+     * 끄면 검증 결과와 관계없이 실행 모드의 일반 루프로 실행
+     */
+    void SetVerificationEnabled(bool enabled) { _verificationEnabled = enabled; }
+    
+    /**
+     * @brief 검사 생략 실행 사용 여부
+     */
+    bool IsVerificationEnabled() const { return _verificationEnabled; }
+    
+    /**
+     * @brief 가드 페이지 스택 실행 사용 여부 (기본 사용 안 함)
+     * 
+     * 켜면 스택 세그먼트에 가드 페이지가 있을 때(StackGuard::CanGuard) 0번지부터 실행하는 검증된 코드 중
+     * 진입 시 스택 범위를 증명하지 못한 코드도 Portable/Threaded 모드에서 검사 생략 루프로 실행하고,
+     * 스택 범위 초과는 가드 페이지 폴트로 감지 (HOSTCALL/THREAD가 있는 코드는 제외)
+     * 프로세스 전체 SIGSEGV 처리기를 처음 사용할 때 등록하므로, 자체 처리기를 쓰는 호스트는 VM보다 먼저 등록해야 함
+     */
+    void SetStackGuardEnabled(bool enabled) { _stackGuardEnabled = enabled; }
+    
+    /**
+     * @brief 가드 페이지 스택 실행 사용 여부
+     */
+    bool IsStackGuardEnabled() const { return _stackGuardEnabled; }
+    
+    /**
+     * @brief 다음 Execute()가 가드 페이지 스택으로 실행될 수 있는지 여부 (설정과 세그먼트/빌드 지원 모두 확인)
+     */
+    bool IsStackGuarded() const;
+    
+    /**
+     * @brief 가드 페이지 폴트로 끝난 실행 횟수
+     */
+    size_t GetStackFaultCount() const { return _stackFaultCount; }
+    
+    /**
+     * @brief 마지막 가드 페이지 폴트 (방향, 폴트 주소, 폴트를 일으킨 명령어 오프셋)
+     */
+    const Memory::StackFault& GetLastStackFault() const { return _lastStackFault; }
+    
+    /**
+     * @brief 힙 크기 정책 변경 (힙에 할당된 블록이 없을 때만)
+     * 
+     * 기본은 생성 시 heapSize에서 시작해 ALLOC할 공간이 모자랄 때마다 2배씩 HeapGrowthPolicy::kDefaultMaxSize까지 늘림
+     * 힙 주소는 그대로 유효하며, 늘어난 힙은 인스턴스 재사용(Reset 후 풀 반납 등) 시 initialSize로 돌아감
+     */
+    void SetHeapGrowthPolicy(const Memory::HeapGrowthPolicy& policy) { _memoryManager->SetHeapGrowthPolicy(policy); }
+    
+    /**
+     * @brief 힙 크기 정책 조회
+     */
+    const Memory::HeapGrowthPolicy& GetHeapGrowthPolicy() const { return _memoryManager->GetHeapGrowthPolicy(); }
+    
+    /**
+     * @brief 힙 할당 통계 (늘린 횟수, 현재/최대 힙 크기 포함)
+     */
+    Memory::HeapStats GetHeapStats() const { return _memoryManager->GetHeapMemory().GetStats(); }
+    
+    /**
+     * @brief 아레나 할당 통계 (ARENA_BEGIN/ARENA_ALLOC/ARENA_RESET)
+     */
+    Memory::ArenaStats GetArenaStats() const { return _memoryManager->GetArenaMemory().GetStats(); }
+    
+    /**
+     * @brief 현재 상태 스냅샷 (CODE/STACK/HEAP/CONSTANT 세그먼트, IP/BP/SP, 힙 할당기 상태)
+     * 
+     * 초기화 코드를 실행한 뒤 한 번 찍어 두고 요청마다 RestoreSnapshot()으로 그 상태에서 시작
+     * Linux에서는 쓰인 구간을 memfd에 한 번 복사하고 복원은 MAP_PRIVATE 매핑이므로, 요청이 쓰는 페이지만 복사됨
+     * MemorySnapshot::SaveToFile()로 저장해 두면 프로세스를 다시 시작해도 초기화를 건너뜀
+     * 
+     * @return std::shared_ptr<const Memory::MemorySnapshot> 스냅샷 (여러 인스턴스가 함께 복원 가능)
+     * @throw std::runtime_error 열린 아레나가 있을 때
+     */
+    std::shared_ptr<const Memory::MemorySnapshot> Snapshot() const;
+    
+    /**
+     * @brief 스냅샷 상태로 되돌림
+     * 
+     * 로드된 코드가 스냅샷 코드와 다르면(다른 인스턴스, 파일에서 읽은 스냅샷) 스냅샷 코드를 먼저 로드
+     * 이후 Execute(시작 주소)로 요청 실행, 실행 설정(모드/검증 등)은 그대로 둠
+     * 
+     * @param snapshot 되돌릴 스냅샷
+     * @throw std::invalid_argument 스택/상수 세그먼트 크기가 이 인스턴스와 다를 때
+     */
+    void RestoreSnapshot(const Memory::MemorySnapshot& snapshot);
+    
+    /**
+     * @brief VM 스택 공유 방식 변경 (기본 StackSharing::Owned)
+     * 
+     * 기본 스택은 실행 스레드만 접근하는 락 없는 스택이며, Reset() 후 처음 접근한 스레드가 소유
+     * 실행 중에 다른 스레드에서 GetStackPointer() 등으로 스택을 조회하려면 실행 전에 Synchronized로 바꿈
+     */
+    void SetStackSharing(Memory::StackSharing sharing) { _memoryManager->GetStackMemory().SetSharing(sharing); }
+    
+    /**
+     * @brief VM 스택 공유 방식 조회
+     */
+    Memory::StackSharing GetStackSharing() const { return _memoryManager->GetStackMemory().GetSharing(); }
+    
     /**
      * @brief 실행 결과 반환 값 조회
      * 
@@ -85,6 +385,42 @@ public:
      */
     uint64_t GetReturnValue() const { return _returnValue; }
     
+    /**
+     * @brief 현재 스택 포인터 조회
+     * 
+     * StackCached 모드에서도 Execute() 반환 시점에는 캐시가 모두 기록되어 있으므로 다른 모드와 같은 값
+     * 
+     * @return size_t 스택 포인터 (스택 세그먼트 오프셋)
+     */
+    size_t GetStackPointer() const { return _memoryManager->GetStackPointer(); }
+    
+    /**
+     * @brief 현재 베이스 포인터 조회 (CALL이 만든 프레임 밖이면 0)
+     * 
+     * @return size_t 베이스 포인터 (스택 세그먼트 오프셋, ControlFlow::FrameLayout 기준 프레임 베이스)
+     */
+    size_t GetBasePointer() const { return _controlFlow.GetBasePointer(); }
+    
+    /**
+     * @brief 현재 VM 호출 스택 (0번이 가장 바깥 호출, 마지막이 현재 함수)
+     * 
+     * 반환 주소와 이전 BP는 VM 스택이 아닌 ControlFlowManager의 연속 배열에 있으므로, 실행 중 HALT로 멈춘 뒤나
+     * 다른 스레드(StackSharing::Synchronized일 때)에서 복사 없이 훑을 수 있음
+     */
+    std::span<const ControlFlow::CallFrame> GetCallStack() const { return _controlFlow.GetCallStack(); }
+    
+    /**
+     * @brief 최대 호출 깊이 설정 (기본 ControlFlow::ControlFlowManager::kDefaultMaxDepth, 넘으면 실행 오류)
+     * 
+     * @param depth 최대 호출 깊이 (1 이상)
+     */
+    void SetMaxCallDepth(size_t depth) { _controlFlow.SetMaxDepth(depth); }
+    
+    /**
+     * @brief 최대 호출 깊이 조회
+     */
+    size_t GetMaxCallDepth() const { return _controlFlow.GetMaxDepth(); }
+    
     /**
      * @brief 실행 결과 값 템플릿 버전
      * 
@@ -100,19 +436,213 @@ public:
     }
     
 private:
+    friend class Tests::EngineBenchmark;
+    friend class InterpreterPool;
+
     // 명령어 포인터
     size_t _ip = 0;
     
     // 메모리 관리자
     std::unique_ptr<Memory::MemoryManager> _memoryManager;
     
+    // 자주 쓰는 세그먼트와 힙 시작 가상 주소 (핸들러가 GetSegment()를 거치지 않도록 생성 시 한 번 조회)
+    // 세그먼트는 _memoryManager가 소유하므로 인스턴스 수명 동안 유효, 데이터 포인터는 코드 공유/분리 시 바뀌므로 GetData()로 읽음
+    Memory::MemorySegment* _codeSegment = nullptr;
+    Memory::MemorySegment* _stackSegment = nullptr;
+    Memory::MemorySegment* _heapSegment = nullptr;
+    uint64_t _heapVirtualBase = 0;
+    
     // 실행 플래그
     bool _running = false;
     
     // 반환 값
     uint64_t _returnValue = 0;
-    // 현재 스택 프레임의 베이스 포인터(BP)
-    size_t _basePointer = 0;
+    // CALL/RET 호출 스택과 현재 스택 프레임의 베이스 포인터(BP)
+    ControlFlow::ControlFlowManager _controlFlow;
+    
+    // 로드된 바이트코드 길이
+    size_t _codeSize = 0;
+    
+    // 실행 모드 (지원되는 빌드에서는 Threaded가 기본)
+    ExecutionMode _executionMode = IsThreadedDispatchSupported() ? ExecutionMode::Threaded : ExecutionMode::Portable;
+    
+    // LoadBytecode 시점에 디코딩한 명령어 스트림
+    InstructionStream _stream;
+    bool _superinstructionsEnabled = true;
+    
+    // Threaded 모드: 스트림 명령어별 핸들러 레이블 주소
+    std::vector<const void*> _threadedHandlers;
+    bool _threadedHandlersValid = false;
+    
+    // Jit 모드: 로드된 코드의 기본 블록 기계어
+    JitCompiler _jit;
+    bool _jitValid = false;
+    
+    // Tiered 모드: 분석만 해두고 뜨거운 영역만 컴파일, 바이트 오프셋별 실행 횟수
+    JitCompiler _tieredJit;
+    bool _tieredJitValid = false;
+    std::vector<uint32_t> _hotCounters;
+    TieringStats _tieringStats{100, 10};
+    
+    // ExecuteBatch: 분기 없는 산술 코드를 입력 여러 개에 대해 한 번에 실행
+    LaneExecutor _lanes;
+    bool _laneParallelEnabled = true;
+    
+    // 로드 시점 검증: 통과하면 명령어별 스택 검사를 생략한 루프로 실행
+    BytecodeVerifier _verifier;
+    bool _verificationEnabled = true;
+    
+    // 가드 페이지 스택: 진입 시 범위를 증명하지 못한 검증된 코드도 스택 범위 초과를 폴트로 감지하며 검사 생략 루프로 실행
+    bool _stackGuardEnabled = false;
+    size_t _stackFaultCount = 0;
+    Memory::StackFault _lastStackFault;
+    volatile uint32_t _guardPc = 0;
+    volatile size_t _guardStackPointer = 0;     ///< 폴트 처리용 명령어 시작 시점 스택 포인터
+    
+    /**
+     * @brief 명령어 스트림을 switch 루프로 _ip부터 실행
+     * 
+     * 명령어 경계가 아닌 곳으로 제어가 넘어가면 그 지점부터 _ExecuteBytecode()로 이어서 실행
+     * 
+     * @return int 실행 결과 코드 (0: 정상 종료, -1: 실행 오류)
+     */
+    int _ExecutePortable();
+    
+    /**
+     * @brief 명령어 스트림을 computed goto로 _ip부터 실행
+     * 
+     * 명령어 경계가 아닌 곳으로 제어가 넘어가면 그 지점부터 _ExecuteBytecode()로 이어서 실행
+     * 
+     * @return int 실행 결과 코드 (0: 정상 종료, -1: 실행 오류)
+     */
+    int _ExecuteThreaded();
+    
+    /**
+     * @brief 스택 최상위 캐싱을 적용한 switch 루프로 _ip부터 실행
+     * 
+     * CALL, HOSTCALL, HALT와 VM 스택을 직접 쓰는 핸들러 호출 직전,
+     * 바이트 단위 실행 전환 및 오류 시에 캐시를 VM 스택에 기록
+     * 
+     * @return int 실행 결과 코드 (0: 정상 종료, -1: 실행 오류)
+     */
+    int _ExecuteStackCached();
+    
+    /**
+     * @brief 검증된 코드를 스택 포인터 직접 조작 switch 루프로 _ip부터 실행
+     * 
+     * 진입 시 스택에 필요한 인자와 최대 증가량만큼 공간이 있는지 한 번 확인하고, 없으면 일반 루프로 대체
+     * 진입 확인에 실패해도 0번지부터 실행하고 가드 페이지 스택을 쓸 수 있으면(IsStackGuarded) _ExecuteGuarded()로 실행
+     * 
+     * @return int 실행 결과 코드 (0: 정상 종료, -1: 실행 오류)
+     */
+    int _ExecuteVerified();
+    
+    /**
+     * @brief StackGuard 범위에서 검사 생략 루프로 _ip부터 실행
+     * 
+     * 가드 페이지 폴트가 나면 명령어 시작 시점 스택 포인터로 되돌리고 그 명령어를 검사하는 핸들러로 다시 실행하여
+     * 일반 루프와 같은 스택 상태와 오류 메시지로 끝냄, 폴트를 일으킨 명령어 오프셋은 GetLastStackFault()에 기록
+     * 
+     * @return int 실행 결과 코드 (0: 정상 종료, -1: 실행 오류)
+     */
+    int _ExecuteGuarded();
+    
+    /**
+     * @brief 스택 포인터 직접 조작 switch 루프 (_ExecuteVerified()/_ExecuteGuarded() 공용)
+     * 
+     * 힙 접근은 범위 비교 한 번으로 처리하고 벗어나면 검사하는 접근자로 같은 오류를 보고
+     * 
+     * @tparam Guarded true면 스택 세그먼트 전체를 쓰인 것으로 표시하고, 명령어마다 인덱스와 스택 포인터를 _guardPc/_guardStackPointer에 기록
+     * @return int 실행 결과 코드 (0: 정상 종료, -1: 실행 오류)
+     */
+    template<bool Guarded>
+    int _ExecuteUnchecked();
+    
+    /**
+     * @brief 컴파일된 블록은 기계어로, 나머지는 디스패치 테이블로 _ip부터 실행
+     * 
+     * 기계어가 탈출하면 그 명령어를 인터프리터가 실행하고, 블록 시작에 도달하면 다시 기계어로 진입
+     * 컴파일할 수 없으면(미지원 빌드, mmap 실패) _ExecutePortable()로 대체
+     * 
+     * @return int 실행 결과 코드 (0: 정상 종료, -1: 실행 오류)
+     */
+    int _ExecuteJit();
+    
+    /**
+     * @brief 디스패치 테이블로 _ip부터 실행하면서 뜨거운 지점을 세어 컴파일하고 기계어로 전환
+     * 
+     * 기계어와 인터프리터가 같은 VM 스택을 쓰므로 루프 도중에도 다음 루프 헤더에서 바로 전환됨
+     * 미지원 빌드에서는 _ExecutePortable()로 대체
+     * 
+     * @return int 실행 결과 코드 (0: 정상 종료, -1: 실행 오류)
+     */
+    int _ExecuteTiered();
+    
+    /**
+     * @brief 지점의 실행 횟수를 세고 기준에 도달하면 그 지점부터 컴파일
+     */
+    void _CountHotSpot(size_t offset, uint32_t threshold);
+    
+    /**
+     * @brief 바이트 단위 fetch + 디스패치 테이블 루프로 _ip부터 실행
+     * 
+     * @return int 실행 결과 코드 (0: 정상 종료, -1: 실행 오류)
+     */
+    int _ExecuteBytecode();
+    
+    /**
+     * @brief 복호화된 코드를 코드 세그먼트에 올리고 명령어 스트림 디코딩
+     */
+    void _LoadPlainCode(const uint8_t* code, size_t size);
+    
+    /**
+     * @brief 같은 크기의 다른 인스턴스에 로드된 코드를 공유
+     * 
+     * 코드 세그먼트 메모리는 복사하지 않고 공유하며, 명령어 스트림/검증/레인 분석 결과는 복사 (다시 디코딩하지 않음)
+     */
+    void _LoadSharedCode(const Interpreter& source);
+    
+    /**
+     * @brief ExecuteBatch()의 한 구간을 현재 인스턴스에서 순차 실행
+     * 
+     * @return size_t 실패한 실행 수
+     */
+    size_t _ExecuteBatchRange(const uint64_t* args, size_t argc, uint64_t* results, size_t count);
+    
+    /**
+     * @brief 실행 한 번: Reset() 후 인자를 푸시하고 startAddress부터 실행
+     * 
+     * @return bool 정상 종료 여부 (result에 반환 값)
+     */
+    bool _ExecuteWithStack(const uint64_t* stack, size_t depth, size_t startAddress, uint64_t& result);
+    
+    /**
+     * @brief 가상 주소에서 8바이트 읽기 (LOAD64, LOADVAR 공용)
+     */
+    uint64_t _Load64(uint64_t address);
+    
+    /**
+     * @brief 가상 주소에 8바이트 쓰기 (STORE64, STOREVAR 공용)
+     */
+    void _Store64(uint64_t address, uint64_t value);
+    
+    /**
+     * @brief 호스트 함수 호출
+     * 
+     * @param functionId 호스트 함수 ID
+     */
+    void _HostCall(uint8_t functionId);
+    
+    /**
+     * @brief 현재 프레임의 지역 변수/인자 슬롯 주소 (LDLOC/STLOC/LDARG 공용)
+     *
+     * FrameLayout과 같은 계산을 인라인으로 함. 프레임 밖(BP = 0)에서 감싸 돈 주소는 슬롯 접근 시 범위 검사에서 거부됨
+     */
+    size_t _LocalAddress(uint8_t index) const 
+    { 
+        return _controlFlow.GetBasePointer() - ControlFlow::FrameLayout::LocalAreaOffset - (static_cast<size_t>(index) + 1) * sizeof(uint64_t); 
+    }
+    size_t _ArgumentAddress(uint8_t index) const { return _controlFlow.GetBasePointer() + static_cast<size_t>(index) * sizeof(uint64_t); }
     
     /**
      * @brief 명령어 가져오기 (fetch)
@@ -143,21 +673,23 @@ private:
     int64_t _FetchInt64();
     
     /**
-     * @brief 명령어 실행 함수 타입 정의
+     * @brief 명령어 실행 함수 타입 정의 (멤버 함수 포인터)
      */
-    using OpcodeHandler = std::function<void(Interpreter*)>;
+    using OpcodeHandler = void (Interpreter::*)();
     
     /**
-     * @brief 명령어 핸들러 맵 초기화
+     * @brief opcode 바이트로 바로 인덱싱하는 디스패치 테이블 생성
      * 
-     * @return std::unordered_map<uint8_t, OpcodeHandler> 핸들러 맵
+     * 정의되지 않은 opcode 슬롯은 모두 _Handle_INVALID 트랩으로 채움
+     * 
+     * @return std::array<OpcodeHandler, 256> 디스패치 테이블
      */
-    static std::unordered_map<uint8_t, OpcodeHandler> _InitializeOpcodeHandlers();
+    static std::array<OpcodeHandler, 256> _BuildDispatchTable();
     
     /**
-     * @brief 명령어 핸들러 맵
+     * @brief 256 엔트리 디스패치 테이블
      */
-    static const std::unordered_map<uint8_t, OpcodeHandler> _opcodeHandlers;
+    static const std::array<OpcodeHandler, 256> _dispatchTable;
     
     // 명령어 실행 핸들러 함수들
     void _Handle_PUSH8();
@@ -188,6 +720,9 @@ private:
     void _Handle_STORE16();
     void _Handle_STORE32();
     void _Handle_STORE64();
+    void _Handle_MEMCPY();
+    void _Handle_MEMSET();
+    void _Handle_MEMCMP();
     
     void _Handle_JMP();
     void _Handle_JZ();
@@ -199,14 +734,28 @@ private:
     
     void _Handle_CALL();
     void _Handle_RET();
+    void _Handle_TAILCALL();
+    void _Handle_LDLOC();
+    void _Handle_STLOC();
+    void _Handle_LDARG();
     
     void _Handle_ALLOC();
     void _Handle_FREE();
+    void _Handle_ARENA_BEGIN();
+    void _Handle_ARENA_ALLOC();
+    void _Handle_ARENA_RESET();
     
     void _Handle_HOSTCALL();
     void _Handle_THREAD();
     
     void _Handle_HALT();
+    
+    /**
+     * @brief 정의되지 않은 opcode 트랩
+     * 
+     * @throw std::runtime_error 항상 발생 (opcode와 위치 포함)
+     */
+    void _Handle_INVALID();
 };
 
 } // namespace Engine
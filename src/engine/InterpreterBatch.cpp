@@ -0,0 +1,135 @@
+#include "Interpreter.h"
+#include <algorithm>
+#include <exception>
+#include <thread>
+
+namespace DarkMatterVM {
+namespace Engine {
+
+int Interpreter::ExecuteBatch(std::span<const uint64_t> args, size_t argc, std::span<uint64_t> results, size_t threadCount)
+{
+    const size_t runCount = results.size();
+    if (args.size() != argc * runCount)
+    {
+        return -1;
+    }
+
+    if (runCount == 0)
+    {
+        return 0;
+    }
+
+    threadCount = std::clamp<size_t>(threadCount, 1, runCount);
+    if (threadCount == 1)
+    {
+        return _ExecuteBatchRange(args.data(), argc, results.data(), runCount) == 0 ? 0 : -1;
+    }
+
+    // 구간 나누기: 앞쪽 구간부터 하나씩 더 받음
+    const size_t chunk = runCount / threadCount;
+    const size_t remainder = runCount % threadCount;
+    auto rangeBegin = [&](size_t index) { return index * chunk + std::min(index, remainder); };
+
+    // 작업 스레드용 인스턴스: 코드 세그먼트와 디코딩 결과를 공유하고 실행 설정만 복사
+    std::vector<std::unique_ptr<Interpreter>> workers;
+    workers.reserve(threadCount - 1);
+    for (size_t i = 1; i < threadCount; ++i)
+    {
+        auto worker = std::make_unique<Interpreter>(
+            _codeSegment->GetSize(),
+            _stackSegment->GetSize(),
+            _heapSegment->GetSize());
+        worker->_executionMode = _executionMode;
+        worker->_superinstructionsEnabled = _superinstructionsEnabled;
+        worker->_laneParallelEnabled = _laneParallelEnabled;
+        worker->_verificationEnabled = _verificationEnabled;
+        worker->_stackGuardEnabled = _stackGuardEnabled;
+        worker->_tieringStats.backEdgeThreshold = _tieringStats.backEdgeThreshold;
+        worker->_tieringStats.callThreshold = _tieringStats.callThreshold;
+        worker->SetHeapGrowthPolicy(GetHeapGrowthPolicy());
+        worker->SetStackSharing(GetStackSharing());
+        worker->_LoadSharedCode(*this);
+        workers.push_back(std::move(worker));
+    }
+
+    std::vector<size_t> failures(threadCount, 0);
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for (size_t i = 1; i < threadCount; ++i)
+    {
+        threads.emplace_back([&, i]()
+        {
+            size_t begin = rangeBegin(i);
+            size_t count = rangeBegin(i + 1) - begin;
+            failures[i] = workers[i - 1]->_ExecuteBatchRange(args.data() + begin * argc, argc, results.data() + begin, count);
+        });
+    }
+
+    failures[0] = _ExecuteBatchRange(args.data(), argc, results.data(), rangeBegin(1));
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    return std::all_of(failures.begin(), failures.end(), [](size_t count) { return count == 0; }) ? 0 : -1;
+}
+
+size_t Interpreter::_ExecuteBatchRange(const uint64_t* args, size_t argc, uint64_t* results, size_t count)
+{
+    size_t failures = 0;
+
+    if (_laneParallelEnabled && _lanes.IsEligible())
+    {
+        // 입력 kLaneCount개씩 레인으로 실행, 레인이 갈라지면 그 레인만 이 인스턴스에서 스칼라 실행
+        LaneFallback fallback = [this](size_t, size_t resumeOffset, const uint64_t* stack, size_t depth, uint64_t& result)
+        {
+            return _ExecuteWithStack(stack, depth, resumeOffset, result);
+        };
+
+        for (size_t base = 0; base < count; base += LaneExecutor::kLaneCount)
+        {
+            size_t laneCount = std::min(LaneExecutor::kLaneCount, count - base);
+            failures += _lanes.Execute(args + base * argc, argc, laneCount, results + base, fallback);
+        }
+
+        return failures;
+    }
+
+    for (size_t run = 0; run < count; ++run)
+    {
+        if (!_ExecuteWithStack(args + run * argc, argc, 0, results[run]))
+        {
+            results[run] = 0;
+            failures++;
+        }
+    }
+
+    return failures;
+}
+
+bool Interpreter::_ExecuteWithStack(const uint64_t* stack, size_t depth, size_t startAddress, uint64_t& result)
+{
+    int resultCode = -1;
+
+    // 인자 푸시 중 스택 오버플로 등은 해당 실행만 실패로 처리
+    try
+    {
+        Reset();
+        for (size_t i = 0; i < depth; ++i)
+        {
+            PushParameter(stack[i]);
+        }
+        resultCode = Execute(startAddress);
+    }
+    catch (const std::exception&)
+    {
+        resultCode = -1;
+    }
+
+    result = resultCode == 0 ? _returnValue : 0;
+    return resultCode == 0;
+}
+
+} // namespace Engine
+} // namespace DarkMatterVM
@@ -0,0 +1,311 @@
+#include "Interpreter.h"
+#include "StackCache.h"
+#include <iostream>
+
+namespace DarkMatterVM {
+namespace Engine {
+
+int Interpreter::_ExecuteStackCached()
+{
+    uint32_t pc = _stream.GetIndex(_ip);
+    if (pc == InstructionStream::kNoIndex)
+    {
+        return _ExecuteBytecode();
+    }
+
+    const uint8_t* opcodes = _stream.GetOpcodes();
+    const uint64_t* immediates = _stream.GetImmediates();
+    const uint32_t* targets = _stream.GetTargets();
+    const uint32_t* nextOffsets = _stream.GetNextOffsets();
+
+    // 최상위 두 슬롯은 지역 변수에 두고 루프 밖으로 나가기 전에만 VM 스택에 기록
+    StackCache cache(*_memoryManager);
+
+    try
+    {
+        while (true)
+        {
+            // 스트림 opcode는 Opcode와 FusedOpcode 값을 함께 쓰므로 원래 바이트 값으로 분기
+            switch (opcodes[pc])
+            {
+                case static_cast<uint8_t>(Opcode::PUSH8):
+                case static_cast<uint8_t>(Opcode::PUSH16):
+                case static_cast<uint8_t>(Opcode::PUSH32):
+                case static_cast<uint8_t>(Opcode::PUSH64):
+                    cache.Push(immediates[pc]);
+                    break;
+                case static_cast<uint8_t>(Opcode::POP):
+                    cache.Pop();
+                    break;
+                case static_cast<uint8_t>(Opcode::DUP):
+                    cache.Push(cache.Top());
+                    break;
+                case static_cast<uint8_t>(Opcode::SWAP):
+                {
+                    uint64_t a = cache.Pop();
+                    uint64_t b = cache.Pop();
+                    cache.Push(a);
+                    cache.Push(b);
+                    break;
+                }
+
+                // 이항 연산: 두 번째 피연산자가 캐시에 있으면 레지스터 연산 한 번
+                case static_cast<uint8_t>(Opcode::ADD):   { uint64_t b = cache.Pop(); cache.Top() += b; break; }
+                case static_cast<uint8_t>(Opcode::SUB):   { uint64_t b = cache.Pop(); cache.Top() -= b; break; }
+                case static_cast<uint8_t>(Opcode::MUL):   { uint64_t b = cache.Pop(); cache.Top() *= b; break; }
+                case static_cast<uint8_t>(Opcode::AND):   { uint64_t b = cache.Pop(); cache.Top() &= b; break; }
+                case static_cast<uint8_t>(Opcode::OR):    { uint64_t b = cache.Pop(); cache.Top() |= b; break; }
+                case static_cast<uint8_t>(Opcode::XOR):   { uint64_t b = cache.Pop(); cache.Top() ^= b; break; }
+                case static_cast<uint8_t>(Opcode::NOT):   { uint64_t& a = cache.Top(); a = ~a; break; }
+                case static_cast<uint8_t>(Opcode::SHL):
+                {
+                    uint64_t b = cache.Pop();
+                    uint64_t& a = cache.Top();
+                    a = b >= 64 ? 0 : a << b;
+                    break;
+                }
+                case static_cast<uint8_t>(Opcode::SHR):
+                {
+                    uint64_t b = cache.Pop();
+                    uint64_t& a = cache.Top();
+                    a = b >= 64 ? 0 : a >> b;
+                    break;
+                }
+
+                // 0으로 나누기 시 스택 상태를 다른 모드와 맞추기 위해 두 값 모두 꺼낸 뒤 검사
+                case static_cast<uint8_t>(Opcode::DIV):
+                {
+                    uint64_t b = cache.Pop();
+                    uint64_t a = cache.Pop();
+                    if (b == 0)
+                    {
+                        throw std::runtime_error("0으로 나누기 시도");
+                    }
+                    cache.Push(a / b);
+                    break;
+                }
+                case static_cast<uint8_t>(Opcode::MOD):
+                {
+                    uint64_t b = cache.Pop();
+                    uint64_t a = cache.Pop();
+                    if (b == 0)
+                    {
+                        throw std::runtime_error("0으로 나누기 시도 (나머지 연산)");
+                    }
+                    cache.Push(a % b);
+                    break;
+                }
+
+                // 주소를 먼저 꺼냄 (접근 오류 시 스택 상태를 다른 모드와 맞춤, 캐시 안에서는 메모리 접근 없음)
+                case static_cast<uint8_t>(Opcode::LOAD64):
+                {
+                    uint64_t address = cache.Pop();
+                    cache.Push(_Load64(address));
+                    break;
+                }
+                case static_cast<uint8_t>(Opcode::STORE64):
+                {
+                    uint64_t value = cache.Pop();
+                    uint64_t address = cache.Pop();
+                    _Store64(address, value);
+                    break;
+                }
+
+                // 힙 세그먼트 접근 핸들러는 VM 스택을 직접 사용
+                case static_cast<uint8_t>(Opcode::LOAD8):     cache.Flush(); _Handle_LOAD8(); break;
+                case static_cast<uint8_t>(Opcode::LOAD16):    cache.Flush(); _Handle_LOAD16(); break;
+                case static_cast<uint8_t>(Opcode::LOAD32):    cache.Flush(); _Handle_LOAD32(); break;
+                case static_cast<uint8_t>(Opcode::STORE8):    cache.Flush(); _Handle_STORE8(); break;
+                case static_cast<uint8_t>(Opcode::STORE16):   cache.Flush(); _Handle_STORE16(); break;
+                case static_cast<uint8_t>(Opcode::STORE32):   cache.Flush(); _Handle_STORE32(); break;
+                case static_cast<uint8_t>(Opcode::MEMCPY):    cache.Flush(); _Handle_MEMCPY(); break;
+                case static_cast<uint8_t>(Opcode::MEMSET):    cache.Flush(); _Handle_MEMSET(); break;
+                case static_cast<uint8_t>(Opcode::MEMCMP):    cache.Flush(); _Handle_MEMCMP(); break;
+
+                case static_cast<uint8_t>(Opcode::JMP):
+                    pc = targets[pc];
+                    continue;
+                case static_cast<uint8_t>(Opcode::JZ):
+                    if (cache.Pop() == 0)
+                    {
+                        pc = targets[pc];
+                        continue;
+                    }
+                    break;
+                case static_cast<uint8_t>(Opcode::JNZ):
+                    if (cache.Pop() != 0)
+                    {
+                        pc = targets[pc];
+                        continue;
+                    }
+                    break;
+                case static_cast<uint8_t>(Opcode::JG):
+                case static_cast<uint8_t>(Opcode::JL):
+                case static_cast<uint8_t>(Opcode::JGE):
+                case static_cast<uint8_t>(Opcode::JLE):
+                {
+                    uint64_t b = cache.Pop();
+                    uint64_t a = cache.Pop();
+
+                    bool taken = false;
+                    switch (static_cast<Opcode>(opcodes[pc]))
+                    {
+                        case Opcode::JG:    taken = a > b; break;
+                        case Opcode::JL:    taken = a < b; break;
+                        case Opcode::JGE:   taken = a >= b; break;
+                        default:            taken = a <= b; break;
+                    }
+
+                    if (taken)
+                    {
+                        pc = targets[pc];
+                        continue;
+                    }
+                    break;
+                }
+
+                // 호출 경계에서는 인자까지 VM 스택에 기록된 상태로 진입 (BP = 기록 후 스택 포인터, 반환 주소는 호출 스택에)
+                case static_cast<uint8_t>(Opcode::CALL):
+                {
+                    uint64_t targetAddress = cache.Pop();
+                    cache.Flush();
+                    _ip = nextOffsets[pc];
+                    _controlFlow.Call(_ip, static_cast<size_t>(targetAddress));
+
+                    uint32_t targetIndex = _stream.GetIndex(_ip);
+                    if (targetIndex == InstructionStream::kNoIndex)
+                    {
+                        return _ExecuteBytecode();
+                    }
+
+                    pc = targetIndex;
+                    continue;
+                }
+                case static_cast<uint8_t>(Opcode::RET):
+                {
+                    cache.Flush();
+                    _controlFlow.Ret(_ip, static_cast<uint8_t>(immediates[pc]));
+
+                    uint32_t returnIndex = _stream.GetIndex(_ip);
+                    if (returnIndex == InstructionStream::kNoIndex)
+                    {
+                        return _ExecuteBytecode();
+                    }
+
+                    pc = returnIndex;
+                    continue;
+                }
+                case static_cast<uint8_t>(Opcode::TAILCALL):
+                {
+                    uint64_t targetAddress = cache.Pop();
+                    cache.Flush();
+                    _controlFlow.TailCall(_ip, static_cast<size_t>(targetAddress),
+                                          static_cast<uint8_t>(immediates[pc]), static_cast<uint8_t>(immediates[pc] >> 8));
+
+                    uint32_t targetIndex = _stream.GetIndex(_ip);
+                    if (targetIndex == InstructionStream::kNoIndex)
+                    {
+                        return _ExecuteBytecode();
+                    }
+
+                    pc = targetIndex;
+                    continue;
+                }
+
+                // 프레임 슬롯은 캐시 아래에 있으므로 캐시를 기록한 뒤 스택 세그먼트에서 접근
+                case static_cast<uint8_t>(Opcode::LDLOC):
+                    cache.Flush();
+                    cache.Push(_memoryManager->ReadStackSlot(_LocalAddress(static_cast<uint8_t>(immediates[pc]))));
+                    break;
+                case static_cast<uint8_t>(Opcode::STLOC):
+                {
+                    uint64_t value = cache.Pop();
+                    cache.Flush();
+                    _memoryManager->WriteStackSlot(_LocalAddress(static_cast<uint8_t>(immediates[pc])), value);
+                    break;
+                }
+                case static_cast<uint8_t>(Opcode::LDARG):
+                    cache.Flush();
+                    cache.Push(_memoryManager->ReadStackSlot(_ArgumentAddress(static_cast<uint8_t>(immediates[pc]))));
+                    break;
+
+                case static_cast<uint8_t>(Opcode::ALLOC):     cache.Flush(); _Handle_ALLOC(); break;
+                case static_cast<uint8_t>(Opcode::FREE):      cache.Flush(); _Handle_FREE(); break;
+                case static_cast<uint8_t>(Opcode::ARENA_BEGIN): _Handle_ARENA_BEGIN(); break;
+                case static_cast<uint8_t>(Opcode::ARENA_ALLOC): cache.Flush(); _Handle_ARENA_ALLOC(); break;
+                case static_cast<uint8_t>(Opcode::ARENA_RESET): _Handle_ARENA_RESET(); break;
+
+                case static_cast<uint8_t>(Opcode::HOSTCALL):  cache.Flush(); _HostCall(static_cast<uint8_t>(immediates[pc])); break;
+                case static_cast<uint8_t>(Opcode::THREAD):    cache.Flush(); _Handle_THREAD(); break;
+
+                case static_cast<uint8_t>(Opcode::HALT):
+                    cache.Flush();
+                    _Handle_HALT();
+                    _ip = nextOffsets[pc];
+                    return 0;
+
+                case static_cast<uint8_t>(FusedOpcode::LOADVAR):
+                    cache.Push(_Load64(immediates[pc]));
+                    pc += GetFusedLength(FusedOpcode::LOADVAR);
+                    continue;
+                case static_cast<uint8_t>(FusedOpcode::STOREVAR):
+                    _Store64(immediates[pc], cache.Pop());
+                    pc += GetFusedLength(FusedOpcode::STOREVAR);
+                    continue;
+                case static_cast<uint8_t>(FusedOpcode::ADDI):
+                    cache.Top() += immediates[pc];
+                    pc += GetFusedLength(FusedOpcode::ADDI);
+                    continue;
+                case static_cast<uint8_t>(FusedOpcode::SUBI):
+                    cache.Top() -= immediates[pc];
+                    pc += GetFusedLength(FusedOpcode::SUBI);
+                    continue;
+                case static_cast<uint8_t>(FusedOpcode::PUSH_JZ):
+                    if (immediates[pc] == 0)
+                    {
+                        pc = targets[pc];
+                        continue;
+                    }
+                    pc += GetFusedLength(FusedOpcode::PUSH_JZ);
+                    continue;
+                case static_cast<uint8_t>(FusedOpcode::DUP_JNZ):
+                    if (cache.Top() != 0)
+                    {
+                        pc = targets[pc];
+                        continue;
+                    }
+                    pc += GetFusedLength(FusedOpcode::DUP_JNZ);
+                    continue;
+
+                // InstructionStream::kExitOpcode
+                default:
+                    cache.Flush();
+                    _ip = static_cast<size_t>(immediates[pc]);
+                    return _ExecuteBytecode();
+            }
+
+            ++pc;
+        }
+    }
+    catch (const Memory::MemoryAccessException& e)
+    {
+        _ip = nextOffsets[pc];
+        cache.TryFlush();
+        std::cerr << "메모리 접근 오류: " << e.what() << std::endl;
+        _running = false;
+
+        return -1;
+    }
+    catch (const std::exception& e)
+    {
+        _ip = nextOffsets[pc];
+        cache.TryFlush();
+        std::cerr << "VM 실행 오류: " << e.what() << std::endl;
+        _running = false;
+
+        return -1;
+    }
+}
+
+} // namespace Engine
+} // namespace DarkMatterVM
@@ -0,0 +1,72 @@
+#include "Interpreter.h"
+#include <iostream>
+
+namespace DarkMatterVM {
+namespace Engine {
+
+int Interpreter::_ExecuteJit()
+{
+    if (!_jitValid)
+    {
+        _jit.Compile(_codeSegment->GetData(), _codeSize);
+        _jitValid = true;
+    }
+
+    // 기계어는 힙이 기본 주소에 있다고 가정하고 가상 주소를 변환함
+    if (_jit.GetBlockCount() == 0 || _heapVirtualBase != JitCompiler::kHeapVirtualBase)
+    {
+        return _ExecutePortable();
+    }
+
+    auto& stackSegment = *_stackSegment;
+    auto& heapSegment = *_heapSegment;
+    JitState state = JitCompiler::CreateState(stackSegment.GetData(), stackSegment.GetSize(),
+                                              heapSegment.GetData(), heapSegment.GetSize());
+
+    // 기계어는 세그먼트에 직접 쓰므로 재사용 시 전체를 지우도록 표시
+    stackSegment.MarkDirty(0, stackSegment.GetSize());
+    heapSegment.MarkDirty(0, heapSegment.GetSize());
+
+    try
+    {
+        while (_running)
+        {
+            // 블록 시작이면 기계어로 실행, 탈출한 명령어는 항상 인터프리터가 실행
+            JitEntry entry = _jit.GetEntry(_ip);
+            if (entry != nullptr)
+            {
+                // ALLOC이 힙을 늘렸으면 기계어가 보는 힙 범위도 갱신
+                if (state.heapSize != heapSegment.GetSize() || state.heapBase != heapSegment.GetData())
+                {
+                    JitCompiler::SetHeap(state, heapSegment.GetData(), heapSegment.GetSize());
+                    heapSegment.MarkDirty(0, heapSegment.GetSize());
+                }
+                state.stackPointer = _memoryManager->GetStackPointer();
+                _ip = entry(&state);
+                _memoryManager->SetStackPointer(static_cast<size_t>(state.stackPointer));
+            }
+
+            uint8_t opcode = _FetchByte();
+            (this->*_dispatchTable[opcode])();
+        }
+    }
+    catch (const Memory::MemoryAccessException& e)
+    {
+        std::cerr << "메모리 접근 오류: " << e.what() << std::endl;
+        _running = false;
+
+        return -1;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "VM 실행 오류: " << e.what() << std::endl;
+        _running = false;
+
+        return -1;
+    }
+
+    return 0;
+}
+
+} // namespace Engine
+} // namespace DarkMatterVM
@@ -0,0 +1,49 @@
+#include "Interpreter.h"
+#include <cstring>
+
+namespace DarkMatterVM {
+namespace Engine {
+
+std::shared_ptr<const Memory::MemorySnapshot> Interpreter::Snapshot() const
+{
+    auto snapshot = std::make_shared<Memory::MemorySnapshot>();
+    _memoryManager->CaptureSnapshot(*snapshot);
+    
+    const uint8_t* code = _codeSegment->GetData();
+    snapshot->code.assign(code, code + _codeSize);
+    snapshot->instructionPointer = _ip;
+    snapshot->basePointer = _controlFlow.GetBasePointer();
+    for (const ControlFlow::CallFrame& frame : _controlFlow.GetCallStack())
+    {
+        snapshot->callStack.push_back({frame.returnAddress, frame.basePointer, frame.entry});
+    }
+    
+    return snapshot;
+}
+
+void Interpreter::RestoreSnapshot(const Memory::MemorySnapshot& snapshot)
+{
+    // 같은 코드면 디코딩/검증 결과를 그대로 씀 (코드 길이만큼 비교)
+    if (_codeSize != snapshot.code.size() ||
+        std::memcmp(_codeSegment->GetData(), snapshot.code.data(), _codeSize) != 0)
+    {
+        _LoadPlainCode(snapshot.code.data(), snapshot.code.size());
+    }
+    
+    _memoryManager->RestoreSnapshot(snapshot);
+    
+    _ip = static_cast<size_t>(snapshot.instructionPointer);
+    std::vector<ControlFlow::CallFrame> frames;
+    frames.reserve(snapshot.callStack.size());
+    for (const Memory::SavedCallFrame& frame : snapshot.callStack)
+    {
+        frames.push_back({static_cast<size_t>(frame.returnAddress), static_cast<size_t>(frame.basePointer), 
+                          static_cast<size_t>(frame.entry)});
+    }
+    _controlFlow.Restore(static_cast<size_t>(snapshot.basePointer), frames);
+    _running = false;
+    _returnValue = 0;
+}
+
+} // namespace Engine
+} // namespace DarkMatterVM
@@ -0,0 +1,395 @@
+#include "Interpreter.h"
+#include <iostream>
+
+namespace DarkMatterVM {
+namespace Engine {
+
+int Interpreter::_ExecuteThreaded()
+{
+#if DMVM_THREADED_DISPATCH
+    if (!_threadedHandlersValid)
+    {
+        const void* labels[256];
+        for (auto& label : labels)
+        {
+            label = &&op_EXIT;
+        }
+        
+        labels[static_cast<uint8_t>(Opcode::PUSH8)] = &&op_PUSH;
+        labels[static_cast<uint8_t>(Opcode::PUSH16)] = &&op_PUSH;
+        labels[static_cast<uint8_t>(Opcode::PUSH32)] = &&op_PUSH;
+        labels[static_cast<uint8_t>(Opcode::PUSH64)] = &&op_PUSH;
+        labels[static_cast<uint8_t>(Opcode::POP)] = &&op_POP;
+        labels[static_cast<uint8_t>(Opcode::DUP)] = &&op_DUP;
+        labels[static_cast<uint8_t>(Opcode::SWAP)] = &&op_SWAP;
+        
+        labels[static_cast<uint8_t>(Opcode::ADD)] = &&op_ADD;
+        labels[static_cast<uint8_t>(Opcode::SUB)] = &&op_SUB;
+        labels[static_cast<uint8_t>(Opcode::MUL)] = &&op_MUL;
+        labels[static_cast<uint8_t>(Opcode::DIV)] = &&op_DIV;
+        labels[static_cast<uint8_t>(Opcode::MOD)] = &&op_MOD;
+        
+        labels[static_cast<uint8_t>(Opcode::AND)] = &&op_AND;
+        labels[static_cast<uint8_t>(Opcode::OR)] = &&op_OR;
+        labels[static_cast<uint8_t>(Opcode::XOR)] = &&op_XOR;
+        labels[static_cast<uint8_t>(Opcode::NOT)] = &&op_NOT;
+        labels[static_cast<uint8_t>(Opcode::SHL)] = &&op_SHL;
+        labels[static_cast<uint8_t>(Opcode::SHR)] = &&op_SHR;
+        
+        labels[static_cast<uint8_t>(Opcode::LOAD8)] = &&op_LOAD8;
+        labels[static_cast<uint8_t>(Opcode::LOAD16)] = &&op_LOAD16;
+        labels[static_cast<uint8_t>(Opcode::LOAD32)] = &&op_LOAD32;
+        labels[static_cast<uint8_t>(Opcode::LOAD64)] = &&op_LOAD64;
+        labels[static_cast<uint8_t>(Opcode::STORE8)] = &&op_STORE8;
+        labels[static_cast<uint8_t>(Opcode::STORE16)] = &&op_STORE16;
+        labels[static_cast<uint8_t>(Opcode::STORE32)] = &&op_STORE32;
+        labels[static_cast<uint8_t>(Opcode::STORE64)] = &&op_STORE64;
+        labels[static_cast<uint8_t>(Opcode::MEMCPY)] = &&op_MEMCPY;
+        labels[static_cast<uint8_t>(Opcode::MEMSET)] = &&op_MEMSET;
+        labels[static_cast<uint8_t>(Opcode::MEMCMP)] = &&op_MEMCMP;
+        
+        labels[static_cast<uint8_t>(Opcode::JMP)] = &&op_JMP;
+        labels[static_cast<uint8_t>(Opcode::JZ)] = &&op_JZ;
+        labels[static_cast<uint8_t>(Opcode::JNZ)] = &&op_JNZ;
+        labels[static_cast<uint8_t>(Opcode::JG)] = &&op_JG;
+        labels[static_cast<uint8_t>(Opcode::JL)] = &&op_JL;
+        labels[static_cast<uint8_t>(Opcode::JGE)] = &&op_JGE;
+        labels[static_cast<uint8_t>(Opcode::JLE)] = &&op_JLE;
+        
+        labels[static_cast<uint8_t>(Opcode::CALL)] = &&op_CALL;
+        labels[static_cast<uint8_t>(Opcode::RET)] = &&op_RET;
+        labels[static_cast<uint8_t>(Opcode::TAILCALL)] = &&op_TAILCALL;
+        labels[static_cast<uint8_t>(Opcode::LDLOC)] = &&op_LDLOC;
+        labels[static_cast<uint8_t>(Opcode::STLOC)] = &&op_STLOC;
+        labels[static_cast<uint8_t>(Opcode::LDARG)] = &&op_LDARG;
+        
+        labels[static_cast<uint8_t>(Opcode::ALLOC)] = &&op_ALLOC;
+        labels[static_cast<uint8_t>(Opcode::FREE)] = &&op_FREE;
+        labels[static_cast<uint8_t>(Opcode::ARENA_BEGIN)] = &&op_ARENA_BEGIN;
+        labels[static_cast<uint8_t>(Opcode::ARENA_ALLOC)] = &&op_ARENA_ALLOC;
+        labels[static_cast<uint8_t>(Opcode::ARENA_RESET)] = &&op_ARENA_RESET;
+        
+        labels[static_cast<uint8_t>(Opcode::HOSTCALL)] = &&op_HOSTCALL;
+        labels[static_cast<uint8_t>(Opcode::THREAD)] = &&op_THREAD;
+        
+        labels[static_cast<uint8_t>(Opcode::HALT)] = &&op_HALT;
+        
+        labels[static_cast<uint8_t>(FusedOpcode::LOADVAR)] = &&op_LOADVAR;
+        labels[static_cast<uint8_t>(FusedOpcode::STOREVAR)] = &&op_STOREVAR;
+        labels[static_cast<uint8_t>(FusedOpcode::ADDI)] = &&op_ADDI;
+        labels[static_cast<uint8_t>(FusedOpcode::SUBI)] = &&op_SUBI;
+        labels[static_cast<uint8_t>(FusedOpcode::PUSH_JZ)] = &&op_PUSH_JZ;
+        labels[static_cast<uint8_t>(FusedOpcode::DUP_JNZ)] = &&op_DUP_JNZ;
+        
+        // 스트림의 opcode 배열을 레이블 주소 배열로 변환 (kExitOpcode는 op_EXIT)
+        const uint8_t* opcodes = _stream.GetOpcodes();
+        _threadedHandlers.resize(_stream.GetCount());
+        for (size_t i = 0; i < _threadedHandlers.size(); ++i)
+        {
+            _threadedHandlers[i] = labels[opcodes[i]];
+        }
+        
+        _threadedHandlersValid = true;
+    }
+    
+    // 시작 주소가 명령어 경계가 아니면 처음부터 바이트 단위로 실행
+    uint32_t pc = _stream.GetIndex(_ip);
+    if (pc == InstructionStream::kNoIndex)
+    {
+        return _ExecuteBytecode();
+    }
+    
+    const void* const* handlers = _threadedHandlers.data();
+    const uint64_t* immediates = _stream.GetImmediates();
+    const uint32_t* targets = _stream.GetTargets();
+    const uint32_t* nextOffsets = _stream.GetNextOffsets();
+    
+// 다음 명령어 핸들러로 바로 점프 (중앙 디스패치 분기 없음)
+#define DMVM_DISPATCH() goto *handlers[pc]
+#define DMVM_NEXT() do { ++pc; goto *handlers[pc]; } while (0)
+#define DMVM_BRANCH() do { pc = targets[pc]; goto *handlers[pc]; } while (0)
+#define DMVM_SKIP(op) do { pc += GetFusedLength(FusedOpcode::op); goto *handlers[pc]; } while (0)
+
+    try
+    {
+        DMVM_DISPATCH();
+        
+    op_PUSH:
+        _memoryManager->PushStack(immediates[pc]);
+        DMVM_NEXT();
+    op_POP:
+        _Handle_POP();
+        DMVM_NEXT();
+    op_DUP:
+        _Handle_DUP();
+        DMVM_NEXT();
+    op_SWAP:
+        _Handle_SWAP();
+        DMVM_NEXT();
+        
+    op_ADD:
+        _Handle_ADD();
+        DMVM_NEXT();
+    op_SUB:
+        _Handle_SUB();
+        DMVM_NEXT();
+    op_MUL:
+        _Handle_MUL();
+        DMVM_NEXT();
+    op_DIV:
+        _Handle_DIV();
+        DMVM_NEXT();
+    op_MOD:
+        _Handle_MOD();
+        DMVM_NEXT();
+        
+    op_AND:
+        _Handle_AND();
+        DMVM_NEXT();
+    op_OR:
+        _Handle_OR();
+        DMVM_NEXT();
+    op_XOR:
+        _Handle_XOR();
+        DMVM_NEXT();
+    op_NOT:
+        _Handle_NOT();
+        DMVM_NEXT();
+    op_SHL:
+        _Handle_SHL();
+        DMVM_NEXT();
+    op_SHR:
+        _Handle_SHR();
+        DMVM_NEXT();
+        
+    op_LOAD8:
+        _Handle_LOAD8();
+        DMVM_NEXT();
+    op_LOAD16:
+        _Handle_LOAD16();
+        DMVM_NEXT();
+    op_LOAD32:
+        _Handle_LOAD32();
+        DMVM_NEXT();
+    op_LOAD64:
+        _Handle_LOAD64();
+        DMVM_NEXT();
+    op_STORE8:
+        _Handle_STORE8();
+        DMVM_NEXT();
+    op_STORE16:
+        _Handle_STORE16();
+        DMVM_NEXT();
+    op_STORE32:
+        _Handle_STORE32();
+        DMVM_NEXT();
+    op_STORE64:
+        _Handle_STORE64();
+        DMVM_NEXT();
+    op_MEMCPY:
+        _Handle_MEMCPY();
+        DMVM_NEXT();
+    op_MEMSET:
+        _Handle_MEMSET();
+        DMVM_NEXT();
+    op_MEMCMP:
+        _Handle_MEMCMP();
+        DMVM_NEXT();
+        
+    op_JMP:
+        DMVM_BRANCH();
+    op_JZ:
+        if (_memoryManager->PopStack() == 0)
+        {
+            DMVM_BRANCH();
+        }
+        DMVM_NEXT();
+    op_JNZ:
+        if (_memoryManager->PopStack() != 0)
+        {
+            DMVM_BRANCH();
+        }
+        DMVM_NEXT();
+    op_JG:
+        {
+            uint64_t b = _memoryManager->PopStack();
+            uint64_t a = _memoryManager->PopStack();
+            if (a > b)
+            {
+                DMVM_BRANCH();
+            }
+        }
+        DMVM_NEXT();
+    op_JL:
+        {
+            uint64_t b = _memoryManager->PopStack();
+            uint64_t a = _memoryManager->PopStack();
+            if (a < b)
+            {
+                DMVM_BRANCH();
+            }
+        }
+        DMVM_NEXT();
+    op_JGE:
+        {
+            uint64_t b = _memoryManager->PopStack();
+            uint64_t a = _memoryManager->PopStack();
+            if (a >= b)
+            {
+                DMVM_BRANCH();
+            }
+        }
+        DMVM_NEXT();
+    op_JLE:
+        {
+            uint64_t b = _memoryManager->PopStack();
+            uint64_t a = _memoryManager->PopStack();
+            if (a <= b)
+            {
+                DMVM_BRANCH();
+            }
+        }
+        DMVM_NEXT();
+        
+    op_CALL:
+        {
+            uint64_t targetAddress = _memoryManager->PopStack();
+            _ip = nextOffsets[pc];
+            _controlFlow.Call(_ip, static_cast<size_t>(targetAddress));
+            
+            uint32_t targetIndex = _stream.GetIndex(_ip);
+            if (targetIndex != InstructionStream::kNoIndex)
+            {
+                pc = targetIndex;
+                DMVM_DISPATCH();
+            }
+            
+            goto resume_bytecode;
+        }
+    op_RET:
+        {
+            _controlFlow.Ret(_ip, static_cast<uint8_t>(immediates[pc]));
+            
+            uint32_t returnIndex = _stream.GetIndex(_ip);
+            if (returnIndex != InstructionStream::kNoIndex)
+            {
+                pc = returnIndex;
+                DMVM_DISPATCH();
+            }
+            
+            goto resume_bytecode;
+        }
+    op_TAILCALL:
+        {
+            uint64_t targetAddress = _memoryManager->PopStack();
+            _controlFlow.TailCall(_ip, static_cast<size_t>(targetAddress),
+                                  static_cast<uint8_t>(immediates[pc]), static_cast<uint8_t>(immediates[pc] >> 8));
+            
+            uint32_t targetIndex = _stream.GetIndex(_ip);
+            if (targetIndex != InstructionStream::kNoIndex)
+            {
+                pc = targetIndex;
+                DMVM_DISPATCH();
+            }
+            
+            goto resume_bytecode;
+        }
+    op_LDLOC:
+        _memoryManager->PushStackSlot(_LocalAddress(static_cast<uint8_t>(immediates[pc])));
+        DMVM_NEXT();
+    op_STLOC:
+        _memoryManager->PopStackSlot(_LocalAddress(static_cast<uint8_t>(immediates[pc])));
+        DMVM_NEXT();
+    op_LDARG:
+        _memoryManager->PushStackSlot(_ArgumentAddress(static_cast<uint8_t>(immediates[pc])));
+        DMVM_NEXT();
+        
+    op_ALLOC:
+        _Handle_ALLOC();
+        DMVM_NEXT();
+    op_FREE:
+        _Handle_FREE();
+        DMVM_NEXT();
+    op_ARENA_BEGIN:
+        _Handle_ARENA_BEGIN();
+        DMVM_NEXT();
+    op_ARENA_ALLOC:
+        _Handle_ARENA_ALLOC();
+        DMVM_NEXT();
+    op_ARENA_RESET:
+        _Handle_ARENA_RESET();
+        DMVM_NEXT();
+        
+    op_HOSTCALL:
+        _HostCall(static_cast<uint8_t>(immediates[pc]));
+        DMVM_NEXT();
+    op_THREAD:
+        _Handle_THREAD();
+        DMVM_NEXT();
+        
+    op_HALT:
+        _Handle_HALT();
+        _ip = nextOffsets[pc];
+        return 0;
+        
+    op_LOADVAR:
+        _memoryManager->PushStack(_Load64(immediates[pc]));
+        DMVM_SKIP(LOADVAR);
+    op_STOREVAR:
+        _Store64(immediates[pc], _memoryManager->PopStack());
+        DMVM_SKIP(STOREVAR);
+    op_ADDI:
+        _memoryManager->PushStack(_memoryManager->PopStack() + immediates[pc]);
+        DMVM_SKIP(ADDI);
+    op_SUBI:
+        _memoryManager->PushStack(_memoryManager->PopStack() - immediates[pc]);
+        DMVM_SKIP(SUBI);
+    op_PUSH_JZ:
+        if (immediates[pc] == 0)
+        {
+            DMVM_BRANCH();
+        }
+        DMVM_SKIP(PUSH_JZ);
+    op_DUP_JNZ:
+        if (_memoryManager->PeekStack() != 0)
+        {
+            DMVM_BRANCH();
+        }
+        DMVM_SKIP(DUP_JNZ);
+        
+    op_EXIT:
+        _ip = static_cast<size_t>(immediates[pc]);
+        goto resume_bytecode;
+    }
+    catch (const Memory::MemoryAccessException& e)
+    {
+        _ip = nextOffsets[pc];
+        std::cerr << "메모리 접근 오류: " << e.what() << std::endl;
+        _running = false;
+
+        return -1;
+    }
+    catch (const std::exception& e)
+    {
+        _ip = nextOffsets[pc];
+        std::cerr << "VM 실행 오류: " << e.what() << std::endl;
+        _running = false;
+
+        return -1;
+    }
+
+#undef DMVM_DISPATCH
+#undef DMVM_NEXT
+#undef DMVM_BRANCH
+#undef DMVM_SKIP
+
+resume_bytecode:
+    return _ExecuteBytecode();
+#else
+    // computed goto를 지원하지 않는 컴파일러 (MSVC 등)
+    return _ExecutePortable();
+#endif
+}
+
+} // namespace Engine
+} // namespace DarkMatterVM
@@ -0,0 +1,153 @@
+#include "Interpreter.h"
+#include <chrono>
+#include <iostream>
+
+namespace DarkMatterVM {
+namespace Engine {
+
+namespace {
+
+uint64_t ElapsedNanoseconds(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+} // namespace
+
+void Interpreter::SetTierUpThresholds(uint32_t backEdgeThreshold, uint32_t callThreshold)
+{
+    _tieringStats.backEdgeThreshold = backEdgeThreshold;
+    _tieringStats.callThreshold = callThreshold;
+}
+
+void Interpreter::ResetTieringStats()
+{
+    _tieringStats.tierUpCount = 0;
+    _tieringStats.jitEntryCount = 0;
+    _tieringStats.interpreterNanoseconds = 0;
+    _tieringStats.jitNanoseconds = 0;
+}
+
+void Interpreter::_CountHotSpot(size_t offset, uint32_t threshold)
+{
+    if (offset >= _hotCounters.size())
+    {
+        return;
+    }
+
+    // 기준에 도달한 뒤로는 더 세지 않음 (컴파일할 수 없는 지점도 한 번만 시도)
+    uint32_t& counter = _hotCounters[offset];
+    if (counter >= threshold || ++counter < threshold)
+    {
+        return;
+    }
+
+    if (_tieredJit.GetEntry(offset) == nullptr && _tieredJit.CompileRegion(offset))
+    {
+        _tieringStats.tierUpCount++;
+    }
+}
+
+int Interpreter::_ExecuteTiered()
+{
+    // 기계어는 힙이 기본 주소에 있다고 가정하고 가상 주소를 변환함
+    if (_heapVirtualBase != JitCompiler::kHeapVirtualBase)
+    {
+        return _ExecutePortable();
+    }
+
+    if (!_tieredJitValid)
+    {
+        if (!_tieredJit.Prepare(_codeSegment->GetData(), _codeSize))
+        {
+            return _ExecutePortable();
+        }
+
+        _hotCounters.assign(_codeSize + 1, 0);
+        ResetTieringStats();
+        _tieredJitValid = true;
+    }
+
+    auto& stackSegment = *_stackSegment;
+    auto& heapSegment = *_heapSegment;
+    JitState state = JitCompiler::CreateState(stackSegment.GetData(), stackSegment.GetSize(),
+                                              heapSegment.GetData(), heapSegment.GetSize());
+
+    // 기계어는 세그먼트에 직접 쓰므로 재사용 시 전체를 지우도록 표시
+    stackSegment.MarkDirty(0, stackSegment.GetSize());
+    heapSegment.MarkDirty(0, heapSegment.GetSize());
+
+    const auto startTime = std::chrono::steady_clock::now();
+    uint64_t jitNanoseconds = 0;
+
+    // 인터프리터 시간은 전체에서 기계어 시간을 빼서 계산
+    auto recordTime = [&]()
+    {
+        uint64_t total = ElapsedNanoseconds(startTime, std::chrono::steady_clock::now());
+        _tieringStats.jitNanoseconds += jitNanoseconds;
+        _tieringStats.interpreterNanoseconds += total > jitNanoseconds ? total - jitNanoseconds : 0;
+    };
+
+    try
+    {
+        while (_running)
+        {
+            // 컴파일된 블록 시작이면 기계어로 실행 (티어 1)
+            JitEntry entry = _tieredJit.GetEntry(_ip);
+            if (entry != nullptr)
+            {
+                // ALLOC이 힙을 늘렸으면 기계어가 보는 힙 범위도 갱신
+                if (state.heapSize != heapSegment.GetSize() || state.heapBase != heapSegment.GetData())
+                {
+                    JitCompiler::SetHeap(state, heapSegment.GetData(), heapSegment.GetSize());
+                    heapSegment.MarkDirty(0, heapSegment.GetSize());
+                }
+                auto nativeStart = std::chrono::steady_clock::now();
+                state.stackPointer = _memoryManager->GetStackPointer();
+                _ip = entry(&state);
+                _memoryManager->SetStackPointer(static_cast<size_t>(state.stackPointer));
+                jitNanoseconds += ElapsedNanoseconds(nativeStart, std::chrono::steady_clock::now());
+                _tieringStats.jitEntryCount++;
+            }
+
+            // 티어 0: 명령어 하나를 실행하고 뒤로 가는 분기와 호출 목적지를 셈
+            size_t instructionStart = _ip;
+            uint8_t opcode = _FetchByte();
+            (this->*_dispatchTable[opcode])();
+
+            if (opcode >= static_cast<uint8_t>(Opcode::JMP) && opcode <= static_cast<uint8_t>(Opcode::JLE))
+            {
+                if (_ip < instructionStart)
+                {
+                    _CountHotSpot(_ip, _tieringStats.backEdgeThreshold);
+                }
+            }
+            else if (opcode == static_cast<uint8_t>(Opcode::CALL) || opcode == static_cast<uint8_t>(Opcode::TAILCALL))
+            {
+                _CountHotSpot(_ip, _tieringStats.callThreshold);
+            }
+        }
+    }
+    catch (const Memory::MemoryAccessException& e)
+    {
+        std::cerr << "메모리 접근 오류: " << e.what() << std::endl;
+        _running = false;
+        recordTime();
+
+        return -1;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "VM 실행 오류: " << e.what() << std::endl;
+        _running = false;
+        recordTime();
+
+        return -1;
+    }
+
+    recordTime();
+    return 0;
+}
+
+} // namespace Engine
+} // namespace DarkMatterVM
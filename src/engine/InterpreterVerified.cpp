@@ -0,0 +1,583 @@
+#include "Interpreter.h"
+#include <atomic>
+#include <cstring>
+#include <iostream>
+#include <utility>
+
+namespace DarkMatterVM {
+namespace Engine {
+
+bool Interpreter::IsStackGuarded() const
+{
+    // 설정을 먼저 확인 (CanGuard()는 처음 호출될 때 SIGSEGV 처리기를 등록)
+    return _stackGuardEnabled && _verifier.IsVerified() && !_verifier.HasHostCalls() &&
+           Memory::StackGuard::CanGuard(*_stackSegment);
+}
+
+int Interpreter::_ExecuteVerified()
+{
+    auto& stackSegment = *_stackSegment;
+
+    // 진입 시 한 번만 스택 범위 확인: 인자가 부족하거나 최대 증가량만큼 공간이 없으면 검사하는 루프로
+    const size_t stackPointer = _memoryManager->GetStackPointer();
+    const size_t slotCount = stackSegment.GetSize() / sizeof(uint64_t);
+    const size_t entryDepth = (stackSegment.GetSize() - stackPointer) / sizeof(uint64_t);
+    if (!_verificationEnabled || _ip != 0 || !_verifier.IsVerified() ||
+        stackPointer % sizeof(uint64_t) != 0 || stackSegment.GetSize() % sizeof(uint64_t) != 0 ||
+        entryDepth < _verifier.GetRequiredEntryDepth() ||
+        slotCount - entryDepth < _verifier.GetMaxStackGrowth())
+    {
+        // 가드 페이지가 있으면 범위를 증명하지 못해도 폴트로 감지하며 같은 루프로 실행 (검증 기준인 0번지 진입만)
+        if (_ip == 0 && IsStackGuarded() && stackPointer % sizeof(uint64_t) == 0)
+        {
+            return _ExecuteGuarded();
+        }
+        if (IsThreadedDispatchSupported() && _executionMode == ExecutionMode::Threaded)
+        {
+            return _ExecuteThreaded();
+        }
+        return _ExecutePortable();
+    }
+
+    return _ExecuteUnchecked<false>();
+}
+
+int Interpreter::_ExecuteGuarded()
+{
+    auto& stackSegment = *_stackSegment;
+
+    {
+        Memory::StackGuard guard(stackSegment);
+        if (!DMVM_STACK_GUARD_FAULTED(guard))
+        {
+            return _ExecuteUnchecked<true>();
+        }
+        _lastStackFault = guard.GetFault();
+    }
+
+    // 폴트를 일으킨 명령어의 바이트코드 오프셋
+    const uint32_t pc = _guardPc;
+    _lastStackFault.ip = 0;
+    for (size_t offset = _stream.GetNextOffsets()[pc]; offset-- > 0; )
+    {
+        if (_stream.GetIndex(offset) == pc)
+        {
+            _lastStackFault.ip = offset;
+            break;
+        }
+    }
+    _stackFaultCount++;
+
+    // 명령어 시작 시점 스택 포인터로 되돌림 (스택 연산은 피연산자를 모두 읽은 뒤에 쓰므로 그 명령어는 아무것도 바꾸지 않았음)
+    // 어디까지 썼는지 알 수 없으므로 스택 전체를 쓰인 것으로 표시
+    stackSegment.MarkDirty(0, stackSegment.GetSize());
+    _memoryManager->SetStackPointer(_guardStackPointer);
+
+    // 같은 명령어를 검사하는 핸들러로 다시 실행해 일반 루프와 같은 스택 상태와 오류로 끝냄
+    _ip = _lastStackFault.ip;
+    return _ExecuteBytecode();
+}
+
+template<bool Guarded>
+int Interpreter::_ExecuteUnchecked()
+{
+    auto& stackSegment = *_stackSegment;
+    auto& heapSegment = *_heapSegment;
+    const size_t stackPointer = _memoryManager->GetStackPointer();
+
+    uint32_t pc = _stream.GetIndex(_ip);
+    if (pc == InstructionStream::kNoIndex)
+    {
+        return _ExecuteBytecode();
+    }
+
+    // 스택 포인터를 직접 옮기므로 닿을 수 있는 구간을 미리 쓰인 것으로 표시 (Guarded는 스택 포인터를 맞출 때 표시)
+    if (!Guarded)
+    {
+        const size_t growthBytes = _verifier.GetMaxStackGrowth() * sizeof(uint64_t);
+        stackSegment.MarkDirty(stackPointer - growthBytes, growthBytes);
+    }
+
+    const uint8_t* opcodes = _stream.GetOpcodes();
+    const uint64_t* immediates = _stream.GetImmediates();
+    const uint32_t* targets = _stream.GetTargets();
+    const uint32_t* nextOffsets = _stream.GetNextOffsets();
+
+    // 스택은 아래로 자라므로 sp[0]이 최상위, sp[1]이 그 아래
+    uint8_t* stackBase = stackSegment.GetData();
+    uint64_t* const stackEnd = reinterpret_cast<uint64_t*>(stackBase + stackSegment.GetSize());
+    uint64_t* sp = reinterpret_cast<uint64_t*>(stackBase + stackPointer);
+
+    // 힙 접근은 범위 비교 한 번, 벗어나면 검사하는 접근자로 같은 예외를 발생시킴
+    const bool heapAccessible = heapSegment.HasAccess(Memory::MemoryAccessFlags::READ) &&
+                                heapSegment.HasAccess(Memory::MemoryAccessFlags::WRITE);
+    uint8_t* heap = heapSegment.GetData();
+    uint64_t heapSize = heapAccessible ? heapSegment.GetSize() : 0;
+    Memory::ArenaMemory& arena = _memoryManager->GetArenaMemory();
+
+    // Guarded: 명령어 시작 시점의 가장 낮은 스택 포인터 (한 명령어는 최대 한 슬롯만 늘림)
+    uint64_t* lowWater = sp;
+
+    auto syncStack = [&]()
+    {
+        if (Guarded)
+        {
+            uint64_t* low = (sp < lowWater ? sp : lowWater) - 1;
+            size_t begin = low < reinterpret_cast<uint64_t*>(stackBase) ? 0 :
+                           static_cast<size_t>(reinterpret_cast<uint8_t*>(low) - stackBase);
+            stackSegment.MarkDirty(begin, stackSegment.GetSize() - begin);
+        }
+        _memoryManager->SetStackPointer(static_cast<size_t>(reinterpret_cast<uint8_t*>(sp) - stackBase));
+    };
+    auto reloadStack = [&]()
+    {
+        sp = reinterpret_cast<uint64_t*>(stackBase + _memoryManager->GetStackPointer());
+    };
+
+    try
+    {
+        while (true)
+        {
+            if (Guarded)
+            {
+                // 폴트 처리기가 읽을 수 있도록 다음 명령어의 스택 접근보다 먼저 기록
+                _guardPc = pc;
+                _guardStackPointer = static_cast<size_t>(reinterpret_cast<uint8_t*>(sp) - stackBase);
+                std::atomic_signal_fence(std::memory_order_seq_cst);
+                lowWater = sp < lowWater ? sp : lowWater;
+            }
+
+            // 스트림 opcode는 Opcode와 FusedOpcode 값을 함께 쓰므로 원래 바이트 값으로 분기
+            switch (opcodes[pc])
+            {
+                case static_cast<uint8_t>(Opcode::PUSH8):
+                case static_cast<uint8_t>(Opcode::PUSH16):
+                case static_cast<uint8_t>(Opcode::PUSH32):
+                case static_cast<uint8_t>(Opcode::PUSH64):
+                    *--sp = immediates[pc];
+                    break;
+                case static_cast<uint8_t>(Opcode::POP):
+                    // 빈 스택에서 꺼내면 가드 페이지에 닿도록 읽고 버림
+                    static_cast<void>(*static_cast<volatile const uint64_t*>(sp));
+                    ++sp;
+                    break;
+                case static_cast<uint8_t>(Opcode::DUP):       --sp; sp[0] = sp[1]; break;
+                case static_cast<uint8_t>(Opcode::SWAP):      std::swap(sp[0], sp[1]); break;
+
+                case static_cast<uint8_t>(Opcode::ADD):       sp[1] = sp[1] + sp[0]; ++sp; break;
+                case static_cast<uint8_t>(Opcode::SUB):       sp[1] = sp[1] - sp[0]; ++sp; break;
+                case static_cast<uint8_t>(Opcode::MUL):       sp[1] = sp[1] * sp[0]; ++sp; break;
+                case static_cast<uint8_t>(Opcode::DIV):
+                case static_cast<uint8_t>(Opcode::MOD):
+                {
+                    uint64_t b = sp[0];
+                    uint64_t a = sp[1];
+                    sp += 2;
+                    if (b == 0)
+                    {
+                        throw std::runtime_error(static_cast<Opcode>(opcodes[pc]) == Opcode::DIV ?
+                            "0으로 나누기 시도" : "0으로 나누기 시도 (나머지 연산)");
+                    }
+                    *--sp = static_cast<Opcode>(opcodes[pc]) == Opcode::DIV ? a / b : a % b;
+                    break;
+                }
+
+                case static_cast<uint8_t>(Opcode::AND):       sp[1] = sp[1] & sp[0]; ++sp; break;
+                case static_cast<uint8_t>(Opcode::OR):        sp[1] = sp[1] | sp[0]; ++sp; break;
+                case static_cast<uint8_t>(Opcode::XOR):       sp[1] = sp[1] ^ sp[0]; ++sp; break;
+                case static_cast<uint8_t>(Opcode::NOT):       sp[0] = ~sp[0]; break;
+                case static_cast<uint8_t>(Opcode::SHL):       sp[1] = sp[0] >= 64 ? 0 : sp[1] << sp[0]; ++sp; break;
+                case static_cast<uint8_t>(Opcode::SHR):       sp[1] = sp[0] >= 64 ? 0 : sp[1] >> sp[0]; ++sp; break;
+
+                case static_cast<uint8_t>(Opcode::LOAD8):
+                case static_cast<uint8_t>(Opcode::LOAD16):
+                case static_cast<uint8_t>(Opcode::LOAD32):
+                {
+                    Opcode op = static_cast<Opcode>(opcodes[pc]);
+                    size_t width = op == Opcode::LOAD8 ? 1 : op == Opcode::LOAD16 ? 2 : 4;
+                    uint64_t address = *sp++;
+                    uint32_t value = 0;
+                    if (address < heapSize && address + width <= heapSize)
+                    {
+                        std::memcpy(&value, heap + address, width);
+                    }
+                    else
+                    {
+                        syncStack();
+                        heapSegment.Read(static_cast<size_t>(address), width, &value);
+                    }
+                    *--sp = value;
+                    break;
+                }
+                case static_cast<uint8_t>(Opcode::STORE8):
+                case static_cast<uint8_t>(Opcode::STORE16):
+                case static_cast<uint8_t>(Opcode::STORE32):
+                {
+                    Opcode op = static_cast<Opcode>(opcodes[pc]);
+                    size_t width = op == Opcode::STORE8 ? 1 : op == Opcode::STORE16 ? 2 : 4;
+                    uint32_t value = static_cast<uint32_t>(sp[0]);
+                    uint64_t address = sp[1];
+                    sp += 2;
+                    if (address < heapSize && address + width <= heapSize)
+                    {
+                        std::memcpy(heap + address, &value, width);
+                        heapSegment.MarkDirty(static_cast<size_t>(address), width);
+                    }
+                    else
+                    {
+                        syncStack();
+                        heapSegment.Write(static_cast<size_t>(address), width, &value);
+                    }
+                    break;
+                }
+                case static_cast<uint8_t>(Opcode::LOAD64):
+                {
+                    uint64_t offset = sp[0] - _heapVirtualBase;
+                    if (offset < heapSize && offset + 8 <= heapSize)
+                    {
+                        std::memcpy(sp, heap + offset, sizeof(uint64_t));
+                    }
+                    else
+                    {
+                        uint64_t address = *sp++;
+                        syncStack();
+                        uint64_t value = _Load64(address);
+                        *--sp = value;
+                    }
+                    break;
+                }
+                case static_cast<uint8_t>(Opcode::STORE64):
+                {
+                    uint64_t value = sp[0];
+                    uint64_t address = sp[1];
+                    sp += 2;
+                    uint64_t offset = address - _heapVirtualBase;
+                    if (offset < heapSize && offset + 8 <= heapSize)
+                    {
+                        std::memcpy(heap + offset, &value, sizeof(uint64_t));
+                        heapSegment.MarkDirty(static_cast<size_t>(offset), sizeof(uint64_t));
+                    }
+                    else
+                    {
+                        syncStack();
+                        _Store64(address, value);
+                    }
+                    break;
+                }
+
+                // 블록 연산: 구간 검사 한 번 후 memmove/memset/memcmp (스택 세그먼트도 대상이 될 수 있어 먼저 맞춤)
+                case static_cast<uint8_t>(Opcode::MEMCPY):
+                {
+                    uint64_t size = sp[0];
+                    uint64_t source = sp[1];
+                    uint64_t destination = sp[2];
+                    sp += 3;
+                    syncStack();
+                    _memoryManager->CopyMemory(static_cast<size_t>(destination), static_cast<size_t>(source),
+                                               static_cast<size_t>(size));
+                    break;
+                }
+                case static_cast<uint8_t>(Opcode::MEMSET):
+                {
+                    uint64_t size = sp[0];
+                    uint64_t value = sp[1];
+                    uint64_t destination = sp[2];
+                    sp += 3;
+                    syncStack();
+                    _memoryManager->FillMemory(static_cast<size_t>(destination), static_cast<uint8_t>(value),
+                                               static_cast<size_t>(size));
+                    break;
+                }
+                case static_cast<uint8_t>(Opcode::MEMCMP):
+                {
+                    uint64_t size = sp[0];
+                    uint64_t second = sp[1];
+                    uint64_t first = sp[2];
+                    sp += 3;
+                    syncStack();
+                    int result = _memoryManager->CompareMemory(static_cast<size_t>(first), static_cast<size_t>(second),
+                                                               static_cast<size_t>(size));
+                    *--sp = static_cast<uint64_t>(static_cast<int64_t>(result));
+                    break;
+                }
+
+                case static_cast<uint8_t>(Opcode::JMP):
+                    pc = targets[pc];
+                    continue;
+                case static_cast<uint8_t>(Opcode::JZ):
+                    if (*sp++ == 0)
+                    {
+                        pc = targets[pc];
+                        continue;
+                    }
+                    break;
+                case static_cast<uint8_t>(Opcode::JNZ):
+                    if (*sp++ != 0)
+                    {
+                        pc = targets[pc];
+                        continue;
+                    }
+                    break;
+                case static_cast<uint8_t>(Opcode::JG):
+                case static_cast<uint8_t>(Opcode::JL):
+                case static_cast<uint8_t>(Opcode::JGE):
+                case static_cast<uint8_t>(Opcode::JLE):
+                {
+                    uint64_t b = sp[0];
+                    uint64_t a = sp[1];
+                    sp += 2;
+
+                    bool taken = false;
+                    switch (static_cast<Opcode>(opcodes[pc]))
+                    {
+                        case Opcode::JG:    taken = a > b; break;
+                        case Opcode::JL:    taken = a < b; break;
+                        case Opcode::JGE:   taken = a >= b; break;
+                        default:            taken = a <= b; break;
+                    }
+
+                    if (taken)
+                    {
+                        pc = targets[pc];
+                        continue;
+                    }
+                    break;
+                }
+
+                // 동적 목적지 (검증된 코드에는 없음): 프레임은 ControlFlowManager가 만들고, 명령어 경계가 아니면 바이트 단위 실행으로 전환
+                case static_cast<uint8_t>(Opcode::CALL):
+                {
+                    uint64_t targetAddress = *sp++;
+                    syncStack();
+                    _ip = nextOffsets[pc];
+                    _controlFlow.Call(_ip, static_cast<size_t>(targetAddress));
+
+                    uint32_t targetIndex = _stream.GetIndex(_ip);
+                    if (targetIndex == InstructionStream::kNoIndex)
+                    {
+                        return _ExecuteBytecode();
+                    }
+
+                    pc = targetIndex;
+                    continue;
+                }
+                case static_cast<uint8_t>(Opcode::RET):
+                {
+                    syncStack();
+                    _controlFlow.Ret(_ip, static_cast<uint8_t>(immediates[pc]));
+                    reloadStack();
+
+                    uint32_t returnIndex = _stream.GetIndex(_ip);
+                    if (returnIndex == InstructionStream::kNoIndex)
+                    {
+                        return _ExecuteBytecode();
+                    }
+
+                    pc = returnIndex;
+                    continue;
+                }
+                case static_cast<uint8_t>(Opcode::TAILCALL):
+                {
+                    uint64_t targetAddress = *sp++;
+                    syncStack();
+                    _controlFlow.TailCall(_ip, static_cast<size_t>(targetAddress),
+                                          static_cast<uint8_t>(immediates[pc]), static_cast<uint8_t>(immediates[pc] >> 8));
+                    reloadStack();
+
+                    uint32_t targetIndex = _stream.GetIndex(_ip);
+                    if (targetIndex == InstructionStream::kNoIndex)
+                    {
+                        return _ExecuteBytecode();
+                    }
+
+                    pc = targetIndex;
+                    continue;
+                }
+
+                // 프레임 슬롯이 현재 스택 포인터와 스택 끝 사이면 직접 접근, 아니면 검사하는 접근자로 같은 예외를 발생시킴
+                case static_cast<uint8_t>(Opcode::LDLOC):
+                case static_cast<uint8_t>(Opcode::LDARG):
+                {
+                    const uint8_t index = static_cast<uint8_t>(immediates[pc]);
+                    const size_t address = static_cast<Opcode>(opcodes[pc]) == Opcode::LDLOC ?
+                                           _LocalAddress(index) : _ArgumentAddress(index);
+                    const size_t top = static_cast<size_t>(reinterpret_cast<uint8_t*>(sp) - stackBase);
+                    uint64_t value;
+                    if (address >= top && address < stackSegment.GetSize() && stackSegment.GetSize() - address >= sizeof(uint64_t))
+                    {
+                        value = *reinterpret_cast<const uint64_t*>(stackBase + address);
+                    }
+                    else
+                    {
+                        syncStack();
+                        value = _memoryManager->ReadStackSlot(address);
+                    }
+                    *--sp = value;
+                    break;
+                }
+                case static_cast<uint8_t>(Opcode::STLOC):
+                {
+                    const size_t address = _LocalAddress(static_cast<uint8_t>(immediates[pc]));
+                    uint64_t value = *sp++;
+                    const size_t top = static_cast<size_t>(reinterpret_cast<uint8_t*>(sp) - stackBase);
+                    if (address >= top && address < stackSegment.GetSize() && stackSegment.GetSize() - address >= sizeof(uint64_t))
+                    {
+                        *reinterpret_cast<uint64_t*>(stackBase + address) = value;
+                    }
+                    else
+                    {
+                        syncStack();
+                        _memoryManager->WriteStackSlot(address, value);
+                    }
+                    break;
+                }
+
+                // 스택/힙 관리자를 거치는 명령어는 스택 포인터를 맞춘 뒤 호출
+                case static_cast<uint8_t>(Opcode::ALLOC):
+                {
+                    uint64_t size = *sp++;
+                    syncStack();
+                    *--sp = _memoryManager->Allocate(static_cast<size_t>(size));
+
+                    // 할당하면서 힙이 늘었을 수 있음 (예약을 넘으면 데이터 포인터도 바뀜)
+                    heap = heapSegment.GetData();
+                    heapSize = heapAccessible ? heapSegment.GetSize() : 0;
+                    break;
+                }
+                case static_cast<uint8_t>(Opcode::FREE):
+                {
+                    uint64_t address = *sp++;
+                    syncStack();
+                    _memoryManager->Free(static_cast<size_t>(address));
+                    break;
+                }
+                case static_cast<uint8_t>(Opcode::ARENA_BEGIN):
+                    arena.Begin();
+                    break;
+                case static_cast<uint8_t>(Opcode::ARENA_ALLOC):
+                {
+                    // 크기를 먼저 꺼냄 (할당 오류 시 스택 상태가 일반 루프와 같도록)
+                    uint64_t size = *sp++;
+                    *--sp = arena.Allocate(static_cast<size_t>(size));
+
+                    // 새 청크를 받으면 힙이 늘었을 수 있음
+                    heap = heapSegment.GetData();
+                    heapSize = heapAccessible ? heapSegment.GetSize() : 0;
+                    break;
+                }
+                case static_cast<uint8_t>(Opcode::ARENA_RESET):
+                    arena.Reset();
+                    break;
+                case static_cast<uint8_t>(Opcode::HOSTCALL):
+                    syncStack();
+                    _HostCall(static_cast<uint8_t>(immediates[pc]));
+                    reloadStack();
+                    break;
+                case static_cast<uint8_t>(Opcode::THREAD):
+                    syncStack();
+                    _Handle_THREAD();
+                    reloadStack();
+                    break;
+
+                case static_cast<uint8_t>(Opcode::HALT):
+                    if (sp < stackEnd)
+                    {
+                        _returnValue = *sp++;
+                    }
+                    syncStack();
+                    _running = false;
+                    _ip = nextOffsets[pc];
+                    return 0;
+
+                // 슈퍼명령어: 폴스루 시 묶인 명령어 수만큼 건너뜀
+                case static_cast<uint8_t>(FusedOpcode::LOADVAR):
+                {
+                    uint64_t offset = immediates[pc] - _heapVirtualBase;
+                    uint64_t value;
+                    if (offset < heapSize && offset + 8 <= heapSize)
+                    {
+                        std::memcpy(&value, heap + offset, sizeof(uint64_t));
+                    }
+                    else
+                    {
+                        syncStack();
+                        value = _Load64(immediates[pc]);
+                    }
+                    *--sp = value;
+                    pc += GetFusedLength(FusedOpcode::LOADVAR);
+                    continue;
+                }
+                case static_cast<uint8_t>(FusedOpcode::STOREVAR):
+                {
+                    uint64_t value = *sp++;
+                    uint64_t offset = immediates[pc] - _heapVirtualBase;
+                    if (offset < heapSize && offset + 8 <= heapSize)
+                    {
+                        std::memcpy(heap + offset, &value, sizeof(uint64_t));
+                        heapSegment.MarkDirty(static_cast<size_t>(offset), sizeof(uint64_t));
+                    }
+                    else
+                    {
+                        syncStack();
+                        _Store64(immediates[pc], value);
+                    }
+                    pc += GetFusedLength(FusedOpcode::STOREVAR);
+                    continue;
+                }
+                case static_cast<uint8_t>(FusedOpcode::ADDI):
+                    sp[0] += immediates[pc];
+                    pc += GetFusedLength(FusedOpcode::ADDI);
+                    continue;
+                case static_cast<uint8_t>(FusedOpcode::SUBI):
+                    sp[0] -= immediates[pc];
+                    pc += GetFusedLength(FusedOpcode::SUBI);
+                    continue;
+                case static_cast<uint8_t>(FusedOpcode::PUSH_JZ):
+                    if (immediates[pc] == 0)
+                    {
+                        pc = targets[pc];
+                        continue;
+                    }
+                    pc += GetFusedLength(FusedOpcode::PUSH_JZ);
+                    continue;
+                case static_cast<uint8_t>(FusedOpcode::DUP_JNZ):
+                    if (sp[0] != 0)
+                    {
+                        pc = targets[pc];
+                        continue;
+                    }
+                    pc += GetFusedLength(FusedOpcode::DUP_JNZ);
+                    continue;
+
+                // InstructionStream::kExitOpcode (검증된 코드는 명령어 경계로만 분기하므로 Guarded일 때만 도달)
+                default:
+                    syncStack();
+                    _ip = static_cast<size_t>(immediates[pc]);
+                    return _ExecuteBytecode();
+            }
+
+            ++pc;
+        }
+    }
+    catch (const Memory::MemoryAccessException& e)
+    {
+        syncStack();
+        _ip = nextOffsets[pc];
+        std::cerr << "메모리 접근 오류: " << e.what() << std::endl;
+        _running = false;
+
+        return -1;
+    }
+    catch (const std::exception& e)
+    {
+        syncStack();
+        _ip = nextOffsets[pc];
+        std::cerr << "VM 실행 오류: " << e.what() << std::endl;
+        _running = false;
+
+        return -1;
+    }
+}
+
+} // namespace Engine
+} // namespace DarkMatterVM
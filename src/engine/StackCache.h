@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstdint>
+#include <memory/MemoryManager.h>
+
+namespace DarkMatterVM {
+namespace Engine {
+
+/**
+ * @brief 스택 최상위 두 슬롯을 지역 변수에 보관하는 캐시
+ *
+ * 논리적 스택 = VM 스택 메모리 ... | second | top
+ * 캐시가 비어 있을 때만 VM 스택에 접근하고, 가득 찬 상태에서 푸시하면 second만 내려 씀
+ * 루프 밖의 코드(핸들러, 호스트 함수, HALT)가 스택을 보기 전에 반드시 Flush() 호출
+ */
+class StackCache
+{
+public:
+    explicit StackCache(Memory::MemoryManager& memoryManager)
+        : _memoryManager(memoryManager)
+    {
+    }
+
+    /**
+     * @brief 캐시에 들어 있는 슬롯 수 (0~2)
+     */
+    uint32_t GetCachedCount() const { return _count; }
+
+    void Push(uint64_t value)
+    {
+        if (_count == 2)
+        {
+            _memoryManager.PushStack(_second);
+        }
+        else
+        {
+            ++_count;
+        }
+
+        _second = _top;
+        _top = value;
+    }
+
+    uint64_t Pop()
+    {
+        if (_count == 0)
+        {
+            return _memoryManager.PopStack();
+        }
+
+        uint64_t value = _top;
+        _top = _second;
+        --_count;
+
+        return value;
+    }
+
+    /**
+     * @brief 최상위 슬롯 참조 (비어 있으면 VM 스택에서 하나 채움)
+     *
+     * 단항/이항 연산 결과를 제자리에 쓰는 용도
+     */
+    uint64_t& Top()
+    {
+        if (_count == 0)
+        {
+            _top = _memoryManager.PopStack();
+            _count = 1;
+        }
+
+        return _top;
+    }
+
+    /**
+     * @brief 캐시된 슬롯을 VM 스택에 순서대로 기록하고 캐시 비움
+     */
+    void Flush()
+    {
+        if (_count == 2)
+        {
+            _memoryManager.PushStack(_second);
+        }
+        if (_count >= 1)
+        {
+            _memoryManager.PushStack(_top);
+        }
+
+        _count = 0;
+    }
+
+    /**
+     * @brief 오류 처리 경로용 Flush (스택 오버플로 등으로 기록 실패 시 false)
+     */
+    bool TryFlush() noexcept
+    {
+        try
+        {
+            Flush();
+            return true;
+        }
+        catch (...)
+        {
+            return false;
+        }
+    }
+
+private:
+    Memory::MemoryManager& _memoryManager;
+    uint64_t _top = 0;
+    uint64_t _second = 0;
+    uint32_t _count = 0;
+};
+
+} // namespace Engine
+} // namespace DarkMatterVM
@@ -0,0 +1,177 @@
+#include "InstructionStream.h"
+#include <cstring>
+
+namespace DarkMatterVM 
+{
+namespace Engine 
+{
+
+void InstructionStream::Decode(const uint8_t* code, size_t size, bool fuseSuperinstructions)
+{
+    Clear();
+    
+    _codeSize = size;
+    _indexByOffset.assign(size + 1, kNoIndex);
+    
+    // 1) 선형 디코딩
+    size_t offset = 0;
+    while (offset < size)
+    {
+        uint8_t opcode = code[offset];
+        if (!_IsDefined(opcode))
+        {
+            break;
+        }
+        
+        size_t instructionSize = _decoder.GetInstructionSize(static_cast<Opcode>(opcode));
+        if (offset + instructionSize > size)
+        {
+            break;
+        }
+        
+        uint64_t immediate = 0;
+        if (instructionSize > 1)
+        {
+            immediate = _decoder.DecodeOperand(code + offset + 1, instructionSize - 1);
+        }
+        
+        _indexByOffset[offset] = _Append(opcode, immediate, offset + instructionSize);
+        offset += instructionSize;
+    }
+    
+    // 디코딩이 멈춘 지점부터는 바이트 단위 실행 (잘못된 opcode 트랩 포함)
+    _indexByOffset[offset] = _Append(kExitOpcode, offset, offset);
+    
+    // 2) 상대 분기를 절대 오프셋/명령어 인덱스로 변환
+    size_t decodedCount = _opcodes.size() - 1;
+    for (size_t i = 0; i < decodedCount; ++i)
+    {
+        if (!_IsRelativeJump(static_cast<Opcode>(_opcodes[i])))
+        {
+            continue;
+        }
+        
+        int16_t relative = static_cast<int16_t>(_immediates[i]);
+        size_t targetOffset = _nextOffsets[i] + relative;
+        _immediates[i] = targetOffset;
+        
+        uint32_t targetIndex = GetIndex(targetOffset);
+        if (targetIndex == kNoIndex)
+        {
+            // 명령어 중간으로의 분기: 그 지점부터 바이트 단위 실행
+            targetIndex = _Append(kExitOpcode, targetOffset, targetOffset);
+        }
+        
+        _targets[i] = targetIndex;
+    }
+    
+    // 3) 슈퍼명령어 합치기 (분기 목적지 변환 후에 수행)
+    if (fuseSuperinstructions)
+    {
+        _FuseSuperinstructions(decodedCount);
+    }
+}
+
+void InstructionStream::_FuseSuperinstructions(size_t count)
+{
+    auto opcodeAt = [this, count](size_t i) -> int
+    {
+        return i < count ? _opcodes[i] : -1;
+    };
+    
+    // 앞에서부터 순서대로 첫 명령어 자리만 덮어쓰므로 뒤쪽 패턴 검사는 항상 원래 opcode를 봄
+    for (size_t i = 0; i < count; ++i)
+    {
+        int first = _opcodes[i];
+        int second = opcodeAt(i + 1);
+        
+        if (_IsPush(static_cast<uint8_t>(first)))
+        {
+            if (second == static_cast<int>(Opcode::LOAD64))
+            {
+                _Fuse(i, FusedOpcode::LOADVAR);
+            }
+            else if (second == static_cast<int>(Opcode::SWAP) && opcodeAt(i + 2) == static_cast<int>(Opcode::STORE64))
+            {
+                _Fuse(i, FusedOpcode::STOREVAR);
+            }
+            else if (second == static_cast<int>(Opcode::ADD))
+            {
+                _Fuse(i, FusedOpcode::ADDI);
+            }
+            else if (second == static_cast<int>(Opcode::SUB))
+            {
+                _Fuse(i, FusedOpcode::SUBI);
+            }
+            else if (second == static_cast<int>(Opcode::JZ))
+            {
+                _Fuse(i, FusedOpcode::PUSH_JZ);
+            }
+        }
+        else if (first == static_cast<int>(Opcode::DUP) && second == static_cast<int>(Opcode::JNZ))
+        {
+            _Fuse(i, FusedOpcode::DUP_JNZ);
+        }
+    }
+}
+
+void InstructionStream::_Fuse(size_t i, FusedOpcode op)
+{
+    size_t last = i + GetFusedLength(op) - 1;
+    
+    _opcodes[i] = static_cast<uint8_t>(op);
+    _targets[i] = _targets[last];
+    _nextOffsets[i] = _nextOffsets[last];
+}
+
+void InstructionStream::Clear()
+{
+    _opcodes.clear();
+    _immediates.clear();
+    _targets.clear();
+    _nextOffsets.clear();
+    _indexByOffset.clear();
+    _codeSize = 0;
+}
+
+uint32_t InstructionStream::_Append(uint8_t opcode, uint64_t immediate, size_t nextOffset)
+{
+    uint32_t index = static_cast<uint32_t>(_opcodes.size());
+    
+    _opcodes.push_back(opcode);
+    _immediates.push_back(immediate);
+    _targets.push_back(kNoIndex);
+    _nextOffsets.push_back(static_cast<uint32_t>(nextOffset));
+    
+    return index;
+}
+
+bool InstructionStream::_IsDefined(uint8_t opcode)
+{
+    return std::strcmp(GetOpcodeInfo(static_cast<Opcode>(opcode)).mnemonic, "INVALID") != 0;
+}
+
+bool InstructionStream::_IsPush(uint8_t opcode)
+{
+    return opcode >= static_cast<uint8_t>(Opcode::PUSH8) && opcode <= static_cast<uint8_t>(Opcode::PUSH64);
+}
+
+bool InstructionStream::_IsRelativeJump(Opcode opcode)
+{
+    switch (opcode)
+    {
+        case Opcode::JMP:
+        case Opcode::JZ:
+        case Opcode::JNZ:
+        case Opcode::JG:
+        case Opcode::JL:
+        case Opcode::JGE:
+        case Opcode::JLE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+} // namespace Engine
+} // namespace DarkMatterVM
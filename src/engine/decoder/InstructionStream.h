@@ -0,0 +1,157 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../../../include/Opcodes.h"
+#include "OpcodeDecoder.h"
+
+namespace DarkMatterVM {
+namespace Engine {
+
+/**
+ * @brief 명령어 스트림 전용 슈퍼명령어 (바이트코드 ISA에는 없음)
+ * 
+ * 자주 나오는 명령어 묶음을 첫 명령어 자리에 하나의 의사 opcode로 합침
+ * 나머지 명령어는 스트림에 그대로 남아 있으므로 묶음 중간으로 분기해도 동작이 같음
+ * 묶음 목록은 OpcodeNgramMiner로 바이트코드 코퍼스를 분석해 다시 뽑을 수 있음
+ */
+enum class FusedOpcode : uint8_t
+{
+    LOADVAR     = 0x80, ///< PUSHn addr; LOAD64            → [addr] 로드
+    STOREVAR    = 0x81, ///< PUSHn addr; SWAP; STORE64     → 최상위 값을 [addr]에 저장
+    ADDI        = 0x82, ///< PUSHn imm; ADD                → 최상위 값 += imm
+    SUBI        = 0x83, ///< PUSHn imm; SUB                → 최상위 값 -= imm
+    PUSH_JZ     = 0x84, ///< PUSHn imm; JZ target          → imm이 0이면 분기
+    DUP_JNZ     = 0x85, ///< DUP; JNZ target               → 최상위 값이 0이 아니면 분기 (값 유지)
+};
+
+/**
+ * @brief 슈퍼명령어가 대체하는 원래 명령어 개수
+ * 
+ * @param op 슈퍼명령어
+ * @return uint32_t 명령어 개수 (폴스루 시 건너뛸 스트림 항목 수)
+ */
+constexpr uint32_t GetFusedLength(FusedOpcode op)
+{
+    return op == FusedOpcode::STOREVAR ? 3 : 2;
+}
+
+/**
+ * @brief 사전 디코딩된 명령어 스트림 (structure-of-arrays)
+ * 
+ * LoadBytecode 시점에 코드를 한 번만 디코딩하여 명령어별 opcode, 확장된 즉시값,
+ * 분기 목적지 인덱스, 다음 명령어 오프셋을 각각의 배열로 보관
+ * 인터프리터는 바이트 단위 fetch 없이 인덱스로 이 배열들을 읽어 실행
+ */
+class InstructionStream {
+public:
+    /**
+     * @brief 명령어 경계가 아닌 바이트 오프셋을 나타내는 인덱스
+     */
+    static constexpr uint32_t kNoIndex = 0xFFFFFFFF;
+    
+    /**
+     * @brief 바이트 단위 실행으로 넘어가는 의사 opcode
+     * 
+     * 디코딩할 수 없는 지점(정의되지 않은 opcode, 잘린 오퍼랜드, 코드 끝)과
+     * 명령어 경계가 아닌 분기 목적지에 배치되며, 즉시값에 재개할 바이트 오프셋을 보관
+     */
+    static constexpr uint8_t kExitOpcode = 0x00;
+    
+    InstructionStream() = default;
+    ~InstructionStream() = default;
+    
+    /**
+     * @brief 코드를 선형으로 디코딩하여 스트림 구성
+     * 
+     * 상대 분기(JMP/JZ/...)의 즉시값은 절대 바이트 오프셋으로, 목적지는 명령어 인덱스로 변환
+     * 
+     * @param code 코드 버퍼
+     * @param size 코드 크기
+     * @param fuseSuperinstructions 슈퍼명령어 합치기 여부
+     */
+    void Decode(const uint8_t* code, std::size_t size, bool fuseSuperinstructions = true);
+    
+    /**
+     * @brief 스트림 비우기
+     */
+    void Clear();
+    
+    /**
+     * @brief 바이트 오프셋에 해당하는 명령어 인덱스 조회
+     * 
+     * @param offset 바이트 오프셋
+     * @return uint32_t 명령어 인덱스 (경계가 아니면 kNoIndex)
+     */
+    uint32_t GetIndex(std::size_t offset) const
+    {
+        return offset < _indexByOffset.size() ? _indexByOffset[offset] : kNoIndex;
+    }
+    
+    /**
+     * @brief 명령어 개수 (EXIT 항목 포함)
+     */
+    std::size_t GetCount() const { return _opcodes.size(); }
+    
+    /**
+     * @brief 디코딩된 코드 크기 (바이트)
+     */
+    std::size_t GetCodeSize() const { return _codeSize; }
+    
+    const uint8_t* GetOpcodes() const { return _opcodes.data(); }
+    const uint64_t* GetImmediates() const { return _immediates.data(); }
+    const uint32_t* GetTargets() const { return _targets.data(); }
+    const uint32_t* GetNextOffsets() const { return _nextOffsets.data(); }
+    
+private:
+    // 명령어별 배열 (인덱스가 같으면 같은 명령어)
+    std::vector<uint8_t> _opcodes;
+    std::vector<uint64_t> _immediates;
+    std::vector<uint32_t> _targets;
+    std::vector<uint32_t> _nextOffsets;
+    
+    // 바이트 오프셋 → 명령어 인덱스
+    std::vector<uint32_t> _indexByOffset;
+    
+    std::size_t _codeSize = 0;
+    
+    OpcodeDecoder _decoder;
+    
+    /**
+     * @brief 명령어 하나 추가
+     * 
+     * @return uint32_t 추가된 명령어 인덱스
+     */
+    uint32_t _Append(uint8_t opcode, uint64_t immediate, std::size_t nextOffset);
+    
+    /**
+     * @brief 디코딩된 명령어에 슈퍼명령어 패턴 적용
+     * 
+     * @param count EXIT 항목을 제외한 디코딩 명령어 수
+     */
+    void _FuseSuperinstructions(std::size_t count);
+    
+    /**
+     * @brief 명령어 i를 슈퍼명령어로 교체 (분기 목적지와 다음 오프셋은 묶음 마지막 명령어 기준)
+     */
+    void _Fuse(std::size_t i, FusedOpcode op);
+    
+    /**
+     * @brief 정의된 opcode인지 확인
+     */
+    static bool _IsDefined(uint8_t opcode);
+    
+    /**
+     * @brief 상대 분기 명령어인지 확인
+     */
+    static bool _IsRelativeJump(Opcode opcode);
+    
+    /**
+     * @brief PUSH8/16/32/64 중 하나인지 확인
+     */
+    static bool _IsPush(uint8_t opcode);
+};
+
+} // namespace Engine
+} // namespace DarkMatterVM
@@ -0,0 +1,131 @@
+#include "OpcodeNgramMiner.h"
+#include "InstructionStream.h"
+#include <algorithm>
+#include <map>
+#include <sstream>
+
+namespace DarkMatterVM 
+{
+namespace Engine 
+{
+
+OpcodeNgramMiner::OpcodeNgramMiner(bool mergePushWidths)
+    : _mergePushWidths(mergePushWidths)
+{
+}
+
+void OpcodeNgramMiner::AddProgram(const uint8_t* bytecode, size_t size, uint64_t weight)
+{
+    // 슈퍼명령어 없이 디코딩하여 원래 opcode 순서를 얻음
+    InstructionStream stream;
+    stream.Decode(bytecode, size, false);
+    
+    Program program;
+    program.weight = weight;
+    
+    const uint8_t* opcodes = stream.GetOpcodes();
+    for (size_t i = 0; i < stream.GetCount(); ++i)
+    {
+        uint8_t opcode = opcodes[i];
+        if (opcode == InstructionStream::kExitOpcode)
+        {
+            break;
+        }
+        
+        if (_mergePushWidths && opcode >= static_cast<uint8_t>(Opcode::PUSH8) && opcode <= static_cast<uint8_t>(Opcode::PUSH64))
+        {
+            opcode = kMergedPush;
+        }
+        
+        program.opcodes.push_back(opcode);
+    }
+    
+    _programs.push_back(std::move(program));
+}
+
+std::vector<OpcodeNgramMiner::Ngram> OpcodeNgramMiner::GetTop(size_t n, size_t limit) const
+{
+    std::map<std::vector<uint8_t>, uint64_t> counts;
+    
+    for (const auto& program : _programs)
+    {
+        if (n == 0 || program.opcodes.size() < n)
+        {
+            continue;
+        }
+        
+        for (size_t i = 0; i + n <= program.opcodes.size(); ++i)
+        {
+            std::vector<uint8_t> key(program.opcodes.begin() + i, program.opcodes.begin() + i + n);
+            counts[key] += program.weight;
+        }
+    }
+    
+    std::vector<Ngram> result;
+    result.reserve(counts.size());
+    for (const auto& [opcodes, count] : counts)
+    {
+        result.push_back({opcodes, count});
+    }
+    
+    // 횟수 내림차순, 같으면 opcode 순 (결과 고정)
+    std::sort(result.begin(), result.end(), [](const Ngram& a, const Ngram& b)
+    {
+        return a.count != b.count ? a.count > b.count : a.opcodes < b.opcodes;
+    });
+    
+    if (result.size() > limit)
+    {
+        result.resize(limit);
+    }
+    
+    return result;
+}
+
+std::string OpcodeNgramMiner::FormatReport(size_t minN, size_t maxN, size_t limit) const
+{
+    std::ostringstream report;
+    
+    for (size_t n = minN; n <= maxN; ++n)
+    {
+        report << n << "-gram 상위 " << limit << "개\n";
+        for (const auto& ngram : GetTop(n, limit))
+        {
+            report << "  " << ngram.count << "\t" << ngram.ToString() << "\n";
+        }
+    }
+    
+    return report.str();
+}
+
+void OpcodeNgramMiner::Clear()
+{
+    _programs.clear();
+}
+
+std::string OpcodeNgramMiner::Ngram::ToString() const
+{
+    std::string text;
+    
+    for (size_t i = 0; i < opcodes.size(); ++i)
+    {
+        if (i > 0)
+        {
+            text += " ";
+        }
+        
+        if (opcodes[i] == kMergedPush)
+        {
+            text += "PUSHn";
+        }
+        else
+        {
+            text += GetOpcodeInfo(static_cast<Opcode>(opcodes[i])).mnemonic;
+        }
+    }
+    
+    return text;
+}
+
+} // namespace Engine
+} // namespace DarkMatterVM
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../../../include/Opcodes.h"
+
+namespace DarkMatterVM {
+namespace Engine {
+
+/**
+ * @brief 바이트코드 코퍼스에서 자주 나오는 opcode n-gram을 뽑는 도구
+ * 
+ * 슈퍼명령어(FusedOpcode) 목록을 다시 정할 때 사용
+ * 프로그램마다 가중치(예: 프로파일링한 실행 횟수)를 줄 수 있음
+ */
+class OpcodeNgramMiner {
+public:
+    /**
+     * @brief n-gram 하나와 등장 횟수
+     */
+    struct Ngram
+    {
+        std::vector<uint8_t> opcodes;
+        uint64_t count;
+        
+        /**
+         * @brief "PUSHn LOAD64" 형태의 문자열
+         */
+        std::string ToString() const;
+    };
+    
+    /**
+     * @brief 생성자
+     * 
+     * @param mergePushWidths PUSH8/16/32/64를 하나의 PUSHn으로 취급할지 여부
+     */
+    explicit OpcodeNgramMiner(bool mergePushWidths = true);
+    ~OpcodeNgramMiner() = default;
+    
+    /**
+     * @brief 코퍼스에 프로그램 추가 (선형 디코딩, 정의되지 않은 opcode에서 중단)
+     * 
+     * @param bytecode 바이트코드 버퍼
+     * @param size 바이트코드 크기
+     * @param weight 이 프로그램에서 나온 n-gram에 더할 가중치
+     */
+    void AddProgram(const uint8_t* bytecode, size_t size, uint64_t weight = 1);
+    
+    /**
+     * @brief 가장 자주 나온 길이 n의 n-gram 조회
+     * 
+     * @param n n-gram 길이
+     * @param limit 최대 개수
+     * @return std::vector<Ngram> 등장 횟수 내림차순
+     */
+    std::vector<Ngram> GetTop(size_t n, size_t limit) const;
+    
+    /**
+     * @brief 길이 minN~maxN의 상위 n-gram 보고서
+     */
+    std::string FormatReport(size_t minN, size_t maxN, size_t limit) const;
+    
+    /**
+     * @brief 코퍼스 비우기
+     */
+    void Clear();
+    
+    /**
+     * @brief PUSH 폭을 합칠 때 사용하는 값 (정의되지 않은 opcode 0x00)
+     */
+    static constexpr uint8_t kMergedPush = 0x00;
+    
+private:
+    struct Program
+    {
+        std::vector<uint8_t> opcodes;
+        uint64_t weight;
+    };
+    
+    std::vector<Program> _programs;
+    bool _mergePushWidths;
+};
+
+} // namespace Engine
+} // namespace DarkMatterVM
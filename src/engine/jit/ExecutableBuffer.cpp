@@ -0,0 +1,67 @@
+#include "ExecutableBuffer.h"
+#include <cstring>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace DarkMatterVM {
+namespace Engine {
+
+ExecutableBuffer::~ExecutableBuffer()
+{
+    Release();
+}
+
+bool ExecutableBuffer::Assign(const std::vector<uint8_t>& code)
+{
+    Release();
+
+#if defined(__linux__)
+    if (code.empty())
+    {
+        return false;
+    }
+
+    size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t size = (code.size() + pageSize - 1) / pageSize * pageSize;
+
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (data == MAP_FAILED)
+    {
+        return false;
+    }
+
+    std::memcpy(data, code.data(), code.size());
+
+    if (mprotect(data, size, PROT_READ | PROT_EXEC) != 0)
+    {
+        munmap(data, size);
+        return false;
+    }
+
+    _data = data;
+    _size = size;
+    return true;
+#else
+    (void)code;
+    return false;
+#endif
+}
+
+void ExecutableBuffer::Release()
+{
+#if defined(__linux__)
+    if (_data != nullptr)
+    {
+        munmap(_data, _size);
+    }
+#endif
+
+    _data = nullptr;
+    _size = 0;
+}
+
+} // namespace Engine
+} // namespace DarkMatterVM
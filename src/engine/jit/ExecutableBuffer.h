@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace DarkMatterVM {
+namespace Engine {
+
+/**
+ * @brief JIT 기계어를 담는 실행 가능 메모리
+ *
+ * mmap으로 쓰기 가능한 페이지를 받아 코드를 복사한 뒤 mprotect로 읽기/실행 전용으로 바꿈
+ * 쓰기와 실행 권한을 동시에 갖는 시점은 없음 (W^X)
+ * Linux 이외의 플랫폼에서는 Assign()이 항상 실패
+ */
+class ExecutableBuffer
+{
+public:
+    ExecutableBuffer() = default;
+    ~ExecutableBuffer();
+
+    ExecutableBuffer(const ExecutableBuffer&) = delete;
+    ExecutableBuffer& operator=(const ExecutableBuffer&) = delete;
+
+    /**
+     * @brief 기계어를 실행 가능 메모리에 복사
+     *
+     * 기존 버퍼는 해제됨
+     *
+     * @param code 기계어 바이트
+     * @return bool 성공 여부 (mmap/mprotect 실패 또는 미지원 플랫폼이면 false)
+     */
+    bool Assign(const std::vector<uint8_t>& code);
+
+    /**
+     * @brief 버퍼 해제
+     */
+    void Release();
+
+    /**
+     * @brief 코드 시작 주소 (할당 전에는 nullptr)
+     */
+    const uint8_t* GetData() const { return static_cast<const uint8_t*>(_data); }
+
+    /**
+     * @brief 매핑된 크기 (페이지 단위로 올림)
+     */
+    size_t GetSize() const { return _size; }
+
+private:
+    void* _data = nullptr;
+    size_t _size = 0;
+};
+
+} // namespace Engine
+} // namespace DarkMatterVM
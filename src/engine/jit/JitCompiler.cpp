@@ -0,0 +1,672 @@
+#include "JitCompiler.h"
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <map>
+#include <memory>
+
+namespace DarkMatterVM {
+namespace Engine {
+
+namespace {
+
+static_assert(offsetof(JitState, stackBase) == 0, "JitState 레이아웃이 템플릿과 다름");
+static_assert(offsetof(JitState, stackPointer) == 8, "JitState 레이아웃이 템플릿과 다름");
+static_assert(offsetof(JitState, stackSize) == 16, "JitState 레이아웃이 템플릿과 다름");
+static_assert(offsetof(JitState, heapBase) == 24, "JitState 레이아웃이 템플릿과 다름");
+static_assert(offsetof(JitState, heapSize) == 32, "JitState 레이아웃이 템플릿과 다름");
+static_assert(offsetof(JitState, heapWindowEnd) == 40, "JitState 레이아웃이 템플릿과 다름");
+
+// 레지스터 배치: rdi = JitState*, r8 = 스택 시작, r9 = 스택 포인터, r10 = 힙 시작
+// rax/rcx/rdx는 템플릿 안에서만 쓰는 임시 레지스터 (호출이 없으므로 모두 caller-saved로 충분)
+
+// x86 조건 코드 (0F 80+cc rel32)
+enum Condition : uint8_t
+{
+    kBelow          = 0x2,  // jb
+    kAboveOrEqual   = 0x3,  // jae
+    kZero           = 0x4,  // jz
+    kNotZero        = 0x5,  // jnz
+    kBelowOrEqual   = 0x6,  // jbe
+    kAbove          = 0x7,  // ja
+};
+
+/**
+ * @brief 기계어 바이트 버퍼
+ */
+class CodeWriter
+{
+public:
+    void Emit(std::initializer_list<uint8_t> bytes)
+    {
+        _code.insert(_code.end(), bytes.begin(), bytes.end());
+    }
+
+    void Emit32(uint32_t value)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            _code.push_back(static_cast<uint8_t>(value >> (i * 8)));
+        }
+    }
+
+    void Emit64(uint64_t value)
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            _code.push_back(static_cast<uint8_t>(value >> (i * 8)));
+        }
+    }
+
+    /**
+     * @brief rel32 자리를 비워두고 그 위치 반환
+     */
+    size_t EmitRel32()
+    {
+        size_t position = _code.size();
+        Emit32(0);
+        return position;
+    }
+
+    void PatchRel32(size_t position, size_t target)
+    {
+        uint32_t relative = static_cast<uint32_t>(static_cast<int64_t>(target) - static_cast<int64_t>(position + 4));
+        for (int i = 0; i < 4; ++i)
+        {
+            _code[position + i] = static_cast<uint8_t>(relative >> (i * 8));
+        }
+    }
+
+    size_t GetPosition() const { return _code.size(); }
+    const std::vector<uint8_t>& GetCode() const { return _code; }
+
+private:
+    std::vector<uint8_t> _code;
+};
+
+/**
+ * @brief 명령어의 스택 사용량
+ */
+struct StackEffect
+{
+    int reads;  ///< 실행 전 최상위에서 읽는 슬롯 수
+    int delta;  ///< 실행 후 슬롯 수 변화
+};
+
+StackEffect GetStackEffect(Opcode op)
+{
+    switch (op)
+    {
+        case Opcode::PUSH8:
+        case Opcode::PUSH16:
+        case Opcode::PUSH32:
+        case Opcode::PUSH64:    return {0, 1};
+        case Opcode::POP:       return {1, -1};
+        case Opcode::DUP:       return {1, 1};
+        case Opcode::SWAP:      return {2, 0};
+        case Opcode::NOT:
+        case Opcode::LOAD8:
+        case Opcode::LOAD16:
+        case Opcode::LOAD32:
+        case Opcode::LOAD64:    return {1, 0};
+        case Opcode::STORE8:
+        case Opcode::STORE16:
+        case Opcode::STORE32:
+        case Opcode::STORE64:
+        case Opcode::JG:
+        case Opcode::JL:
+        case Opcode::JGE:
+        case Opcode::JLE:       return {2, -2};
+        case Opcode::JZ:
+        case Opcode::JNZ:       return {1, -1};
+        case Opcode::JMP:       return {0, 0};
+        // 이항 연산
+        default:                return {2, -1};
+    }
+}
+
+bool IsBranch(Opcode op)
+{
+    return op >= Opcode::JMP && op <= Opcode::JLE;
+}
+
+} // namespace
+
+bool JitCompiler::_IsSupported(uint8_t opcode)
+{
+    switch (static_cast<Opcode>(opcode))
+    {
+        case Opcode::PUSH8: case Opcode::PUSH16: case Opcode::PUSH32: case Opcode::PUSH64:
+        case Opcode::POP: case Opcode::DUP: case Opcode::SWAP:
+        case Opcode::ADD: case Opcode::SUB: case Opcode::MUL: case Opcode::DIV: case Opcode::MOD:
+        case Opcode::AND: case Opcode::OR: case Opcode::XOR: case Opcode::NOT:
+        case Opcode::SHL: case Opcode::SHR:
+        case Opcode::LOAD8: case Opcode::LOAD16: case Opcode::LOAD32: case Opcode::LOAD64:
+        case Opcode::STORE8: case Opcode::STORE16: case Opcode::STORE32: case Opcode::STORE64:
+        case Opcode::JMP: case Opcode::JZ: case Opcode::JNZ:
+        case Opcode::JG: case Opcode::JL: case Opcode::JGE: case Opcode::JLE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+JitState JitCompiler::CreateState(uint8_t* stackBase, size_t stackSize, uint8_t* heapBase, size_t heapSize)
+{
+    JitState state{};
+    state.stackBase = stackBase;
+    state.stackPointer = stackSize;
+    state.stackSize = stackSize;
+    SetHeap(state, heapBase, heapSize);
+    return state;
+}
+
+void JitCompiler::SetHeap(JitState& state, uint8_t* heapBase, size_t heapSize)
+{
+    state.heapBase = heapBase;
+    state.heapSize = heapSize;
+
+    // offset <= 0xFFFFF(힙 창 안) && offset + 8 <= heapSize  ⇔  offset + 8 <= min(heapSize, 0x100007)
+    state.heapWindowEnd = std::min<uint64_t>(heapSize, kHeapVirtualSize + 7);
+}
+
+void JitCompiler::Clear()
+{
+    _stream.Clear();
+    _offsets.clear();
+    _leaders.clear();
+    _compiledBlocks.clear();
+    _buffers.clear();
+    _entries.clear();
+    _blockCount = 0;
+    _compiledInstructionCount = 0;
+    _nativeCodeSize = 0;
+}
+
+bool JitCompiler::Prepare(const uint8_t* code, size_t size)
+{
+    Clear();
+
+#if DMVM_JIT
+    // 슈퍼명령어 없이 원래 명령어 단위로 디코딩
+    _stream.Decode(code, size, false);
+
+    const size_t count = _stream.GetCount();
+    const uint8_t* opcodes = _stream.GetOpcodes();
+    const uint64_t* immediates = _stream.GetImmediates();
+    const uint32_t* targets = _stream.GetTargets();
+    const uint32_t* nextOffsets = _stream.GetNextOffsets();
+
+    // 명령어별 바이트 오프셋 (EXIT 항목은 재개할 오프셋)
+    _offsets.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (opcodes[i] == InstructionStream::kExitOpcode)
+        {
+            _offsets[i] = static_cast<uint32_t>(immediates[i]);
+        }
+        else
+        {
+            _offsets[i] = i == 0 ? 0 : nextOffsets[i - 1];
+        }
+    }
+
+    // 기본 블록 시작점: 코드 시작, 분기 목적지, 분기 다음, 지원하지 않는 명령어 앞뒤
+    _leaders.assign(count, false);
+    _leaders[0] = true;
+    for (size_t i = 0; i < count; ++i)
+    {
+        bool supported = _IsSupported(opcodes[i]);
+        bool branch = supported && IsBranch(static_cast<Opcode>(opcodes[i]));
+        if (branch)
+        {
+            _leaders[targets[i]] = true;
+        }
+        if (!supported)
+        {
+            _leaders[i] = true;
+        }
+        if ((branch || !supported) && i + 1 < count)
+        {
+            _leaders[i + 1] = true;
+        }
+    }
+
+    _compiledBlocks.assign(count, false);
+    _entries.assign(size + 1, nullptr);
+    return true;
+#else
+    (void)code;
+    (void)size;
+    return false;
+#endif
+}
+
+bool JitCompiler::Compile(const uint8_t* code, size_t size)
+{
+    if (!Prepare(code, size))
+    {
+        return false;
+    }
+
+    std::vector<uint32_t> starts;
+    for (uint32_t i = 0; i < _stream.GetCount(); ++i)
+    {
+        if (_IsBlockStart(i))
+        {
+            starts.push_back(i);
+        }
+    }
+
+    return _EmitRegion(starts);
+}
+
+bool JitCompiler::CompileRegion(size_t offset)
+{
+    uint32_t first = _stream.GetIndex(offset);
+    if (first == InstructionStream::kNoIndex || !_IsBlockStart(first) || _compiledBlocks[first])
+    {
+        return GetEntry(offset) != nullptr;
+    }
+
+    const uint8_t* opcodes = _stream.GetOpcodes();
+    const uint32_t* targets = _stream.GetTargets();
+
+    // 시작 블록에서 분기/폴스루로 닿는 아직 컴파일되지 않은 블록을 모두 모음
+    std::vector<uint32_t> starts;
+    std::vector<uint32_t> worklist = {first};
+    std::vector<bool> queued(_stream.GetCount(), false);
+    queued[first] = true;
+
+    while (!worklist.empty())
+    {
+        uint32_t start = worklist.back();
+        worklist.pop_back();
+        starts.push_back(start);
+
+        uint32_t end = _GetBlockEnd(start);
+        auto enqueue = [&](uint32_t index)
+        {
+            if (_IsBlockStart(index) && !_compiledBlocks[index] && !queued[index])
+            {
+                queued[index] = true;
+                worklist.push_back(index);
+            }
+        };
+
+        for (uint32_t pc = start; pc < end; ++pc)
+        {
+            if (IsBranch(static_cast<Opcode>(opcodes[pc])))
+            {
+                enqueue(targets[pc]);
+            }
+        }
+        if (static_cast<Opcode>(opcodes[end - 1]) != Opcode::JMP)
+        {
+            enqueue(end);
+        }
+    }
+
+    std::sort(starts.begin(), starts.end());
+    return _EmitRegion(starts);
+}
+
+bool JitCompiler::_IsBlockStart(uint32_t index) const
+{
+    return index < _leaders.size() && _leaders[index] && _IsSupported(_stream.GetOpcodes()[index]);
+}
+
+uint32_t JitCompiler::_GetBlockEnd(uint32_t start) const
+{
+    const uint8_t* opcodes = _stream.GetOpcodes();
+    uint32_t end = start + 1;
+    while (end < _stream.GetCount() && _IsSupported(opcodes[end]) && !_leaders[end])
+    {
+        ++end;
+    }
+    return end;
+}
+
+bool JitCompiler::_EmitRegion(const std::vector<uint32_t>& starts)
+{
+#if DMVM_JIT
+    if (starts.empty())
+    {
+        return false;
+    }
+
+    const size_t count = _stream.GetCount();
+    const uint8_t* opcodes = _stream.GetOpcodes();
+    const uint64_t* immediates = _stream.GetImmediates();
+    const uint32_t* targets = _stream.GetTargets();
+    const std::vector<uint32_t>& offsets = _offsets;
+
+    std::vector<bool> inRegion(count, false);
+    for (uint32_t start : starts)
+    {
+        inRegion[start] = true;
+    }
+
+    CodeWriter writer;
+    std::vector<size_t> bodyPositions(count, SIZE_MAX);
+    std::vector<std::pair<size_t, uint32_t>> bodyFixups;       // (rel32 위치, 목적지 명령어 인덱스)
+    std::map<uint32_t, std::vector<size_t>> exitFixups;         // 탈출 오프셋 → rel32 위치 목록
+    std::vector<std::pair<uint32_t, size_t>> entryPositions;    // (바이트 오프셋, 진입점 위치)
+
+    // 탈출: 인터프리터가 offset부터 이어서 실행
+    auto emitExitRel32 = [&](uint32_t offset)
+    {
+        exitFixups[offset].push_back(writer.EmitRel32());
+    };
+
+    // 명령어 인덱스로 분기: 이번 영역의 블록이면 본문으로, 아니면 탈출 (다른 영역 블록은 인터프리터가 다시 진입)
+    auto emitTargetRel32 = [&](uint32_t index)
+    {
+        if (inRegion[index])
+        {
+            bodyFixups.emplace_back(writer.EmitRel32(), index);
+        }
+        else
+        {
+            emitExitRel32(offsets[index]);
+        }
+    };
+
+    auto emitJcc = [&](uint8_t condition) { writer.Emit({0x0F, static_cast<uint8_t>(0x80 | condition)}); };
+
+    // 힙 범위 검사: rax = 오프셋, 범위를 벗어나면 현재 명령어 직전 상태로 탈출
+    auto emitHeapCheck = [&](uint8_t stateField, uint8_t accessSize, uint32_t deoptOffset)
+    {
+        writer.Emit({0x48, 0x3B, 0x47, stateField});            // cmp rax, [rdi+field]
+        emitJcc(kAboveOrEqual);
+        emitExitRel32(deoptOffset);
+        writer.Emit({0x48, 0x8D, 0x48, accessSize});            // lea rcx, [rax+size]
+        writer.Emit({0x48, 0x3B, 0x4F, stateField});            // cmp rcx, [rdi+field]
+        emitJcc(kAbove);
+        emitExitRel32(deoptOffset);
+    };
+
+    for (uint32_t start : starts)
+    {
+        // 블록 범위와 스택 사용량 (진입 시점 대비 필요한 슬롯 수, 최대 증가량)
+        uint32_t end = _GetBlockEnd(start);
+        int depth = 0;
+        int need = 0;
+        int growth = 0;
+        for (uint32_t pc = start; pc < end; ++pc)
+        {
+            StackEffect effect = GetStackEffect(static_cast<Opcode>(opcodes[pc]));
+            need = std::max(need, effect.reads - depth);
+            depth += effect.delta;
+            growth = std::max(growth, depth);
+        }
+
+        // 진입점: 상태를 레지스터로 올림
+        entryPositions.emplace_back(offsets[start], writer.GetPosition());
+        writer.Emit({0x4C, 0x8B, 0x47, 0x00});                  // mov r8, [rdi+0]
+        writer.Emit({0x4C, 0x8B, 0x4F, 0x08});                  // mov r9, [rdi+8]
+        writer.Emit({0x4C, 0x8B, 0x57, 0x18});                  // mov r10, [rdi+24]
+
+        // 본문: 다른 블록에서 분기해 올 때도 스택 검사부터 수행
+        bodyPositions[start] = writer.GetPosition();
+        if (need > 0)
+        {
+            writer.Emit({0x49, 0x8D, 0x81});                    // lea rax, [r9+need*8]
+            writer.Emit32(static_cast<uint32_t>(need * 8));
+            writer.Emit({0x48, 0x3B, 0x47, 0x10});              // cmp rax, [rdi+16]
+            emitJcc(kAbove);
+            emitExitRel32(offsets[start]);
+        }
+        if (growth > 0)
+        {
+            writer.Emit({0x49, 0x81, 0xF9});                    // cmp r9, growth*8
+            writer.Emit32(static_cast<uint32_t>(growth * 8));
+            emitJcc(kBelow);
+            emitExitRel32(offsets[start]);
+        }
+
+        bool fallsThrough = true;
+        for (uint32_t pc = start; pc < end; ++pc)
+        {
+            Opcode op = static_cast<Opcode>(opcodes[pc]);
+            uint32_t offset = offsets[pc];
+
+            switch (op)
+            {
+                case Opcode::PUSH8:
+                case Opcode::PUSH16:
+                case Opcode::PUSH32:
+                case Opcode::PUSH64:
+                {
+                    uint64_t value = immediates[pc];
+                    int64_t signedValue = static_cast<int64_t>(value);
+                    if (signedValue >= INT32_MIN && signedValue <= INT32_MAX)
+                    {
+                        writer.Emit({0x49, 0x83, 0xE9, 0x08});  // sub r9, 8
+                        writer.Emit({0x4B, 0xC7, 0x04, 0x08});  // mov qword [r8+r9], imm32
+                        writer.Emit32(static_cast<uint32_t>(value));
+                    }
+                    else
+                    {
+                        writer.Emit({0x48, 0xB8});              // mov rax, imm64
+                        writer.Emit64(value);
+                        writer.Emit({0x49, 0x83, 0xE9, 0x08});  // sub r9, 8
+                        writer.Emit({0x4B, 0x89, 0x04, 0x08});  // mov [r8+r9], rax
+                    }
+                    break;
+                }
+                case Opcode::POP:
+                    writer.Emit({0x49, 0x83, 0xC1, 0x08});      // add r9, 8
+                    break;
+                case Opcode::DUP:
+                    writer.Emit({0x4B, 0x8B, 0x04, 0x08});      // mov rax, [r8+r9]
+                    writer.Emit({0x49, 0x83, 0xE9, 0x08});      // sub r9, 8
+                    writer.Emit({0x4B, 0x89, 0x04, 0x08});      // mov [r8+r9], rax
+                    break;
+                case Opcode::SWAP:
+                    writer.Emit({0x4B, 0x8B, 0x04, 0x08});      // mov rax, [r8+r9]
+                    writer.Emit({0x4B, 0x8B, 0x4C, 0x08, 0x08});// mov rcx, [r8+r9+8]
+                    writer.Emit({0x4B, 0x89, 0x0C, 0x08});      // mov [r8+r9], rcx
+                    writer.Emit({0x4B, 0x89, 0x44, 0x08, 0x08});// mov [r8+r9+8], rax
+                    break;
+
+                case Opcode::ADD:
+                case Opcode::SUB:
+                case Opcode::MUL:
+                case Opcode::AND:
+                case Opcode::OR:
+                case Opcode::XOR:
+                case Opcode::SHL:
+                case Opcode::SHR:
+                    writer.Emit({0x4B, 0x8B, 0x0C, 0x08});      // mov rcx, [r8+r9]      (b)
+                    writer.Emit({0x49, 0x83, 0xC1, 0x08});      // add r9, 8
+                    writer.Emit({0x4B, 0x8B, 0x04, 0x08});      // mov rax, [r8+r9]      (a)
+                    switch (op)
+                    {
+                        case Opcode::ADD:   writer.Emit({0x48, 0x01, 0xC8}); break;         // add rax, rcx
+                        case Opcode::SUB:   writer.Emit({0x48, 0x29, 0xC8}); break;         // sub rax, rcx
+                        case Opcode::MUL:   writer.Emit({0x48, 0x0F, 0xAF, 0xC1}); break;   // imul rax, rcx
+                        case Opcode::AND:   writer.Emit({0x48, 0x21, 0xC8}); break;         // and rax, rcx
+                        case Opcode::OR:    writer.Emit({0x48, 0x09, 0xC8}); break;         // or rax, rcx
+                        case Opcode::XOR:   writer.Emit({0x48, 0x31, 0xC8}); break;         // xor rax, rcx
+                        default:
+                            // 시프트 양이 64 이상이면 결과는 0
+                            writer.Emit({0x48, 0xD3, static_cast<uint8_t>(op == Opcode::SHL ? 0xE0 : 0xE8)}); // shl/shr rax, cl
+                            writer.Emit({0x31, 0xD2});                  // xor edx, edx
+                            writer.Emit({0x48, 0x83, 0xF9, 0x40});      // cmp rcx, 64
+                            writer.Emit({0x48, 0x0F, 0x43, 0xC2});      // cmovae rax, rdx
+                            break;
+                    }
+                    writer.Emit({0x4B, 0x89, 0x04, 0x08});      // mov [r8+r9], rax
+                    break;
+
+                case Opcode::DIV:
+                case Opcode::MOD:
+                    writer.Emit({0x4B, 0x8B, 0x0C, 0x08});      // mov rcx, [r8+r9]
+                    writer.Emit({0x48, 0x85, 0xC9});            // test rcx, rcx
+                    emitJcc(kZero);                             // 0으로 나누기: 인터프리터가 오류 처리
+                    emitExitRel32(offset);
+                    writer.Emit({0x49, 0x83, 0xC1, 0x08});      // add r9, 8
+                    writer.Emit({0x4B, 0x8B, 0x04, 0x08});      // mov rax, [r8+r9]
+                    writer.Emit({0x31, 0xD2});                  // xor edx, edx
+                    writer.Emit({0x48, 0xF7, 0xF1});            // div rcx
+                    if (op == Opcode::DIV)
+                    {
+                        writer.Emit({0x4B, 0x89, 0x04, 0x08});  // mov [r8+r9], rax
+                    }
+                    else
+                    {
+                        writer.Emit({0x4B, 0x89, 0x14, 0x08});  // mov [r8+r9], rdx
+                    }
+                    break;
+
+                case Opcode::NOT:
+                    writer.Emit({0x4B, 0xF7, 0x14, 0x08});      // not qword [r8+r9]
+                    break;
+
+                case Opcode::LOAD8:
+                case Opcode::LOAD16:
+                case Opcode::LOAD32:
+                case Opcode::LOAD64:
+                    writer.Emit({0x4B, 0x8B, 0x04, 0x08});      // mov rax, [r8+r9]
+                    if (op == Opcode::LOAD64)
+                    {
+                        writer.Emit({0x48, 0x2D});              // sub rax, kHeapVirtualBase
+                        writer.Emit32(static_cast<uint32_t>(kHeapVirtualBase));
+                        emitJcc(kBelow);
+                        emitExitRel32(offset);
+                        emitHeapCheck(40, 8, offset);
+                        writer.Emit({0x49, 0x8B, 0x04, 0x02});  // mov rax, [r10+rax]
+                    }
+                    else if (op == Opcode::LOAD32)
+                    {
+                        emitHeapCheck(32, 4, offset);
+                        writer.Emit({0x41, 0x8B, 0x04, 0x02});  // mov eax, [r10+rax]
+                    }
+                    else if (op == Opcode::LOAD16)
+                    {
+                        emitHeapCheck(32, 2, offset);
+                        writer.Emit({0x41, 0x0F, 0xB7, 0x04, 0x02}); // movzx eax, word [r10+rax]
+                    }
+                    else
+                    {
+                        emitHeapCheck(32, 1, offset);
+                        writer.Emit({0x41, 0x0F, 0xB6, 0x04, 0x02}); // movzx eax, byte [r10+rax]
+                    }
+                    writer.Emit({0x4B, 0x89, 0x04, 0x08});      // mov [r8+r9], rax
+                    break;
+
+                case Opcode::STORE8:
+                case Opcode::STORE16:
+                case Opcode::STORE32:
+                case Opcode::STORE64:
+                    writer.Emit({0x4B, 0x8B, 0x44, 0x08, 0x08});// mov rax, [r8+r9+8]    (주소)
+                    if (op == Opcode::STORE64)
+                    {
+                        writer.Emit({0x48, 0x2D});              // sub rax, kHeapVirtualBase
+                        writer.Emit32(static_cast<uint32_t>(kHeapVirtualBase));
+                        emitJcc(kBelow);
+                        emitExitRel32(offset);
+                        emitHeapCheck(40, 8, offset);
+                    }
+                    else
+                    {
+                        emitHeapCheck(32, op == Opcode::STORE32 ? 4 : op == Opcode::STORE16 ? 2 : 1, offset);
+                    }
+                    writer.Emit({0x4B, 0x8B, 0x0C, 0x08});      // mov rcx, [r8+r9]      (값)
+                    switch (op)
+                    {
+                        case Opcode::STORE64: writer.Emit({0x49, 0x89, 0x0C, 0x02}); break;       // mov [r10+rax], rcx
+                        case Opcode::STORE32: writer.Emit({0x41, 0x89, 0x0C, 0x02}); break;       // mov [r10+rax], ecx
+                        case Opcode::STORE16: writer.Emit({0x66, 0x41, 0x89, 0x0C, 0x02}); break; // mov [r10+rax], cx
+                        default:              writer.Emit({0x41, 0x88, 0x0C, 0x02}); break;       // mov [r10+rax], cl
+                    }
+                    writer.Emit({0x49, 0x83, 0xC1, 0x10});      // add r9, 16
+                    break;
+
+                case Opcode::JMP:
+                    writer.Emit({0xE9});                        // jmp target
+                    emitTargetRel32(targets[pc]);
+                    fallsThrough = false;
+                    break;
+                case Opcode::JZ:
+                case Opcode::JNZ:
+                    writer.Emit({0x4B, 0x8B, 0x04, 0x08});      // mov rax, [r8+r9]
+                    writer.Emit({0x49, 0x83, 0xC1, 0x08});      // add r9, 8
+                    writer.Emit({0x48, 0x85, 0xC0});            // test rax, rax
+                    emitJcc(op == Opcode::JZ ? kZero : kNotZero);
+                    emitTargetRel32(targets[pc]);
+                    break;
+                default:
+                {
+                    // JG/JL/JGE/JLE: 부호 없는 비교 a(second) ? b(top)
+                    writer.Emit({0x4B, 0x8B, 0x0C, 0x08});      // mov rcx, [r8+r9]
+                    writer.Emit({0x4B, 0x8B, 0x44, 0x08, 0x08});// mov rax, [r8+r9+8]
+                    writer.Emit({0x49, 0x83, 0xC1, 0x10});      // add r9, 16
+                    writer.Emit({0x48, 0x39, 0xC8});            // cmp rax, rcx
+                    uint8_t condition = op == Opcode::JG ? kAbove : op == Opcode::JL ? kBelow :
+                                        op == Opcode::JGE ? kAboveOrEqual : kBelowOrEqual;
+                    emitJcc(condition);
+                    emitTargetRel32(targets[pc]);
+                    break;
+                }
+            }
+        }
+
+        // 블록 끝에서 다음 명령어로 (블록 경계이므로 항상 분기 시작점)
+        if (fallsThrough)
+        {
+            writer.Emit({0xE9});
+            emitTargetRel32(static_cast<uint32_t>(end));
+        }
+
+        _compiledInstructionCount += end - start;
+    }
+
+    // 탈출 스텁: 스택 포인터를 기록하고 재개할 바이트 오프셋 반환
+    for (const auto& [offset, positions] : exitFixups)
+    {
+        size_t stub = writer.GetPosition();
+        writer.Emit({0x4C, 0x89, 0x4F, 0x08});                  // mov [rdi+8], r9
+        writer.Emit({0xB8});                                    // mov eax, offset
+        writer.Emit32(offset);
+        writer.Emit({0xC3});                                    // ret
+
+        for (size_t position : positions)
+        {
+            writer.PatchRel32(position, stub);
+        }
+    }
+
+    for (const auto& [position, index] : bodyFixups)
+    {
+        writer.PatchRel32(position, bodyPositions[index]);
+    }
+
+    auto buffer = std::make_unique<ExecutableBuffer>();
+    if (!buffer->Assign(writer.GetCode()))
+    {
+        return false;
+    }
+
+    for (const auto& [offset, position] : entryPositions)
+    {
+        _entries[offset] = reinterpret_cast<JitEntry>(const_cast<uint8_t*>(buffer->GetData() + position));
+    }
+    for (uint32_t start : starts)
+    {
+        _compiledBlocks[start] = true;
+    }
+
+    _blockCount += starts.size();
+    _nativeCodeSize += writer.GetCode().size();
+    _buffers.push_back(std::move(buffer));
+    return true;
+#else
+    (void)starts;
+    return false;
+#endif
+}
+
+} // namespace Engine
+} // namespace DarkMatterVM
@@ -0,0 +1,200 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "ExecutableBuffer.h"
+#include "../decoder/InstructionStream.h"
+
+/**
+ * @brief x86-64 템플릿 JIT 지원 여부
+ *
+ * Linux x86-64(System V 호출 규약, mmap)에서만 1
+ * 빌드 옵션으로 0을 지정하면 비활성화 가능
+ */
+#ifndef DMVM_JIT
+#if defined(__x86_64__) && defined(__linux__)
+#define DMVM_JIT 1
+#else
+#define DMVM_JIT 0
+#endif
+#endif
+
+namespace DarkMatterVM {
+namespace Engine {
+
+/**
+ * @brief JIT 코드와 인터프리터가 주고받는 실행 상태
+ *
+ * 기계어 템플릿이 고정 오프셋으로 읽으므로 필드 순서를 바꾸면 안 됨
+ */
+struct JitState
+{
+    uint8_t* stackBase;         ///< +0  스택 세그먼트 시작 주소
+    uint64_t stackPointer;      ///< +8  스택 포인터 (세그먼트 오프셋, 진입/탈출 시 갱신)
+    uint64_t stackSize;         ///< +16 스택 세그먼트 크기
+    uint8_t* heapBase;          ///< +24 힙 세그먼트 시작 주소
+    uint64_t heapSize;          ///< +32 힙 세그먼트 크기 (LOAD8~32/STORE8~32 범위)
+    uint64_t heapWindowEnd;     ///< +40 힙 가상 주소 창 끝 오프셋 (LOAD64/STORE64 범위)
+};
+
+/**
+ * @brief JIT 블록 진입점
+ *
+ * @return uint32_t 인터프리터가 이어서 실행할 바이트 오프셋 (JitState::stackPointer도 갱신됨)
+ */
+using JitEntry = uint32_t (*)(JitState* state);
+
+/**
+ * @brief 기본 블록 단위 x86-64 템플릿 JIT
+ *
+ * 명령어마다 미리 정해둔 기계어 템플릿을 복사하고 즉시값과 분기 목적지만 패치함
+ * VM 스택은 메모리에 그대로 두고 스택 포인터만 레지스터(r9)에 올려 사용
+ *
+ * 블록 진입 시 블록 전체의 스택 사용량을 한 번에 검사하고, 0으로 나누기와
+ * 범위를 벗어난 메모리 접근은 해당 명령어 직전 상태로 탈출(deopt)하여
+ * 인터프리터가 그 명령어를 다시 실행하므로 오류 메시지와 IP/SP가 인터프리터와 같음
+ * CALL/RET/TAILCALL/LDLOC/STLOC/LDARG/HOSTCALL/HALT/ALLOC/FREE/ARENA_BEGIN/ARENA_ALLOC/ARENA_RESET/MEMCPY/MEMSET/MEMCMP/THREAD와 힙 창 밖의 LOAD64/STORE64는 인터프리터가 실행
+ */
+class JitCompiler
+{
+public:
+    /**
+     * @brief 현재 빌드에서 JIT 사용 가능 여부
+     */
+    static constexpr bool IsSupported() { return DMVM_JIT != 0; }
+
+    /**
+     * @brief LOAD64/STORE64 가상 주소 중 힙 세그먼트 시작 (MemoryManager::kHeapBaseAddress와 같음)
+     *
+     * 스택이 커서 힙이 다른 주소에 배치된 인스턴스는 Jit/Tiered 모드에서도 Portable로 실행
+     */
+    static constexpr uint64_t kHeapVirtualBase = 0x200000;
+
+    /**
+     * @brief 힙 가상 주소 창 크기
+     */
+    static constexpr uint64_t kHeapVirtualSize = 0x100000;
+
+    JitCompiler() = default;
+    ~JitCompiler() = default;
+
+    /**
+     * @brief 코드 전체를 기본 블록 단위로 컴파일
+     *
+     * @param code 바이트코드 (복호화된 평문)
+     * @param size 바이트코드 크기
+     * @return bool 실행 가능한 코드가 만들어졌는지 여부
+     */
+    bool Compile(const uint8_t* code, size_t size);
+
+    /**
+     * @brief 코드를 디코딩하고 블록 경계만 분석 (기계어는 만들지 않음)
+     *
+     * 이후 CompileRegion()으로 필요한 영역만 컴파일
+     *
+     * @param code 바이트코드 (복호화된 평문)
+     * @param size 바이트코드 크기
+     * @return bool 현재 빌드에서 JIT을 쓸 수 있는지 여부
+     */
+    bool Prepare(const uint8_t* code, size_t size);
+
+    /**
+     * @brief 지정한 블록과 거기서 닿는 아직 컴파일되지 않은 블록들을 하나의 영역으로 컴파일
+     *
+     * 영역 밖(이미 컴파일된 다른 영역 포함)으로 가는 분기는 탈출 스텁으로 연결되어
+     * 인터프리터가 다음 블록 진입점에서 다시 기계어로 들어감
+     *
+     * @param offset 영역 시작 바이트 오프셋 (보통 루프 헤더나 함수 시작)
+     * @return bool 해당 오프셋에 진입점이 있는지 여부
+     */
+    bool CompileRegion(size_t offset);
+
+    /**
+     * @brief 컴파일 결과 비우기
+     */
+    void Clear();
+
+    /**
+     * @brief 바이트 오프셋에서 시작하는 컴파일된 블록 진입점
+     *
+     * @param offset 바이트 오프셋
+     * @return JitEntry 진입점 (블록 시작이 아니면 nullptr)
+     */
+    JitEntry GetEntry(size_t offset) const
+    {
+        return offset < _entries.size() ? _entries[offset] : nullptr;
+    }
+
+    /**
+     * @brief 세그먼트 정보로 실행 상태 구성
+     */
+    static JitState CreateState(uint8_t* stackBase, size_t stackSize, uint8_t* heapBase, size_t heapSize);
+
+    /**
+     * @brief 힙 세그먼트가 늘어나거나 옮겨졌을 때 실행 상태의 힙 정보 갱신
+     */
+    static void SetHeap(JitState& state, uint8_t* heapBase, size_t heapSize);
+
+    /**
+     * @brief 컴파일된 블록 수
+     */
+    size_t GetBlockCount() const { return _blockCount; }
+
+    /**
+     * @brief 기계어로 변환된 명령어 수
+     */
+    size_t GetCompiledInstructionCount() const { return _compiledInstructionCount; }
+
+    /**
+     * @brief 생성된 기계어 크기 (바이트)
+     */
+    size_t GetNativeCodeSize() const { return _nativeCodeSize; }
+
+    /**
+     * @brief 컴파일된 영역 수 (Compile()은 항상 1개)
+     */
+    size_t GetRegionCount() const { return _buffers.size(); }
+
+private:
+    InstructionStream _stream;
+
+    // 영역마다 하나씩
+    std::vector<std::unique_ptr<ExecutableBuffer>> _buffers;
+
+    // 명령어 인덱스별 바이트 오프셋, 블록 시작 여부, 컴파일 여부
+    std::vector<uint32_t> _offsets;
+    std::vector<bool> _leaders;
+    std::vector<bool> _compiledBlocks;
+
+    // 바이트 오프셋 → 블록 진입점
+    std::vector<JitEntry> _entries;
+
+    size_t _blockCount = 0;
+    size_t _compiledInstructionCount = 0;
+    size_t _nativeCodeSize = 0;
+
+    /**
+     * @brief 기계어 템플릿이 있는 명령어인지 확인
+     */
+    static bool _IsSupported(uint8_t opcode);
+
+    /**
+     * @brief 기계어로 시작할 수 있는 블록 시작점인지 확인
+     */
+    bool _IsBlockStart(uint32_t index) const;
+
+    /**
+     * @brief 블록 끝 (마지막 명령어 다음 인덱스)
+     */
+    uint32_t _GetBlockEnd(uint32_t start) const;
+
+    /**
+     * @brief 블록 시작점 목록을 하나의 실행 가능 버퍼로 생성
+     */
+    bool _EmitRegion(const std::vector<uint32_t>& starts);
+};
+
+} // namespace Engine
+} // namespace DarkMatterVM
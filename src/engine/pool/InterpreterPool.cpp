@@ -0,0 +1,173 @@
+#include "InterpreterPool.h"
+#include <algorithm>
+#include <utility>
+
+namespace DarkMatterVM {
+namespace Engine {
+
+InterpreterPool::Lease::Lease(Lease&& other) noexcept
+    : _pool(other._pool), _interpreter(std::move(other._interpreter)), _module(other._module)
+{
+    other._pool = nullptr;
+    other._module = nullptr;
+}
+
+InterpreterPool::Lease& InterpreterPool::Lease::operator=(Lease&& other) noexcept
+{
+    if (this != &other)
+    {
+        Release();
+        _pool = other._pool;
+        _interpreter = std::move(other._interpreter);
+        _module = other._module;
+        other._pool = nullptr;
+        other._module = nullptr;
+    }
+
+    return *this;
+}
+
+InterpreterPool::Lease::~Lease()
+{
+    Release();
+}
+
+void InterpreterPool::Lease::Release()
+{
+    if (_pool != nullptr && _interpreter != nullptr)
+    {
+        _pool->_Return(std::move(_interpreter), _module);
+    }
+
+    _pool = nullptr;
+    _interpreter.reset();
+    _module = nullptr;
+}
+
+InterpreterPool::InterpreterPool(size_t codeSize, size_t stackSize, size_t heapSize, size_t maxIdleCount)
+    : _codeSize(codeSize), _stackSize(stackSize), _heapSize(heapSize), _maxIdleCount(maxIdleCount)
+{
+}
+
+InterpreterPool::Lease InterpreterPool::Acquire(const uint8_t* bytecode, size_t size)
+{
+    std::unique_ptr<Interpreter> interpreter;
+    const Interpreter* module = nullptr;
+    bool sameModule = false;
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        module = &_GetModule(bytecode, size);
+
+        // 같은 모듈을 올려 둔 인스턴스 우선, 없으면 가장 최근에 반납된 인스턴스
+        if (!_idle.empty())
+        {
+            size_t pick = _idle.size() - 1;
+            for (size_t i = _idle.size(); i-- > 0;)
+            {
+                if (_idle[i].module == module)
+                {
+                    pick = i;
+                    break;
+                }
+            }
+
+            sameModule = _idle[pick].module == module;
+            interpreter = std::move(_idle[pick].interpreter);
+            _idle.erase(_idle.begin() + static_cast<std::ptrdiff_t>(pick));
+            _stats.reusedCount++;
+        }
+        else
+        {
+            _stats.createdCount++;
+        }
+
+        if (!sameModule)
+        {
+            _stats.sharedLoadCount++;
+        }
+    }
+
+    if (interpreter == nullptr)
+    {
+        interpreter = std::make_unique<Interpreter>(_codeSize, _stackSize, _heapSize);
+    }
+
+    if (!sameModule)
+    {
+        interpreter->_LoadSharedCode(*module);
+    }
+
+    // 이전 사용자가 바꾼 실행 설정은 모듈 원본(기본값)으로 되돌림
+    interpreter->_executionMode = module->_executionMode;
+    interpreter->_laneParallelEnabled = module->_laneParallelEnabled;
+    interpreter->_verificationEnabled = module->_verificationEnabled;
+    interpreter->_stackGuardEnabled = module->_stackGuardEnabled;
+    interpreter->SetStackSharing(module->GetStackSharing());
+    interpreter->_tieringStats.backEdgeThreshold = module->_tieringStats.backEdgeThreshold;
+    interpreter->_tieringStats.callThreshold = module->_tieringStats.callThreshold;
+
+    // 힙 정책은 풀의 힙 크기에서 시작하는 기본 정책으로 (모듈은 힙을 쓰지 않음, 반납 시 비워져 있음)
+    Memory::HeapGrowthPolicy heapPolicy;
+    heapPolicy.initialSize = _heapSize;
+    heapPolicy.maxSize = std::max(heapPolicy.maxSize, _heapSize);
+    if (!(interpreter->GetHeapGrowthPolicy() == heapPolicy))
+    {
+        interpreter->SetHeapGrowthPolicy(heapPolicy);
+    }
+    if (interpreter->_superinstructionsEnabled != module->_superinstructionsEnabled)
+    {
+        interpreter->_LoadSharedCode(*module);
+    }
+
+    return Lease(this, std::move(interpreter), module);
+}
+
+size_t InterpreterPool::GetIdleCount() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _idle.size();
+}
+
+InterpreterPool::Stats InterpreterPool::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _stats;
+}
+
+const Interpreter& InterpreterPool::_GetModule(const uint8_t* bytecode, size_t size)
+{
+    std::vector<uint8_t> key(bytecode, bytecode + size);
+
+    auto it = _modules.find(key);
+    if (it == _modules.end())
+    {
+        auto module = std::make_unique<Interpreter>(_codeSize, sizeof(uint64_t), sizeof(uint64_t));
+        module->LoadBytecode(bytecode, size);
+        it = _modules.emplace(std::move(key), std::move(module)).first;
+        _stats.moduleCount++;
+    }
+
+    return *it->second;
+}
+
+void InterpreterPool::_Return(std::unique_ptr<Interpreter> interpreter, const Interpreter* module)
+{
+    // 빌려 간 쪽에서 LoadBytecode()로 다른 코드를 올렸으면 공유가 끊겨 있으므로 다음에 다시 올림
+    if (!interpreter->_memoryManager->GetSegment(Memory::MemorySegmentType::CODE).IsShared())
+    {
+        module = nullptr;
+    }
+
+    size_t scrubbed = interpreter->Recycle();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stats.scrubbedBytes += scrubbed;
+    if (_idle.size() < _maxIdleCount)
+    {
+        _idle.push_back({std::move(interpreter), module});
+    }
+}
+
+} // namespace Engine
+} // namespace DarkMatterVM
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "../Interpreter.h"
+
+namespace DarkMatterVM {
+namespace Engine {
+
+/**
+ * @brief 재사용 가능한 Interpreter 인스턴스 풀
+ *
+ * 인스턴스 생성은 코드/스택/힙 세그먼트 할당과 0 채우기(기본 크기 기준 2MB 이상)가 대부분이므로
+ * 짧은 실행을 반복할 때는 반납된 인스턴스를 Interpreter::Recycle()로 지워 다시 씀
+ * - 반납 시 지우는 양은 지난 실행이 실제로 쓴 스택/힙 구간(세그먼트별 high-water 구간)에 비례
+ * - 모듈(바이트코드)마다 원본 인스턴스에서 한 번만 복호화/디코딩/검증하고, 빌려 가는 인스턴스는
+ *   코드 세그먼트 메모리를 공유하고 분석 결과만 복사
+ * - 빌려 간 인스턴스의 실행 설정(실행 모드 등)은 빌려 줄 때마다 기본값으로 되돌림
+ *
+ * 모듈 캐시는 풀이 소멸할 때까지 유지되며, Lease는 풀보다 먼저 소멸해야 함
+ */
+class InterpreterPool
+{
+public:
+    /**
+     * @brief 풀 통계
+     */
+    struct Stats
+    {
+        uint64_t createdCount = 0;      ///< 새로 만든 인스턴스 수
+        uint64_t reusedCount = 0;       ///< 반납된 인스턴스를 다시 빌려 준 횟수
+        uint64_t moduleCount = 0;       ///< 디코딩한 모듈 수 (모듈마다 한 번)
+        uint64_t sharedLoadCount = 0;   ///< 코드 세그먼트를 공유해 모듈을 올린 횟수
+        uint64_t scrubbedBytes = 0;     ///< 반납 시 지운 바이트 수 누적
+    };
+
+    /**
+     * @brief 빌려 간 인스턴스 (소멸 시 풀에 반납)
+     */
+    class Lease
+    {
+    public:
+        Lease() = default;
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&& other) noexcept;
+        ~Lease();
+
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+
+        Interpreter* operator->() const { return _interpreter.get(); }
+        Interpreter& operator*() const { return *_interpreter; }
+        Interpreter* Get() const { return _interpreter.get(); }
+        explicit operator bool() const { return _interpreter != nullptr; }
+
+        /**
+         * @brief 소멸을 기다리지 않고 바로 반납
+         */
+        void Release();
+
+    private:
+        friend class InterpreterPool;
+
+        Lease(InterpreterPool* pool, std::unique_ptr<Interpreter> interpreter, const Interpreter* module)
+            : _pool(pool), _interpreter(std::move(interpreter)), _module(module)
+        {
+        }
+
+        InterpreterPool* _pool = nullptr;
+        std::unique_ptr<Interpreter> _interpreter;
+        const Interpreter* _module = nullptr;
+    };
+
+    /**
+     * @brief 풀 생성 (모든 인스턴스가 같은 세그먼트 크기를 씀)
+     *
+     * @param codeSize 코드 세그먼트 크기
+     * @param stackSize 스택 세그먼트 크기
+     * @param heapSize 힙 세그먼트 크기
+     * @param maxIdleCount 반납된 인스턴스를 보관할 최대 개수 (넘으면 해제)
+     */
+    InterpreterPool(size_t codeSize = 64 * 1024,
+                    size_t stackSize = 1024 * 1024,
+                    size_t heapSize = 1024 * 1024,
+                    size_t maxIdleCount = 16);
+
+    ~InterpreterPool() = default;
+
+    InterpreterPool(const InterpreterPool&) = delete;
+    InterpreterPool& operator=(const InterpreterPool&) = delete;
+
+    /**
+     * @brief 모듈을 올린 인스턴스 빌리기 (LoadBytecode()와 같은 형식, 암호화된 바이트코드 포함)
+     *
+     * 같은 모듈을 마지막으로 실행한 인스턴스를 우선 빌려 주고, 없으면 다른 반납 인스턴스나 새 인스턴스에 올림
+     * 빌려 준 인스턴스는 Reset() 상태이므로 PushParameter() 후 Execute() 가능
+     *
+     * @param bytecode 바이트코드 버퍼
+     * @param size 바이트코드 크기
+     * @return Lease 빌려 간 인스턴스
+     */
+    Lease Acquire(const uint8_t* bytecode, size_t size);
+
+    /**
+     * @brief 반납되어 보관 중인 인스턴스 수
+     */
+    size_t GetIdleCount() const;
+
+    /**
+     * @brief 풀 통계
+     */
+    Stats GetStats() const;
+
+private:
+    struct IdleEntry
+    {
+        std::unique_ptr<Interpreter> interpreter;
+        const Interpreter* module;  ///< 코드 세그먼트를 공유 중인 모듈 원본 (없으면 nullptr)
+    };
+
+    size_t _codeSize;
+    size_t _stackSize;
+    size_t _heapSize;
+    size_t _maxIdleCount;
+
+    mutable std::mutex _mutex;
+    std::vector<IdleEntry> _idle;
+
+    // 바이트코드 → 모듈 원본 (코드 세그먼트와 분석 결과만 쓰므로 스택/힙은 최소 크기)
+    std::map<std::vector<uint8_t>, std::unique_ptr<Interpreter>> _modules;
+
+    Stats _stats;
+
+    /**
+     * @brief 모듈 원본 조회, 없으면 로드 (락을 잡은 상태에서 호출)
+     */
+    const Interpreter& _GetModule(const uint8_t* bytecode, size_t size);
+
+    /**
+     * @brief 반납된 인스턴스를 지우고 보관
+     */
+    void _Return(std::unique_ptr<Interpreter> interpreter, const Interpreter* module);
+};
+
+} // namespace Engine
+} // namespace DarkMatterVM
@@ -0,0 +1,188 @@
+#include "RegisterInterpreter.h"
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <common/Logger.h>
+#include <memory/ArenaMemory.h>
+
+namespace DarkMatterVM {
+namespace Engine {
+
+RegisterInterpreter::RegisterInterpreter(size_t codeSize, size_t stackSize, size_t heapSize)
+{
+    _memoryManager = std::make_unique<Memory::MemoryManager>(codeSize, stackSize, heapSize);
+}
+
+bool RegisterInterpreter::LoadModule(const uint8_t* data, size_t size)
+{
+    RegisterModule module;
+    std::string error;
+    if (!RegisterModule::Deserialize(data, size, module, error))
+    {
+        Logger::Error("RegisterInterpreter", "모듈 로드 실패: " + error);
+        return false;
+    }
+
+    return LoadModule(std::move(module));
+}
+
+bool RegisterInterpreter::LoadModule(RegisterModule module)
+{
+    std::string error;
+    if (!module.Validate(error))
+    {
+        Logger::Error("RegisterInterpreter", "모듈 검증 실패: " + error);
+        return false;
+    }
+
+    _module = std::move(module);
+    Reset();
+    return true;
+}
+
+void RegisterInterpreter::Reset()
+{
+    _frame.fill(0);
+
+    // RK 상수 영역 채우기
+    size_t rkCount = std::min<size_t>(_module.constants.size(), kMaxRKConstants);
+    std::copy_n(_module.constants.begin(), rkCount, _frame.begin() + kRegConstantFlag);
+
+    _returnValue = 0;
+    _pc = 0;
+}
+
+int RegisterInterpreter::Execute()
+{
+    uint64_t* frame = _frame.data();
+    const RegInstruction* code = _module.code.data();
+    const uint64_t* constants = _module.constants.data();
+    auto& heapSegment = _memoryManager->GetSegment(Memory::MemorySegmentType::HEAP);
+
+    // Validate()를 통과한 모듈은 TRAP/HALT/JMP로 끝나므로 pc 범위 검사 생략
+    size_t pc = _pc;
+
+    try
+    {
+        while (true)
+        {
+            const RegInstruction& ins = code[pc++];
+            const uint64_t b = frame[ins.b];
+            const uint64_t c = frame[ins.c];
+
+            switch (static_cast<RegOpcode>(ins.op))
+            {
+                case RegOpcode::MOVE:   frame[ins.a] = b; break;
+                case RegOpcode::LOADK:  frame[ins.a] = constants[ins.ext]; break;
+
+                case RegOpcode::ADD:    frame[ins.a] = b + c; break;
+                case RegOpcode::SUB:    frame[ins.a] = b - c; break;
+                case RegOpcode::MUL:    frame[ins.a] = b * c; break;
+                case RegOpcode::DIV:
+                    if (c == 0)
+                    {
+                        throw std::runtime_error("0으로 나누기 시도");
+                    }
+                    frame[ins.a] = b / c;
+                    break;
+                case RegOpcode::MOD:
+                    if (c == 0)
+                    {
+                        throw std::runtime_error("0으로 나누기 시도 (나머지 연산)");
+                    }
+                    frame[ins.a] = b % c;
+                    break;
+                case RegOpcode::AND:    frame[ins.a] = b & c; break;
+                case RegOpcode::OR:     frame[ins.a] = b | c; break;
+                case RegOpcode::XOR:    frame[ins.a] = b ^ c; break;
+                case RegOpcode::NOT:    frame[ins.a] = ~b; break;
+                case RegOpcode::SHL:    frame[ins.a] = c >= 64 ? 0 : b << c; break;
+                case RegOpcode::SHR:    frame[ins.a] = c >= 64 ? 0 : b >> c; break;
+
+                case RegOpcode::LOAD8:  frame[ins.a] = heapSegment.ReadByte(static_cast<size_t>(b)); break;
+                case RegOpcode::LOAD16: frame[ins.a] = heapSegment.ReadUInt16(static_cast<size_t>(b)); break;
+                case RegOpcode::LOAD32: frame[ins.a] = heapSegment.ReadUInt32(static_cast<size_t>(b)); break;
+                case RegOpcode::LOAD64: frame[ins.a] = _memoryManager->ReadUInt64(static_cast<size_t>(b)); break;
+                case RegOpcode::STORE8:  heapSegment.WriteByte(static_cast<size_t>(b), static_cast<uint8_t>(c)); break;
+                case RegOpcode::STORE16: heapSegment.WriteUInt16(static_cast<size_t>(b), static_cast<uint16_t>(c)); break;
+                case RegOpcode::STORE32: heapSegment.WriteUInt32(static_cast<size_t>(b), static_cast<uint32_t>(c)); break;
+                case RegOpcode::STORE64: _memoryManager->WriteUInt64(static_cast<size_t>(b), c); break;
+                case RegOpcode::MEMCPY:
+                    _memoryManager->CopyMemory(static_cast<size_t>(b), static_cast<size_t>(c),
+                                               static_cast<size_t>(frame[static_cast<uint8_t>(ins.ext)]));
+                    break;
+                case RegOpcode::MEMSET:
+                    _memoryManager->FillMemory(static_cast<size_t>(b), static_cast<uint8_t>(c),
+                                               static_cast<size_t>(frame[static_cast<uint8_t>(ins.ext)]));
+                    break;
+                case RegOpcode::MEMCMP:
+                    frame[ins.a] = static_cast<uint64_t>(static_cast<int64_t>(_memoryManager->CompareMemory(
+                        static_cast<size_t>(b), static_cast<size_t>(c), static_cast<size_t>(frame[static_cast<uint8_t>(ins.ext)]))));
+                    break;
+
+                case RegOpcode::JMP:    pc = ins.ext; break;
+                case RegOpcode::JZ:     if (b == 0) pc = ins.ext; break;
+                case RegOpcode::JNZ:    if (b != 0) pc = ins.ext; break;
+                case RegOpcode::JG:     if (b > c) pc = ins.ext; break;
+                case RegOpcode::JL:     if (b < c) pc = ins.ext; break;
+                case RegOpcode::JGE:    if (b >= c) pc = ins.ext; break;
+                case RegOpcode::JLE:    if (b <= c) pc = ins.ext; break;
+
+                case RegOpcode::ALLOC:  frame[ins.a] = _memoryManager->Allocate(static_cast<size_t>(b)); break;
+                case RegOpcode::FREE:   _memoryManager->Free(static_cast<size_t>(b)); break;
+                case RegOpcode::ARENA_BEGIN: _memoryManager->GetArenaMemory().Begin(); break;
+                case RegOpcode::ARENA_ALLOC: frame[ins.a] = _memoryManager->GetArenaMemory().Allocate(static_cast<size_t>(b)); break;
+                case RegOpcode::ARENA_RESET: _memoryManager->GetArenaMemory().Reset(); break;
+
+                case RegOpcode::HOSTCALL: _HostCall(ins.ext, b); break;
+
+                case RegOpcode::HALT:
+                    if (ins.a != 0)
+                    {
+                        _returnValue = b;
+                    }
+                    _pc = pc;
+                    return 0;
+
+                // RegOpcode::TRAP 포함
+                default:
+                {
+                    std::stringstream ss;
+                    ss << "알 수 없는 레지스터 명령어: 0x" << std::hex << static_cast<int>(ins.op)
+                       << " (인덱스 " << std::dec << (pc - 1) << ")";
+                    throw std::runtime_error(ss.str());
+                }
+            }
+        }
+    }
+    catch (const Memory::MemoryAccessException& e)
+    {
+        _pc = pc;
+        std::cerr << "메모리 접근 오류: " << e.what() << std::endl;
+        return -1;
+    }
+    catch (const std::exception& e)
+    {
+        _pc = pc;
+        std::cerr << "VM 실행 오류: " << e.what() << std::endl;
+        return -1;
+    }
+}
+
+void RegisterInterpreter::_HostCall(uint32_t functionId, uint64_t argument)
+{
+    switch (functionId)
+    {
+        case 0: // 값 출력
+            std::cout << "호스트 출력: " << argument << std::endl;
+            break;
+        case 1: // 문자 출력
+            std::cout << "호스트 문자 출력: " << static_cast<char>(argument) << std::endl;
+            break;
+        default:
+            throw std::runtime_error("알 수 없는 호스트 함수 ID: " + std::to_string(functionId));
+    }
+}
+
+} // namespace Engine
+} // namespace DarkMatterVM
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <memory/MemoryManager.h>
+#include "RegisterModule.h"
+
+namespace DarkMatterVM {
+namespace Engine {
+
+/**
+ * @brief 레지스터 ISA 인터프리터
+ *
+ * Interpreter와 같은 메모리 배치(MemoryManager)를 쓰며 힙/가상 주소 접근 의미도 같음
+ * 프레임은 레지스터 128개 + RK 상수 128개를 하나의 배열로 두어
+ * RK 오퍼랜드를 분기 없이 인덱스 하나로 읽음
+ */
+class RegisterInterpreter
+{
+public:
+    /**
+     * @brief 생성자
+     *
+     * @param codeSize 코드 세그먼트 크기 (기본 64KB)
+     * @param stackSize 스택 세그먼트 크기 (기본 1MB)
+     * @param heapSize 힙 세그먼트 크기 (기본 1MB)
+     */
+    RegisterInterpreter(size_t codeSize = 64 * 1024,
+                        size_t stackSize = 1024 * 1024,
+                        size_t heapSize = 1024 * 1024);
+
+    ~RegisterInterpreter() = default;
+
+    /**
+     * @brief 직렬화된 레지스터 모듈 로드
+     *
+     * @param data 모듈 데이터 (RegisterModule::Serialize 형식)
+     * @param size 데이터 크기
+     * @return bool 성공 여부 (형식 오류 시 Logger에 기록)
+     */
+    bool LoadModule(const uint8_t* data, size_t size);
+
+    /**
+     * @brief 레지스터 모듈 로드
+     *
+     * @param module 변환된 모듈
+     * @return bool 성공 여부 (RegisterModule::Validate 실패 시 false)
+     */
+    bool LoadModule(RegisterModule module);
+
+    /**
+     * @brief 레지스터, 반환 값 초기화
+     */
+    void Reset();
+
+    /**
+     * @brief 모듈 실행
+     *
+     * @return int 실행 결과 코드 (0: 정상 종료, -1: 실행 오류)
+     */
+    int Execute();
+
+    /**
+     * @brief 실행 결과 반환 값 조회
+     */
+    uint64_t GetReturnValue() const { return _returnValue; }
+
+    /**
+     * @brief 레지스터 값 조회 (디버깅 용)
+     */
+    uint64_t GetRegister(uint8_t index) const { return _frame[index & (kMaxRegisters - 1)]; }
+
+    /**
+     * @brief 로드된 모듈
+     */
+    const RegisterModule& GetModule() const { return _module; }
+
+private:
+    std::unique_ptr<Memory::MemoryManager> _memoryManager;
+    RegisterModule _module;
+
+    // [0, 128): 레지스터, [128, 256): RK 상수
+    std::array<uint64_t, 256> _frame{};
+
+    uint64_t _returnValue = 0;
+    size_t _pc = 0;
+
+    /**
+     * @brief 호스트 함수 호출 (Interpreter와 같은 함수 ID)
+     */
+    void _HostCall(uint32_t functionId, uint64_t argument);
+};
+
+} // namespace Engine
+} // namespace DarkMatterVM
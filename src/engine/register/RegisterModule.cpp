@@ -0,0 +1,196 @@
+#include "RegisterModule.h"
+#include <sstream>
+
+namespace DarkMatterVM {
+namespace Engine {
+
+namespace {
+
+void WriteLE(std::vector<uint8_t>& out, uint64_t value, size_t bytes)
+{
+    for (size_t i = 0; i < bytes; ++i)
+    {
+        out.push_back(static_cast<uint8_t>(value >> (i * 8)));
+    }
+}
+
+uint64_t ReadLE(const uint8_t* data, size_t bytes)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < bytes; ++i)
+    {
+        value |= static_cast<uint64_t>(data[i]) << (i * 8);
+    }
+    return value;
+}
+
+bool IsBranch(uint8_t op)
+{
+    return op >= static_cast<uint8_t>(RegOpcode::JMP) && op <= static_cast<uint8_t>(RegOpcode::JLE);
+}
+
+bool IsBulkMemory(uint8_t op)
+{
+    return op >= static_cast<uint8_t>(RegOpcode::MEMCPY) && op <= static_cast<uint8_t>(RegOpcode::MEMCMP);
+}
+
+} // namespace
+
+std::vector<uint8_t> RegisterModule::Serialize() const
+{
+    std::vector<uint8_t> out;
+    out.reserve(kHeaderSize + constants.size() * 8 + code.size() * 8);
+
+    WriteLE(out, kMagic, 4);
+    out.push_back(kVersion);
+    out.push_back(registerCount);
+    WriteLE(out, 0, 2);
+    WriteLE(out, constants.size(), 4);
+    WriteLE(out, code.size(), 4);
+
+    for (uint64_t constant : constants)
+    {
+        WriteLE(out, constant, 8);
+    }
+
+    for (const auto& instruction : code)
+    {
+        out.push_back(instruction.op);
+        out.push_back(instruction.a);
+        out.push_back(instruction.b);
+        out.push_back(instruction.c);
+        WriteLE(out, instruction.ext, 4);
+    }
+
+    return out;
+}
+
+bool RegisterModule::Deserialize(const uint8_t* data, size_t size, RegisterModule& module, std::string& error)
+{
+    if (size < kHeaderSize || ReadLE(data, 4) != kMagic)
+    {
+        error = "레지스터 모듈 헤더가 아님";
+        return false;
+    }
+
+    if (data[4] != kVersion)
+    {
+        error = "지원하지 않는 레지스터 모듈 버전: " + std::to_string(data[4]);
+        return false;
+    }
+
+    uint64_t constantCount = ReadLE(data + 8, 4);
+    uint64_t instructionCount = ReadLE(data + 12, 4);
+    if (size != kHeaderSize + constantCount * 8 + instructionCount * 8)
+    {
+        error = "레지스터 모듈 크기 불일치";
+        return false;
+    }
+
+    RegisterModule result;
+    result.registerCount = data[5];
+
+    const uint8_t* cursor = data + kHeaderSize;
+    result.constants.resize(static_cast<size_t>(constantCount));
+    for (auto& constant : result.constants)
+    {
+        constant = ReadLE(cursor, 8);
+        cursor += 8;
+    }
+
+    result.code.resize(static_cast<size_t>(instructionCount));
+    for (auto& instruction : result.code)
+    {
+        instruction.op = cursor[0];
+        instruction.a = cursor[1];
+        instruction.b = cursor[2];
+        instruction.c = cursor[3];
+        instruction.ext = static_cast<uint32_t>(ReadLE(cursor + 4, 4));
+        cursor += 8;
+    }
+
+    if (!result.Validate(error))
+    {
+        return false;
+    }
+
+    module = std::move(result);
+    return true;
+}
+
+bool RegisterModule::Validate(std::string& error) const
+{
+    // 코드 끝을 넘어 실행하지 않도록 마지막 명령어는 흐름을 끝내야 함
+    if (code.empty())
+    {
+        error = "빈 레지스터 모듈";
+        return false;
+    }
+
+    uint8_t lastOp = code.back().op;
+    if (lastOp != static_cast<uint8_t>(RegOpcode::TRAP) && lastOp != static_cast<uint8_t>(RegOpcode::HALT) &&
+        lastOp != static_cast<uint8_t>(RegOpcode::JMP))
+    {
+        error = "레지스터 모듈이 TRAP/HALT/JMP로 끝나지 않음";
+        return false;
+    }
+
+    for (const auto& instruction : code)
+    {
+        if (instruction.a >= kMaxRegisters)
+        {
+            error = "결과 레지스터 범위 초과";
+            return false;
+        }
+        for (uint8_t operand : {instruction.b, instruction.c})
+        {
+            if ((operand & kRegConstantFlag) && static_cast<uint32_t>(operand & ~kRegConstantFlag) >= constants.size())
+            {
+                error = "상수 풀 범위를 벗어난 RK 오퍼랜드";
+                return false;
+            }
+        }
+        if (IsBulkMemory(instruction.op) &&
+            (instruction.ext > 0xFF || ((instruction.ext & kRegConstantFlag) &&
+                                        (instruction.ext & ~kRegConstantFlag) >= constants.size())))
+        {
+            error = "MEMCPY/MEMSET/MEMCMP 길이 오퍼랜드 범위 초과";
+            return false;
+        }
+        if (IsBranch(instruction.op) && instruction.ext >= code.size())
+        {
+            error = "코드 범위를 벗어난 분기 목적지";
+            return false;
+        }
+        if (instruction.op == static_cast<uint8_t>(RegOpcode::LOADK) && instruction.ext >= constants.size())
+        {
+            error = "상수 풀 범위를 벗어난 LOADK";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::string RegisterModule::Disassemble() const
+{
+    auto operand = [](uint8_t rk)
+    {
+        return (rk & kRegConstantFlag) ? "K" + std::to_string(rk & ~kRegConstantFlag) : "R" + std::to_string(rk);
+    };
+
+    std::ostringstream out;
+    for (size_t i = 0; i < code.size(); ++i)
+    {
+        const auto& instruction = code[i];
+        out << i << "\t" << GetRegOpcodeMnemonic(static_cast<RegOpcode>(instruction.op))
+            << " a=R" << static_cast<int>(instruction.a)
+            << " b=" << operand(instruction.b)
+            << " c=" << operand(instruction.c)
+            << " ext=" << instruction.ext << "\n";
+    }
+    return out.str();
+}
+
+} // namespace Engine
+} // namespace DarkMatterVM
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../../../include/RegisterOpcodes.h"
+
+namespace DarkMatterVM {
+namespace Engine {
+
+/**
+ * @brief 레지스터 ISA 모듈 (상수 풀 + 명령어 배열)
+ *
+ * 직렬화 형식 (little-endian):
+ *   "DMRG" | version(1) | registerCount(1) | reserved(2) | constantCount(4) | instructionCount(4)
+ *   | constants(8 * constantCount) | instructions(8 * instructionCount)
+ */
+struct RegisterModule
+{
+    static constexpr uint32_t kMagic = 0x47524D44; // "DMRG"
+    static constexpr uint8_t kVersion = 1;
+    static constexpr size_t kHeaderSize = 16;
+
+    uint8_t registerCount = 0;              ///< 프레임당 사용하는 레지스터 수
+    std::vector<uint64_t> constants;        ///< 상수 풀
+    std::vector<RegInstruction> code;       ///< 명령어 배열
+
+    /**
+     * @brief 바이트 배열로 직렬화 (패키지 모듈 데이터로 사용)
+     */
+    std::vector<uint8_t> Serialize() const;
+
+    /**
+     * @brief 바이트 배열에서 모듈 복원
+     *
+     * 헤더와 크기를 확인한 뒤 Validate() 수행
+     *
+     * @param data 직렬화된 모듈
+     * @param size 데이터 크기
+     * @param module 복원된 모듈 (출력)
+     * @param error 실패 시 오류 메시지 (출력)
+     * @return bool 성공 여부
+     */
+    static bool Deserialize(const uint8_t* data, size_t size, RegisterModule& module, std::string& error);
+
+    /**
+     * @brief 실행 전 검사 (결과 레지스터, RK 상수 인덱스, 분기/LOADK 범위, 종료 명령어)
+     *
+     * 실행 루프는 이 검사를 통과한 모듈만 받으므로 명령어마다 범위를 확인하지 않음
+     *
+     * @param error 실패 시 오류 메시지 (출력)
+     * @return bool 유효 여부
+     */
+    bool Validate(std::string& error) const;
+
+    /**
+     * @brief 디스어셈블리 문자열 (디버깅용)
+     */
+    std::string Disassemble() const;
+};
+
+} // namespace Engine
+} // namespace DarkMatterVM
@@ -0,0 +1,582 @@
+#include "StackToRegisterTranslator.h"
+#include "../decoder/InstructionStream.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace DarkMatterVM {
+namespace Engine {
+
+namespace {
+
+bool IsJump(Opcode op)
+{
+    return op >= Opcode::JMP && op <= Opcode::JLE;
+}
+
+/**
+ * @brief 상수 피연산자끼리의 이항 연산 (인터프리터 핸들러와 같은 의미)
+ */
+uint64_t Fold(RegOpcode op, uint64_t a, uint64_t b)
+{
+    switch (op)
+    {
+        case RegOpcode::ADD:    return a + b;
+        case RegOpcode::SUB:    return a - b;
+        case RegOpcode::MUL:    return a * b;
+        case RegOpcode::DIV:    return a / b;
+        case RegOpcode::MOD:    return a % b;
+        case RegOpcode::AND:    return a & b;
+        case RegOpcode::OR:     return a | b;
+        case RegOpcode::XOR:    return a ^ b;
+        case RegOpcode::SHL:    return b >= 64 ? 0 : a << b;
+        case RegOpcode::SHR:    return b >= 64 ? 0 : a >> b;
+        default:                throw std::logic_error("상수 접기를 지원하지 않는 연산");
+    }
+}
+
+bool Compare(RegOpcode op, uint64_t a, uint64_t b)
+{
+    switch (op)
+    {
+        case RegOpcode::JG:     return a > b;
+        case RegOpcode::JL:     return a < b;
+        case RegOpcode::JGE:    return a >= b;
+        default:                return a <= b;
+    }
+}
+
+} // namespace
+
+bool StackToRegisterTranslator::Translate(const uint8_t* bytecode, size_t size, RegisterModule& module)
+{
+    _Reset();
+
+    try
+    {
+        InstructionStream stream;
+        stream.Decode(bytecode, size, false);
+
+        const size_t count = stream.GetCount();
+        const uint8_t* opcodes = stream.GetOpcodes();
+        const uint64_t* immediates = stream.GetImmediates();
+        const uint32_t* targets = stream.GetTargets();
+
+        // 분기 목적지 수집 (명령어 경계가 아닌 목적지는 레지스터 코드로 옮길 수 없음)
+        std::vector<bool> isLabel(count, false);
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (opcodes[i] == InstructionStream::kExitOpcode)
+            {
+                continue;
+            }
+
+            ++_stackInstructionCount;
+            if (IsJump(static_cast<Opcode>(opcodes[i])))
+            {
+                uint32_t target = targets[i];
+                if (target == InstructionStream::kNoIndex || opcodes[target] == InstructionStream::kExitOpcode)
+                {
+                    throw std::runtime_error("명령어 경계가 아닌 분기 목적지 (오프셋 " + std::to_string(immediates[i]) + ")");
+                }
+                isLabel[target] = true;
+            }
+        }
+
+        _labelDepth.assign(count, -1);
+        _labelPosition.assign(count, InstructionStream::kNoIndex);
+
+        bool reachable = true;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (isLabel[i])
+            {
+                if (reachable)
+                {
+                    _Flush();
+                    _MergeDepth(static_cast<uint32_t>(i), _stack.size());
+                }
+                else if (_labelDepth[i] >= 0)
+                {
+                    _stack.clear();
+                    for (int32_t depth = 0; depth < _labelDepth[i]; ++depth)
+                    {
+                        _PushRegister(static_cast<uint8_t>(depth));
+                    }
+                    reachable = true;
+                }
+                else
+                {
+                    throw std::runtime_error("뒤쪽 분기로만 도달하는 분기 지점의 스택 깊이를 알 수 없음");
+                }
+
+                _labelPosition[i] = static_cast<uint32_t>(_code.size());
+            }
+
+            if (!reachable)
+            {
+                continue;
+            }
+
+            const uint64_t immediate = immediates[i];
+            const uint32_t target = targets[i];
+
+            // 코드 끝, 정의되지 않은 opcode: 스택 VM과 마찬가지로 도달하면 실행 오류
+            if (opcodes[i] == InstructionStream::kExitOpcode)
+            {
+                _Emit(RegOpcode::TRAP);
+                reachable = false;
+                continue;
+            }
+
+            switch (static_cast<Opcode>(opcodes[i]))
+            {
+                case Opcode::PUSH8:
+                case Opcode::PUSH16:
+                case Opcode::PUSH32:
+                case Opcode::PUSH64:
+                    _PushConstant(immediate);
+                    break;
+                case Opcode::POP:
+                    _Pop();
+                    break;
+                case Opcode::DUP:
+                {
+                    Operand top = _Pop();
+                    _stack.push_back(top);
+                    _stack.push_back(top);
+                    break;
+                }
+                case Opcode::SWAP:
+                    _TranslateSwap();
+                    break;
+
+                case Opcode::ADD:   _TranslateBinary(RegOpcode::ADD); break;
+                case Opcode::SUB:   _TranslateBinary(RegOpcode::SUB); break;
+                case Opcode::MUL:   _TranslateBinary(RegOpcode::MUL); break;
+                case Opcode::DIV:   _TranslateBinary(RegOpcode::DIV); break;
+                case Opcode::MOD:   _TranslateBinary(RegOpcode::MOD); break;
+                case Opcode::AND:   _TranslateBinary(RegOpcode::AND); break;
+                case Opcode::OR:    _TranslateBinary(RegOpcode::OR); break;
+                case Opcode::XOR:   _TranslateBinary(RegOpcode::XOR); break;
+                case Opcode::SHL:   _TranslateBinary(RegOpcode::SHL); break;
+                case Opcode::SHR:   _TranslateBinary(RegOpcode::SHR); break;
+                case Opcode::NOT:
+                {
+                    Operand value = _Pop();
+                    if (value.isConstant)
+                    {
+                        _PushConstant(~value.value);
+                        break;
+                    }
+                    uint8_t dest = _Home(_stack.size());
+                    _Emit(RegOpcode::NOT, dest, _Encode(value));
+                    _PushRegister(dest);
+                    break;
+                }
+
+                case Opcode::LOAD8:
+                case Opcode::LOAD16:
+                case Opcode::LOAD32:
+                case Opcode::LOAD64:
+                {
+                    Operand address = _Pop();
+                    uint8_t dest = _Home(_stack.size());
+                    _Emit(static_cast<RegOpcode>(opcodes[i]), dest, _Encode(address));
+                    _PushRegister(dest);
+                    break;
+                }
+                case Opcode::STORE8:
+                case Opcode::STORE16:
+                case Opcode::STORE32:
+                case Opcode::STORE64:
+                {
+                    Operand value = _Pop();
+                    Operand address = _Pop();
+                    _Emit(static_cast<RegOpcode>(opcodes[i]), 0, _Encode(address), _Encode(value));
+                    break;
+                }
+                case Opcode::MEMCPY:
+                case Opcode::MEMSET:
+                case Opcode::MEMCMP:
+                {
+                    // 세 번째 오퍼랜드(길이)는 ext에 RK로 둠
+                    Operand size = _Pop();
+                    Operand second = _Pop();
+                    Operand first = _Pop();
+                    uint8_t dest = static_cast<Opcode>(opcodes[i]) == Opcode::MEMCMP ? _Home(_stack.size()) : 0;
+                    _Emit(static_cast<RegOpcode>(opcodes[i]), dest, _Encode(first), _Encode(second), _Encode(size));
+                    if (static_cast<Opcode>(opcodes[i]) == Opcode::MEMCMP)
+                    {
+                        _PushRegister(dest);
+                    }
+                    break;
+                }
+
+                case Opcode::JMP:
+                    _Flush();
+                    _MergeDepth(target, _stack.size());
+                    _EmitBranch(RegOpcode::JMP, target);
+                    reachable = false;
+                    break;
+                case Opcode::JZ:
+                case Opcode::JNZ:
+                    reachable = _TranslateConditional(static_cast<RegOpcode>(opcodes[i]), target, 1);
+                    break;
+                case Opcode::JG:
+                case Opcode::JL:
+                case Opcode::JGE:
+                case Opcode::JLE:
+                    reachable = _TranslateConditional(static_cast<RegOpcode>(opcodes[i]), target, 2);
+                    break;
+
+                case Opcode::ALLOC:
+                {
+                    Operand allocationSize = _Pop();
+                    uint8_t dest = _Home(_stack.size());
+                    _Emit(RegOpcode::ALLOC, dest, _Encode(allocationSize));
+                    _PushRegister(dest);
+                    break;
+                }
+                case Opcode::FREE:
+                {
+                    Operand address = _Pop();
+                    _Emit(RegOpcode::FREE, 0, _Encode(address));
+                    break;
+                }
+                case Opcode::ARENA_BEGIN:
+                case Opcode::ARENA_RESET:
+                    _Emit(static_cast<RegOpcode>(opcodes[i]));
+                    break;
+                case Opcode::ARENA_ALLOC:
+                {
+                    Operand allocationSize = _Pop();
+                    uint8_t dest = _Home(_stack.size());
+                    _Emit(RegOpcode::ARENA_ALLOC, dest, _Encode(allocationSize));
+                    _PushRegister(dest);
+                    break;
+                }
+
+                case Opcode::HOSTCALL:
+                {
+                    // 인자를 받는 호스트 함수는 0(값 출력), 1(문자 출력)뿐, 나머지는 실행 시 오류
+                    uint8_t argument = 0;
+                    if (immediate <= 1)
+                    {
+                        argument = _Encode(_Pop());
+                    }
+                    _Emit(RegOpcode::HOSTCALL, 0, argument, 0, static_cast<uint32_t>(immediate));
+                    break;
+                }
+
+                case Opcode::HALT:
+                    if (_stack.empty())
+                    {
+                        _Emit(RegOpcode::HALT);
+                    }
+                    else
+                    {
+                        _Emit(RegOpcode::HALT, 1, _Encode(_stack.back()));
+                    }
+                    reachable = false;
+                    break;
+
+                case Opcode::CALL:
+                case Opcode::RET:
+                case Opcode::TAILCALL:
+                case Opcode::LDLOC:
+                case Opcode::STLOC:
+                case Opcode::LDARG:
+                case Opcode::THREAD:
+                default:
+                    throw std::runtime_error(std::string("지원하지 않는 명령어: ") +
+                                             GetOpcodeInfo(static_cast<Opcode>(opcodes[i])).mnemonic);
+            }
+        }
+
+        // 마지막 명령어가 흐름을 끝내지 않으면 코드 끝에서 멈추도록 TRAP 추가
+        if (_code.empty() || reachable)
+        {
+            _Emit(RegOpcode::TRAP);
+        }
+        else if (_code.back().op != static_cast<uint8_t>(RegOpcode::TRAP) &&
+                 _code.back().op != static_cast<uint8_t>(RegOpcode::HALT) &&
+                 _code.back().op != static_cast<uint8_t>(RegOpcode::JMP))
+        {
+            _Emit(RegOpcode::TRAP);
+        }
+
+        for (const auto& [position, label] : _fixups)
+        {
+            _code[position].ext = _labelPosition[label];
+        }
+
+        RegisterModule result;
+        result.registerCount = static_cast<uint8_t>(_scratchUsed ? kMaxRegisters : _maxRegister + 1);
+        result.constants = std::move(_constants);
+        result.code = std::move(_code);
+
+        std::string error;
+        if (!result.Validate(error))
+        {
+            throw std::runtime_error(error);
+        }
+
+        module = std::move(result);
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        _lastError = e.what();
+        return false;
+    }
+}
+
+void StackToRegisterTranslator::_Reset()
+{
+    _stack.clear();
+    _code.clear();
+    _constants.clear();
+    _constantIndex.clear();
+    _labelDepth.clear();
+    _labelPosition.clear();
+    _fixups.clear();
+    _maxRegister = 0;
+    _scratchUsed = false;
+    _stackInstructionCount = 0;
+    _lastError.clear();
+}
+
+void StackToRegisterTranslator::_Emit(RegOpcode op, uint8_t a, uint8_t b, uint8_t c, uint32_t ext)
+{
+    _code.push_back({static_cast<uint8_t>(op), a, b, c, ext});
+}
+
+void StackToRegisterTranslator::_EmitBranch(RegOpcode op, uint32_t target, uint8_t b, uint8_t c)
+{
+    _fixups.emplace_back(_code.size(), target);
+    _Emit(op, 0, b, c);
+}
+
+uint32_t StackToRegisterTranslator::_GetConstantIndex(uint64_t value)
+{
+    auto it = _constantIndex.find(value);
+    if (it != _constantIndex.end())
+    {
+        return it->second;
+    }
+
+    uint32_t index = static_cast<uint32_t>(_constants.size());
+    _constants.push_back(value);
+    _constantIndex.emplace(value, index);
+    return index;
+}
+
+uint8_t StackToRegisterTranslator::_Home(size_t depth)
+{
+    if (depth >= kScratchRegister)
+    {
+        throw std::runtime_error("스택 깊이가 레지스터 수를 초과함: " + std::to_string(depth));
+    }
+
+    _maxRegister = std::max(_maxRegister, static_cast<uint32_t>(depth));
+    return static_cast<uint8_t>(depth);
+}
+
+void StackToRegisterTranslator::_PushConstant(uint64_t value)
+{
+    uint32_t index = _GetConstantIndex(value);
+    if (index < kMaxRKConstants)
+    {
+        _stack.push_back({true, value, 0});
+        return;
+    }
+
+    // RK로 표현할 수 없는 상수는 바로 자기 자리 레지스터에 적재
+    uint8_t dest = _Home(_stack.size());
+    _Emit(RegOpcode::LOADK, dest, 0, 0, index);
+    _PushRegister(dest);
+}
+
+void StackToRegisterTranslator::_PushRegister(uint8_t reg)
+{
+    _stack.push_back({false, 0, reg});
+}
+
+StackToRegisterTranslator::Operand StackToRegisterTranslator::_Pop()
+{
+    if (_stack.empty())
+    {
+        throw std::runtime_error("스택 언더플로 (모듈 밖에서 전달된 값을 읽음)");
+    }
+
+    Operand operand = _stack.back();
+    _stack.pop_back();
+    return operand;
+}
+
+uint8_t StackToRegisterTranslator::_Encode(const Operand& operand) const
+{
+    if (operand.isConstant)
+    {
+        return static_cast<uint8_t>(kRegConstantFlag | _constantIndex.at(operand.value));
+    }
+    return operand.reg;
+}
+
+void StackToRegisterTranslator::_Flush()
+{
+    // 위쪽 슬롯부터 채우면 덮어쓰는 레지스터를 아래쪽 슬롯이 아직 읽지 않았음이 불변식으로 보장됨
+    for (size_t i = _stack.size(); i-- > 0;)
+    {
+        Operand& slot = _stack[i];
+        if (!slot.isConstant && slot.reg == i)
+        {
+            continue;
+        }
+
+        uint8_t dest = _Home(i);
+        _Emit(RegOpcode::MOVE, dest, _Encode(slot));
+        slot = {false, 0, dest};
+    }
+}
+
+void StackToRegisterTranslator::_PinOperands(size_t count)
+{
+    size_t remaining = _stack.size() - count;
+    for (size_t i = _stack.size(); i-- > remaining;)
+    {
+        Operand& slot = _stack[i];
+        if (slot.isConstant || slot.reg >= remaining)
+        {
+            continue;
+        }
+
+        // 가리키는 레지스터의 주인 슬롯이 자기 자리에 있으면 _Flush()가 건드리지 않음
+        const Operand& owner = _stack[slot.reg];
+        if (!owner.isConstant && owner.reg == slot.reg)
+        {
+            continue;
+        }
+
+        // 스택 위쪽 레지스터는 어떤 슬롯도 가리키지 않으므로 그쪽으로 옮김 (곧바로 꺼내 쓰므로 불변식 유지)
+        uint8_t dest = _Home(_stack.size() + (i - remaining));
+        _Emit(RegOpcode::MOVE, dest, slot.reg);
+        slot.reg = dest;
+    }
+}
+
+void StackToRegisterTranslator::_MergeDepth(uint32_t label, size_t depth)
+{
+    if (_labelDepth[label] < 0)
+    {
+        _labelDepth[label] = static_cast<int32_t>(depth);
+    }
+    else if (static_cast<size_t>(_labelDepth[label]) != depth)
+    {
+        throw std::runtime_error("분기 지점마다 스택 깊이가 다름 (" + std::to_string(_labelDepth[label]) +
+                                 " / " + std::to_string(depth) + ")");
+    }
+}
+
+void StackToRegisterTranslator::_TranslateBinary(RegOpcode op)
+{
+    Operand b = _Pop();
+    Operand a = _Pop();
+
+    // 0으로 나누기는 실행 시 오류가 나도록 접지 않음
+    bool divideByZero = (op == RegOpcode::DIV || op == RegOpcode::MOD) && b.isConstant && b.value == 0;
+    if (a.isConstant && b.isConstant && !divideByZero)
+    {
+        _PushConstant(Fold(op, a.value, b.value));
+        return;
+    }
+
+    // 불변식상 남은 슬롯은 결과 레지스터보다 낮은 번호만 가리킴
+    uint8_t dest = _Home(_stack.size());
+    _Emit(op, dest, _Encode(a), _Encode(b));
+    _PushRegister(dest);
+}
+
+void StackToRegisterTranslator::_TranslateSwap()
+{
+    if (_stack.size() < 2)
+    {
+        throw std::runtime_error("스택 언더플로 (SWAP)");
+    }
+
+    const size_t lower = _stack.size() - 2;
+    Operand lowerSlot = _stack[lower];
+    Operand upperSlot = _stack[lower + 1];
+
+    // 아래로 내려오는 값이 자기보다 위 번호 레지스터(R[lower+1])에 있을 때만 실제 이동 필요
+    if (!upperSlot.isConstant && upperSlot.reg > lower)
+    {
+        uint8_t lowerHome = _Home(lower);
+        uint8_t upperHome = _Home(lower + 1);
+
+        if (!lowerSlot.isConstant && lowerSlot.reg == lowerHome)
+        {
+            _Emit(RegOpcode::MOVE, kScratchRegister, lowerHome);
+            _Emit(RegOpcode::MOVE, lowerHome, upperHome);
+            _Emit(RegOpcode::MOVE, upperHome, kScratchRegister);
+            _scratchUsed = true;
+
+            _stack[lower] = {false, 0, lowerHome};
+            _stack[lower + 1] = {false, 0, upperHome};
+            return;
+        }
+
+        _Emit(RegOpcode::MOVE, lowerHome, upperHome);
+        upperSlot = {false, 0, lowerHome};
+    }
+
+    _stack[lower] = upperSlot;
+    _stack[lower + 1] = lowerSlot;
+}
+
+bool StackToRegisterTranslator::_TranslateConditional(RegOpcode op, uint32_t target, size_t operandCount)
+{
+    if (_stack.size() < operandCount)
+    {
+        throw std::runtime_error("스택 언더플로 (조건 분기)");
+    }
+
+    _PinOperands(operandCount);
+    Operand b = _Pop();
+    Operand a = operandCount == 2 ? _Pop() : b;
+    _Flush();
+
+    if (a.isConstant && b.isConstant)
+    {
+        bool taken = false;
+        switch (op)
+        {
+            case RegOpcode::JZ:     taken = b.value == 0; break;
+            case RegOpcode::JNZ:    taken = b.value != 0; break;
+            default:                taken = Compare(op, a.value, b.value); break;
+        }
+
+        if (!taken)
+        {
+            return true;
+        }
+
+        _MergeDepth(target, _stack.size());
+        _EmitBranch(RegOpcode::JMP, target);
+        return false;
+    }
+
+    _MergeDepth(target, _stack.size());
+    if (operandCount == 1)
+    {
+        _EmitBranch(op, target, _Encode(b));
+    }
+    else
+    {
+        _EmitBranch(op, target, _Encode(a), _Encode(b));
+    }
+    return true;
+}
+
+} // namespace Engine
+} // namespace DarkMatterVM
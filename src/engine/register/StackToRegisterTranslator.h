@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "RegisterModule.h"
+
+namespace DarkMatterVM {
+namespace Engine {
+
+/**
+ * @brief 스택 바이트코드 → 레지스터 ISA 변환기
+ *
+ * 스택 깊이 d의 슬롯을 레지스터 R[d]에 대응시키고, 변환 중에는 심볼릭 스택으로
+ * 상수와 복제(DUP)/교환(SWAP)을 명령어 없이 추적하여 PUSH/DUP/SWAP/POP을 없앰
+ * 소비하는 명령어가 나올 때만 상수는 RK 오퍼랜드로, 값은 3-주소 명령어로 내보냄
+ *
+ * 분기 지점과 분기 직전에는 모든 슬롯을 R[d]에 실체화하므로 각 분기 지점의 스택 깊이는
+ * 모든 경로에서 같아야 함. 동적 목적지(CALL/RET), 프레임 슬롯(LDLOC/STLOC/LDARG)과 THREAD는 지원하지 않으며,
+ * 이런 모듈은 변환에 실패하고 스택 ISA로 남음
+ *
+ * 심볼릭 스택 불변식: 깊이 i 슬롯이 레지스터를 가리키면 그 레지스터 번호는 i 이하
+ */
+class StackToRegisterTranslator {
+public:
+    /**
+     * @brief 두 레지스터 값을 맞바꿀 때 쓰는 임시 레지스터
+     */
+    static constexpr uint8_t kScratchRegister = static_cast<uint8_t>(kMaxRegisters - 1);
+
+    StackToRegisterTranslator() = default;
+    ~StackToRegisterTranslator() = default;
+
+    /**
+     * @brief 스택 바이트코드를 레지스터 모듈로 변환
+     *
+     * @param bytecode 스택 바이트코드 (암호화되지 않은 평문)
+     * @param size 바이트코드 크기
+     * @param module 변환 결과 (출력)
+     * @return bool 성공 여부 (실패 시 GetLastError())
+     */
+    bool Translate(const uint8_t* bytecode, size_t size, RegisterModule& module);
+
+    /**
+     * @brief 마지막 변환 실패 이유
+     */
+    const std::string& GetLastError() const { return _lastError; }
+
+    /**
+     * @brief 마지막 변환에서 읽은 스택 명령어 수 (레지스터 명령어 수와 비교용)
+     */
+    size_t GetStackInstructionCount() const { return _stackInstructionCount; }
+
+private:
+    /**
+     * @brief 심볼릭 스택 슬롯 (상수 또는 레지스터)
+     */
+    struct Operand
+    {
+        bool isConstant;
+        uint64_t value;     ///< 상수 값
+        uint8_t reg;        ///< 레지스터 번호
+    };
+
+    std::vector<Operand> _stack;
+    std::vector<RegInstruction> _code;
+    std::vector<uint64_t> _constants;
+    std::unordered_map<uint64_t, uint32_t> _constantIndex;
+
+    // 스트림 인덱스별 분기 지점 정보
+    std::vector<int32_t> _labelDepth;
+    std::vector<uint32_t> _labelPosition;
+
+    // (레지스터 명령어 인덱스, 목적지 스트림 인덱스)
+    std::vector<std::pair<size_t, uint32_t>> _fixups;
+
+    uint32_t _maxRegister = 0;
+    bool _scratchUsed = false;
+    size_t _stackInstructionCount = 0;
+    std::string _lastError;
+
+    void _Reset();
+
+    void _Emit(RegOpcode op, uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint32_t ext = 0);
+    void _EmitBranch(RegOpcode op, uint32_t target, uint8_t b = 0, uint8_t c = 0);
+
+    uint32_t _GetConstantIndex(uint64_t value);
+    uint8_t _Home(size_t depth);
+
+    void _PushConstant(uint64_t value);
+    void _PushRegister(uint8_t reg);
+    Operand _Pop();
+    uint8_t _Encode(const Operand& operand) const;
+
+    /**
+     * @brief 모든 슬롯을 R[d]에 실체화 (위쪽 슬롯부터)
+     */
+    void _Flush();
+
+    /**
+     * @brief 분기 오퍼랜드 보호: _Flush()가 덮어쓸 레지스터를 가리키는 최상위 count개 슬롯을 스택 위쪽 레지스터로 이동
+     */
+    void _PinOperands(size_t count);
+
+    /**
+     * @brief 분기 지점의 스택 깊이 기록 또는 확인
+     */
+    void _MergeDepth(uint32_t label, size_t depth);
+
+    void _TranslateBinary(RegOpcode op);
+    void _TranslateSwap();
+
+    /**
+     * @brief JZ/JNZ/JG/JL/JGE/JLE 변환 (피연산자가 모두 상수면 JMP 또는 제거)
+     *
+     * @return bool 다음 명령어로 흐름이 이어지는지 여부
+     */
+    bool _TranslateConditional(RegOpcode op, uint32_t target, size_t operandCount);
+};
+
+} // namespace Engine
+} // namespace DarkMatterVM
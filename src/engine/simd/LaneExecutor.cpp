@@ -0,0 +1,333 @@
+#include "LaneExecutor.h"
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace DarkMatterVM {
+namespace Engine {
+
+namespace {
+
+#if DMVM_LANE_VECTOR_EXTENSIONS
+
+// 레인 kLaneCount개짜리 uint64_t 벡터 (산술/논리 연산자는 컴파일러가 SIMD 명령어로 내림)
+typedef uint64_t LaneVector __attribute__((vector_size(LaneExecutor::kLaneCount * sizeof(uint64_t))));
+
+// 벡터를 값으로 반환하면 AVX-512를 켜지 않은 빌드에서 호출 규약 경고(-Wpsabi)가 나므로 참조로 채움
+inline void Broadcast(LaneVector& lanes, uint64_t value)
+{
+    lanes = LaneVector{} + value;
+}
+
+#else
+
+struct LaneVector
+{
+    uint64_t lanes[LaneExecutor::kLaneCount];
+
+    uint64_t& operator[](size_t lane) { return lanes[lane]; }
+    uint64_t operator[](size_t lane) const { return lanes[lane]; }
+};
+
+#define DMVM_LANE_BINARY_OPERATOR(op)                                   \
+    inline LaneVector operator op(const LaneVector& a, const LaneVector& b) \
+    {                                                                   \
+        LaneVector result;                                              \
+        for (size_t lane = 0; lane < LaneExecutor::kLaneCount; ++lane)  \
+        {                                                               \
+            result[lane] = a[lane] op b[lane];                          \
+        }                                                               \
+        return result;                                                  \
+    }
+
+DMVM_LANE_BINARY_OPERATOR(+)
+DMVM_LANE_BINARY_OPERATOR(-)
+DMVM_LANE_BINARY_OPERATOR(*)
+DMVM_LANE_BINARY_OPERATOR(&)
+DMVM_LANE_BINARY_OPERATOR(|)
+DMVM_LANE_BINARY_OPERATOR(^)
+
+#undef DMVM_LANE_BINARY_OPERATOR
+
+inline LaneVector operator~(const LaneVector& a)
+{
+    LaneVector result;
+    for (size_t lane = 0; lane < LaneExecutor::kLaneCount; ++lane)
+    {
+        result[lane] = ~a[lane];
+    }
+    return result;
+}
+
+inline void Broadcast(LaneVector& lanes, uint64_t value)
+{
+    std::fill(std::begin(lanes.lanes), std::end(lanes.lanes), value);
+}
+
+#endif
+
+/**
+ * @brief 명령어가 실행 전에 읽는 스택 슬롯 수
+ */
+size_t GetStackReads(Opcode op)
+{
+    switch (op)
+    {
+        case Opcode::PUSH8:
+        case Opcode::PUSH16:
+        case Opcode::PUSH32:
+        case Opcode::PUSH64:
+        case Opcode::JMP:
+        case Opcode::HALT:      return 0;
+        case Opcode::POP:
+        case Opcode::DUP:
+        case Opcode::NOT:
+        case Opcode::JZ:
+        case Opcode::JNZ:       return 1;
+        default:                return 2;
+    }
+}
+
+} // namespace
+
+bool LaneExecutor::IsSupported(uint8_t opcode)
+{
+    switch (static_cast<Opcode>(opcode))
+    {
+        case Opcode::PUSH8: case Opcode::PUSH16: case Opcode::PUSH32: case Opcode::PUSH64:
+        case Opcode::POP: case Opcode::DUP: case Opcode::SWAP:
+        case Opcode::ADD: case Opcode::SUB: case Opcode::MUL: case Opcode::DIV: case Opcode::MOD:
+        case Opcode::AND: case Opcode::OR: case Opcode::XOR: case Opcode::NOT:
+        case Opcode::SHL: case Opcode::SHR:
+        case Opcode::JMP: case Opcode::JZ: case Opcode::JNZ:
+        case Opcode::JG: case Opcode::JL: case Opcode::JGE: case Opcode::JLE:
+        case Opcode::HALT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool LaneExecutor::Analyze(const uint8_t* code, size_t size)
+{
+    _stream.Decode(code, size, false);
+
+    const size_t count = _stream.GetCount();
+    const uint8_t* opcodes = _stream.GetOpcodes();
+    const uint64_t* immediates = _stream.GetImmediates();
+    const uint32_t* nextOffsets = _stream.GetNextOffsets();
+
+    _offsets.resize(count);
+    _eligible = size > 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (opcodes[i] == InstructionStream::kExitOpcode)
+        {
+            _offsets[i] = static_cast<uint32_t>(immediates[i]);
+            continue;
+        }
+
+        _offsets[i] = i == 0 ? 0 : nextOffsets[i - 1];
+
+        // 메모리/호출/호스트 명령어가 하나라도 있으면 레인 실행 대상이 아님
+        if (!IsSupported(opcodes[i]))
+        {
+            _eligible = false;
+        }
+    }
+
+    return _eligible;
+}
+
+size_t LaneExecutor::Execute(const uint64_t* args, size_t argc, size_t laneCount, uint64_t* results, const LaneFallback& fallback)
+{
+    laneCount = std::min(laneCount, kLaneCount);
+    _stats.groupCount++;
+
+    size_t failures = 0;
+
+    // 인자가 벡터 스택보다 많으면 처음부터 스칼라로 실행
+    if (!_eligible || argc > kMaxStackDepth)
+    {
+        for (size_t lane = 0; lane < laneCount; ++lane)
+        {
+            if (!fallback(lane, 0, args + lane * argc, argc, results[lane]))
+            {
+                results[lane] = 0;
+                failures++;
+            }
+        }
+        _stats.fallbackLaneCount += laneCount;
+        return failures;
+    }
+
+    const uint8_t* opcodes = _stream.GetOpcodes();
+    const uint64_t* immediates = _stream.GetImmediates();
+    const uint32_t* targets = _stream.GetTargets();
+    const uint32_t* nextOffsets = _stream.GetNextOffsets();
+
+    // 사용하지 않는 레인은 0으로 채워 계산만 함께 하고 결과/분기 판단에서는 제외
+    LaneVector stack[kMaxStackDepth];
+    size_t depth = argc;
+    for (size_t slot = 0; slot < argc; ++slot)
+    {
+        Broadcast(stack[slot], 0);
+        for (size_t lane = 0; lane < laneCount; ++lane)
+        {
+            stack[slot][lane] = args[lane * argc + slot];
+        }
+    }
+
+    const uint32_t activeMask = (1u << laneCount) - 1;
+
+    // mask에 속한 레인을 현재 스택 상태로 offset부터 스칼라 실행
+    auto runScalar = [&](uint32_t mask, size_t offset)
+    {
+        uint64_t laneStack[kMaxStackDepth];
+        for (size_t lane = 0; lane < laneCount; ++lane)
+        {
+            if ((mask & (1u << lane)) == 0)
+            {
+                continue;
+            }
+
+            for (size_t slot = 0; slot < depth; ++slot)
+            {
+                laneStack[slot] = stack[slot][lane];
+            }
+
+            if (!fallback(lane, offset, laneStack, depth, results[lane]))
+            {
+                results[lane] = 0;
+                failures++;
+            }
+            _stats.fallbackLaneCount++;
+        }
+    };
+
+    uint32_t pc = 0;
+    while (true)
+    {
+        Opcode op = static_cast<Opcode>(opcodes[pc]);
+
+        // EXIT, 스택 부족, 벡터 스택 한도: 이 명령어부터 스칼라로 실행 (오류도 스칼라가 보고)
+        if (opcodes[pc] == InstructionStream::kExitOpcode || depth < GetStackReads(op) || depth >= kMaxStackDepth)
+        {
+            runScalar(activeMask, _offsets[pc]);
+            return failures;
+        }
+
+        LaneVector* top = stack + (depth > 0 ? depth - 1 : 0);
+        switch (op)
+        {
+            case Opcode::PUSH8:
+            case Opcode::PUSH16:
+            case Opcode::PUSH32:
+            case Opcode::PUSH64:
+                Broadcast(stack[depth++], immediates[pc]);
+                break;
+            case Opcode::POP:
+                depth--;
+                break;
+            case Opcode::DUP:
+                stack[depth] = *top;
+                depth++;
+                break;
+            case Opcode::SWAP:
+                std::swap(top[0], top[-1]);
+                break;
+            case Opcode::ADD: top[-1] = top[-1] + top[0]; depth--; break;
+            case Opcode::SUB: top[-1] = top[-1] - top[0]; depth--; break;
+            case Opcode::MUL: top[-1] = top[-1] * top[0]; depth--; break;
+            case Opcode::AND: top[-1] = top[-1] & top[0]; depth--; break;
+            case Opcode::OR:  top[-1] = top[-1] | top[0]; depth--; break;
+            case Opcode::XOR: top[-1] = top[-1] ^ top[0]; depth--; break;
+            case Opcode::NOT: top[0] = ~top[0]; break;
+            case Opcode::DIV:
+            case Opcode::MOD:
+            case Opcode::SHL:
+            case Opcode::SHR:
+            {
+                // 레인별 연산 (64비트 나눗셈과 가변 시프트는 SIMD 명령어가 없음)
+                bool divide = op == Opcode::DIV || op == Opcode::MOD;
+                bool zeroDivisor = false;
+                for (size_t lane = 0; lane < laneCount; ++lane)
+                {
+                    zeroDivisor |= divide && top[0][lane] == 0;
+                }
+                if (zeroDivisor)
+                {
+                    runScalar(activeMask, _offsets[pc]);
+                    return failures;
+                }
+
+                for (size_t lane = 0; lane < laneCount; ++lane)
+                {
+                    uint64_t a = top[-1][lane];
+                    uint64_t b = top[0][lane];
+                    switch (op)
+                    {
+                        case Opcode::DIV: top[-1][lane] = a / b; break;
+                        case Opcode::MOD: top[-1][lane] = a % b; break;
+                        case Opcode::SHL: top[-1][lane] = b >= 64 ? 0 : a << b; break;
+                        default:          top[-1][lane] = b >= 64 ? 0 : a >> b; break;
+                    }
+                }
+                depth--;
+                break;
+            }
+            case Opcode::JMP:
+                pc = targets[pc];
+                continue;
+            case Opcode::HALT:
+                for (size_t lane = 0; lane < laneCount; ++lane)
+                {
+                    results[lane] = depth > 0 ? (*top)[lane] : 0;
+                }
+                _stats.vectorLaneCount += laneCount;
+                return failures;
+            default:
+            {
+                // 조건 분기: 레인별 조건을 비트 마스크로 모음 (JG/JL/JGE/JLE는 부호 없는 비교)
+                uint32_t taken = 0;
+                for (size_t lane = 0; lane < laneCount; ++lane)
+                {
+                    uint64_t b = top[0][lane];
+                    uint64_t a = depth > 1 ? top[-1][lane] : 0;
+                    bool condition = false;
+                    switch (op)
+                    {
+                        case Opcode::JZ:  condition = b == 0; break;
+                        case Opcode::JNZ: condition = b != 0; break;
+                        case Opcode::JG:  condition = a > b; break;
+                        case Opcode::JL:  condition = a < b; break;
+                        case Opcode::JGE: condition = a >= b; break;
+                        default:          condition = a <= b; break;
+                    }
+                    taken |= static_cast<uint32_t>(condition) << lane;
+                }
+
+                depth -= GetStackReads(op);
+
+                if (taken == activeMask)
+                {
+                    pc = targets[pc];
+                    continue;
+                }
+                if (taken != 0)
+                {
+                    // 레인마다 방향이 다르면 각자 분기 방향부터 스칼라 실행
+                    runScalar(taken, _offsets[targets[pc]]);
+                    runScalar(activeMask & ~taken, nextOffsets[pc]);
+                    return failures;
+                }
+                break;
+            }
+        }
+
+        pc++;
+    }
+}
+
+} // namespace Engine
+} // namespace DarkMatterVM
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "../decoder/InstructionStream.h"
+
+/**
+ * @brief GCC/Clang 벡터 확장 사용 여부
+ *
+ * 1이면 레인 벡터를 __attribute__((vector_size))로 선언하여 컴파일러가
+ * 빌드 대상에 맞는 SIMD 명령어(SSE2 기본, -mavx2/-mavx512f 지정 시 AVX2/AVX-512)로 내림
+ * 0이면(MSVC 등) 레인 배열 루프로 대체
+ */
+#ifndef DMVM_LANE_VECTOR_EXTENSIONS
+#if defined(__GNUC__) || defined(__clang__)
+#define DMVM_LANE_VECTOR_EXTENSIONS 1
+#else
+#define DMVM_LANE_VECTOR_EXTENSIONS 0
+#endif
+#endif
+
+namespace DarkMatterVM {
+namespace Engine {
+
+/**
+ * @brief 레인이 스칼라 인터프리터로 넘어갈 때 호출되는 함수
+ *
+ * @param lane 레인 번호
+ * @param resumeOffset 이어서 실행할 바이트 오프셋
+ * @param stack 레인의 스택 값 (0번이 가장 아래)
+ * @param depth 스택 값 개수
+ * @param result 실행 결과 반환 값
+ * @return bool 정상 종료 여부
+ */
+using LaneFallback = std::function<bool(size_t lane, size_t resumeOffset, const uint64_t* stack, size_t depth, uint64_t& result)>;
+
+/**
+ * @brief 분기 없는 산술 코드를 여러 입력에 대해 한 번에 실행하는 SIMD 레인 실행기
+ *
+ * VM 스택 슬롯 하나가 입력 kLaneCount개의 값을 담는 벡터이고, 명령어 하나를 모든 레인에 동시에 적용
+ * 로드 시점에 코드가 스택/산술/비교 분기/HALT만으로 이루어졌는지 검사하여 대상 여부를 결정
+ *
+ * 다음 경우에는 해당 명령어 직전 상태로 레인별 스칼라 실행(LaneFallback)으로 넘어가므로
+ * 결과와 오류는 스칼라 실행과 같음
+ * - 조건 분기에서 레인마다 방향이 다를 때 (각 레인은 자기 분기 방향부터 실행)
+ * - 스택 부족/벡터 스택 한도 초과, 0으로 나누기, 명령어 경계가 아닌 곳(EXIT)에 도달
+ */
+class LaneExecutor
+{
+public:
+    /**
+     * @brief 한 번에 실행하는 입력 수
+     */
+    static constexpr size_t kLaneCount = 8;
+
+    /**
+     * @brief 벡터 스택 최대 깊이 (넘으면 스칼라로 대체)
+     */
+    static constexpr size_t kMaxStackDepth = 64;
+
+    /**
+     * @brief 실행 통계
+     */
+    struct Stats
+    {
+        uint64_t groupCount = 0;        ///< 벡터로 시작한 입력 묶음 수
+        uint64_t vectorLaneCount = 0;   ///< 끝까지 벡터로 실행된 레인 수
+        uint64_t fallbackLaneCount = 0; ///< 스칼라로 넘어간 레인 수
+    };
+
+    LaneExecutor() = default;
+    ~LaneExecutor() = default;
+
+    /**
+     * @brief 코드를 디코딩하고 레인 실행 대상인지 검사
+     *
+     * @param code 바이트코드 (복호화된 평문)
+     * @param size 바이트코드 크기
+     * @return bool 대상 여부
+     */
+    bool Analyze(const uint8_t* code, size_t size);
+
+    /**
+     * @brief 로드된 코드가 레인 실행 대상인지 여부
+     */
+    bool IsEligible() const { return _eligible; }
+
+    /**
+     * @brief 입력 최대 kLaneCount개를 레인으로 나누어 실행
+     *
+     * @param args 인자 배열 (레인마다 argc개, 앞에서부터 푸시한 순서)
+     * @param argc 레인 하나의 인자 수
+     * @param laneCount 사용할 레인 수 (1 ~ kLaneCount)
+     * @param results 레인별 반환 값 (실패한 레인은 0)
+     * @param fallback 스칼라 실행 함수
+     * @return size_t 실패한 레인 수
+     */
+    size_t Execute(const uint64_t* args, size_t argc, size_t laneCount, uint64_t* results, const LaneFallback& fallback);
+
+    /**
+     * @brief 실행 통계
+     */
+    const Stats& GetStats() const { return _stats; }
+
+    /**
+     * @brief 실행 통계 초기화
+     */
+    void ResetStats() { _stats = Stats{}; }
+
+    /**
+     * @brief 레인 실행기가 처리하는 opcode인지 확인
+     */
+    static bool IsSupported(uint8_t opcode);
+
+private:
+    InstructionStream _stream;
+
+    // 명령어 인덱스별 바이트 오프셋 (EXIT 항목은 재개할 오프셋)
+    std::vector<uint32_t> _offsets;
+
+    bool _eligible = false;
+    Stats _stats;
+};
+
+} // namespace Engine
+} // namespace DarkMatterVM
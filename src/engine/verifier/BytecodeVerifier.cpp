@@ -0,0 +1,224 @@
+#include "BytecodeVerifier.h"
+#include <algorithm>
+
+namespace DarkMatterVM {
+namespace Engine {
+
+namespace {
+
+// 아직 도달하지 않은 오프셋
+constexpr int kUnvisited = INT32_MIN;
+
+bool IsConditionalBranch(Opcode op)
+{
+    return op >= Opcode::JZ && op <= Opcode::JLE;
+}
+
+} // namespace
+
+bool BytecodeVerifier::GetStackEffect(Opcode op, int& reads, int& delta)
+{
+    switch (op)
+    {
+        case Opcode::PUSH8:
+        case Opcode::PUSH16:
+        case Opcode::PUSH32:
+        case Opcode::PUSH64:    reads = 0; delta = 1; return true;
+        case Opcode::POP:       reads = 1; delta = -1; return true;
+        case Opcode::DUP:       reads = 1; delta = 1; return true;
+        case Opcode::SWAP:      reads = 2; delta = 0; return true;
+
+        case Opcode::ADD:
+        case Opcode::SUB:
+        case Opcode::MUL:
+        case Opcode::DIV:
+        case Opcode::MOD:
+        case Opcode::AND:
+        case Opcode::OR:
+        case Opcode::XOR:
+        case Opcode::SHL:
+        case Opcode::SHR:       reads = 2; delta = -1; return true;
+        case Opcode::NOT:       reads = 1; delta = 0; return true;
+
+        case Opcode::LOAD8:
+        case Opcode::LOAD16:
+        case Opcode::LOAD32:
+        case Opcode::LOAD64:    reads = 1; delta = 0; return true;
+        case Opcode::STORE8:
+        case Opcode::STORE16:
+        case Opcode::STORE32:
+        case Opcode::STORE64:   reads = 2; delta = -2; return true;
+        case Opcode::MEMCPY:
+        case Opcode::MEMSET:    reads = 3; delta = -3; return true;
+        case Opcode::MEMCMP:    reads = 3; delta = -2; return true;
+
+        case Opcode::JMP:       reads = 0; delta = 0; return true;
+        case Opcode::JZ:
+        case Opcode::JNZ:       reads = 1; delta = -1; return true;
+        case Opcode::JG:
+        case Opcode::JL:
+        case Opcode::JGE:
+        case Opcode::JLE:       reads = 2; delta = -2; return true;
+
+        // 프레임 슬롯은 피연산자 스택 깊이와 무관 (슬롯 범위는 실행 시 확인)
+        case Opcode::LDLOC:
+        case Opcode::LDARG:     reads = 0; delta = 1; return true;
+        case Opcode::STLOC:     reads = 1; delta = -1; return true;
+
+        case Opcode::ALLOC:     reads = 1; delta = 0; return true;
+        case Opcode::FREE:      reads = 1; delta = -1; return true;
+        case Opcode::ARENA_BEGIN:
+        case Opcode::ARENA_RESET: reads = 0; delta = 0; return true;
+        case Opcode::ARENA_ALLOC: reads = 1; delta = 0; return true;
+        case Opcode::HOSTCALL:  reads = 1; delta = -1; return true;
+        case Opcode::THREAD:    reads = 2; delta = -1; return true;
+
+        // 스택이 비어 있으면 꺼내지 않음
+        case Opcode::HALT:      reads = 0; delta = 0; return true;
+
+        default:
+            return false;
+    }
+}
+
+bool BytecodeVerifier::Verify(const uint8_t* code, size_t size)
+{
+    _verified = false;
+    _lastError.clear();
+    _requiredEntryDepth = 0;
+    _maxStackGrowth = 0;
+    _instructionCount = 0;
+    _hasHostCalls = false;
+
+    if (size == 0)
+    {
+        return _Fail(0, "빈 코드");
+    }
+
+    // 오프셋별 진입 시점 대비 스택 깊이 (명령어 실행 전)
+    std::vector<int> depths(size, kUnvisited);
+    std::vector<size_t> worklist = {0};
+    depths[0] = 0;
+
+    int required = 0;
+    int growth = 0;
+
+    auto reach = [&](size_t from, int64_t target, int depth)
+    {
+        if (target < 0 || static_cast<uint64_t>(target) >= size)
+        {
+            return _Fail(from, "분기 목적지가 코드 범위를 벗어남: " + std::to_string(target));
+        }
+
+        int& known = depths[static_cast<size_t>(target)];
+        if (known == kUnvisited)
+        {
+            known = depth;
+            worklist.push_back(static_cast<size_t>(target));
+        }
+        else if (known != depth)
+        {
+            return _Fail(static_cast<size_t>(target), "합류 지점의 스택 깊이가 다름 (" +
+                         std::to_string(known) + ", " + std::to_string(depth) + ")");
+        }
+        return true;
+    };
+
+    while (!worklist.empty())
+    {
+        size_t offset = worklist.back();
+        worklist.pop_back();
+
+        Opcode op = static_cast<Opcode>(code[offset]);
+        OpcodeInfo info = GetOpcodeInfo(op);
+
+        int reads = 0;
+        int delta = 0;
+        if (!GetStackEffect(op, reads, delta))
+        {
+            if (op == Opcode::CALL || op == Opcode::RET || op == Opcode::TAILCALL)
+            {
+                return _Fail(offset, std::string("실행 중에 목적지가 정해지는 명령어: ") + info.mnemonic);
+            }
+            return _Fail(offset, "정의되지 않은 opcode: " + std::to_string(code[offset]));
+        }
+
+        size_t next = offset + 1 + info.operandSize;
+        if (next > size)
+        {
+            return _Fail(offset, std::string("오퍼랜드가 잘림: ") + info.mnemonic);
+        }
+
+        if (op == Opcode::HOSTCALL && code[offset + 1] > 1)
+        {
+            return _Fail(offset, "알 수 없는 호스트 함수 ID: " + std::to_string(code[offset + 1]));
+        }
+        _hasHostCalls |= op == Opcode::HOSTCALL || op == Opcode::THREAD;
+
+        // 진입 시점 대비 깊이로 필요한 인자 수와 최대 증가량 계산
+        int depth = depths[offset];
+        required = std::max(required, reads - depth);
+        growth = std::max(growth, depth + std::max(delta, 0));
+
+        int after = depth + delta;
+        _instructionCount++;
+
+        if (op == Opcode::HALT)
+        {
+            continue;
+        }
+
+        if (op == Opcode::JMP || IsConditionalBranch(op))
+        {
+            int16_t relative = static_cast<int16_t>(code[offset + 1] | (code[offset + 2] << 8));
+            if (!reach(offset, static_cast<int64_t>(next) + relative, after))
+            {
+                return false;
+            }
+            if (op == Opcode::JMP)
+            {
+                continue;
+            }
+        }
+
+        // 폴스루
+        if (next >= size)
+        {
+            return _Fail(offset, "코드 끝을 지나 실행됨");
+        }
+        if (!reach(offset, static_cast<int64_t>(next), after))
+        {
+            return false;
+        }
+    }
+
+    // 도달한 명령어끼리 겹치면(명령어 중간으로 분기) 거부
+    size_t coveredEnd = 0;
+    for (size_t offset = 0; offset < size; ++offset)
+    {
+        if (depths[offset] == kUnvisited)
+        {
+            continue;
+        }
+        if (offset < coveredEnd)
+        {
+            return _Fail(offset, "명령어 경계가 아닌 곳으로 분기");
+        }
+        coveredEnd = offset + 1 + GetOpcodeInfo(static_cast<Opcode>(code[offset])).operandSize;
+    }
+
+    _requiredEntryDepth = static_cast<size_t>(required);
+    _maxStackGrowth = static_cast<size_t>(growth);
+    _verified = true;
+    return true;
+}
+
+bool BytecodeVerifier::_Fail(size_t offset, const std::string& message)
+{
+    _lastError = "오프셋 " + std::to_string(offset) + ": " + message;
+    _verified = false;
+    return false;
+}
+
+} // namespace Engine
+} // namespace DarkMatterVM
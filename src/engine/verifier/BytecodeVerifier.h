@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../../../include/Opcodes.h"
+
+namespace DarkMatterVM {
+namespace Engine {
+
+/**
+ * @brief 로드 시점 바이트코드 검증기
+ *
+ * 오프셋 0에서 도달할 수 있는 명령어를 제어 흐름 그래프를 따라 추상 실행하여 다음을 확인
+ * - opcode가 정의되어 있고 오퍼랜드가 코드 안에서 잘리지 않음 (HOSTCALL은 알려진 함수 ID)
+ * - 분기 목적지가 코드 안의 명령어 경계이고, 도달한 명령어끼리 바이트가 겹치지 않음
+ * - 명령어마다 진입 시점 대비 스택 깊이가 경로와 무관하게 같음 (합류 지점 깊이 일치)
+ * - 마지막 명령어가 코드 끝을 지나 실행되지 않음 (HALT 또는 무조건 분기로 끝남)
+ *
+ * 목적지가 실행 중에 정해지는 CALL/RET/TAILCALL은 검증할 수 없으므로 거부
+ * 통과하면 진입 시 필요한 스택 깊이와 최대 증가량이 정해지므로, 실행 시작 때 한 번만
+ * 스택 범위를 확인하면 명령어마다 확인할 필요가 없음
+ */
+class BytecodeVerifier
+{
+public:
+    BytecodeVerifier() = default;
+    ~BytecodeVerifier() = default;
+
+    /**
+     * @brief 코드 검증
+     *
+     * @param code 바이트코드 (복호화된 평문)
+     * @param size 바이트코드 크기
+     * @return bool 검증 통과 여부 (실패 시 GetLastError())
+     */
+    bool Verify(const uint8_t* code, size_t size);
+
+    /**
+     * @brief 마지막 Verify() 결과
+     */
+    bool IsVerified() const { return _verified; }
+
+    /**
+     * @brief 검증 실패 사유
+     */
+    const std::string& GetLastError() const { return _lastError; }
+
+    /**
+     * @brief 진입 시 스택에 있어야 하는 최소 슬롯 수 (인자 수)
+     */
+    size_t GetRequiredEntryDepth() const { return _requiredEntryDepth; }
+
+    /**
+     * @brief 진입 시점 대비 스택이 늘어나는 최대 슬롯 수
+     */
+    size_t GetMaxStackGrowth() const { return _maxStackGrowth; }
+
+    /**
+     * @brief 도달 가능한 명령어 수
+     */
+    size_t GetInstructionCount() const { return _instructionCount; }
+
+    /**
+     * @brief 도달 가능한 HOSTCALL/THREAD가 있는지 여부 (루프 밖 코드로 나가는 명령어)
+     */
+    bool HasHostCalls() const { return _hasHostCalls; }
+
+    /**
+     * @brief 명령어가 실행 전에 읽는 스택 슬롯 수와 실행 후 변화량
+     *
+     * @return bool 스택 효과가 정해진 명령어인지 여부 (CALL/RET/TAILCALL/정의되지 않은 opcode는 false)
+     */
+    static bool GetStackEffect(Opcode op, int& reads, int& delta);
+
+private:
+    bool _verified = false;
+    std::string _lastError;
+    size_t _requiredEntryDepth = 0;
+    size_t _maxStackGrowth = 0;
+    size_t _instructionCount = 0;
+    bool _hasHostCalls = false;
+
+    /**
+     * @brief 실패 기록 후 false 반환
+     */
+    bool _Fail(size_t offset, const std::string& message);
+};
+
+} // namespace Engine
+} // namespace DarkMatterVM
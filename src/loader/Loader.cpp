@@ -4,6 +4,8 @@
 #include <filesystem>
 #include <zlib.h>
 #include <common/Logger.h>
+#include <engine/Interpreter.h>
+#include <engine/register/RegisterInterpreter.h>
 
 namespace DarkMatterVM
 {
@@ -11,6 +13,9 @@ namespace DarkMatterVM
 // 패키지 파일 매직 넘버
 static const uint32_t PACKAGE_MAGIC = 0x4D564D44; // "DMVM" in ASCII
 
+// 지원하는 최신 패키지 형식 버전 (2: 모듈 이름 뒤에 명령어 집합 바이트 추가)
+static const uint8_t PACKAGE_VERSION = 2;
+
 // 패키지 헤더 구조체 (파일 형식)
 struct PackageHeader 
 {
@@ -28,6 +33,7 @@ struct PackageHeader
 
 Loader::Loader()
     : _packingOption(PackingOption::None)
+    , _packageVersion(PACKAGE_VERSION)
 {
 }
 
@@ -145,6 +151,36 @@ const std::vector<uint8_t>& Loader::GetBytecodeModule(const std::string& moduleN
     return _bytecodeModules.at(moduleName);
 }
 
+Engine::BytecodeIsa Loader::GetBytecodeModuleIsa(const std::string& moduleName) const
+{
+    return _bytecodeModuleIsas.at(moduleName);
+}
+
+int Loader::ExecuteBytecodeModule(const std::string& moduleName, uint64_t& returnValue) const
+{
+    const std::vector<uint8_t>& bytecode = _bytecodeModules.at(moduleName);
+    
+    if (GetBytecodeModuleIsa(moduleName) == Engine::BytecodeIsa::Register)
+    {
+        Engine::RegisterInterpreter interpreter;
+        if (!interpreter.LoadModule(bytecode.data(), bytecode.size()))
+        {
+            return -1;
+        }
+        
+        int result = interpreter.Execute();
+        returnValue = interpreter.GetReturnValue();
+        return result;
+    }
+    
+    Engine::Interpreter interpreter;
+    interpreter.LoadBytecode(bytecode.data(), bytecode.size());
+    
+    int result = interpreter.Execute();
+    returnValue = interpreter.GetReturnValue();
+    return result;
+}
+
 std::vector<std::string> Loader::GetBytecodeModuleNames() const
 {
     std::vector<std::string> names;
@@ -197,13 +233,15 @@ bool Loader::_ReadPackageHeader(const std::vector<uint8_t>& fileData, size_t& of
     }
     
     // 버전 확인
-    if (header.version != 1)
+    if (header.version != 1 && header.version != PACKAGE_VERSION)
     {
         _lastError = "지원되지 않는 패키지 버전: " + std::to_string(header.version);
         Logger::Error("Loader", _lastError);
         return false;
     }
     
+    _packageVersion = header.version;
+    
     // 패킹 옵션 설정
     _packingOption = static_cast<PackingOption>(header.packingFlags);
     
@@ -243,6 +281,7 @@ bool Loader::_ReadBytecodeModules(const std::vector<uint8_t>& fileData, size_t o
     {
         // 바이트코드 모듈 맵 초기화
         _bytecodeModules.clear();
+        _bytecodeModuleIsas.clear();
         
         // 각 모듈 읽기
         for (uint16_t i = 0; i < moduleCount; i++)
@@ -250,6 +289,23 @@ bool Loader::_ReadBytecodeModules(const std::vector<uint8_t>& fileData, size_t o
             // 모듈 이름 읽기
             std::string moduleName = _ReadString(fileData, offset);
             
+            // 명령어 집합 읽기 (버전 1 패키지에는 없으며 스택 ISA로 간주)
+            Engine::BytecodeIsa isa = Engine::BytecodeIsa::Stack;
+            if (_packageVersion >= 2)
+            {
+                if (offset >= fileData.size())
+                {
+                    throw std::out_of_range("파일 끝을 넘어 읽으려고 시도했습니다 (명령어 집합)");
+                }
+                
+                uint8_t isaValue = fileData[offset++];
+                if (isaValue > static_cast<uint8_t>(Engine::BytecodeIsa::Register))
+                {
+                    throw std::runtime_error("알 수 없는 명령어 집합: " + std::to_string(isaValue));
+                }
+                isa = static_cast<Engine::BytecodeIsa>(isaValue);
+            }
+            
             // 바이트코드 데이터 읽기
             std::vector<uint8_t> bytecodeData = _ReadDataBlock(fileData, offset);
             
@@ -266,6 +322,7 @@ bool Loader::_ReadBytecodeModules(const std::vector<uint8_t>& fileData, size_t o
             
             // 모듈 저장
             _bytecodeModules[moduleName] = std::move(bytecodeData);
+            _bytecodeModuleIsas[moduleName] = isa;
         }
         
         return true;
@@ -5,6 +5,7 @@
 #include <memory>
 #include <unordered_map>
 #include <packer/Packer.h>
+#include <Opcodes.h>
 
 namespace DarkMatterVM
 {
@@ -80,6 +81,27 @@ public:
      */
     std::vector<std::string> GetBytecodeModuleNames() const;
     
+    /**
+     * @brief 바이트코드 모듈의 명령어 집합 가져오기
+     * 
+     * @param moduleName 모듈 이름
+     * @return Engine::BytecodeIsa 명령어 집합 (버전 1 패키지는 항상 Stack)
+     * @throws std::out_of_range 모듈이 존재하지 않는 경우
+     */
+    Engine::BytecodeIsa GetBytecodeModuleIsa(const std::string& moduleName) const;
+    
+    /**
+     * @brief 바이트코드 모듈 실행
+     * 
+     * 모듈 헤더의 명령어 집합에 따라 Interpreter 또는 RegisterInterpreter로 실행
+     * 
+     * @param moduleName 모듈 이름
+     * @param returnValue 실행 결과 값 (HALT 반환 값)
+     * @return int 실행 결과 코드 (0: 정상 종료, -1: 로드 또는 실행 오류)
+     * @throws std::out_of_range 모듈이 존재하지 않는 경우
+     */
+    int ExecuteBytecodeModule(const std::string& moduleName, uint64_t& returnValue) const;
+    
     /**
      * @brief 리소스 존재 여부 확인
      * 
@@ -114,8 +136,10 @@ public:
 private:
     PackageMetadata _metadata;  ///< 패키지 메타데이터
     std::unordered_map<std::string, std::vector<uint8_t>> _bytecodeModules;  ///< 바이트코드 모듈
+    std::unordered_map<std::string, Engine::BytecodeIsa> _bytecodeModuleIsas;  ///< 모듈별 명령어 집합
     std::unordered_map<std::string, std::vector<uint8_t>> _resources;  ///< 리소스
     PackingOption _packingOption;  ///< 패킹 옵션
+    uint8_t _packageVersion;  ///< 패키지 형식 버전
     std::string _lastError;  ///< 마지막 오류 메시지
     
     /**
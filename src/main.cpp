@@ -5,6 +5,7 @@
 #include <locale.h>
 #include "tests/engine/TestEngine.h"
 #include "tests/translator/TestTranslator.h"
+#include "tests/benchmark/EngineBenchmark.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -175,6 +176,12 @@ void RunTranslatorTests()
 	}
 }
 
+void RunEngineBenchmarks()
+{
+	DarkMatterVM::Tests::EngineBenchmark benchmark;
+	benchmark.RunAll();
+}
+
 int main()
 {
 	// Windows 콘솔에서 UTF-8 한글 표시를 위한 설정
@@ -205,6 +212,9 @@ int main()
 	
 	// Translator TEST
 	RunTranslatorTests();
+	
+	// Engine BENCHMARK
+	RunEngineBenchmarks();
 
 	// Logger 정리
 	DarkMatterVM::Logger::Cleanup();
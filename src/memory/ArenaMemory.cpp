@@ -0,0 +1,98 @@
+#include "ArenaMemory.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace DarkMatterVM::Memory
+{
+
+ArenaMemory::ArenaMemory(HeapMemory& heap)
+    : _heap(heap)
+{
+}
+
+void ArenaMemory::Begin()
+{
+    _marks.push_back({_chunks.size(), _cursor, _limit});
+}
+
+size_t ArenaMemory::Allocate(size_t size)
+{
+    if (_marks.empty())
+    {
+        throw std::runtime_error("ArenaMemory: no active arena");
+    }
+
+    if (size == 0 || size > SIZE_MAX - kDefaultChunkSize)
+    {
+        throw std::runtime_error("ArenaMemory: invalid allocation size");
+    }
+
+    size = (size + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1);
+    if (size > _limit - _cursor)
+    {
+        _AddChunk(size);
+    }
+
+    size_t address = _cursor;
+    _cursor += size;
+
+    _stats.allocationCount++;
+    _stats.allocatedBytes += size;
+    return address;
+}
+
+void ArenaMemory::Reset()
+{
+    if (_marks.empty())
+    {
+        throw std::runtime_error("ArenaMemory: no active arena");
+    }
+
+    // 이 아레나에서 받은 청크는 받은 역순으로 돌려줌 (힙 뒤쪽 미사용 공간과 바로 병합)
+    const Mark mark = _marks.back();
+    _marks.pop_back();
+    while (_chunks.size() > mark.chunkCount)
+    {
+        _heap.Free(_chunks.back().offset);
+        _chunkBytes -= _chunks.back().size;
+        _chunks.pop_back();
+    }
+
+    _cursor = mark.cursor;
+    _limit = mark.limit;
+    _stats.resetCount++;
+}
+
+void ArenaMemory::Clear()
+{
+    _chunks.clear();
+    _marks.clear();
+    _cursor = 0;
+    _limit = 0;
+    _chunkBytes = 0;
+    _stats = ArenaStats();
+}
+
+ArenaStats ArenaMemory::GetStats() const
+{
+    ArenaStats stats = _stats;
+    stats.depth = _marks.size();
+    stats.chunkCount = _chunks.size();
+    stats.chunkBytes = _chunkBytes;
+    return stats;
+}
+
+void ArenaMemory::_AddChunk(size_t size)
+{
+    // 힙 블록 헤더를 빼고도 기본 크기를 다 쓰도록 맞춤
+    size_t chunkSize = std::max(size, kDefaultChunkSize - HeapMemory::kHeaderSize);
+    size_t offset = _heap.Allocate(chunkSize);
+
+    _chunks.push_back({offset, chunkSize});
+    _chunkBytes += chunkSize;
+    _cursor = offset;
+    _limit = offset + chunkSize;
+    _stats.chunkAllocations++;
+}
+
+} // namespace DarkMatterVM::Memory
@@ -0,0 +1,119 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "HeapMemory.h"
+
+namespace DarkMatterVM::Memory
+{
+
+/**
+ * @brief 아레나 할당 통계
+ */
+struct ArenaStats
+{
+    size_t depth = 0;               ///< 열려 있는 아레나 수
+    size_t chunkCount = 0;          ///< 힙에서 받아 둔 청크 수
+    size_t chunkBytes = 0;          ///< 받아 둔 청크 바이트 합
+    size_t allocationCount = 0;     ///< 누적 할당 횟수
+    size_t allocatedBytes = 0;      ///< 누적 할당 바이트 (8바이트 정렬 후)
+    size_t resetCount = 0;          ///< 누적 해제(아레나 닫기) 횟수
+    size_t chunkAllocations = 0;    ///< 힙에서 청크를 받은 누적 횟수
+};
+
+/**
+ * @brief 아레나(구역) 할당기
+ *
+ * HeapMemory에서 청크를 받아 포인터를 밀어 가며 할당하고, 아레나를 닫으면 그 안의 할당을 한 번에 해제
+ * - Begin(): 현재 위치를 표시하고 새 아레나를 엶 (중첩 가능, 안쪽 아레나는 바깥 청크의 남은 공간부터 씀)
+ * - Allocate(): 블록마다 헤더나 기록을 남기지 않고 위치만 옮김, 청크가 차면 힙에서 새 청크를 받음
+ * - Reset(): 표시한 위치로 되돌리고 그 뒤에 받은 청크만 힙에 돌려줌 (새 청크가 없었으면 O(1))
+ *
+ * 아레나에서 받은 주소는 힙 주소와 같은 형식(힙 세그먼트 오프셋)이며, HeapMemory::Free()로 해제할 수 없음
+ */
+class ArenaMemory
+{
+public:
+    /**
+     * @brief 기본 청크 크기 (이보다 큰 할당은 그 크기의 청크를 받음)
+     */
+    static constexpr size_t kDefaultChunkSize = 64 * 1024;
+
+    /**
+     * @brief 아레나 할당기 생성
+     *
+     * @param heap 청크를 받을 힙 메모리
+     */
+    explicit ArenaMemory(HeapMemory& heap);
+
+    ArenaMemory(const ArenaMemory&)            = delete;
+    ArenaMemory& operator=(const ArenaMemory&) = delete;
+
+    /**
+     * @brief 새 아레나 열기
+     */
+    void Begin();
+
+    /**
+     * @brief 가장 안쪽 아레나에서 할당
+     *
+     * @param size 할당할 크기
+     * @return size_t 할당된 메모리 주소 (힙 세그먼트 내 오프셋, 8바이트 정렬)
+     * @throw std::runtime_error 열린 아레나가 없거나 크기가 0일 때, 힙에서 청크를 받지 못할 때
+     */
+    size_t Allocate(size_t size);
+
+    /**
+     * @brief 가장 안쪽 아레나를 닫고 그 안의 할당을 모두 해제
+     *
+     * @throw std::runtime_error 열린 아레나가 없을 때
+     */
+    void Reset();
+
+    /**
+     * @brief 모든 아레나를 힙에 돌려주지 않고 잊음 (HeapMemory::Reset()과 함께 호출)
+     */
+    void Clear();
+
+    /**
+     * @brief 열려 있는 아레나 수
+     */
+    size_t GetDepth() const { return _marks.size(); }
+
+    /**
+     * @brief 할당 통계 조회
+     */
+    ArenaStats GetStats() const;
+
+private:
+    struct Chunk
+    {
+        size_t offset;  ///< 힙 주소
+        size_t size;    ///< 크기
+    };
+
+    /**
+     * @brief Begin() 시점의 위치 (Reset()이 되돌아갈 곳)
+     */
+    struct Mark
+    {
+        size_t chunkCount;
+        size_t cursor;
+        size_t limit;
+    };
+
+    /**
+     * @brief 힙에서 size 이상의 새 청크를 받아 할당 위치를 옮김
+     */
+    void _AddChunk(size_t size);
+
+    HeapMemory& _heap;              ///< 청크를 받을 힙
+    std::vector<Chunk> _chunks;     ///< 받아 둔 청크 (받은 순서)
+    std::vector<Mark> _marks;       ///< 열린 아레나별 시작 위치
+    size_t _cursor = 0;             ///< 다음 할당 위치
+    size_t _limit = 0;              ///< 현재 청크 끝
+    size_t _chunkBytes = 0;         ///< 받아 둔 청크 바이트 합
+    ArenaStats _stats;              ///< 누적 통계
+};
+
+} // namespace DarkMatterVM::Memory
@@ -1,12 +1,19 @@
 #include "HeapMemory.h"
+#include <algorithm>
+#include <bit>
 #include <stdexcept>
 
 namespace DarkMatterVM::Memory
 {
 
-HeapMemory::HeapMemory(MemorySegment& segment)
-    : _segment(segment), _nextHeapAddress(0)
+// 빈 블록 배치: [헤더][다음 빈 블록][이전 빈 블록(큰 블록만)] ... [블록 크기(큰 블록만, 마지막 8바이트)]
+
+HeapMemory::HeapMemory(MemorySegment& segment, const HeapGrowthPolicy& policy)
+    : _segment(segment), _policy(policy)
 {
+    _policy.initialSize = segment.GetSize();
+    _policy.maxSize = std::max(_policy.maxSize, _policy.initialSize);
+    Reset();
 }
 
 size_t HeapMemory::Allocate(size_t size)
@@ -16,75 +23,444 @@ size_t HeapMemory::Allocate(size_t size)
         throw std::runtime_error("HeapMemory: invalid allocation size");
     }
 
-    auto alignedSize = _Aligned(size);
+    if (size > std::max(_segment.GetSize(), _policy.maxSize))
+    {
+        throw std::runtime_error("HeapMemory: heap allocation failed (out of memory)");
+    }
+
+    size_t blockSize = std::max(kMinBlockSize, _Aligned(size + kHeaderSize, kGranule));
+    size_t block = kNone;
+
+    // 1) 같은 등급(작은 블록) 또는 올림한 구간(큰 블록)부터 비어 있지 않은 리스트의 머리: 반드시 충분히 큼
+    size_t bin = _FindBin(_BinIndex(blockSize, true));
+    if (bin != kNone)
+    {
+        block = _heads[bin];
+    }
+
+    // 2) 올림하지 않은 구간의 머리 블록 (뒤쪽 미사용 공간을 넓히기 전에 한 번만 확인)
+    if (block == kNone && blockSize > kSmallLimit)
+    {
+        size_t head = _heads[_BinIndex(blockSize, false)];
+        if (head != kNone && _BlockSize(_LoadWord(head)) >= blockSize)
+        {
+            block = head;
+        }
+    }
+
+    if (block != kNone)
+    {
+        blockSize = _TakeFree(block, _FreeBlockSize(block), blockSize);
+    }
+    else if (blockSize <= _segment.GetSize() - _top)
+    {
+        // 3) 뒤쪽 미사용 공간 (그 앞 블록은 빈 블록이 아님)
+        block = _CarveTop(blockSize);
+    }
+    else
+    {
+        // 4) 올림하지 않은 구간의 나머지 블록 (공간이 거의 다 찼을 때만 도달, 링크가 순환하면 블록 수를 넘기 전에 예외)
+        size_t steps = 0;
+        for (size_t candidate = blockSize > kSmallLimit ? _heads[_BinIndex(blockSize, false)] : kNone; 
+             candidate != kNone; candidate = _NextFree(candidate))
+        {
+            if (++steps > _top / kMinBlockSize)
+            {
+                throw std::runtime_error("HeapMemory: heap metadata corrupted");
+            }
+            size_t found = _FreeBlockSize(candidate);
+            if (found >= blockSize)
+            {
+                block = candidate;
+                blockSize = _TakeFree(block, found, blockSize);
+                break;
+            }
+        }
+
+        // 5) 정책 안에서 힙을 늘려 뒤쪽 미사용 공간에서 잘라 씀
+        if (block == kNone && _Grow(blockSize))
+        {
+            block = _CarveTop(blockSize);
+        }
+    }
 
-    std::lock_guard<std::mutex> lock(_heapMutex);
-    
-    // 간단한 선형 할당
-    if (_nextHeapAddress + alignedSize > _segment.GetSize())
+    if (block == kNone)
     {
         throw std::runtime_error("HeapMemory: heap allocation failed (out of memory)");
     }
-    
-    size_t address = _nextHeapAddress;
-    _nextHeapAddress += alignedSize;
-    
-    // 할당 정보 저장
-    _allocatedBlocks[address] = alignedSize;
-    
-    return address;
+
+    _StoreWord(block, _MakeHeader(blockSize, kUsed));
+
+    _stats.allocationCount++;
+    _stats.liveBlocks++;
+    _stats.liveBytes += blockSize;
+    _stats.peakLiveBytes = std::max(_stats.peakLiveBytes, _stats.liveBytes);
+
+    return block + kHeaderSize;
 }
 
 void HeapMemory::Free(size_t address)
 {
-    std::lock_guard<std::mutex> lock(_heapMutex);
-    
-    auto it = _allocatedBlocks.find(address);
-    if (it == _allocatedBlocks.end())
+    if (address < kHeaderSize || address >= _top || (address - kHeaderSize) % kGranule != 0)
+    {
+        throw std::runtime_error("HeapMemory: invalid heap address for free");
+    }
+
+    size_t block = address - kHeaderSize;
+    uint64_t header = _LoadWord(block);
+    size_t size = _BlockSize(header);
+    if ((header & kMagicMask) != kMagic || (header & kUsed) == 0 || size < kMinBlockSize || size > _top - block)
     {
         throw std::runtime_error("HeapMemory: invalid heap address for free");
     }
-    
-    // 현재는 실제로 메모리를 해제하지 않고 블록 정보만 제거
-    // 간단한 구현을 위해 재사용 없음
-    _allocatedBlocks.erase(it);
+
+    // 병합할 이웃 블록을 바꾸기 전에 모두 확인: 앞 블록은 꼬리에 적힌 크기 위치에 같은 크기의 빈 블록 헤더가 있어야 함
+    size_t prevSize = 0;
+    if ((header & kPrevFree) != 0)
+    {
+        prevSize = block >= kMinBlockSize ? static_cast<size_t>(_LoadWord(block - sizeof(uint64_t))) : 0;
+        if (prevSize < kMinBlockSize || prevSize > block || prevSize % kGranule != 0 || 
+            _FreeBlockSize(block - prevSize) != prevSize)
+        {
+            throw std::runtime_error("HeapMemory: heap metadata corrupted");
+        }
+        _CheckLinks(block - prevSize, prevSize);
+    }
+
+    size_t next = block + size;
+    size_t nextSize = 0;
+    if (next != _top)
+    {
+        uint64_t nextHeader = _LoadWord(next);
+        if ((nextHeader & kMagicMask) != kMagic)
+        {
+            throw std::runtime_error("HeapMemory: heap metadata corrupted");
+        }
+        if ((nextHeader & kUsed) == 0)
+        {
+            nextSize = _FreeBlockSize(next);
+            _CheckLinks(next, nextSize);
+        }
+    }
+
+    _stats.freeCount++;
+    _stats.liveBlocks--;
+    _stats.liveBytes -= size;
+
+    // 앞 블록이 비었으면 병합
+    if (prevSize != 0)
+    {
+        block -= prevSize;
+        _RemoveFree(block, prevSize);
+        size += prevSize;
+    }
+
+    // 맨 뒤 블록은 미사용 공간으로, 아니면 뒤 블록이 비었을 때 병합
+    if (next == _top)
+    {
+        _top = block;
+        return;
+    }
+
+    if (nextSize != 0)
+    {
+        _RemoveFree(next, nextSize);
+        size += nextSize;
+    }
+
+    _InsertFree(block, size);
 }
 
 void HeapMemory::ReadHeap(size_t address, void* buffer, size_t size)
 {
-    std::lock_guard<std::mutex> lock(_heapMutex);
-    
     _ValidateAccess(address, size);
     _segment.Read(address, size, buffer);
 }
 
 void HeapMemory::WriteHeap(size_t address, const void* data, size_t size)
 {
-    std::lock_guard<std::mutex> lock(_heapMutex);
-    
     _ValidateAccess(address, size);
     _segment.Write(address, size, data);
 }
 
-void HeapMemory::_ValidateAccess(size_t address, size_t size) const
+void HeapMemory::Reset()
+{
+    _top = 0;
+    _heads.fill(kNone);
+    _binMap.fill(0);
+    _stats = HeapStats();
+
+    if (_segment.GetSize() != _policy.initialSize)
+    {
+        _segment.Resize(_policy.initialSize);
+    }
+    _stats.peakHeapSize = _policy.initialSize;
+}
+
+void HeapMemory::SetGrowthPolicy(const HeapGrowthPolicy& policy)
+{
+    if (policy.initialSize == 0 || policy.maxSize < policy.initialSize || !(policy.growthFactor >= 1.0))
+    {
+        throw std::invalid_argument("HeapMemory: invalid growth policy");
+    }
+
+    if (_stats.liveBlocks != 0)
+    {
+        throw std::runtime_error("HeapMemory: growth policy can only change while no block is allocated");
+    }
+
+    _policy = policy;
+    _segment.Reserve(policy.maxSize);
+    Reset();
+}
+
+HeapAllocatorState HeapMemory::SaveState() const
+{
+    HeapAllocatorState state;
+    state.policy = _policy;
+    state.top = _top;
+    state.heads.assign(_heads.begin(), _heads.end());
+    state.binMap.assign(_binMap.begin(), _binMap.end());
+    state.stats = _stats;
+    return state;
+}
+
+void HeapMemory::RestoreState(const HeapAllocatorState& state)
+{
+    if (!(state.policy == _policy) || state.heads.size() != _heads.size() || state.binMap.size() != _binMap.size() ||
+        state.top > _segment.GetSize())
+    {
+        throw std::invalid_argument("HeapMemory: allocator state does not match this heap");
+    }
+
+    _top = state.top;
+    std::copy(state.heads.begin(), state.heads.end(), _heads.begin());
+    std::copy(state.binMap.begin(), state.binMap.end(), _binMap.begin());
+    _stats = state.stats;
+}
+
+HeapStats HeapMemory::GetStats() const
+{
+    HeapStats stats = _stats;
+    stats.usedBytes = _top;
+    stats.heapSize = _segment.GetSize();
+
+    // 가장 큰 빈 블록: 뒤쪽 미사용 공간과 비어 있지 않은 가장 큰 등급/구간의 블록
+    size_t tail = _segment.GetSize() - _top;
+    size_t largest = tail;
+    for (size_t word = _binMap.size(); word-- > 0;)
+    {
+        if (_binMap[word] != 0)
+        {
+            size_t bin = word * 64 + 63 - std::countl_zero(_binMap[word]);
+            size_t steps = 0;
+            for (size_t block = _heads[bin]; block != kNone; block = _NextFree(block))
+            {
+                if (++steps > _top / kMinBlockSize)
+                {
+                    throw std::runtime_error("HeapMemory: heap metadata corrupted");
+                }
+                largest = std::max(largest, _FreeBlockSize(block));
+            }
+            break;
+        }
+    }
+
+    size_t totalFree = stats.freeBytes + tail;
+    stats.largestFreeBlock = largest;
+    stats.fragmentation = totalFree == 0 ? 0.0 : 1.0 - static_cast<double>(largest) / static_cast<double>(totalFree);
+    return stats;
+}
+
+size_t HeapMemory::_BinIndex(size_t size, bool roundUp)
 {
-    // 1) addr 보다 큰 첫 블록(upper_bound)을 찾고,
-    //    그 앞 블록(이전 반복자)이 실제로 해당 addr을 포함하는지 검사
-    auto it = _allocatedBlocks.upper_bound(address);
-    if (it == _allocatedBlocks.begin()) 
+    if (size <= kSmallLimit)
     {
-        throw std::out_of_range("HeapMemory: invalid heap address for access");
+        return size / kGranule - 1;
     }
-    --it;
 
-    size_t blockAddr = it->first;
-    size_t blockSize = it->second;
+    if (roundUp)
+    {
+        size += (size_t(1) << (std::bit_width(size) - 1 - kSubBinShift)) - 1;
+    }
+
+    size_t shift = std::bit_width(size) - 1;
+    size_t sub = (size >> (shift - kSubBinShift)) & ((size_t(1) << kSubBinShift) - 1);
+    return kSmallClassCount + ((shift - kLargeMinShift) << kSubBinShift) + sub;
+}
+
+size_t HeapMemory::_FindBin(size_t from) const
+{
+    for (size_t word = from / 64; word < _binMap.size(); ++word)
+    {
+        uint64_t bits = _binMap[word];
+        if (word == from / 64)
+        {
+            bits &= ~0ull << (from % 64);
+        }
+        if (bits != 0)
+        {
+            return word * 64 + std::countr_zero(bits);
+        }
+    }
+    return kNone;
+}
+
+size_t HeapMemory::_FreeBlockSize(size_t block) const
+{
+    if (!_IsBlockOffset(block))
+    {
+        throw std::runtime_error("HeapMemory: heap metadata corrupted");
+    }
+
+    uint64_t header = _LoadWord(block);
+    size_t size = _BlockSize(header);
+    if ((header & kMagicMask) != kMagic || (header & kUsed) != 0 || size < kMinBlockSize || size >= _top - block)
+    {
+        throw std::runtime_error("HeapMemory: heap metadata corrupted");
+    }
+    return size;
+}
+
+size_t HeapMemory::_NextFree(size_t block) const
+{
+    size_t next = static_cast<size_t>(_LoadWord(block + kHeaderSize));
+    if (next != kNone && !_IsBlockOffset(next))
+    {
+        throw std::runtime_error("HeapMemory: heap metadata corrupted");
+    }
+    return next;
+}
+
+void HeapMemory::_CheckLinks(size_t block, size_t size) const
+{
+    size_t next = static_cast<size_t>(_LoadWord(block + kHeaderSize));
+    size_t prev = static_cast<size_t>(_LoadWord(block + 2 * kHeaderSize));
+
+    bool linked = prev == kNone ? _heads[_BinIndex(size, false)] == block
+                                : _IsBlockOffset(prev) && _LoadWord(prev + kHeaderSize) == block;
+    if (linked && next != kNone)
+    {
+        linked = _IsBlockOffset(next) && _LoadWord(next + 2 * kHeaderSize) == block;
+    }
+    if (!linked)
+    {
+        throw std::runtime_error("HeapMemory: heap metadata corrupted");
+    }
+}
+
+void HeapMemory::_InsertFree(size_t block, size_t size)
+{
+    size_t bin = _BinIndex(size, false);
+    size_t head = _heads[bin];
+
+    _StoreWord(block, _MakeHeader(size, 0));
+    _StoreWord(block + kHeaderSize, head);
+    _StoreWord(block + 2 * kHeaderSize, kNone);
+    _StoreWord(block + size - sizeof(uint64_t), size);
+    if (head != kNone)
+    {
+        _StoreWord(head + 2 * kHeaderSize, block);
+    }
+
+    _heads[bin] = block;
+    _binMap[bin / 64] |= 1ull << (bin % 64);
+    _stats.freeBytes += size;
+
+    size_t next = block + size;
+    _StoreWord(next, _LoadWord(next) | kPrevFree);
+}
 
-    // 2) [addr, addr+size) 가 블록 범위 내에 완전히 들어오는지 확인
-    if (address < blockAddr || address + size > blockAddr + blockSize) 
+void HeapMemory::_RemoveFree(size_t block, size_t size)
+{
+    _CheckLinks(block, size);
+
+    size_t bin = _BinIndex(size, false);
+    size_t next = static_cast<size_t>(_LoadWord(block + kHeaderSize));
+    size_t prev = static_cast<size_t>(_LoadWord(block + 2 * kHeaderSize));
+
+    if (prev != kNone)
+    {
+        _StoreWord(prev + kHeaderSize, next);
+    }
+    else
+    {
+        _heads[bin] = next;
+        if (next == kNone)
+        {
+            _binMap[bin / 64] &= ~(1ull << (bin % 64));
+        }
+    }
+    if (next != kNone)
+    {
+        _StoreWord(next + 2 * kHeaderSize, prev);
+    }
+
+    _stats.freeBytes -= size;
+
+    size_t after = block + size;
+    _StoreWord(after, _LoadWord(after) & ~kPrevFree);
+}
+
+size_t HeapMemory::_TakeFree(size_t block, size_t size, size_t wanted)
+{
+    // 등급/구간과 맞지 않는 크기 (헤더가 바뀐 블록)
+    if (size < wanted)
+    {
+        throw std::runtime_error("HeapMemory: heap metadata corrupted");
+    }
+
+    _RemoveFree(block, size);
+
+    size_t remainder = size - wanted;
+    if (remainder < kMinBlockSize)
+    {
+        return size;
+    }
+
+    _InsertFree(block + wanted, remainder);
+    return wanted;
+}
+
+size_t HeapMemory::_CarveTop(size_t blockSize)
+{
+    size_t block = _top;
+    _top += blockSize;
+    _segment.MarkDirty(block, blockSize);
+    _stats.peakUsedBytes = std::max(_stats.peakUsedBytes, _top);
+    return block;
+}
+
+bool HeapMemory::_Grow(size_t blockSize)
+{
+    const size_t current = _segment.GetSize();
+    const size_t required = _top + blockSize;
+    if (required > _policy.maxSize)
+    {
+        return false;
+    }
+
+    // 배수로 늘리되 요청이 들어갈 만큼은 늘리고, 페이지 단위(4KB)로 맞춘 뒤 최대 크기로 자름
+    size_t grown = static_cast<size_t>(static_cast<double>(current) * _policy.growthFactor);
+    grown = _Aligned(std::max(grown, required), 4096);
+    grown = std::min(grown, _policy.maxSize);
+
+    if (_segment.Resize(grown))
+    {
+        _stats.relocationCount++;
+    }
+    _stats.growthCount++;
+    _stats.peakHeapSize = std::max(_stats.peakHeapSize, grown);
+    return true;
+}
+
+void HeapMemory::_ValidateAccess(size_t address, size_t size) const
+{
+    // 블록 헤더 뒤부터 마지막 블록 끝까지 (블록 단위 검사는 LOAD/STORE와 같이 하지 않음, 헤더를 덮어쓰면 할당기가 읽을 때 예외)
+    if (address < kHeaderSize || size > _top || address > _top - size)
     {
         throw std::out_of_range("HeapMemory: access out of bounds");
     }
 }
 
-} // namespace DarkMatterVM::Memory 
\ No newline at end of file
+} // namespace DarkMatterVM::Memory
@@ -1,84 +1,308 @@
 #pragma once
+#include <array>
 #include <cstddef>
-#include <map>
-#include <mutex>
+#include <cstdint>
+#include <cstring>
+#include <vector>
 #include "MemorySegment.h"
 
 namespace DarkMatterVM::Memory
 {
 
+/**
+ * @brief 힙 할당 통계
+ */
+struct HeapStats
+{
+    size_t allocationCount = 0;     ///< 누적 할당 횟수
+    size_t freeCount = 0;           ///< 누적 해제 횟수
+    size_t liveBlocks = 0;          ///< 사용 중인 블록 수
+    size_t liveBytes = 0;           ///< 사용 중인 블록 바이트 (헤더 포함)
+    size_t peakLiveBytes = 0;       ///< liveBytes 최댓값
+    size_t usedBytes = 0;           ///< 세그먼트 앞쪽부터 블록이 놓인 구간 (이후는 한 번도 쓰지 않은 공간)
+    size_t peakUsedBytes = 0;       ///< usedBytes 최댓값 (실제로 필요했던 힙 크기)
+    size_t freeBytes = 0;           ///< usedBytes 안에서 해제되어 재사용을 기다리는 바이트
+    size_t largestFreeBlock = 0;    ///< 한 번에 할당할 수 있는 가장 큰 빈 블록 (뒤쪽 미사용 공간 포함)
+    double fragmentation = 0.0;     ///< 외부 단편화 (1 - largestFreeBlock / 전체 빈 바이트, 0이면 빈 공간이 한 덩어리)
+    size_t heapSize = 0;            ///< 현재 힙 세그먼트 크기
+    size_t peakHeapSize = 0;        ///< heapSize 최댓값
+    size_t growthCount = 0;         ///< 힙 세그먼트를 늘린 횟수
+    size_t relocationCount = 0;     ///< 늘리면서 예약을 넘어 메모리를 옮긴 횟수 (Heap 방식 세그먼트)
+};
+
+/**
+ * @brief 힙 크기 정책
+ *
+ * 할당할 공간이 없으면 현재 크기 × growthFactor(요청이 들어갈 만큼은 최소로)로 늘리되 maxSize를 넘지 않음
+ * 힙 주소는 세그먼트 오프셋이므로 늘려도 이미 받은 주소는 그대로 유효
+ */
+struct HeapGrowthPolicy
+{
+    static constexpr size_t kDefaultMaxSize = 64 * 1024 * 1024;
+
+    size_t initialSize = 1024 * 1024;       ///< 생성/초기화 시 힙 크기
+    double growthFactor = 2.0;              ///< 늘릴 때 현재 크기에 곱하는 값 (1.0 이상)
+    size_t maxSize = kDefaultMaxSize;       ///< 최대 크기 (initialSize와 같으면 늘리지 않음)
+
+    bool operator==(const HeapGrowthPolicy&) const = default;
+};
+
+/**
+ * @brief 세그먼트 밖에 두는 할당기 상태 (스냅샷 저장/복원용, 블록 헤더와 리스트 링크는 세그먼트 안에 있음)
+ */
+struct HeapAllocatorState
+{
+    HeapGrowthPolicy policy;            ///< 힙 크기 정책
+    size_t top = 0;                     ///< 미사용 공간 시작
+    std::vector<size_t> heads;          ///< 등급/구간별 해제 리스트 머리
+    std::vector<uint64_t> binMap;       ///< 비어 있지 않은 등급/구간 비트맵
+    HeapStats stats;                    ///< 누적 통계
+};
+
+/**
+ * @brief 힙 메모리 할당기
+ *
+ * 블록 헤더(8바이트: 크기, 사용 여부, 앞 블록이 비었는지)를 세그먼트 안에 두는 크기 등급별 할당기
+ * - 작은 블록(헤더 포함 512바이트 이하): 16바이트 단위 정확한 크기 등급
+ * - 큰 블록: 2의 거듭제곱을 4등분한 크기 구간
+ * - 등급/구간마다 양방향 해제 리스트, 비어 있지 않은 등급/구간은 비트맵으로 찾음
+ * - 빈 블록은 마지막 8바이트에 크기를 적어 두고, 해제 시 앞뒤 빈 블록과 병합 (빈 블록끼리 붙어 있지 않음)
+ * - 리스트에 맞는 블록이 없으면 세그먼트 뒤쪽 미사용 공간에서 잘라 씀, 맨 뒤 블록을 해제하면 미사용 공간으로 돌려줌
+ * - 미사용 공간도 모자라면 HeapGrowthPolicy에 따라 세그먼트를 늘림
+ *
+ * 할당과 해제는 리스트 머리와 비트맵만 보므로 O(1) (공간이 거의 다 찼을 때만 한 구간을 훑음)
+ * 헤더/링크/꼬리 크기는 게스트 STORE로 덮어쓸 수 있으므로 읽을 때마다 범위와 서로의 일치를 확인하고, 어긋나면 예외
+ * 한 인터프리터 인스턴스(한 스레드)가 소유하므로 동기화하지 않음
+ */
 class HeapMemory
 {
 public:
     /**
      * @brief 힙 메모리 생성
-     * 
-     * @param segment 힙 세그먼트 참조
+     *
+     * @param segment 힙 세그먼트 참조 (policy.maxSize만큼 예약되어 있으면 제자리에서 늘어남)
+     * @param policy 힙 크기 정책 (initialSize는 세그먼트 크기로 맞춤)
      */
-    explicit HeapMemory(MemorySegment& segment);
+    HeapMemory(MemorySegment& segment, const HeapGrowthPolicy& policy);
 
     HeapMemory(const HeapMemory&)            = delete;
     HeapMemory& operator=(const HeapMemory&) = delete;
 
     /**
      * @brief 힙 메모리 할당
-     * 
+     *
      * @param size 할당할 크기
-     * @return size_t 할당된 메모리 주소
+     * @return size_t 할당된 메모리 주소 (힙 세그먼트 내 오프셋, 8바이트 정렬)
      */
     size_t Allocate(size_t size);
 
     /**
      * @brief 힙 메모리 해제
-     * 
+     *
      * @param address 해제할 메모리 주소
-     */ 
+     * @throw std::runtime_error Allocate()가 반환한 사용 중인 주소가 아니거나 병합할 이웃 블록의 메타데이터가 손상되었을 때
+     *        (예외 시 할당기 상태는 바뀌지 않음)
+     */
     void Free(size_t address);
 
     /**
      * @brief 힙 메모리 읽기
-     * 
+     *
      * @param address 읽을 메모리 주소
      * @param buffer 읽은 데이터를 저장할 버퍼
      * @param size 읽을 크기
      */
     void ReadHeap(size_t address, void* buffer, size_t size);
-    
+
     /**
      * @brief 힙 메모리 쓰기
-     * 
+     *
      * @param address 쓸 메모리 주소
      * @param data 쓸 데이터
      * @param size 쓸 크기
      */
     void WriteHeap(size_t address, const void* data, size_t size);
 
+    /**
+     * @brief 모든 할당 정보를 지우고 처음 상태로 (세그먼트 내용은 MemorySegment::ScrubDirty()로 지움)
+     *
+     * 늘어난 힙은 initialSize로 되돌림
+     */
+    void Reset();
+
+    /**
+     * @brief 힙 크기 정책 변경 (할당된 블록이 없을 때만, 세그먼트를 maxSize만큼 예약하고 initialSize로 맞춤)
+     *
+     * @throw std::invalid_argument 크기가 0이거나 maxSize < initialSize이거나 growthFactor < 1일 때
+     * @throw std::runtime_error 할당된 블록이 있을 때
+     */
+    void SetGrowthPolicy(const HeapGrowthPolicy& policy);
+
+    /**
+     * @brief 힙 크기 정책 조회
+     */
+    const HeapGrowthPolicy& GetGrowthPolicy() const { return _policy; }
+
+    /**
+     * @brief 할당 통계 조회
+     *
+     * 가장 큰 빈 블록은 비어 있지 않은 가장 큰 크기 구간 하나만 훑어 계산
+     *
+     * @throw std::runtime_error 훑는 구간의 블록 메타데이터가 손상되었을 때
+     */
+    HeapStats GetStats() const;
+
+    /**
+     * @brief 할당기 상태 저장 (세그먼트 내용과 함께 저장해야 복원 가능)
+     */
+    HeapAllocatorState SaveState() const;
+
+    /**
+     * @brief 저장한 할당기 상태로 복원 (세그먼트는 저장 시점의 크기와 내용으로 먼저 되돌려 두어야 함)
+     *
+     * @throw std::invalid_argument 정책이 현재와 다르거나 등급/구간 수, 미사용 공간 위치가 맞지 않을 때
+     */
+    void RestoreState(const HeapAllocatorState& state);
+
+    /**
+     * @brief 할당 단위 (블록 크기와 시작 오프셋은 이 값의 배수)
+     */
+    static constexpr size_t kGranule = 16;
+
+    /**
+     * @brief 블록 헤더 크기 (Allocate()가 반환하는 주소는 블록 시작 + kHeaderSize)
+     */
+    static constexpr size_t kHeaderSize = sizeof(uint64_t);
+
+    /**
+     * @brief 최소 블록 크기 (빈 블록의 헤더, 두 링크, 꼬리 크기가 들어가야 함)
+     */
+    static constexpr size_t kMinBlockSize = 4 * sizeof(uint64_t);
+
+    /**
+     * @brief 작은 블록 최대 크기 (헤더 포함)
+     */
+    static constexpr size_t kSmallLimit = 512;
+
 private:
+    static constexpr size_t kSmallClassCount = kSmallLimit / kGranule;
+    static constexpr size_t kLargeMinShift = 9;                 ///< 큰 블록 구간은 2^9부터 시작
+    static constexpr size_t kSubBinShift = 2;                   ///< 2의 거듭제곱 구간을 4등분
+    static constexpr size_t kBinCount = kSmallClassCount + ((64 - kLargeMinShift) << kSubBinShift);
+    static constexpr size_t kNone = SIZE_MAX;
+
+    // 헤더 비트: [63:48] 확인용 표식, [47:4] 블록 크기, bit1 앞 블록이 빈 블록, bit0 사용 중
+    static constexpr uint64_t kUsed = 1;
+    static constexpr uint64_t kPrevFree = 2;
+    static constexpr uint64_t kFlagMask = kGranule - 1;
+    static constexpr uint64_t kMagic = 0xD4A7ull << 48;
+    static constexpr uint64_t kMagicMask = 0xFFFFull << 48;
+
+    /**
+     * @brief 세그먼트 오프셋의 8바이트 값 읽기/쓰기 (헤더, 꼬리, 리스트 링크)
+     */
+    uint64_t _LoadWord(size_t offset) const
+    {
+        uint64_t value;
+        std::memcpy(&value, _segment.GetData() + offset, sizeof(value));
+        return value;
+    }
+    void _StoreWord(size_t offset, uint64_t value)
+    {
+        std::memcpy(_segment.GetData() + offset, &value, sizeof(value));
+    }
+
+    static size_t _BlockSize(uint64_t header) { return static_cast<size_t>(header & ~kMagicMask & ~kFlagMask); }
+    static uint64_t _MakeHeader(size_t size, uint64_t flags) { return kMagic | size | flags; }
+
+    /**
+     * @brief 블록 시작으로 쓸 수 있는 오프셋인지 (정렬, 최소 블록이 미사용 공간 앞에 들어감)
+     */
+    bool _IsBlockOffset(size_t block) const
+    {
+        return block % kGranule == 0 && block < _top && _top - block >= kMinBlockSize;
+    }
+
+    /**
+     * @brief 빈 블록 헤더를 확인하고 크기 반환 (빈 블록은 맨 뒤에 오지 않으므로 다음 블록 헤더가 항상 있음)
+     *
+     * @throw std::runtime_error 오프셋이나 헤더(표식, 사용 여부, 크기)가 어긋날 때
+     */
+    size_t _FreeBlockSize(size_t block) const;
+
+    /**
+     * @brief 빈 블록의 다음 링크 읽기 (kNone이 아니면 블록 오프셋인지 확인)
+     *
+     * @throw std::runtime_error 링크가 미사용 공간 앞의 블록 오프셋이 아닐 때
+     */
+    size_t _NextFree(size_t block) const;
+
+    /**
+     * @brief 리스트에서 빼기 전 이웃 링크가 이 블록을 가리키는지 확인 (리스트 머리는 세그먼트 밖에 있음)
+     *
+     * @throw std::runtime_error 링크가 어긋날 때
+     */
+    void _CheckLinks(size_t block, size_t size) const;
+
+    /**
+     * @brief 블록 크기 → 등급/구간 번호 (작은 블록은 크기별 등급, 큰 블록은 kSmallClassCount부터)
+     *
+     * @param roundUp true면 구간 안 어느 블록이든 size 이상이 되도록 다음 구간으로 올림 (할당 시 검색용)
+     */
+    static size_t _BinIndex(size_t size, bool roundUp);
+
+    /**
+     * @brief 빈 블록을 등급/구간 리스트에 넣기/빼기 (다음 블록의 kPrevFree도 함께 갱신)
+     */
+    void _InsertFree(size_t block, size_t size);
+    void _RemoveFree(size_t block, size_t size);
+
+    /**
+     * @brief from 이상 등급/구간 중 비어 있지 않은 첫 번호 (없으면 kNone)
+     */
+    size_t _FindBin(size_t from) const;
+
+    /**
+     * @brief 리스트에서 꺼낸 블록의 뒤쪽을 잘라 빈 블록으로 돌려줌 (남는 크기가 kMinBlockSize 미만이면 그대로 둠)
+     *
+     * @return size_t 잘라낸 뒤 블록 크기
+     */
+    size_t _TakeFree(size_t block, size_t size, size_t wanted);
+
+    /**
+     * @brief 뒤쪽 미사용 공간 앞에서 blockSize만큼 잘라 블록 시작 오프셋 반환
+     */
+    size_t _CarveTop(size_t blockSize);
+
     /**
-     * @brief 힙 메모리 검증
+     * @brief 뒤쪽 미사용 공간이 blockSize 이상이 되도록 세그먼트를 늘림
+     *
+     * @return bool 늘렸는지 여부 (maxSize에 막히면 false)
      */
-    void _ValidateHeap(size_t address, size_t size) const;
+    bool _Grow(size_t blockSize);
 
     /**
-     * @brief 힙 메모리 접근 검증
+     * @brief 힙 메모리 접근 검증 (블록 헤더도 쓸 수 있으므로 할당기가 읽을 때 따로 확인)
      */
     void _ValidateAccess(size_t address, size_t size) const;
 
     /**
      * @brief 힙 메모리 정렬
-     * 
+     *
      * @param n 정렬할 크기
      * @param alignment 정렬 단위
      * @return size_t 정렬된 크기
      */
-    inline size_t _Aligned(size_t n, size_t alignment = sizeof(uint64_t)) 
+    inline size_t _Aligned(size_t n, size_t alignment = sizeof(uint64_t))
     {
         return (n + alignment - 1) & ~(alignment - 1);
     }
 
-    std::map<size_t, size_t> _allocatedBlocks;
-    MemorySegment& _segment;    //<<< 힙 세그먼트 참조
-    size_t _nextHeapAddress;    //<<< 다음 힙 주소
-    mutable std::mutex _heapMutex; //<<< 힙 접근 동기화를 위한 뮤텍스
+    MemorySegment& _segment;                                    ///< 힙 세그먼트 참조
+    HeapGrowthPolicy _policy;                                   ///< 힙 크기 정책
+    size_t _top = 0;                                            ///< 미사용 공간 시작 (이 앞까지 블록이 놓임)
+    std::array<size_t, kBinCount> _heads;                       ///< 등급/구간별 해제 리스트 머리
+    std::array<uint64_t, (kBinCount + 63) / 64> _binMap;        ///< 비어 있지 않은 등급/구간 비트맵
+    HeapStats _stats;                                           ///< 통계 (largestFreeBlock, fragmentation은 GetStats()에서 계산)
 };
-} // namespace DarkMatterVM::Memory
\ No newline at end of file
+} // namespace DarkMatterVM::Memory
@@ -1,24 +1,28 @@
 #include "MemoryManager.h"
 #include "StackMemory.h"
 #include "HeapMemory.h"
+#include "ArenaMemory.h"
+#include "MemorySnapshot.h"
 #include <common/Logger.h>
 #include <cstring>
 #include <algorithm>
 #include <stdexcept>
 #include <unordered_map>
+#include <utility>
 
 namespace DarkMatterVM::Memory 
 {
 
 /// MemoryManager 구현
-MemoryManager::MemoryManager(size_t codeSize, size_t stackSize, size_t heapSize)
+MemoryManager::MemoryManager(size_t codeSize, size_t stackSize, size_t heapSize, MemoryBacking backing)
 {
     // 코드 세그먼트 생성 (읽기+실행)
     _segments.push_back(std::make_unique<MemorySegment>(
         MemorySegmentType::CODE, 
         codeSize, 
         static_cast<uint8_t>(MemoryAccessFlags::READ) | 
-        static_cast<uint8_t>(MemoryAccessFlags::EXECUTE)
+        static_cast<uint8_t>(MemoryAccessFlags::EXECUTE),
+        backing
     ));
     
     // 스택 세그먼트 생성 (읽기+쓰기)
@@ -26,57 +30,71 @@ MemoryManager::MemoryManager(size_t codeSize, size_t stackSize, size_t heapSize)
         MemorySegmentType::STACK, 
         stackSize, 
         static_cast<uint8_t>(MemoryAccessFlags::READ) | 
-        static_cast<uint8_t>(MemoryAccessFlags::WRITE)
+        static_cast<uint8_t>(MemoryAccessFlags::WRITE),
+        backing
     ));
     
-    // 힙 세그먼트 생성 (읽기+쓰기)
+    // 힙 세그먼트 생성 (읽기+쓰기, 기본 정책의 최대 크기까지 예약해 제자리에서 늘어남)
     _segments.push_back(std::make_unique<MemorySegment>(
         MemorySegmentType::HEAP, 
         heapSize, 
         static_cast<uint8_t>(MemoryAccessFlags::READ) | 
-        static_cast<uint8_t>(MemoryAccessFlags::WRITE)
+        static_cast<uint8_t>(MemoryAccessFlags::WRITE),
+        backing,
+        HeapGrowthPolicy::kDefaultMaxSize
     ));
     
     // 상수 세그먼트 생성 (읽기 전용)
     _segments.push_back(std::make_unique<MemorySegment>(
         MemorySegmentType::CONSTANT, 
         1024,  // 1KB
-        static_cast<uint8_t>(MemoryAccessFlags::READ)
+        static_cast<uint8_t>(MemoryAccessFlags::READ),
+        backing
     ));
     
     // 스택 메모리 생성
     _stackMemory = std::make_unique<StackMemory>(GetSegment(MemorySegmentType::STACK));
     
     // 힙 메모리 생성
-    _heapMemory = std::make_unique<HeapMemory>(GetSegment(MemorySegmentType::HEAP));
+    _heapMemory = std::make_unique<HeapMemory>(GetSegment(MemorySegmentType::HEAP), HeapGrowthPolicy());
+    _arenaMemory = std::make_unique<ArenaMemory>(*_heapMemory);
+    
+    _LayoutAddressSpace();
 }
 
 MemoryManager::~MemoryManager() = default;
 
-const MemorySegment& MemoryManager::GetSegment(MemorySegmentType type) const 
+void MemoryManager::_LayoutAddressSpace()
 {
-    for (const auto& segment : _segments) 
+    const size_t regionSize = size_t{1} << kRegionShift;
+    auto alignUp = [regionSize](size_t value) { return (value + regionSize - 1) & ~(regionSize - 1); };
+    
+    // CODE, CONSTANT, STACK은 0번지부터 영역 단위로 붙이고 HEAP은 기본 주소 또는 그 뒤
+    size_t next = 0;
+    for (MemorySegmentType type : {MemorySegmentType::CODE, MemorySegmentType::CONSTANT, MemorySegmentType::STACK})
     {
-        if (segment->GetType() == type) 
-        {
-            return *segment;
-        }
+        _baseAddresses[static_cast<size_t>(type)] = next;
+        next = alignUp(next + GetSegment(type).GetSize());
     }
+    _baseAddresses[static_cast<size_t>(MemorySegmentType::HEAP)] = std::max(kHeapBaseAddress, next);
     
-    throw std::runtime_error("MemoryManager: segment not found");
-}
-
-MemorySegment& MemoryManager::GetSegment(MemorySegmentType type) 
-{
-    for (auto& segment : _segments) 
+    // 힙은 늘어날 수 있는 최대 크기까지 배치 (현재 크기 밖 접근은 세그먼트 범위 검사에서 거부)
+    auto layoutSize = [this](const MemorySegment& segment)
+    {
+        return segment.GetType() == MemorySegmentType::HEAP ?
+               std::max(segment.GetSize(), _heapMemory->GetGrowthPolicy().maxSize) : segment.GetSize();
+    };
+    
+    const size_t heapEnd = GetBaseAddress(MemorySegmentType::HEAP) + layoutSize(GetSegment(MemorySegmentType::HEAP));
+    _regionTable.assign(alignUp(heapEnd) >> kRegionShift, kNoSegment);
+    for (const auto& segment : _segments)
     {
-        if (segment->GetType() == type) 
+        size_t base = GetBaseAddress(segment->GetType());
+        for (size_t region = base >> kRegionShift; region < alignUp(base + layoutSize(*segment)) >> kRegionShift; ++region)
         {
-            return *segment;
+            _regionTable[region] = static_cast<uint8_t>(segment->GetType());
         }
     }
-    
-    throw std::runtime_error("MemoryManager: segment not found");
 }
 
 void MemoryManager::InitializeCode(const uint8_t* code, size_t size) 
@@ -90,9 +108,97 @@ void MemoryManager::InitializeCode(const uint8_t* code, size_t size)
     // 코드 구역은 실행 중 WRITE 권한이 없도록 설계되어 있으므로
     // 초기 로딩 단계에서는 권한 체크를 우회해 직접 메모리에 복사한다.
     // codeSegment.Write(0, size, code)
+    // 다른 인스턴스와 공유 중이면 그쪽 코드를 덮어쓰지 않도록 먼저 분리
+    codeSegment.Unshare();
     std::memcpy(codeSegment.GetData(), code, size);
 }
 
+void MemoryManager::ShareCode(const MemoryManager& source)
+{
+    GetSegment(MemorySegmentType::CODE).ShareData(source.GetSegment(MemorySegmentType::CODE));
+}
+
+size_t MemoryManager::GetReservedBytes() const
+{
+    size_t reserved = 0;
+    for (const auto& segment : _segments)
+    {
+        reserved += segment->GetReservedBytes();
+    }
+    return reserved;
+}
+
+size_t MemoryManager::GetCommittedBytes() const
+{
+    size_t committed = 0;
+    for (const auto& segment : _segments)
+    {
+        committed += segment->GetCommittedBytes();
+    }
+    return committed;
+}
+
+size_t MemoryManager::ScrubDirty()
+{
+    size_t scrubbed = 0;
+    for (MemorySegmentType type : {MemorySegmentType::STACK, MemorySegmentType::HEAP, MemorySegmentType::CONSTANT})
+    {
+        scrubbed += GetSegment(type).ScrubDirty();
+    }
+    
+    _heapMemory->Reset();
+    _arenaMemory->Clear();
+    
+    return scrubbed;
+}
+
+void MemoryManager::SetHeapGrowthPolicy(const HeapGrowthPolicy& policy)
+{
+    _heapMemory->SetGrowthPolicy(policy);
+    _LayoutAddressSpace();
+}
+
+const HeapGrowthPolicy& MemoryManager::GetHeapGrowthPolicy() const
+{
+    return _heapMemory->GetGrowthPolicy();
+}
+
+void MemoryManager::CaptureSnapshot(MemorySnapshot& snapshot) const
+{
+    if (_arenaMemory->GetDepth() != 0)
+    {
+        throw std::runtime_error("MemoryManager: cannot snapshot while an arena is open");
+    }
+    
+    snapshot.stack = SegmentImage::Capture(GetSegment(MemorySegmentType::STACK));
+    snapshot.heap = SegmentImage::Capture(GetSegment(MemorySegmentType::HEAP));
+    snapshot.constant = SegmentImage::Capture(GetSegment(MemorySegmentType::CONSTANT));
+    snapshot.heapState = _heapMemory->SaveState();
+    snapshot.stackPointer = _stackMemory->GetStackPointer();
+}
+
+void MemoryManager::RestoreSnapshot(const MemorySnapshot& snapshot)
+{
+    if (snapshot.stack.GetSegmentSize() != GetSegment(MemorySegmentType::STACK).GetSize() ||
+        snapshot.constant.GetSegmentSize() != GetSegment(MemorySegmentType::CONSTANT).GetSize())
+    {
+        throw std::invalid_argument("MemoryManager: snapshot segment sizes do not match");
+    }
+    
+    // 마지막 실행이 쓴 구간만 지우고(힙 크기/할당 정보도 초기화) 그 위에 이미지를 덮음
+    ScrubDirty();
+    if (!(GetHeapGrowthPolicy() == snapshot.heapState.policy))
+    {
+        SetHeapGrowthPolicy(snapshot.heapState.policy);
+    }
+    
+    snapshot.stack.Restore(GetSegment(MemorySegmentType::STACK));
+    snapshot.heap.Restore(GetSegment(MemorySegmentType::HEAP));
+    snapshot.constant.Restore(GetSegment(MemorySegmentType::CONSTANT));
+    _heapMemory->RestoreState(snapshot.heapState);
+    _stackMemory->Reset(snapshot.stackPointer);
+}
+
 // 스택 관련 메서드 구현
 
 void MemoryManager::SetStackPointer(size_t stackPointer)
@@ -125,6 +231,31 @@ uint64_t MemoryManager::GetStackValue(size_t offset) const
     return _stackMemory->GetStackValue(offset);
 }
 
+uint64_t MemoryManager::ReadStackSlot(size_t address) const
+{
+    return _stackMemory->ReadSlot(address);
+}
+
+void MemoryManager::WriteStackSlot(size_t address, uint64_t value)
+{
+    _stackMemory->WriteSlot(address, value);
+}
+
+void MemoryManager::PushStackSlot(size_t address)
+{
+    _stackMemory->PushSlot(address);
+}
+
+void MemoryManager::PopStackSlot(size_t address)
+{
+    _stackMemory->PopSlot(address);
+}
+
+void MemoryManager::MoveStackTopSlots(size_t address, size_t slotCount)
+{
+    _stackMemory->MoveTopSlots(address, slotCount);
+}
+
 void MemoryManager::EnterStackFrame(size_t basePointer, size_t returnAddress)
 {
     _stackMemory->EnterStackFrame(basePointer, returnAddress);
@@ -178,66 +309,68 @@ const MemorySegment& MemoryManager::GetSegmentByAddress(size_t address) const
 
 uint64_t MemoryManager::ReadUInt64(size_t address) const
 {
-    Logger::Debug("MemoryManager", "ReadUInt64 호출 - 주소=0x" + std::to_string(address));
     auto [segmentType, offset] = _ResolveAddress(address);
     
-    std::string segTypeName;
-    switch(segmentType) {
-        case MemorySegmentType::CODE: segTypeName = "CODE"; break;
-        case MemorySegmentType::STACK: segTypeName = "STACK"; break;
-        case MemorySegmentType::HEAP: segTypeName = "HEAP"; break;
-        case MemorySegmentType::CONSTANT: segTypeName = "CONSTANT"; break;
-        default: segTypeName = "UNKNOWN"; break;
-    }
-    
-    Logger::Debug("MemoryManager", "주소 변환 결과 - 세그먼트=" + segTypeName + ", 오프셋=0x" + std::to_string(offset));
+    DMVM_TRACE_DEBUG("MemoryManager", "ReadUInt64 - 주소=0x" + std::to_string(address) + 
+                     " → 세그먼트=" + ToString(segmentType) + ", 오프셋=0x" + std::to_string(offset));
     
     return GetSegment(segmentType).ReadUInt64(offset);
 }
 
 void MemoryManager::WriteUInt64(size_t address, uint64_t value)
 {
-    Logger::Debug("MemoryManager", "WriteUInt64 호출 - 주소=0x" + std::to_string(address) + ", 값=" + std::to_string(value));
     auto [segmentType, offset] = _ResolveAddress(address);
     
-    std::string segTypeName;
-    switch(segmentType) {
-        case MemorySegmentType::CODE: segTypeName = "CODE"; break;
-        case MemorySegmentType::STACK: segTypeName = "STACK"; break;
-        case MemorySegmentType::HEAP: segTypeName = "HEAP"; break;
-        case MemorySegmentType::CONSTANT: segTypeName = "CONSTANT"; break;
-        default: segTypeName = "UNKNOWN"; break;
-    }
-    
-    Logger::Debug("MemoryManager", "주소 변환 결과 - 세그먼트=" + segTypeName + ", 오프셋=0x" + std::to_string(offset));
+    DMVM_TRACE_DEBUG("MemoryManager", "WriteUInt64 - 주소=0x" + std::to_string(address) + ", 값=" + std::to_string(value) + 
+                     " → 세그먼트=" + ToString(segmentType) + ", 오프셋=0x" + std::to_string(offset));
     
     GetSegment(segmentType).WriteUInt64(offset, value);
 }
 
-std::pair<MemorySegmentType, size_t> MemoryManager::_ResolveAddress(size_t address) const 
+void MemoryManager::CopyMemory(size_t destination, size_t source, size_t size)
 {
-    // 주소 범위에 따라 세그먼트 유형과 오프셋 결정
-    // 이 예제에서는 단순 구현 (실제 구현에서는 더 복잡할 수 있음)
+    // 원본부터 검사해 실패하면 대상 구간을 쓰인 것으로 기록하지 않음
+    auto [sourceType, sourceOffset] = _ResolveAddress(source);
+    auto [destinationType, destinationOffset] = _ResolveAddress(destination);
+    const uint8_t* from = std::as_const(GetSegment(sourceType)).GetReadableRange(sourceOffset, size);
+    uint8_t* to = GetSegment(destinationType).GetWritableRange(destinationOffset, size);
     
-    // 코드 영역: 0x00000000 ~ 0x0000FFFF
-    if (address < 0x10000) 
-    {
-        return {MemorySegmentType::CODE, address};
-    }
-    // 상수 영역: 0x00010000 ~ 0x000103FF
-    else if (address < 0x10400) 
-    {
-        return {MemorySegmentType::CONSTANT, address - 0x10000};
-    }
-    // 스택 영역: 0x00020000 ~ 0x0011FFFF
-    else if (address < 0x120000) 
-    {
-        return {MemorySegmentType::STACK, address - 0x20000};
-    }
-    // 힙 영역: 0x00200000 ~ 0x002FFFFF
-    else if (address < 0x300000) 
+    DMVM_TRACE_DEBUG("MemoryManager", "CopyMemory - 0x" + std::to_string(source) + " → 0x" + 
+                     std::to_string(destination) + ", " + std::to_string(size) + " 바이트");
+    
+    std::memmove(to, from, size);
+}
+
+void MemoryManager::FillMemory(size_t destination, uint8_t value, size_t size)
+{
+    auto [segmentType, offset] = _ResolveAddress(destination);
+    uint8_t* to = GetSegment(segmentType).GetWritableRange(offset, size);
+    
+    DMVM_TRACE_DEBUG("MemoryManager", "FillMemory - 0x" + std::to_string(destination) + ", 값=" + 
+                     std::to_string(value) + ", " + std::to_string(size) + " 바이트");
+    
+    std::memset(to, value, size);
+}
+
+int MemoryManager::CompareMemory(size_t first, size_t second, size_t size) const
+{
+    auto [firstType, firstOffset] = _ResolveAddress(first);
+    auto [secondType, secondOffset] = _ResolveAddress(second);
+    const uint8_t* a = GetSegment(firstType).GetReadableRange(firstOffset, size);
+    const uint8_t* b = GetSegment(secondType).GetReadableRange(secondOffset, size);
+    
+    int result = std::memcmp(a, b, size);
+    return (result > 0) - (result < 0);
+}
+
+std::pair<MemorySegmentType, size_t> MemoryManager::_ResolveAddress(size_t address) const 
+{
+    // 영역 표 한 번 조회 (영역 안이지만 세그먼트 끝을 넘는 오프셋은 세그먼트 접근자가 범위 초과로 거부)
+    size_t region = address >> kRegionShift;
+    if (region < _regionTable.size() && _regionTable[region] != kNoSegment) 
     {
-        return {MemorySegmentType::HEAP, address - 0x200000};
+        MemorySegmentType type = static_cast<MemorySegmentType>(_regionTable[region]);
+        return {type, address - GetBaseAddress(type)};
     }
     
     throw MemoryAccessException("유효하지 않은 메모리 주소 접근");
@@ -1,4 +1,5 @@
 #pragma once
+#include <array>
 #include <cstdint>
 #include <vector>
 #include <memory>
@@ -11,25 +12,45 @@ namespace DarkMatterVM::Memory
 
 class StackMemory;
 class HeapMemory;
+class ArenaMemory;
+struct HeapGrowthPolicy;
+struct MemorySnapshot;
 
 /**
  * @brief 메모리 관리자
  * 
  * VM의 전체 메모리를 관리하는 클래스
+ * 
+ * 세그먼트는 하나의 평탄한 가상 주소 공간에 배치됨: CODE, CONSTANT, STACK 순으로 0번지부터
+ * 영역(1 << kRegionShift 바이트) 단위로 정렬해 붙이고, HEAP은 kHeapBaseAddress(앞 세그먼트가
+ * 넘치면 그 뒤 첫 영역)에 둠. 기본 크기에서는 CODE 0x0, CONSTANT 0x10000, STACK 0x20000, HEAP 0x200000
+ * 주소 해석은 주소를 kRegionShift만큼 민 값으로 영역 표를 한 번 조회
  */
 class MemoryManager 
 {
 public:
+    /**
+     * @brief 주소→세그먼트 영역 표의 영역 크기 (1 << kRegionShift 바이트, 세그먼트 시작 주소 정렬 단위)
+     */
+    static constexpr size_t kRegionShift = 16;
+    
+    /**
+     * @brief 힙 세그먼트 기본 시작 주소 (번역기와 JIT가 가정하는 주소)
+     */
+    static constexpr size_t kHeapBaseAddress = 0x200000;
+    
     /**
      * @brief 메모리 관리자 생성
      * 
      * @param codeSize 코드 세그먼트 크기
      * @param stackSize 스택 세그먼트 크기
-     * @param heapSize 힙 세그먼트 초기 크기
+     * @param heapSize 힙 세그먼트 초기 크기 (기본 정책은 HeapGrowthPolicy::kDefaultMaxSize까지 늘어남)
+     * @param backing 세그먼트 메모리 확보 방식 (Linux 기본은 Mapped: 건드린 페이지만 커밋)
      */
     MemoryManager(size_t codeSize = 64 * 1024,    // 64KB
                   size_t stackSize = 1024 * 1024,  // 1MB
-                  size_t heapSize = 1024 * 1024);  // 1MB
+                  size_t heapSize = 1024 * 1024,   // 1MB
+                  MemoryBacking backing = MemorySegment::GetDefaultBacking());
     
     /**
      * @brief 메모리 관리자 소멸자
@@ -42,7 +63,10 @@ public:
      * @param type 세그먼트 유형
      * @return const MemorySegment& 세그먼트 참조
      */
-    const MemorySegment& GetSegment(MemorySegmentType type) const;
+    const MemorySegment& GetSegment(MemorySegmentType type) const 
+    {
+        return const_cast<MemoryManager*>(this)->GetSegment(type);
+    }
     
     /**
      * @brief 특정 세그먼트 조회 (쓰기 가능)
@@ -50,7 +74,29 @@ public:
      * @param type 세그먼트 유형
      * @return MemorySegment& 세그먼트 참조
      */
-    MemorySegment& GetSegment(MemorySegmentType type);
+    MemorySegment& GetSegment(MemorySegmentType type) 
+    {
+        // _segments는 MemorySegmentType 값 순서로 생성됨
+        size_t index = static_cast<size_t>(type);
+        if (index >= _segments.size()) 
+        {
+            throw std::runtime_error("MemoryManager: segment not found");
+        }
+        return *_segments[index];
+    }
+    
+    /**
+     * @brief 세그먼트 시작 가상 주소
+     * 
+     * @param type 세그먼트 유형
+     * @return size_t 가상 주소 공간에서 세그먼트 0번 오프셋의 주소
+     */
+    size_t GetBaseAddress(MemorySegmentType type) const { return _baseAddresses[static_cast<size_t>(type)]; }
+    
+    /**
+     * @brief 가상 주소 공간 크기 (마지막 세그먼트 끝을 영역 단위로 올림)
+     */
+    size_t GetAddressSpaceSize() const { return _regionTable.size() << kRegionShift; }
     
     /**
      * @brief 코드 세그먼트 초기화
@@ -60,6 +106,68 @@ public:
      */
     void InitializeCode(const uint8_t* code, size_t size);
     
+    /**
+     * @brief 다른 관리자의 코드 세그먼트를 복사 없이 공유
+     * 
+     * 같은 모듈을 여러 인스턴스가 실행할 때 사용 (코드 세그먼트 크기가 같아야 함)
+     * 이후 InitializeCode()를 호출하면 전용 메모리로 분리한 뒤 복사
+     * 
+     * @param source 코드를 가진 메모리 관리자
+     */
+    void ShareCode(const MemoryManager& source);
+    
+    /**
+     * @brief 모든 세그먼트의 예약 바이트 합
+     */
+    size_t GetReservedBytes() const;
+    
+    /**
+     * @brief 모든 세그먼트의 커밋 바이트 합 (세그먼트별 값은 GetSegment(type).GetCommittedBytes())
+     */
+    size_t GetCommittedBytes() const;
+    
+    /**
+     * @brief 스택/힙/상수 세그먼트에서 쓰인 구간만 0으로 되돌리고 힙 할당 정보 초기화
+     * 
+     * 재사용할 인스턴스를 새로 만든 것과 같은 상태로 만들되, 비용은 마지막 실행이 쓴 바이트 수에 비례
+     * 
+     * @return size_t 지운 바이트 수
+     */
+    size_t ScrubDirty();
+    
+    /**
+     * @brief 힙 크기 정책 변경 (할당된 블록이 없을 때만, HeapMemory::SetGrowthPolicy() 참고)
+     * 
+     * 힙 세그먼트를 최대 크기만큼 예약하고 주소 공간도 최대 크기까지 배치
+     */
+    void SetHeapGrowthPolicy(const HeapGrowthPolicy& policy);
+    
+    /**
+     * @brief 힙 크기 정책 조회
+     */
+    const HeapGrowthPolicy& GetHeapGrowthPolicy() const;
+    
+    /**
+     * @brief 스택/힙/상수 세그먼트의 쓰인 구간, 힙 할당기 상태, 스택 포인터를 스냅샷에 담음
+     * 
+     * 코드와 레지스터(IP/BP)는 Interpreter::Snapshot()이 채움
+     * 
+     * @param snapshot 채울 스냅샷
+     * @throw std::runtime_error 열린 아레나가 있을 때 (아레나 청크 목록은 스냅샷에 담지 않음)
+     */
+    void CaptureSnapshot(MemorySnapshot& snapshot) const;
+    
+    /**
+     * @brief 스냅샷 시점의 스택/힙/상수 세그먼트와 힙 할당기 상태, 스택 포인터로 되돌림
+     * 
+     * 먼저 ScrubDirty()로 마지막 실행이 쓴 구간을 지운 뒤 이미지 구간을 매핑(또는 복사)하므로
+     * 비용은 이미지 크기가 아니라 마지막 실행이 쓴 양에 비례
+     * 
+     * @param snapshot 되돌릴 스냅샷
+     * @throw std::invalid_argument 스택/상수 세그먼트 크기가 다를 때
+     */
+    void RestoreSnapshot(const MemorySnapshot& snapshot);
+    
     /**
      * @brief 스택 메모리 조회
      * 
@@ -88,6 +196,20 @@ public:
      */
     const HeapMemory& GetHeapMemory() const { return *_heapMemory; }
     
+    /**
+     * @brief 아레나 메모리 조회 (힙 위에서 동작, ScrubDirty() 시 함께 초기화)
+     * 
+     * @return ArenaMemory& 아레나 메모리 참조
+     */
+    ArenaMemory& GetArenaMemory() { return *_arenaMemory; }
+    
+    /**
+     * @brief 아레나 메모리 조회 (읽기 전용)
+     * 
+     * @return const ArenaMemory& 아레나 메모리 참조
+     */
+    const ArenaMemory& GetArenaMemory() const { return *_arenaMemory; }
+    
     /**
      * @brief 지정된 주소에서 바이트 읽기
      * 
@@ -141,6 +263,44 @@ public:
      */
     uint64_t GetStackValue(size_t offset) const;
     
+    /**
+     * @brief 스택 슬롯 읽기 (프레임 지역 변수/인자 접근)
+     * 
+     * @param address 스택 세그먼트 오프셋 (현재 스택 포인터 이상)
+     * @return uint64_t 슬롯 값
+     */
+    uint64_t ReadStackSlot(size_t address) const;
+    
+    /**
+     * @brief 스택 슬롯 쓰기 (프레임 지역 변수 접근)
+     * 
+     * @param address 스택 세그먼트 오프셋 (현재 스택 포인터 이상)
+     * @param value 쓸 값
+     */
+    void WriteStackSlot(size_t address, uint64_t value);
+    
+    /**
+     * @brief 스택 슬롯 값을 스택에 푸시 (LDLOC/LDARG)
+     * 
+     * @param address 스택 세그먼트 오프셋 (현재 스택 포인터 이상)
+     */
+    void PushStackSlot(size_t address);
+    
+    /**
+     * @brief 스택 최상위 값을 팝해 슬롯에 저장 (STLOC)
+     * 
+     * @param address 스택 세그먼트 오프셋 (팝한 뒤 스택 포인터 이상)
+     */
+    void PopStackSlot(size_t address);
+    
+    /**
+     * @brief 스택 최상위 슬롯들을 address로 옮기고 스택 포인터를 address로 설정 (TAILCALL)
+     * 
+     * @param address 옮길 위치 (현재 스택 포인터 이상)
+     * @param slotCount 옮길 슬롯 수
+     */
+    void MoveStackTopSlots(size_t address, size_t slotCount);
+    
     /**
      * @brief 스택 프레임 정보 저장
      * 
@@ -224,6 +384,39 @@ public:
      */
     void WriteUInt64(size_t address, uint64_t value);
     
+    /**
+     * @brief 블록 복사 (MEMCPY)
+     * 
+     * 두 주소를 한 번씩 해석하고 구간 범위를 한 번 검사한 뒤 memmove로 복사 (세그먼트가 달라도 되고 겹쳐도 됨)
+     * 
+     * @param destination 대상 가상 주소
+     * @param source 원본 가상 주소
+     * @param size 복사할 바이트 수
+     * @throw MemoryAccessException 주소가 유효하지 않거나 구간이 세그먼트를 벗어날 때
+     */
+    void CopyMemory(size_t destination, size_t source, size_t size);
+    
+    /**
+     * @brief 블록 채우기 (MEMSET)
+     * 
+     * @param destination 대상 가상 주소
+     * @param value 채울 바이트 값
+     * @param size 채울 바이트 수
+     * @throw MemoryAccessException 주소가 유효하지 않거나 구간이 세그먼트를 벗어날 때
+     */
+    void FillMemory(size_t destination, uint8_t value, size_t size);
+    
+    /**
+     * @brief 블록 비교 (MEMCMP)
+     * 
+     * @param first 첫 번째 구간 가상 주소
+     * @param second 두 번째 구간 가상 주소
+     * @param size 비교할 바이트 수
+     * @return int 첫 번째가 작으면 -1, 같으면 0, 크면 1
+     * @throw MemoryAccessException 주소가 유효하지 않거나 구간이 세그먼트를 벗어날 때
+     */
+    int CompareMemory(size_t first, size_t second, size_t size) const;
+    
     /**
      * @brief 특정 세그먼트 조회
      * 
@@ -250,6 +443,19 @@ private:
     std::vector<std::unique_ptr<MemorySegment>> _segments;  ///< 메모리 세그먼트 목록
     std::unique_ptr<StackMemory> _stackMemory;                ///< 스택 메모리
     std::unique_ptr<HeapMemory> _heapMemory;                  ///< 힙 메모리
+    std::unique_ptr<ArenaMemory> _arenaMemory;                ///< 아레나 메모리 (힙 청크 사용)
+    std::array<size_t, 4> _baseAddresses = {};                ///< 세그먼트 유형별 시작 가상 주소
+    std::vector<uint8_t> _regionTable;                        ///< 영역 번호 → 세그먼트 유형 (없으면 kNoSegment)
+    
+    /**
+     * @brief 영역 표에서 세그먼트가 없는 영역
+     */
+    static constexpr uint8_t kNoSegment = 0xFF;
+    
+    /**
+     * @brief 세그먼트 크기로 시작 주소와 영역 표 계산
+     */
+    void _LayoutAddressSpace();
     
     /**
      * @brief 가상 주소 해결 (세그먼트 + 오프셋)
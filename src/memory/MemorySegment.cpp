@@ -1,13 +1,269 @@
 #include "MemorySegment.h"
 #include <cstring>
+#include <vector>
+
+#if DMVM_MAPPED_SEGMENTS
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 namespace DarkMatterVM::Memory
 {
 
 /// MemorySegment 구현
-MemorySegment::MemorySegment(MemorySegmentType type, size_t size, uint8_t accessFlags)
-    : _memoryManager(std::make_unique<uint8_t[]>(size)), _type(type), _size(size), _accessFlags(accessFlags) 
+namespace
+{
+
+#if DMVM_MAPPED_SEGMENTS
+size_t GetPageSize()
+{
+    static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return pageSize;
+}
+
+// 쓰인 구간이 이 크기 이상이면 온전한 페이지는 memset 대신 커널에 돌려줌
+constexpr size_t kDecommitThreshold = 64 * 1024;
+#endif
+
+} // namespace
+
+MemorySegment::MemorySegment(MemorySegmentType type, size_t size, uint8_t accessFlags, MemoryBacking backing, size_t capacity)
+    : _size(size), _type(type), _accessFlags(accessFlags), _dirtyBegin(size), _backing(backing), _capacity(size)
 {
+    // 예약 크기만큼 잡으면 가드 페이지 배치가 달라지므로 스택은 크기 그대로
+    if (capacity > size && type != MemorySegmentType::STACK && backing == MemoryBacking::Mapped)
+    {
+        _capacity = capacity;
+    }
+
+    _memoryManager = _Allocate(_capacity, type == MemorySegmentType::STACK, _backing, _guardBytes);
+    if (_backing != MemoryBacking::Mapped)
+    {
+        _capacity = size;
+    }
+}
+
+std::shared_ptr<uint8_t[]> MemorySegment::_Allocate(size_t size, bool guarded, MemoryBacking& backing, size_t& guardBytes)
+{
+    guardBytes = 0;
+
+#if DMVM_MAPPED_SEGMENTS
+    const size_t pageSize = GetPageSize();
+    if (backing == MemoryBacking::Mapped && guarded && size > 0 && size % pageSize == 0)
+    {
+        // [가드 페이지][세그먼트][가드 페이지]로 예약하고 가운데만 읽기/쓰기 허용
+        const size_t total = size + 2 * pageSize;
+        void* mapping = mmap(nullptr, total, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (mapping != MAP_FAILED)
+        {
+            uint8_t* data = static_cast<uint8_t*>(mapping) + pageSize;
+            if (mprotect(data, size, PROT_READ | PROT_WRITE) == 0)
+            {
+                guardBytes = pageSize;
+                return std::shared_ptr<uint8_t[]>(data, [total, pageSize](uint8_t* begin) { munmap(begin - pageSize, total); });
+            }
+            munmap(mapping, total);
+        }
+    }
+
+    if (backing == MemoryBacking::Mapped && size > 0)
+    {
+        // 주소 공간만 예약하고 스왑 예약도 하지 않음, 처음 건드린 페이지를 커널이 0으로 채움
+        void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (mapping != MAP_FAILED)
+        {
+            return std::shared_ptr<uint8_t[]>(static_cast<uint8_t*>(mapping), [size](uint8_t* data) { munmap(data, size); });
+        }
+    }
+#endif
+
+    backing = MemoryBacking::Heap;
+    return std::make_shared<uint8_t[]>(size);
+}
+
+size_t MemorySegment::GetCommittedBytes() const
+{
+#if DMVM_MAPPED_SEGMENTS
+    if (_backing == MemoryBacking::Mapped)
+    {
+        const size_t pageSize = GetPageSize();
+        std::vector<unsigned char> residency((_size + pageSize - 1) / pageSize);
+        if (mincore(const_cast<uint8_t*>(GetData()), _size, residency.data()) != 0)
+        {
+            return _size;
+        }
+
+        size_t committed = 0;
+        for (unsigned char page : residency)
+        {
+            committed += (page & 1) ? pageSize : 0;
+        }
+        return committed < _size ? committed : _size;
+    }
+#endif
+
+    return _size;
+}
+
+size_t MemorySegment::ScrubDirty()
+{
+    size_t dirtyBytes = GetDirtyBytes();
+    if (dirtyBytes > 0)
+    {
+        size_t begin = _dirtyBegin;
+        size_t end = _dirtyEnd < _size ? _dirtyEnd : _size;
+
+#if DMVM_MAPPED_SEGMENTS
+        // 넓은 구간은 안쪽 페이지를 커널에 돌려주고(다시 건드리면 0으로 채워짐) 양끝만 memset
+        if (_backing == MemoryBacking::Mapped && dirtyBytes >= kDecommitThreshold && !IsShared())
+        {
+            const size_t pageSize = GetPageSize();
+            size_t pageBegin = (begin + pageSize - 1) / pageSize * pageSize;
+            size_t pageEnd = end / pageSize * pageSize;
+            if (pageBegin < pageEnd && _Decommit(GetData() + pageBegin, pageEnd - pageBegin))
+            {
+                std::memset(GetData() + begin, 0, pageBegin - begin);
+                std::memset(GetData() + pageEnd, 0, end - pageEnd);
+                begin = end;
+            }
+        }
+#endif
+
+        if (begin < end)
+        {
+            std::memset(GetData() + begin, 0, end - begin);
+        }
+    }
+    
+    _dirtyBegin = _size;
+    _dirtyEnd = 0;
+    
+    return dirtyBytes;
+}
+
+bool MemorySegment::_Decommit(uint8_t* begin, size_t length)
+{
+#if DMVM_MAPPED_SEGMENTS
+    // 파일 매핑 페이지에 MADV_DONTNEED를 쓰면 0이 아니라 파일 내용으로 돌아가므로 익명 페이지로 덮음
+    if (_fileMapped)
+    {
+        return mmap(begin, length, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED, -1, 0) != MAP_FAILED;
+    }
+    return madvise(begin, length, MADV_DONTNEED) == 0;
+#else
+    (void)begin;
+    (void)length;
+    return false;
+#endif
+}
+
+bool MemorySegment::MapPrivate(size_t offset, size_t length, int fd, uint64_t fileOffset)
+{
+#if DMVM_MAPPED_SEGMENTS
+    const size_t pageSize = GetPageSize();
+    if (_backing != MemoryBacking::Mapped || IsShared() || length == 0 || length > _size || offset > _size - length ||
+        offset % pageSize != 0 || fileOffset % pageSize != 0)
+    {
+        return false;
+    }
+
+    void* mapping = mmap(GetData() + offset, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd,
+                         static_cast<off_t>(fileOffset));
+    if (mapping == MAP_FAILED)
+    {
+        return false;
+    }
+
+    _fileMapped = true;
+    return true;
+#else
+    (void)offset;
+    (void)length;
+    (void)fd;
+    (void)fileOffset;
+    return false;
+#endif
+}
+
+void MemorySegment::Reserve(size_t capacity)
+{
+    if (capacity <= _capacity || _backing != MemoryBacking::Mapped)
+    {
+        return;
+    }
+
+    if (IsShared() || _guardBytes != 0)
+    {
+        throw std::runtime_error("MemorySegment: cannot reserve a shared or guarded segment");
+    }
+
+    auto storage = _Allocate(capacity, false, _backing, _guardBytes);
+    std::memcpy(storage.get(), GetData(), _size);
+    _memoryManager = std::move(storage);
+    _capacity = _backing == MemoryBacking::Mapped ? capacity : _size;
+    _fileMapped = false;
+}
+
+bool MemorySegment::Resize(size_t size)
+{
+    if (IsShared() || _guardBytes != 0)
+    {
+        throw std::runtime_error("MemorySegment: cannot resize a shared or guarded segment");
+    }
+
+    const size_t oldSize = _size;
+    if (size < oldSize)
+    {
+        // 잘려 나간 구간 중 쓰인 부분만 ScrubDirty()로 0으로 되돌리고(건드리지 않은 페이지는 이미 0) 남은 쓰인 구간은 다시 표시
+        size_t dirtyBegin = _dirtyBegin;
+        size_t dirtyEnd = _dirtyEnd;
+        if (dirtyEnd > size && dirtyEnd > dirtyBegin)
+        {
+            _dirtyBegin = dirtyBegin > size ? dirtyBegin : size;
+            ScrubDirty();
+        }
+
+        _size = size;
+        _dirtyEnd = dirtyEnd < size ? dirtyEnd : size;
+        _dirtyBegin = _dirtyEnd > dirtyBegin ? dirtyBegin : size;
+        return false;
+    }
+
+    if (size <= _capacity)
+    {
+        _size = size;
+        return false;
+    }
+
+    // 예약을 넘으면 새 메모리로 옮김 (Heap 방식은 늘릴 때마다 여기로 옴)
+    auto storage = _Allocate(size, false, _backing, _guardBytes);
+    std::memcpy(storage.get(), GetData(), oldSize);
+    _memoryManager = std::move(storage);
+    _size = size;
+    _capacity = size;
+    _fileMapped = false;
+    return true;
+}
+
+void MemorySegment::ShareData(const MemorySegment& source)
+{
+    if (source._size != _size || source._type != _type)
+    {
+        throw std::runtime_error("MemorySegment: shared segment size/type mismatch");
+    }
+    
+    _memoryManager = source._memoryManager;
+    _fileMapped = source._fileMapped;
+}
+
+void MemorySegment::Unshare()
+{
+    if (IsShared())
+    {
+        _memoryManager = _Allocate(_size, _type == MemorySegmentType::STACK, _backing, _guardBytes);
+        _fileMapped = false;
+    }
 }
 
 uint8_t MemorySegment::ReadByte(size_t offset) const 
@@ -66,17 +322,18 @@ void MemorySegment::WriteUInt64(size_t offset, uint64_t value)
     Write(offset, sizeof(uint64_t), &value);
 }
 
-void MemorySegment::_ValidateAccess(size_t offset, size_t size, MemoryAccessFlags flag) const 
+void MemorySegment::_ThrowAccessViolation(size_t offset, size_t size, MemoryAccessFlags flag) const 
 {
+    DMVM_TRACE_DEBUG("MemorySegment", "세그먼트=" + std::string(ToString(_type)) + ", 접근=" + ToString(flag) + 
+                     ", 현재권한=" + std::to_string(_accessFlags) + ", 오프셋=" + std::to_string(offset) + 
+                     ", 크기=" + std::to_string(size));
+    
     if (!HasAccess(flag)) 
     {
         throw MemoryAccessException("Memory access violation: no permission");
     }
     
-    if (offset + size > _size) 
-    {
-        throw MemoryAccessException("Memory access violation: out of bounds");
-    }
+    throw MemoryAccessException("Memory access violation: out of bounds");
 }
 
 } // namespace DarkMatterVM::Memory
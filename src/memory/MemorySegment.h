@@ -1,11 +1,25 @@
 #pragma once
 #include <cstdint>
 #include <cstddef>
+#include <cstring>
 #include <stdexcept>
 #include <string>
 #include <memory>
 #include <common/Logger.h>
 
+/**
+ * @brief 세그먼트 기본 메모리를 익명 mmap으로 예약할지 여부
+ * 
+ * Linux에서만 1 (빌드 옵션으로 0을 지정하면 make_shared 할당만 사용)
+ */
+#ifndef DMVM_MAPPED_SEGMENTS
+#if defined(__linux__)
+#define DMVM_MAPPED_SEGMENTS 1
+#else
+#define DMVM_MAPPED_SEGMENTS 0
+#endif
+#endif
+
 namespace DarkMatterVM::Memory 
 {
 
@@ -30,6 +44,44 @@ enum class MemorySegmentType : uint8_t
     CONSTANT    ///< 상수 영역 (읽기 전용 데이터)
 };
 
+/**
+ * @brief 세그먼트 메모리 확보 방식
+ */
+enum class MemoryBacking : uint8_t 
+{
+    Heap,       ///< 힙에 할당하고 전체를 0으로 채움 (모든 플랫폼)
+    Mapped      ///< 익명 mmap(MAP_NORESERVE)으로 주소 공간만 예약, 처음 건드린 페이지만 커널이 0으로 채워 커밋 (미지원 시 Heap)
+};
+
+/**
+ * @brief 세그먼트 유형 이름 (로그용)
+ */
+inline const char* ToString(MemorySegmentType type)
+{
+    switch (type)
+    {
+        case MemorySegmentType::CODE:       return "CODE";
+        case MemorySegmentType::STACK:      return "STACK";
+        case MemorySegmentType::HEAP:       return "HEAP";
+        case MemorySegmentType::CONSTANT:   return "CONSTANT";
+        default:                            return "UNKNOWN";
+    }
+}
+
+/**
+ * @brief 접근 권한 이름 (로그용)
+ */
+inline const char* ToString(MemoryAccessFlags flag)
+{
+    switch (flag)
+    {
+        case MemoryAccessFlags::READ:       return "READ";
+        case MemoryAccessFlags::WRITE:      return "WRITE";
+        case MemoryAccessFlags::EXECUTE:    return "EXECUTE";
+        default:                            return "UNKNOWN";
+    }
+}
+
 /**
  * @brief 메모리 접근 예외
  */
@@ -53,8 +105,87 @@ public:
      * @param type 세그먼트 유형
      * @param size 세그먼트 크기 (바이트)
      * @param accessFlags 접근 권한 플래그
+     * @param backing 메모리 확보 방식 (Mapped를 쓸 수 없으면 Heap으로 대체)
+     * @param capacity 미리 예약할 크기 (Resize()로 이만큼까지 제자리에서 늘림, size보다 작으면 size)
+     */
+    MemorySegment(MemorySegmentType type, size_t size, uint8_t accessFlags,
+                  MemoryBacking backing = GetDefaultBacking(), size_t capacity = 0);
+    
+    /**
+     * @brief 빌드 기본 메모리 확보 방식 (DMVM_MAPPED_SEGMENTS이면 Mapped)
+     */
+    static constexpr MemoryBacking GetDefaultBacking() 
+    {
+        return DMVM_MAPPED_SEGMENTS ? MemoryBacking::Mapped : MemoryBacking::Heap;
+    }
+    
+    /**
+     * @brief 실제로 사용 중인 메모리 확보 방식
      */
-    MemorySegment(MemorySegmentType type, size_t size, uint8_t accessFlags);
+    MemoryBacking GetBacking() const { return _backing; }
+    
+    /**
+     * @brief 예약된 바이트 수 (Resize()로 제자리에서 늘릴 수 있는 크기, Heap 방식은 세그먼트 크기)
+     */
+    size_t GetReservedBytes() const { return _capacity; }
+    
+    /**
+     * @brief 예약 크기를 capacity 이상으로 늘림 (Mapped만, 내용은 새 예약으로 복사되고 데이터 포인터가 바뀜)
+     * 
+     * Heap 방식은 미리 예약할 수 없으므로 아무것도 하지 않음 (Resize()가 그때그때 옮김)
+     */
+    void Reserve(size_t capacity);
+    
+    /**
+     * @brief 세그먼트 크기 변경 (오프셋으로 나타낸 주소는 그대로 유효)
+     * 
+     * 예약 안에서 늘리면 데이터 포인터가 바뀌지 않고, 예약을 넘으면 새 메모리로 내용을 옮김
+     * 줄이면 잘려 나간 구간을 0으로 되돌려(Mapped는 페이지를 커널에 반환) 다시 늘렸을 때 0으로 보이게 함
+     * 
+     * @param size 새 크기
+     * @return bool 데이터 포인터가 바뀌었는지 여부
+     * @throw std::runtime_error 공유 중이거나 가드 페이지가 있는 세그먼트일 때
+     */
+    bool Resize(size_t size);
+    
+    /**
+     * @brief 앞뒤에 접근 금지 가드 페이지가 붙어 있는지 여부
+     * 
+     * Mapped STACK 세그먼트이고 크기가 페이지 크기의 배수일 때만 붙음
+     * 세그먼트 바로 앞(오버플로)과 바로 뒤(언더플로)를 건드리면 SIGSEGV가 발생 (StackGuard 참고)
+     */
+    bool HasGuardPages() const { return _guardBytes != 0; }
+    
+    /**
+     * @brief 주소가 어느 쪽 가드 페이지에 속하는지 (시그널 처리기에서 호출 가능)
+     * 
+     * @param address 확인할 주소
+     * @return int -1: 앞쪽(오버플로), 1: 뒤쪽(언더플로), 0: 가드 페이지가 아님
+     */
+    int GetGuardSide(uintptr_t address) const 
+    {
+        uintptr_t begin = reinterpret_cast<uintptr_t>(GetData());
+        if (_guardBytes == 0) 
+        {
+            return 0;
+        }
+        if (address < begin && address >= begin - _guardBytes) 
+        {
+            return -1;
+        }
+        if (address >= begin + _size && address < begin + _size + _guardBytes) 
+        {
+            return 1;
+        }
+        return 0;
+    }
+    
+    /**
+     * @brief 물리 메모리에 올라온 바이트 수
+     * 
+     * Mapped는 페이지별 상주 여부(mincore)로 계산하고, Heap은 생성 시 전체를 채우므로 세그먼트 크기와 같음
+     */
+    size_t GetCommittedBytes() const;
     
     /**
      * @brief 메모리 세그먼트 소멸자
@@ -87,7 +218,107 @@ public:
     {
         _ValidateAccess(offset, size, MemoryAccessFlags::WRITE);
         std::memcpy(GetData() + offset, data, size);
+        MarkDirty(offset, size);
     }
+    
+    /**
+     * @brief 구간 범위를 한 번 검사하고 시작 포인터 반환 (MEMCPY/MEMSET처럼 여러 바이트를 한꺼번에 쓰는 코드용)
+     * 
+     * 쓰기 구간으로 기록하므로 호출자는 반환된 포인터로 [offset, offset + size)에 바로 씀
+     * 
+     * @param offset 세그먼트 내 오프셋
+     * @param size 쓸 바이트 수
+     * @return uint8_t* 구간 시작 포인터
+     * @throw MemoryAccessException 쓰기 권한 없거나 범위 초과 시
+     */
+    inline uint8_t* GetWritableRange(size_t offset, size_t size)
+    {
+        _ValidateAccess(offset, size, MemoryAccessFlags::WRITE);
+        MarkDirty(offset, size);
+        return GetData() + offset;
+    }
+    
+    /**
+     * @brief 구간 범위를 한 번 검사하고 시작 포인터 반환 (읽기용)
+     * 
+     * @param offset 세그먼트 내 오프셋
+     * @param size 읽을 바이트 수
+     * @return const uint8_t* 구간 시작 포인터
+     * @throw MemoryAccessException 읽기 권한 없거나 범위 초과 시
+     */
+    inline const uint8_t* GetReadableRange(size_t offset, size_t size) const
+    {
+        _ValidateAccess(offset, size, MemoryAccessFlags::READ);
+        return GetData() + offset;
+    }
+    
+    /**
+     * @brief 쓰인 구간 기록 (Write()를 거치지 않고 GetData()로 직접 쓰는 코드용)
+     * 
+     * 쓰인 바이트를 모두 덮는 [begin, end) 한 구간만 유지 (스택은 아래, 힙은 위로 자라므로 두 값이면 충분)
+     * 
+     * @param offset 세그먼트 내 오프셋
+     * @param size 쓴 바이트 수
+     */
+    inline void MarkDirty(size_t offset, size_t size)
+    {
+        _dirtyBegin = offset < _dirtyBegin ? offset : _dirtyBegin;
+        _dirtyEnd = offset + size > _dirtyEnd ? offset + size : _dirtyEnd;
+    }
+    
+    /**
+     * @brief 마지막 ScrubDirty() 이후 쓰인 바이트 수 (구간 길이)
+     */
+    size_t GetDirtyBytes() const { return _dirtyEnd > _dirtyBegin ? _dirtyEnd - _dirtyBegin : 0; }
+    
+    /**
+     * @brief 마지막 ScrubDirty() 이후 쓰인 구간 시작/끝 (비어 있으면 GetDirtyBytes() == 0, 구간 밖은 모두 0)
+     */
+    size_t GetDirtyBegin() const { return _dirtyBegin; }
+    size_t GetDirtyEnd() const { return _dirtyEnd; }
+    
+    /**
+     * @brief 파일(memfd, 스냅샷 파일)의 한 구간을 세그먼트 위에 MAP_PRIVATE로 덮어 매핑
+     * 
+     * 내용은 복사하지 않고 페이지 캐시를 여러 세그먼트가 함께 쓰며, 쓰기가 일어난 페이지만 복사됨 (copy-on-write)
+     * 이후 ScrubDirty()는 이 페이지를 커널에 돌려줄 때 파일 내용이 아닌 0 페이지로 바꿈
+     * 
+     * @param offset 세그먼트 내 오프셋 (페이지 정렬)
+     * @param length 매핑할 바이트 수
+     * @param fd 파일 디스크립터
+     * @param fileOffset 파일 내 오프셋 (페이지 정렬)
+     * @return bool 매핑했는지 여부 (Mapped가 아니거나 공유 중이거나 정렬/범위가 맞지 않으면 false, 호출자가 복사)
+     */
+    bool MapPrivate(size_t offset, size_t length, int fd, uint64_t fileOffset);
+    
+    /**
+     * @brief 쓰인 구간만 0으로 되돌림
+     * 
+     * 세그먼트 전체가 아니라 마지막 ScrubDirty() 이후 쓰인 구간만 지우므로 비용은 실제로 쓴 양에 비례
+     * Mapped는 구간 안의 온전한 페이지를 커널에 돌려주므로(madvise) 커밋된 바이트도 줄어듦
+     * 
+     * @return size_t 지운 바이트 수
+     */
+    size_t ScrubDirty();
+    
+    /**
+     * @brief 다른 세그먼트의 메모리를 복사 없이 공유 (읽기 전용 코드 세그먼트용)
+     * 
+     * 크기와 유형이 같아야 하며, 이후 이 세그먼트에 쓰려면 먼저 Unshare()
+     * 
+     * @param source 공유할 세그먼트
+     */
+    void ShareData(const MemorySegment& source);
+    
+    /**
+     * @brief 다른 세그먼트와 메모리를 공유 중이면 0으로 채운 전용 메모리로 교체
+     */
+    void Unshare();
+    
+    /**
+     * @brief 다른 세그먼트와 메모리를 공유 중인지 여부
+     */
+    bool IsShared() const { return _memoryManager.use_count() > 1; }
 
     /**
      * @brief 바이트 한 개 읽기
@@ -176,30 +407,7 @@ public:
      */
     bool HasAccess(MemoryAccessFlags flag) const 
     {
-        bool result = (_accessFlags & static_cast<uint8_t>(flag)) != 0;
-        
-        // 디버깅 로그 추가
-        std::string flagName;
-        switch(flag) {
-            case MemoryAccessFlags::READ: flagName = "READ"; break;
-            case MemoryAccessFlags::WRITE: flagName = "WRITE"; break;
-            case MemoryAccessFlags::EXECUTE: flagName = "EXECUTE"; break;
-            default: flagName = "UNKNOWN"; break;
-        }
-        
-        std::string typeName;
-        switch(_type) {
-            case MemorySegmentType::CODE: typeName = "CODE"; break;
-            case MemorySegmentType::STACK: typeName = "STACK"; break;
-            case MemorySegmentType::HEAP: typeName = "HEAP"; break;
-            case MemorySegmentType::CONSTANT: typeName = "CONSTANT"; break;
-            default: typeName = "UNKNOWN"; break;
-        }
-        
-        Logger::Debug("MemorySegment", "세그먼트=" + typeName + ", 권한체크=" + flagName + 
-                     ", 현재권한=" + std::to_string(_accessFlags) + ", 결과=" + (result ? "허용" : "거부"));
-        
-        return result;
+        return (_accessFlags & static_cast<uint8_t>(flag)) != 0;
     }
     
     /**
@@ -225,12 +433,41 @@ private:
      * @param flag 접근 유형 플래그
      * @throw MemoryAccessException 접근 권한 없거나 범위 초과 시
      */
-    void _ValidateAccess(size_t offset, size_t size, MemoryAccessFlags flag) const;
+    inline void _ValidateAccess(size_t offset, size_t size, MemoryAccessFlags flag) const
+    {
+        if (!HasAccess(flag) || size > _size || offset > _size - size) 
+        {
+            _ThrowAccessViolation(offset, size, flag);
+        }
+    }
+    
+    /**
+     * @brief 접근 실패 예외 발생 (권한 없음/범위 초과 구분, 추적 로그가 켜져 있으면 기록)
+     */
+    [[noreturn]] void _ThrowAccessViolation(size_t offset, size_t size, MemoryAccessFlags flag) const;
+    
+    /**
+     * @brief backing 방식으로 0으로 채워진 메모리 확보 (Mapped 실패 시 Heap으로 바꾸어 할당)
+     */
+    static std::shared_ptr<uint8_t[]> _Allocate(size_t size, bool guarded, MemoryBacking& backing, size_t& guardBytes);
+    
+    /**
+     * @brief 페이지 구간을 커널에 돌려줌 (다시 건드리면 0 페이지)
+     * 
+     * @return bool 돌려줬는지 여부 (false면 호출자가 memset)
+     */
+    bool _Decommit(uint8_t* begin, size_t length);
 
-    std::unique_ptr<uint8_t[]> _memoryManager; ///< 실제 메모리 저장 공간 (OS 힙에 할당)
+    std::shared_ptr<uint8_t[]> _memoryManager; ///< 실제 메모리 저장 공간 (OS 힙에 할당, 코드 세그먼트는 인스턴스 간 공유 가능)
     size_t _size;                   ///< 메모리 크기
     MemorySegmentType _type;        ///< 세그먼트 유형
     uint8_t _accessFlags;           ///< 접근 권한 플래그
+    size_t _dirtyBegin;             ///< 쓰인 구간 시작 (비어 있으면 _size)
+    MemoryBacking _backing;         ///< 실제 메모리 확보 방식
+    size_t _guardBytes = 0;         ///< 앞뒤 가드 페이지 크기 (없으면 0)
+    size_t _dirtyEnd = 0;           ///< 쓰인 구간 끝
+    size_t _capacity;               ///< 예약 크기 (Mapped는 이만큼 주소 공간을 잡아 둠)
+    bool _fileMapped = false;       ///< MapPrivate()로 파일 페이지를 덮어 매핑한 적이 있는지
 };
 
 } // namespace DarkMatterVM::Memory
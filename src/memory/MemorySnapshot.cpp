@@ -0,0 +1,370 @@
+#include "MemorySnapshot.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#if DMVM_MAPPED_SEGMENTS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace DarkMatterVM::Memory
+{
+
+/**
+ * @brief 이미지가 가리키는 파일 디스크립터 (memfd 또는 스냅샷 파일)
+ */
+struct SegmentImage::File
+{
+    int fd = -1;
+
+#if DMVM_MAPPED_SEGMENTS
+    ~File()
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+    }
+#endif
+};
+
+/// MemorySnapshot 구현
+namespace
+{
+
+// 파일에 저장하는 HeapStats 필드 (usedBytes 등 GetStats()가 계산하는 값도 함께 저장)
+constexpr size_t HeapStats::* kStatFields[] = {
+    &HeapStats::allocationCount, &HeapStats::freeCount, &HeapStats::liveBlocks, &HeapStats::liveBytes,
+    &HeapStats::peakLiveBytes, &HeapStats::usedBytes, &HeapStats::peakUsedBytes, &HeapStats::freeBytes,
+    &HeapStats::largestFreeBlock, &HeapStats::heapSize, &HeapStats::peakHeapSize, &HeapStats::growthCount,
+    &HeapStats::relocationCount
+};
+
+size_t AlignUp(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+void WriteLE(std::vector<uint8_t>& out, uint64_t value, size_t bytes)
+{
+    for (size_t i = 0; i < bytes; ++i)
+    {
+        out.push_back(static_cast<uint8_t>(value >> (i * 8)));
+    }
+}
+
+uint64_t ReadLE(std::istream& in, size_t bytes)
+{
+    uint8_t data[8] = {};
+    if (!in.read(reinterpret_cast<char*>(data), static_cast<std::streamsize>(bytes)))
+    {
+        throw std::runtime_error("MemorySnapshot: truncated snapshot file");
+    }
+
+    uint64_t value = 0;
+    for (size_t i = 0; i < bytes; ++i)
+    {
+        value |= static_cast<uint64_t>(data[i]) << (i * 8);
+    }
+    return value;
+}
+
+} // namespace
+
+SegmentImage SegmentImage::Capture(const MemorySegment& segment)
+{
+    SegmentImage image;
+    image._segmentSize = segment.GetSize();
+    if (segment.GetDirtyBytes() == 0)
+    {
+        return image;
+    }
+
+    const size_t end = std::min(AlignUp(segment.GetDirtyEnd(), kAlignment), segment.GetSize());
+    image._begin = segment.GetDirtyBegin() / kAlignment * kAlignment;
+    image._length = end - image._begin;
+    const uint8_t* source = segment.GetData() + image._begin;
+
+#if DMVM_MAPPED_SEGMENTS
+    // 내용을 memfd에 한 번 복사해 두면 복원은 매핑만 함
+    auto file = std::make_shared<File>();
+    file->fd = memfd_create("dmvm-snapshot", MFD_CLOEXEC);
+    size_t written = 0;
+    while (file->fd >= 0 && written < image._length)
+    {
+        ssize_t count = pwrite(file->fd, source + written, image._length - written, static_cast<off_t>(written));
+        if (count <= 0)
+        {
+            break;
+        }
+        written += static_cast<size_t>(count);
+    }
+
+    if (written == image._length)
+    {
+        image._file = std::move(file);
+        return image;
+    }
+#endif
+
+    image._bytes = std::make_shared<const std::vector<uint8_t>>(source, source + image._length);
+    return image;
+}
+
+void SegmentImage::Restore(MemorySegment& segment) const
+{
+    if (segment.GetSize() != _segmentSize)
+    {
+        segment.Resize(_segmentSize);
+    }
+
+    if (_length == 0)
+    {
+        return;
+    }
+
+    if (!_file || !segment.MapPrivate(_begin, _length, _file->fd, _fileOffset))
+    {
+        Read(0, segment.GetData() + _begin, _length);
+    }
+
+    // 복원한 구간을 다음 ScrubDirty()가 지우도록 표시
+    segment.MarkDirty(_begin, _length);
+}
+
+void SegmentImage::Read(size_t offset, void* buffer, size_t size) const
+{
+    if (size > _length || offset > _length - size)
+    {
+        throw std::runtime_error("SegmentImage: read out of bounds");
+    }
+
+    if (_bytes)
+    {
+        std::memcpy(buffer, _bytes->data() + offset, size);
+        return;
+    }
+
+#if DMVM_MAPPED_SEGMENTS
+    uint8_t* target = static_cast<uint8_t*>(buffer);
+    size_t done = 0;
+    while (done < size)
+    {
+        ssize_t count = pread(_file->fd, target + done, size - done, static_cast<off_t>(_fileOffset + offset + done));
+        if (count <= 0)
+        {
+            throw std::runtime_error("SegmentImage: failed to read image");
+        }
+        done += static_cast<size_t>(count);
+    }
+#endif
+}
+
+void MemorySnapshot::SaveToFile(const std::string& path) const
+{
+    const SegmentImage* images[] = {&stack, &heap, &constant};
+
+    std::vector<uint8_t> header;
+    WriteLE(header, kMagic, 4);
+    header.push_back(kVersion);
+    WriteLE(header, 0, 3);
+    WriteLE(header, instructionPointer, 8);
+    WriteLE(header, basePointer, 8);
+    WriteLE(header, stackPointer, 8);
+    WriteLE(header, code.size(), 8);
+
+    uint64_t growthFactorBits;
+    std::memcpy(&growthFactorBits, &heapState.policy.growthFactor, sizeof(growthFactorBits));
+    WriteLE(header, heapState.policy.initialSize, 8);
+    WriteLE(header, growthFactorBits, 8);
+    WriteLE(header, heapState.policy.maxSize, 8);
+    WriteLE(header, heapState.top, 8);
+    WriteLE(header, heapState.heads.size(), 4);
+    WriteLE(header, heapState.binMap.size(), 4);
+    for (size_t head : heapState.heads)
+    {
+        WriteLE(header, head, 8);
+    }
+    for (uint64_t word : heapState.binMap)
+    {
+        WriteLE(header, word, 8);
+    }
+    for (auto field : kStatFields)
+    {
+        WriteLE(header, heapState.stats.*field, 8);
+    }
+    WriteLE(header, callStack.size(), 4);
+    for (const SavedCallFrame& frame : callStack)
+    {
+        WriteLE(header, frame.returnAddress, 8);
+        WriteLE(header, frame.basePointer, 8);
+        WriteLE(header, frame.entry, 8);
+    }
+
+    // 세그먼트 내용은 코드 뒤 정렬된 위치부터 차례로
+    size_t fileOffset = AlignUp(header.size() + 4 * 8 * 3 + code.size(), SegmentImage::kAlignment);
+    std::vector<size_t> offsets;
+    for (const SegmentImage* image : images)
+    {
+        offsets.push_back(fileOffset);
+        WriteLE(header, image->GetSegmentSize(), 8);
+        WriteLE(header, image->GetBegin(), 8);
+        WriteLE(header, image->GetLength(), 8);
+        WriteLE(header, fileOffset, 8);
+        fileOffset = AlignUp(fileOffset + image->GetLength(), SegmentImage::kAlignment);
+    }
+    header.insert(header.end(), code.begin(), code.end());
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        throw std::runtime_error("MemorySnapshot: cannot open " + path);
+    }
+    file.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+
+    std::vector<uint8_t> buffer(SegmentImage::kAlignment);
+    for (size_t i = 0; i < std::size(images); ++i)
+    {
+        // 정렬 간격은 0으로 채움
+        std::fill(buffer.begin(), buffer.end(), 0);
+        for (size_t position = static_cast<size_t>(file.tellp()); position < offsets[i]; )
+        {
+            size_t count = std::min(buffer.size(), offsets[i] - position);
+            file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(count));
+            position += count;
+        }
+
+        for (size_t done = 0; done < images[i]->GetLength(); done += buffer.size())
+        {
+            size_t count = std::min(buffer.size(), images[i]->GetLength() - done);
+            images[i]->Read(done, buffer.data(), count);
+            file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(count));
+        }
+    }
+
+    if (!file.flush())
+    {
+        throw std::runtime_error("MemorySnapshot: failed to write " + path);
+    }
+}
+
+std::shared_ptr<MemorySnapshot> MemorySnapshot::LoadFromFile(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        throw std::runtime_error("MemorySnapshot: cannot open " + path);
+    }
+
+    file.seekg(0, std::ios::end);
+    const uint64_t fileSize = static_cast<uint64_t>(file.tellg());
+    file.seekg(0, std::ios::beg);
+
+    if (ReadLE(file, 4) != kMagic)
+    {
+        throw std::runtime_error("MemorySnapshot: not a snapshot file");
+    }
+    if (ReadLE(file, 1) != kVersion)
+    {
+        throw std::runtime_error("MemorySnapshot: unsupported snapshot version");
+    }
+    ReadLE(file, 3);
+
+    auto snapshot = std::make_shared<MemorySnapshot>();
+    snapshot->instructionPointer = ReadLE(file, 8);
+    snapshot->basePointer = ReadLE(file, 8);
+    snapshot->stackPointer = ReadLE(file, 8);
+    const uint64_t codeSize = ReadLE(file, 8);
+
+    HeapAllocatorState& state = snapshot->heapState;
+    state.policy.initialSize = ReadLE(file, 8);
+    uint64_t growthFactorBits = ReadLE(file, 8);
+    std::memcpy(&state.policy.growthFactor, &growthFactorBits, sizeof(growthFactorBits));
+    state.policy.maxSize = ReadLE(file, 8);
+    state.top = ReadLE(file, 8);
+    const uint64_t headCount = ReadLE(file, 4);
+    const uint64_t binMapCount = ReadLE(file, 4);
+    if ((headCount + binMapCount) * 8 + codeSize > fileSize)
+    {
+        throw std::runtime_error("MemorySnapshot: truncated snapshot file");
+    }
+    for (uint64_t i = 0; i < headCount; ++i)
+    {
+        state.heads.push_back(ReadLE(file, 8));
+    }
+    for (uint64_t i = 0; i < binMapCount; ++i)
+    {
+        state.binMap.push_back(ReadLE(file, 8));
+    }
+    for (auto field : kStatFields)
+    {
+        state.stats.*field = ReadLE(file, 8);
+    }
+    const uint64_t callDepth = ReadLE(file, 4);
+    if (callDepth * 3 * 8 > fileSize)
+    {
+        throw std::runtime_error("MemorySnapshot: truncated snapshot file");
+    }
+    for (uint64_t i = 0; i < callDepth; ++i)
+    {
+        SavedCallFrame frame;
+        frame.returnAddress = ReadLE(file, 8);
+        frame.basePointer = ReadLE(file, 8);
+        frame.entry = ReadLE(file, 8);
+        snapshot->callStack.push_back(frame);
+    }
+
+    SegmentImage* images[] = {&snapshot->stack, &snapshot->heap, &snapshot->constant};
+    for (SegmentImage* image : images)
+    {
+        image->_segmentSize = ReadLE(file, 8);
+        image->_begin = ReadLE(file, 8);
+        image->_length = ReadLE(file, 8);
+        image->_fileOffset = ReadLE(file, 8);
+        if (image->_length > image->_segmentSize || image->_begin > image->_segmentSize - image->_length ||
+            image->_fileOffset % SegmentImage::kAlignment != 0 || image->_fileOffset > fileSize ||
+            image->_length > fileSize - image->_fileOffset)
+        {
+            throw std::runtime_error("MemorySnapshot: segment image out of range");
+        }
+    }
+
+    snapshot->code.resize(codeSize);
+    if (!file.read(reinterpret_cast<char*>(snapshot->code.data()), static_cast<std::streamsize>(codeSize)))
+    {
+        throw std::runtime_error("MemorySnapshot: truncated snapshot file");
+    }
+
+#if DMVM_MAPPED_SEGMENTS
+    // 세그먼트 내용은 읽지 않고 파일 구간을 가리킴 (복원 시 페이지 캐시를 MAP_PRIVATE로 매핑)
+    auto mapped = std::make_shared<SegmentImage::File>();
+    mapped->fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (mapped->fd >= 0)
+    {
+        for (SegmentImage* image : images)
+        {
+            image->_file = mapped;
+        }
+        return snapshot;
+    }
+#endif
+
+    for (SegmentImage* image : images)
+    {
+        auto bytes = std::make_shared<std::vector<uint8_t>>(image->_length);
+        file.seekg(static_cast<std::streamoff>(image->_fileOffset));
+        if (!file.read(reinterpret_cast<char*>(bytes->data()), static_cast<std::streamsize>(image->_length)))
+        {
+            throw std::runtime_error("MemorySnapshot: truncated snapshot file");
+        }
+        image->_bytes = std::move(bytes);
+        image->_fileOffset = 0;
+    }
+
+    return snapshot;
+}
+
+} // namespace DarkMatterVM::Memory
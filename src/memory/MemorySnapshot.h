@@ -0,0 +1,142 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "HeapMemory.h"
+#include "MemorySegment.h"
+
+namespace DarkMatterVM::Memory
+{
+
+/**
+ * @brief 세그먼트 한 개의 스냅샷 내용
+ *
+ * 마지막 ScrubDirty() 이후 쓰인 구간을 kAlignment 단위로 넓힌 [begin, begin + length)만 담고 나머지는 0으로 봄
+ * - Linux(DMVM_MAPPED_SEGMENTS): memfd 또는 스냅샷 파일의 한 구간, 복원 시 MAP_PRIVATE로 매핑 (쓰는 페이지만 복사)
+ * - 그 밖: 바이트 배열, 복원 시 복사
+ *
+ * 내용은 만든 뒤 바뀌지 않으므로 여러 인스턴스가 같은 이미지를 함께 복원할 수 있음
+ */
+class SegmentImage
+{
+public:
+    /**
+     * @brief 구간 정렬 단위 (세그먼트 오프셋과 파일 오프셋, 지원하는 페이지 크기의 공배수)
+     */
+    static constexpr size_t kAlignment = 64 * 1024;
+
+    SegmentImage() = default;
+
+    /**
+     * @brief 세그먼트의 쓰인 구간을 이미지로 복사 (memfd를 만들 수 없으면 바이트 배열)
+     *
+     * @param segment 대상 세그먼트
+     */
+    static SegmentImage Capture(const MemorySegment& segment);
+
+    /**
+     * @brief 세그먼트를 이미지 내용으로 되돌림 (먼저 ScrubDirty()로 비워 둔 세그먼트, 크기도 이미지 기준으로 맞춤)
+     *
+     * @param segment 대상 세그먼트
+     */
+    void Restore(MemorySegment& segment) const;
+
+    /**
+     * @brief 이미지 내용 읽기
+     *
+     * @param offset 이미지 구간 안 오프셋 (0 = GetBegin())
+     * @param buffer 읽은 내용을 저장할 버퍼
+     * @param size 읽을 바이트 수
+     * @throw std::runtime_error 범위를 벗어나거나 파일을 읽지 못할 때
+     */
+    void Read(size_t offset, void* buffer, size_t size) const;
+
+    size_t GetSegmentSize() const { return _segmentSize; }      ///< 저장 시점 세그먼트 크기
+    size_t GetBegin() const { return _begin; }                  ///< 담은 구간 시작 (세그먼트 오프셋)
+    size_t GetLength() const { return _length; }                ///< 담은 바이트 수
+
+    /**
+     * @brief 복원 시 복사 없이 매핑할 수 있는 이미지인지 (memfd/파일 구간)
+     */
+    bool IsFileBacked() const { return _file != nullptr; }
+
+private:
+    friend struct MemorySnapshot;
+
+    struct File;
+
+    size_t _segmentSize = 0;
+    size_t _begin = 0;
+    size_t _length = 0;
+    std::shared_ptr<const File> _file;                          ///< 파일 구간일 때 디스크립터 (마지막 이미지가 닫음)
+    uint64_t _fileOffset = 0;                                   ///< 파일 안 시작 위치
+    std::shared_ptr<const std::vector<uint8_t>> _bytes;         ///< 바이트 배열일 때 내용
+};
+
+/**
+ * @brief 저장된 호출 스택 항목 (ControlFlow::CallFrame과 같은 순서의 필드)
+ */
+struct SavedCallFrame
+{
+    uint64_t returnAddress;                 ///< 반환 주소
+    uint64_t basePointer;                   ///< 호출자의 BP
+    uint64_t entry;                         ///< 호출된 함수 시작 오프셋
+};
+
+/**
+ * @brief VM 메모리 스냅샷
+ *
+ * 세그먼트 내용(STACK/HEAP/CONSTANT는 이미지, CODE는 로드된 길이만큼 바이트), 힙 할당기 상태, 레지스터(IP/BP/SP), 호출 스택
+ * MemoryManager::CaptureSnapshot()과 Interpreter::Snapshot()이 채움
+ *
+ * 파일 형식 (little-endian):
+ *   "DMSN" | version(1) | reserved(3) | ip(8) | bp(8) | sp(8) | codeSize(8)
+ *   | policy: initialSize(8) growthFactor(8) maxSize(8) | top(8) | headCount(4) | binMapCount(4)
+ *   | heads(8 * headCount) | binMap(8 * binMapCount) | stats(8 * HeapStats 정수 필드 수)
+ *   | callDepth(4) | 호출 스택 (바깥 호출부터 returnAddress(8) basePointer(8) entry(8))
+ *   | STACK/HEAP/CONSTANT 순 segmentSize(8) begin(8) length(8) fileOffset(8)
+ *   | code(codeSize) | 세그먼트 내용 (각각 SegmentImage::kAlignment 정렬된 fileOffset에서 시작)
+ */
+struct MemorySnapshot
+{
+    static constexpr uint32_t kMagic = 0x4E534D44; // "DMSN"
+    static constexpr uint8_t kVersion = 2;
+
+    SegmentImage stack;                     ///< 스택 세그먼트
+    SegmentImage heap;                      ///< 힙 세그먼트
+    SegmentImage constant;                  ///< 상수 세그먼트
+    std::vector<uint8_t> code;              ///< 코드 세그먼트 (로드된 바이트코드 길이만큼)
+    HeapAllocatorState heapState;           ///< 힙 할당기 상태
+    size_t stackPointer = 0;                ///< 스택 포인터 (SP)
+    uint64_t instructionPointer = 0;        ///< 명령어 포인터 (IP)
+    uint64_t basePointer = 0;               ///< 베이스 포인터 (BP)
+    std::vector<SavedCallFrame> callStack;  ///< CALL/RET 호출 스택 (바깥 호출부터)
+
+    /**
+     * @brief 세그먼트 이미지 바이트 합 (CODE 제외)
+     */
+    size_t GetImageBytes() const { return stack.GetLength() + heap.GetLength() + constant.GetLength(); }
+
+    /**
+     * @brief 파일로 저장
+     *
+     * @param path 저장할 경로
+     * @throw std::runtime_error 파일을 쓰지 못할 때
+     */
+    void SaveToFile(const std::string& path) const;
+
+    /**
+     * @brief 파일에서 읽기
+     *
+     * Linux에서는 세그먼트 내용을 읽지 않고 파일 구간을 가리키는 이미지로 만들어, 복원 시 파일을 바로 MAP_PRIVATE로 매핑
+     *
+     * @param path 읽을 경로
+     * @return std::shared_ptr<MemorySnapshot> 읽은 스냅샷
+     * @throw std::runtime_error 파일을 읽지 못하거나 형식이 맞지 않을 때
+     */
+    static std::shared_ptr<MemorySnapshot> LoadFromFile(const std::string& path);
+};
+
+} // namespace DarkMatterVM::Memory
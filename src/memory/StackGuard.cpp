@@ -0,0 +1,93 @@
+#include "StackGuard.h"
+#include <mutex>
+
+namespace DarkMatterVM::Memory
+{
+
+/// StackGuard 구현
+namespace
+{
+
+// 현재 스레드에서 가장 안쪽 가드 범위 (시그널 처리기가 읽음)
+thread_local StackGuard* t_activeGuard = nullptr;
+
+#if DMVM_STACK_GUARD
+struct sigaction g_previousAction = {};
+#endif
+
+} // namespace
+
+StackGuard::StackGuard(const MemorySegment& segment)
+    : _segment(segment), _previous(t_activeGuard)
+{
+    t_activeGuard = this;
+}
+
+StackGuard::~StackGuard()
+{
+    t_activeGuard = _previous;
+}
+
+bool StackGuard::Install()
+{
+#if DMVM_STACK_GUARD
+    static std::once_flag once;
+    static bool installed = false;
+
+    std::call_once(once, []()
+    {
+        struct sigaction action = {};
+        action.sa_sigaction = &StackGuard::_OnFault;
+        action.sa_flags = SA_SIGINFO | SA_NODEFER | SA_ONSTACK;
+        sigemptyset(&action.sa_mask);
+        installed = sigaction(SIGSEGV, &action, &g_previousAction) == 0;
+    });
+
+    return installed;
+#else
+    return false;
+#endif
+}
+
+bool StackGuard::CanGuard(const MemorySegment& segment)
+{
+    return IsSupported() && segment.HasGuardPages() && Install();
+}
+
+#if DMVM_STACK_GUARD
+void StackGuard::_OnFault(int signal, siginfo_t* info, void* context)
+{
+    // 안쪽 범위부터 폴트 주소가 자기 세그먼트의 가드 페이지인지 확인
+    uintptr_t address = reinterpret_cast<uintptr_t>(info->si_addr);
+    for (StackGuard* guard = t_activeGuard; guard != nullptr; guard = guard->_previous)
+    {
+        int side = guard->_segment.GetGuardSide(address);
+        if (side != 0)
+        {
+            guard->_fault.overflow = side < 0;
+            guard->_fault.address = address;
+            guard->_fault.ip = 0;
+            siglongjmp(guard->_jump, 1);
+        }
+    }
+
+    // VM 스택과 무관한 폴트: 이전 처리기로 넘기고, 기본 동작이면 복원해 같은 명령어에서 다시 폴트가 나게 함
+    if ((g_previousAction.sa_flags & SA_SIGINFO) != 0 && g_previousAction.sa_sigaction != nullptr)
+    {
+        g_previousAction.sa_sigaction(signal, info, context);
+    }
+    else if (g_previousAction.sa_handler != SIG_DFL && g_previousAction.sa_handler != SIG_IGN)
+    {
+        g_previousAction.sa_handler(signal);
+    }
+    else
+    {
+        struct sigaction fallback = {};
+        fallback.sa_handler = SIG_DFL;
+        sigemptyset(&fallback.sa_mask);
+        sigaction(SIGSEGV, &fallback, nullptr);
+    }
+}
+#endif
+
+} // namespace DarkMatterVM::Memory
@@ -0,0 +1,122 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include "MemorySegment.h"
+
+/**
+ * @brief 가드 페이지 폴트를 VM 오류로 바꾸는 SIGSEGV 처리 지원 여부
+ *
+ * mmap 세그먼트를 쓰는 Linux 빌드에서만 1 (빌드 옵션으로 0을 지정하면 비활성화)
+ */
+#ifndef DMVM_STACK_GUARD
+#if DMVM_MAPPED_SEGMENTS && defined(__linux__)
+#define DMVM_STACK_GUARD 1
+#else
+#define DMVM_STACK_GUARD 0
+#endif
+#endif
+
+#if DMVM_STACK_GUARD
+#include <csetjmp>
+#include <csignal>
+
+/**
+ * @brief 가드 범위 진입 지점 설정 (처음에는 false, 가드 페이지 폴트로 돌아오면 true)
+ *
+ * sigsetjmp는 호출한 함수가 살아 있어야 돌아올 수 있으므로 함수가 아니라 매크로로 제공
+ * 시그널 마스크는 저장하지 않음 (핸들러가 SA_NODEFER로 등록되어 SIGSEGV가 막히지 않음)
+ */
+#define DMVM_STACK_GUARD_FAULTED(guard) (sigsetjmp((guard).GetJumpBuffer(), 0) != 0)
+#else
+#define DMVM_STACK_GUARD_FAULTED(guard) false
+#endif
+
+namespace DarkMatterVM::Memory
+{
+
+/**
+ * @brief 가드 페이지 폴트 정보
+ */
+struct StackFault
+{
+    bool overflow = false;      ///< true: 아래쪽 가드(오버플로), false: 위쪽 가드(언더플로)
+    uintptr_t address = 0;      ///< 폴트가 난 주소
+    size_t ip = 0;              ///< 폴트를 일으킨 명령어 오프셋 (실행 엔진이 채움)
+};
+
+/**
+ * @brief 스택 세그먼트 가드 페이지 범위
+ *
+ * 생성부터 소멸까지 현재 스레드에서 세그먼트의 가드 페이지에 난 SIGSEGV를 받아
+ * DMVM_STACK_GUARD_FAULTED() 지점으로 되돌림 (중첩 가능, 안쪽 범위가 우선)
+ * 그 사이의 스택 푸시/팝은 범위 검사 없이 포인터만 옮기면 되고, 넘치면 가드 페이지에서 폴트가 남
+ *
+ * 폴트 시 siglongjmp로 돌아오므로 범위 안에서 폴트가 날 수 있는 코드는 소멸자가 필요한
+ * 지역 객체를 만들지 않아야 하고, 진입 지점 이후 바꾼 지역 변수는 volatile이 아니면 값을 믿을 수 없음
+ * 가드 페이지가 아닌 곳의 폴트는 이전에 등록된 처리기로 넘김
+ */
+class StackGuard
+{
+public:
+    /**
+     * @brief 가드 범위 시작
+     *
+     * @param segment 가드 페이지가 있는 스택 세그먼트
+     */
+    explicit StackGuard(const MemorySegment& segment);
+
+    StackGuard(const StackGuard&)            = delete;
+    StackGuard& operator=(const StackGuard&) = delete;
+
+    /**
+     * @brief 가드 범위 종료
+     */
+    ~StackGuard();
+
+    /**
+     * @brief 이 빌드에서 가드 페이지 폴트를 처리할 수 있는지 여부
+     */
+    static constexpr bool IsSupported() { return DMVM_STACK_GUARD != 0; }
+
+    /**
+     * @brief SIGSEGV 처리기 등록 (프로세스당 한 번, 이후 호출은 결과만 반환)
+     *
+     * @return bool 처리기가 등록되어 있는지 여부
+     */
+    static bool Install();
+
+    /**
+     * @brief 세그먼트를 가드 범위 안에서 포인터 조작으로 실행할 수 있는지 여부
+     *
+     * 빌드 지원, 세그먼트 가드 페이지, 처리기 등록이 모두 갖추어져야 함
+     */
+    static bool CanGuard(const MemorySegment& segment);
+
+    /**
+     * @brief 마지막으로 받은 폴트 (DMVM_STACK_GUARD_FAULTED()가 true일 때 유효)
+     */
+    const StackFault& GetFault() const { return _fault; }
+
+#if DMVM_STACK_GUARD
+    /**
+     * @brief DMVM_STACK_GUARD_FAULTED()용 진입 지점 버퍼
+     */
+    sigjmp_buf& GetJumpBuffer() { return _jump; }
+#endif
+
+private:
+    const MemorySegment& _segment;  ///< 가드 페이지가 있는 세그먼트
+    StackGuard* _previous;          ///< 바깥 가드 범위
+    StackFault _fault;              ///< 받은 폴트
+
+#if DMVM_STACK_GUARD
+    sigjmp_buf _jump;               ///< 폴트 시 돌아갈 지점
+
+    /**
+     * @brief SIGSEGV 처리기
+     */
+    static void _OnFault(int signal, siginfo_t* info, void* context);
+#endif
+};
+
+} // namespace DarkMatterVM::Memory
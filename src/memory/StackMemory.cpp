@@ -1,19 +1,20 @@
 #include "StackMemory.h"
 #include "MemorySegment.h"
+#include <cstring>
 #include <stdexcept>
-#include <mutex>
 
 namespace DarkMatterVM::Memory 
 {
 
-StackMemory::StackMemory(MemorySegment& segment)
+StackMemory::StackMemory(MemorySegment& segment, StackSharing sharing)
     : _segment(segment), _stackPointer(segment.GetSize())
 {
+    SetSharing(sharing);
 }
 
 void StackMemory::SetStackPointer(size_t stackPointer)
 {
-    std::lock_guard<std::mutex> lock(_stackMutex);
+    AccessScope scope(*this);
     
     if (stackPointer > _segment.GetSize())
     {
@@ -25,13 +26,13 @@ void StackMemory::SetStackPointer(size_t stackPointer)
 
 size_t StackMemory::GetStackPointer() const
 {
-    std::lock_guard<std::mutex> lock(_stackMutex);
+    AccessScope scope(*this);
     return _stackPointer;
 }
 
 void StackMemory::PushStack(uint64_t value)
 {
-    std::lock_guard<std::mutex> lock(_stackMutex);
+    AccessScope scope(*this);
     
     // 스택은 아래로 자라므로 포인터를 줄임
     _stackPointer -= sizeof(uint64_t);
@@ -43,7 +44,7 @@ void StackMemory::PushStack(uint64_t value)
 
 uint64_t StackMemory::PopStack()
 {
-    std::lock_guard<std::mutex> lock(_stackMutex);
+    AccessScope scope(*this);
     
     _ValidateStack(_stackPointer);
     
@@ -58,7 +59,7 @@ uint64_t StackMemory::PopStack()
 
 uint64_t StackMemory::PeekStack() const
 {
-    std::lock_guard<std::mutex> lock(_stackMutex);
+    AccessScope scope(*this);
     
     _ValidateStack(_stackPointer);
     
@@ -68,7 +69,7 @@ uint64_t StackMemory::PeekStack() const
 
 uint64_t StackMemory::GetStackValue(size_t offset) const
 {
-    std::lock_guard<std::mutex> lock(_stackMutex);
+    AccessScope scope(*this);
     
     size_t address = _stackPointer + (offset * sizeof(uint64_t));
     _ValidateStack(address);
@@ -76,9 +77,49 @@ uint64_t StackMemory::GetStackValue(size_t offset) const
     return _segment.ReadUInt64(address);
 }
 
+uint64_t StackMemory::ReadSlot(size_t address) const
+{
+    AccessScope scope(*this);
+    
+    _ValidateSlot(address);
+    return _segment.ReadUInt64(address);
+}
+
+void StackMemory::WriteSlot(size_t address, uint64_t value)
+{
+    AccessScope scope(*this);
+    
+    _ValidateSlot(address);
+    _segment.WriteUInt64(address, value);
+}
+
+void StackMemory::PushSlot(size_t address)
+{
+    AccessScope scope(*this);
+    
+    _ValidateSlot(address);
+    uint64_t value = _segment.ReadUInt64(address);
+    
+    _ValidateStack(_stackPointer - sizeof(uint64_t));
+    _stackPointer -= sizeof(uint64_t);
+    _segment.WriteUInt64(_stackPointer, value);
+}
+
+void StackMemory::PopSlot(size_t address)
+{
+    AccessScope scope(*this);
+    
+    _ValidateStack(_stackPointer);
+    uint64_t value = _segment.ReadUInt64(_stackPointer);
+    _stackPointer += sizeof(uint64_t);
+    
+    _ValidateSlot(address);
+    _segment.WriteUInt64(address, value);
+}
+
 void StackMemory::EnterStackFrame(size_t basePointer, size_t returnAddress)
 {
-    std::lock_guard<std::mutex> lock(_stackMutex);
+    AccessScope scope(*this);
     
     // 반환 주소 푸시
     _stackPointer -= sizeof(uint64_t);
@@ -96,7 +137,7 @@ void StackMemory::EnterStackFrame(size_t basePointer, size_t returnAddress)
 
 void StackMemory::LeaveStackFrame(size_t& basePointer, size_t& returnAddress)
 {
-    std::lock_guard<std::mutex> lock(_stackMutex);
+    AccessScope scope(*this);
     
     // 베이스 포인터 복원
     _ValidateStack(_stackPointer);
@@ -109,13 +150,77 @@ void StackMemory::LeaveStackFrame(size_t& basePointer, size_t& returnAddress)
     _stackPointer += sizeof(uint64_t);
 }
 
+void StackMemory::SetSharing(StackSharing sharing)
+{
+    if (sharing == StackSharing::Synchronized)
+    {
+        if (!_stackMutex)
+        {
+            _stackMutex = std::make_unique<std::mutex>();
+        }
+    }
+    else
+    {
+        _stackMutex.reset();
+    }
+    
+    _owner = std::thread::id();
+}
+
+void StackMemory::Reset(size_t stackPointer)
+{
+    std::unique_lock<std::mutex> lock;
+    if (_stackMutex)
+    {
+        lock = std::unique_lock<std::mutex>(*_stackMutex);
+    }
+    
+    if (stackPointer > _segment.GetSize())
+    {
+        throw std::runtime_error("StackMemory: stack pointer out of bounds");
+    }
+    
+    _stackPointer = stackPointer;
+    _owner = std::thread::id();
+}
+
+void StackMemory::_ThrowForeignThread()
+{
+    throw std::logic_error("StackMemory: accessed from a thread other than its owner");
+}
+
 void StackMemory::_ValidateStack(size_t offset, size_t byteCount) const
 {
-    // 이미 락이 걸린 상태에서 호출되므로 추가 락은 필요 없음
+    // 공개 함수의 AccessScope 안에서만 호출됨
     if (offset >= _segment.GetSize() || offset + byteCount > _segment.GetSize())
     {
         throw MemoryAccessException("Stack access violation: out of bounds");
     }
 }
 
+void StackMemory::MoveTopSlots(size_t address, size_t slotCount)
+{
+    AccessScope scope(*this);
+    
+    const size_t byteCount = slotCount * sizeof(uint64_t);
+    _ValidateSlot(address);
+    if (byteCount != 0)
+    {
+        // 원본과 목적지가 겹칠 수 있으므로 memmove (목적지가 항상 원본 이상)
+        const uint8_t* source = _segment.GetReadableRange(_stackPointer, byteCount);
+        std::memmove(_segment.GetWritableRange(address, byteCount), source, byteCount);
+    }
+    _stackPointer = address;
+}
+
+void StackMemory::_ValidateSlot(size_t address) const
+{
+    // 스택 포인터 아래는 다음 푸시가 덮어쓸 빈 구간
+    if (address < _stackPointer)
+    {
+        throw MemoryAccessException("Stack access violation: slot below stack pointer");
+    }
+    _ValidateStack(address);
+}
+
 } // namespace DarkMatterVM::Memory
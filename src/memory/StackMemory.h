@@ -1,15 +1,43 @@
 #pragma once
 #include <cstdint>
+#include <memory>
 #include <mutex>
+#include <thread>
 #include "MemorySegment.h"
 
+/**
+ * @brief 소유 스레드 검사 빌드 옵션 (기본: 디버그 빌드에서만 사용)
+ *
+ * 1이면 StackSharing::Owned 스택을 소유 스레드가 아닌 스레드에서 건드릴 때 std::logic_error
+ */
+#ifndef DMVM_STACK_OWNER_CHECK
+#ifdef NDEBUG
+#define DMVM_STACK_OWNER_CHECK 0
+#else
+#define DMVM_STACK_OWNER_CHECK 1
+#endif
+#endif
+
 namespace DarkMatterVM::Memory 
 {
 
+/**
+ * @brief 스택 공유 방식
+ */
+enum class StackSharing
+{
+    Owned,          ///< 한 스레드(소유 인터프리터)만 접근, 락 없음 (기본)
+    Synchronized    ///< 호스트 코드가 다른 스레드에서 들여다봄, 접근마다 뮤텍스
+};
+
 /**
  * @brief 스택 메모리
  * 
  * VM의 스택 메모리를 관리하는 클래스
+ * 기본(StackSharing::Owned)은 처음 접근한 스레드가 소유하는 락 없는 스택이며,
+ * DMVM_STACK_OWNER_CHECK 빌드에서는 다른 스레드의 접근을 예외로 알림
+ * 실행 중인 스택을 다른 스레드에서 조회해야 할 때만 StackSharing::Synchronized로 바꿈
+ * (검사 생략/JIT 루프는 스택을 직접 다루고 루프를 나갈 때만 스택 포인터를 반영하므로 동기화 대상이 아님)
  */
 class StackMemory 
 {
@@ -18,8 +46,9 @@ public:
      * @brief 스택 메모리 생성
      * 
      * @param segment 스택 세그먼트 참조
+     * @param sharing 스택 공유 방식
      */
-    explicit StackMemory(MemorySegment& segment);
+    explicit StackMemory(MemorySegment& segment, StackSharing sharing = StackSharing::Owned);
 
     StackMemory(const StackMemory&)            = delete;
     StackMemory& operator=(const StackMemory&) = delete;
@@ -72,6 +101,49 @@ public:
      */
     uint64_t GetStackValue(size_t offset) const;
     
+    /**
+     * @brief 스택 슬롯 읽기 (프레임 지역 변수/인자 접근)
+     * 
+     * @param address 스택 세그먼트 오프셋 (현재 스택 포인터 이상, 8바이트 슬롯)
+     * @return uint64_t 슬롯 값
+     * @throw MemoryAccessException 스택 포인터 아래(비어 있는 구간)이거나 범위를 벗어날 때
+     */
+    uint64_t ReadSlot(size_t address) const;
+    
+    /**
+     * @brief 스택 슬롯 쓰기 (프레임 지역 변수 접근)
+     * 
+     * @param address 스택 세그먼트 오프셋 (현재 스택 포인터 이상, 8바이트 슬롯)
+     * @param value 쓸 값
+     * @throw MemoryAccessException 스택 포인터 아래(비어 있는 구간)이거나 범위를 벗어날 때
+     */
+    void WriteSlot(size_t address, uint64_t value);
+    
+    /**
+     * @brief 스택 슬롯 값을 스택에 푸시 (LDLOC/LDARG, 접근 범위를 한 번만 잡음)
+     * 
+     * @param address 스택 세그먼트 오프셋 (현재 스택 포인터 이상, 8바이트 슬롯)
+     * @throw MemoryAccessException 슬롯이 비어 있는 구간이거나 스택이 가득 찼을 때
+     */
+    void PushSlot(size_t address);
+    
+    /**
+     * @brief 스택 최상위 값을 팝해 슬롯에 저장 (STLOC, 접근 범위를 한 번만 잡음)
+     * 
+     * @param address 스택 세그먼트 오프셋 (팝한 뒤 스택 포인터 이상, 8바이트 슬롯)
+     * @throw MemoryAccessException 스택이 비었거나 슬롯이 비어 있는 구간일 때
+     */
+    void PopSlot(size_t address);
+    
+    /**
+     * @brief 스택 최상위 슬롯들을 address로 옮기고 스택 포인터를 address로 설정 (TAILCALL, 사이의 슬롯은 버림)
+     * 
+     * @param address 옮길 위치 (현재 스택 포인터 이상, 8바이트 슬롯)
+     * @param slotCount 옮길 슬롯 수
+     * @throw MemoryAccessException 스택에 슬롯이 부족하거나 위치가 스택 포인터 아래 또는 범위를 벗어날 때
+     */
+    void MoveTopSlots(size_t address, size_t slotCount);
+    
     /**
      * @brief 스택 프레임 정보 저장
      * 
@@ -88,10 +160,89 @@ public:
      */
     void LeaveStackFrame(size_t& basePointer, size_t& returnAddress);
     
+    /**
+     * @brief 스택 공유 방식 변경 (다른 스레드와 스택을 나누기 전, 접근이 없을 때 호출)
+     * 
+     * @param sharing 스택 공유 방식
+     */
+    void SetSharing(StackSharing sharing);
+    
+    /**
+     * @brief 스택 공유 방식 조회
+     */
+    StackSharing GetSharing() const { return _stackMutex ? StackSharing::Synchronized : StackSharing::Owned; }
+    
+    /**
+     * @brief 스택 포인터를 설정하고 소유 스레드를 잊음 (다음에 접근하는 스레드가 새 소유자)
+     * 
+     * 인스턴스를 넘겨받은 스레드도 호출할 수 있도록 소유 스레드는 확인하지 않음
+     * (Interpreter::Reset()은 빈 스택으로, 스냅샷 복원은 저장한 스택 포인터로 호출)
+     * 
+     * @param stackPointer 스택 포인터 위치
+     */
+    void Reset(size_t stackPointer);
+    
 private:
-    MemorySegment& _segment;          ///< 스택 세그먼트 참조
-    size_t _stackPointer;             ///< 현재 스택 포인터 위치
-    mutable std::mutex _stackMutex;   ///< 스택 접근 동기화를 위한 뮤텍스
+    /**
+     * @brief 공개 함수 한 번의 접근 구간 (Synchronized면 뮤텍스, Owned면 소유 스레드 확인)
+     */
+    class AccessScope
+    {
+    public:
+        explicit AccessScope(const StackMemory& stack)
+            : _mutex(stack._stackMutex.get())
+        {
+            if (_mutex)
+            {
+                _mutex->lock();
+            }
+            else
+            {
+                stack._CheckOwner();
+            }
+        }
+        
+        ~AccessScope()
+        {
+            if (_mutex)
+            {
+                _mutex->unlock();
+            }
+        }
+        
+        AccessScope(const AccessScope&)            = delete;
+        AccessScope& operator=(const AccessScope&) = delete;
+        
+    private:
+        std::mutex* _mutex;
+    };
+    
+    /**
+     * @brief 소유 스레드 확인 (소유자가 없으면 현재 스레드가 소유)
+     * 
+     * @throw std::logic_error 다른 스레드가 소유한 스택일 때 (DMVM_STACK_OWNER_CHECK 빌드만)
+     */
+    void _CheckOwner() const
+    {
+#if DMVM_STACK_OWNER_CHECK
+        const std::thread::id self = std::this_thread::get_id();
+        if (_owner == std::thread::id())
+        {
+            _owner = self;
+        }
+        else if (_owner != self)
+        {
+            _ThrowForeignThread();
+        }
+#endif
+    }
+    
+    [[noreturn]] static void _ThrowForeignThread();
+    
+    MemorySegment& _segment;                    ///< 스택 세그먼트 참조
+    size_t _stackPointer;                       ///< 현재 스택 포인터 위치
+    std::unique_ptr<std::mutex> _stackMutex;    ///< Synchronized일 때만 있는 접근 동기화 뮤텍스
+    mutable std::thread::id _owner;             ///< Owned일 때 소유 스레드 (비어 있으면 다음 접근 스레드)
     
     /**
      * @brief 스택 경계 확인
@@ -100,6 +251,14 @@ private:
      * @throw MemoryAccessException 스택 범위 초과 시
      */
     void _ValidateStack(size_t offset, size_t byteCount = sizeof(uint64_t)) const;
+    
+    /**
+     * @brief 프레임 슬롯 확인 (스택 포인터 이상이고 범위 안)
+     * 
+     * @param address 확인할 스택 오프셋
+     * @throw MemoryAccessException 스택 포인터 아래이거나 범위 초과 시
+     */
+    void _ValidateSlot(size_t address) const;
 };
 
 } // namespace DarkMatterVM::Memory
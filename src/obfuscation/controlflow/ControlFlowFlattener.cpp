@@ -1,5 +1,6 @@
 #include "ControlFlowFlattener.h"
 #include <stdexcept>
+#include <Opcodes.h>
 
 namespace DarkMatterVM::Obfuscation::ControlFlow 
 {
@@ -40,30 +41,8 @@ std::vector<uint8_t> ControlFlowFlattener::Flatten(const std::vector<uint8_t>& b
         }
         else 
         {
-            // operand 길이 결정 (간단한 예)
-            size_t operand = 0;
-            switch (op) 
-            {
-                case 0x01: operand = 1; break; // PUSH8
-                case 0x02: operand = 2; break; // PUSH16
-                case 0x03: operand = 4; break; // PUSH32
-                case 0x04: operand = 8; break; // PUSH64
-                case 0x31: // JZ rel16
-                case 0x32: // JNZ rel16
-                case 0x33: // JG rel16
-                case 0x34: // JL rel16
-                case 0x35: // JGE rel16
-                case 0x36: // JLE rel16
-                case 0x40: // CALL rel16
-                    operand = 2;
-                    break;
-                case 0x50: // ALLOC imm8
-                case 0x60: // HOSTCALL imm8
-                    operand = 1;
-                    break;
-                default:
-                    operand = 0; break;
-            }
+            // operand 길이는 opcode 정보 테이블 기준 (RET/TAILCALL/LDLOC 등 프레임 명령어의 인자 수도 그대로 복사)
+            size_t operand = Engine::GetOpcodeInfo(static_cast<Engine::Opcode>(op)).operandSize;
             // opcode + operand 복사
             out.push_back(op);
             for (size_t i = 1; i <= operand; ++i) 
@@ -38,6 +38,9 @@ static void InitCRC32Table()
 // 패키지 파일 매직 넘버
 static const uint32_t PACKAGE_MAGIC = 0x4D564D44; // "DMVM" in ASCII
 
+// 패키지 형식 버전 (2: 모듈 이름 뒤에 명령어 집합 바이트 추가)
+static const uint8_t PACKAGE_VERSION = 2;
+
 // 패키지 헤더 구조체 (파일 형식)
 struct PackageHeader 
 {
@@ -69,7 +72,7 @@ Packer::Packer(PackingOption option)
 	_metadata.crc32Checksum = 0;
 }
 
-bool Packer::AddBytecode(const std::vector<uint8_t>& bytecode, const std::string& name) 
+bool Packer::AddBytecode(const std::vector<uint8_t>& bytecode, const std::string& name, Engine::BytecodeIsa isa) 
 {
 	if (bytecode.empty()) 
 	{
@@ -88,6 +91,7 @@ bool Packer::AddBytecode(const std::vector<uint8_t>& bytecode, const std::string
 	}
 	
 	_bytecodeModules.emplace_back(name, bytecode);
+	_bytecodeModuleIsas.push_back(isa);
 	
 	return true;
 }
@@ -172,7 +176,7 @@ bool Packer::CreatePackage(const std::string& outputPath)
 	// 패키지 헤더 준비
 	PackageHeader header;
 	header.magic = PACKAGE_MAGIC;
-	header.version = 1;
+	header.version = PACKAGE_VERSION;
 	header.packingFlags = static_cast<uint8_t>(_packingOption);
 	header.bytecodeModuleCount = static_cast<uint16_t>(_bytecodeModules.size());
 	header.resourceCount = static_cast<uint16_t>(_resources.size());
@@ -195,6 +199,7 @@ bool Packer::CreatePackage(const std::string& outputPath)
 	for (const auto& module : _bytecodeModules) 
 	{
 		currentOffset += sizeof(uint32_t) + module.first.size(); // 모듈 이름 길이 + 이름
+		currentOffset += sizeof(uint8_t); // 명령어 집합
 		currentOffset += sizeof(uint32_t) + module.second.size(); // 바이트코드 크기 + 바이트코드
 	}
 	
@@ -248,8 +253,10 @@ bool Packer::CreatePackage(const std::string& outputPath)
 	pos += sizeof(uint32_t);
 	
 	// 바이트코드 모듈 복사
-	for (const auto& module : _bytecodeModules) 
+	for (size_t moduleIndex = 0; moduleIndex < _bytecodeModules.size(); moduleIndex++) 
 	{
+		const auto& module = _bytecodeModules[moduleIndex];
+		
 		// 모듈 이름 복사
 		uint32_t moduleNameLength = static_cast<uint32_t>(module.first.size());
 		std::memcpy(packageData.data() + pos, &moduleNameLength, sizeof(uint32_t));
@@ -257,6 +264,9 @@ bool Packer::CreatePackage(const std::string& outputPath)
 		std::memcpy(packageData.data() + pos, module.first.c_str(), moduleNameLength);
 		pos += moduleNameLength;
 		
+		// 명령어 집합 (로더가 실행 엔진을 고르는 데 사용)
+		packageData[pos++] = static_cast<uint8_t>(_bytecodeModuleIsas[moduleIndex]);
+		
 		// 바이트코드 데이터 복사
 		std::vector<uint8_t> processedData = module.second;
 		
@@ -383,7 +393,7 @@ bool Packer::ValidatePackage(const std::string& packagePath)
 	}
 	
 	// 버전 확인
-	if (header.version != 1) 
+	if (header.version != 1 && header.version != PACKAGE_VERSION) 
 	{
 		Logger::Error("Packer", "지원되지 않는 패키지 버전: " + std::to_string(static_cast<int>(header.version)));
 		return false;
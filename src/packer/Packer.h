@@ -4,6 +4,7 @@
 #include <vector>
 #include <memory>
 #include <cstdint>
+#include <Opcodes.h>
 
 namespace DarkMatterVM 
 {
@@ -53,9 +54,11 @@ public:
 	 * 
 	 * @param bytecode 바이트코드 바이너리 데이터
 	 * @param name 바이트코드 모듈 이름 (선택적)
+	 * @param isa 모듈 명령어 집합 (스택 바이트코드 또는 직렬화된 RegisterModule)
 	 * @return 성공 여부
 	 */
-	bool AddBytecode(const std::vector<uint8_t>& bytecode, const std::string& name = "main");
+	bool AddBytecode(const std::vector<uint8_t>& bytecode, const std::string& name = "main",
+					 Engine::BytecodeIsa isa = Engine::BytecodeIsa::Stack);
 	
 	/**
 	 * @brief 리소스 파일 추가
@@ -93,6 +96,7 @@ private:
 	PackingOption _packingOption;
 	PackageMetadata _metadata;
 	std::vector<std::pair<std::string, std::vector<uint8_t>>> _bytecodeModules;
+	std::vector<Engine::BytecodeIsa> _bytecodeModuleIsas; // _bytecodeModules와 같은 순서
 	std::vector<std::pair<std::string, std::vector<uint8_t>>> _resources;
 	
 	/**
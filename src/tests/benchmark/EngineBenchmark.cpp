@@ -0,0 +1,1534 @@
+#include "EngineBenchmark.h"
+#include "../engine/EnginePrograms.h"
+#include "../../engine/decoder/OpcodeNgramMiner.h"
+#include "../../engine/pool/InterpreterPool.h"
+#include "../../engine/register/RegisterInterpreter.h"
+#include "../../engine/register/StackToRegisterTranslator.h"
+#include "../../memory/ArenaMemory.h"
+#include "../../memory/HeapMemory.h"
+#include "../../memory/MemorySnapshot.h"
+#include "../../translator/Translator.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace DarkMatterVM
+{
+namespace Tests
+{
+
+EngineBenchmark::EngineBenchmark(size_t iterations)
+    : _iterations(iterations)
+{
+}
+
+void EngineBenchmark::RunAll()
+{
+    std::cout << "\n=== Engine 벤치마크 시작 (반복 " << _iterations << "회) ===" << std::endl;
+
+    // 측정 중 로그 출력 비용 제외
+    LogLevel previousLevel = Logger::GetLevel();
+    Logger::SetLevel(LogLevel::WARNING);
+
+    BenchDispatch();
+    BenchDecoded();
+    BenchThreaded();
+    BenchSuperinstructions();
+    BenchStackCached();
+    BenchRegister();
+    BenchJit();
+    BenchTiered();
+    BenchBatch();
+    BenchLanes();
+    BenchVerified();
+    BenchPool();
+    BenchMappedSegments();
+    BenchStackGuard();
+    BenchHeapAllocator();
+    BenchHeapGrowth();
+    BenchArena();
+    BenchTracing();
+    BenchStackSharing();
+    BenchSnapshot();
+    BenchBulkMemory();
+    BenchFrameLocals();
+    BenchTailCall();
+
+    Logger::SetLevel(previousLevel);
+}
+
+void EngineBenchmark::BenchDispatch()
+{
+    _PrintHeader("디스패치", "map+function", "table");
+
+    LegacyHandlerMap legacyHandlers = _BuildLegacyHandlers();
+
+    auto programs = Programs::All();
+    programs.push_back({"CountdownLoop(100)", Programs::CountdownLoop(100), 0});
+
+    _BenchPrograms(programs,
+        [](Engine::Interpreter&) {},
+        [](Engine::Interpreter&) {},
+        [&](Engine::Interpreter& interpreter) { _ExecuteLegacy(interpreter, legacyHandlers); },
+        &EngineBenchmark::_ExecuteTable);
+}
+
+void EngineBenchmark::BenchDecoded()
+{
+    _PrintHeader("사전 디코딩 스트림", "table", "decoded");
+
+    std::vector<Programs::EngineProgram> programs = {
+        {"LargeNumbers", Programs::LargeNumbers(), 3000000},
+        {"FunctionCall", Programs::FunctionCall(), 42},
+        {"CountdownLoop(100)", Programs::CountdownLoop(100), 0}
+    };
+
+    auto portableWithoutFusion = [](Engine::Interpreter& interpreter)
+    {
+        interpreter.SetExecutionMode(Engine::ExecutionMode::Portable);
+        interpreter.SetSuperinstructionsEnabled(false);
+    };
+
+    _BenchPrograms(programs, portableWithoutFusion, portableWithoutFusion, &EngineBenchmark::_ExecuteTable);
+}
+
+void EngineBenchmark::BenchThreaded()
+{
+    if (!Engine::Interpreter::IsThreadedDispatchSupported())
+    {
+        std::cout << "\n--- Threaded 디스패치 ---\n  (생략) 이 빌드는 computed goto를 지원하지 않음" << std::endl;
+        return;
+    }
+
+    _PrintHeader("Threaded 디스패치", "switch", "threaded");
+
+    std::vector<Programs::EngineProgram> programs = {
+        {"ControlFlow", Programs::ControlFlow(), 100},
+        {"FunctionCall", Programs::FunctionCall(), 42},
+        {"CountdownLoop(100)", Programs::CountdownLoop(100), 0}
+    };
+
+    _BenchPrograms(programs,
+        [](Engine::Interpreter& interpreter) { interpreter.SetExecutionMode(Engine::ExecutionMode::Portable); },
+        [](Engine::Interpreter& interpreter) { interpreter.SetExecutionMode(Engine::ExecutionMode::Threaded); });
+}
+
+void EngineBenchmark::BenchSuperinstructions()
+{
+    // 코퍼스: Engine 테스트 프로그램 + Translator 출력
+    Engine::OpcodeNgramMiner miner;
+    for (const auto& program : Programs::All())
+    {
+        miner.AddProgram(program.bytecode.data(), program.bytecode.size());
+    }
+
+    auto sumLoop = Programs::SumLoop(100);
+    miner.AddProgram(sumLoop.data(), sumLoop.size());
+
+    const char* sources[] = {
+        "int x = 10; int y = 5; int sum = x + y;",
+        "int a = 10; int b = 3; int c = 2; int result = a * b + c;",
+        "int a = 10; int b = 20; int c = a + b; int d = c - 1; int e = d + 2;"
+    };
+    for (const char* source : sources)
+    {
+        Translator::Translator translator;
+        if (translator.TranslateFromCpp(source, "ngram_corpus") == Translator::TranslationResult::Success)
+        {
+            const auto& bytecode = translator.GetBytecode();
+            miner.AddProgram(bytecode.data(), bytecode.size());
+        }
+    }
+
+    std::cout << "\n--- opcode n-gram (슈퍼명령어 후보) ---\n" << miner.FormatReport(2, 3, 5);
+
+    _PrintHeader("슈퍼명령어", "plain", "fused");
+
+    std::vector<Programs::EngineProgram> programs = {
+        {"SumLoop(100)", sumLoop, 5050},
+        {"CountdownLoop(100)", Programs::CountdownLoop(100), 0}
+    };
+
+    _BenchPrograms(programs,
+        [](Engine::Interpreter& interpreter) { interpreter.SetSuperinstructionsEnabled(false); },
+        [](Engine::Interpreter& interpreter) { interpreter.SetSuperinstructionsEnabled(true); });
+}
+
+void EngineBenchmark::BenchStackCached()
+{
+    _PrintHeader("스택 최상위 캐싱", "switch", "cached");
+
+    std::vector<Programs::EngineProgram> programs = {
+        {"BasicArithmetic", Programs::BasicArithmetic(), 55},
+        {"LargeNumbers", Programs::LargeNumbers(), 3000000},
+        {"FunctionCall", Programs::FunctionCall(), 42},
+        {"SumLoop(100)", Programs::SumLoop(100), 5050},
+        {"CountdownLoop(100)", Programs::CountdownLoop(100), 0}
+    };
+
+    _BenchPrograms(programs,
+        [](Engine::Interpreter& interpreter) { interpreter.SetExecutionMode(Engine::ExecutionMode::Portable); },
+        [](Engine::Interpreter& interpreter) { interpreter.SetExecutionMode(Engine::ExecutionMode::StackCached); });
+}
+
+void EngineBenchmark::BenchRegister()
+{
+    _PrintHeader("레지스터 ISA", "stack", "register");
+
+    std::vector<Programs::EngineProgram> programs = {
+        {"BasicArithmetic", Programs::BasicArithmetic(), 55},
+        {"LargeNumbers", Programs::LargeNumbers(), 3000000},
+        {"SumLoop(100)", Programs::SumLoop(100), 5050},
+        {"CountdownLoop(100)", Programs::CountdownLoop(100), 0}
+    };
+
+    Engine::StackToRegisterTranslator translator;
+    for (const auto& program : programs)
+    {
+        Engine::RegisterModule module;
+        if (!translator.Translate(program.bytecode.data(), program.bytecode.size(), module))
+        {
+            std::cout << "  (생략) " << program.name << ": " << translator.GetLastError() << std::endl;
+            continue;
+        }
+
+        Engine::Interpreter baseline;
+        baseline.SetExecutionMode(Engine::ExecutionMode::Portable);
+        baseline.LoadBytecode(program.bytecode.data(), program.bytecode.size());
+
+        Engine::RegisterInterpreter optimized;
+        optimized.LoadModule(module);
+
+        BenchResult result;
+        result.name = program.name;
+        result.baselineNs = _Measure([&]()
+        {
+            baseline.Reset();
+            baseline.Execute();
+        });
+        result.optimizedNs = _Measure([&]()
+        {
+            optimized.Reset();
+            optimized.Execute();
+        });
+
+        if (baseline.GetReturnValue() != program.expectedResult || optimized.GetReturnValue() != program.expectedResult)
+        {
+            std::cout << "  (주의) " << program.name << " 결과 불일치: 예상값=" << program.expectedResult
+                      << ", 스택=" << baseline.GetReturnValue() << ", 레지스터=" << optimized.GetReturnValue() << std::endl;
+        }
+
+        _PrintResult(result);
+        _results.push_back(result);
+
+        // 정적 명령어 수 (PUSH/DUP/SWAP/POP 제거 효과)
+        std::cout << "    명령어 수: " << translator.GetStackInstructionCount() << " → " << module.code.size() << std::endl;
+    }
+}
+
+void EngineBenchmark::BenchJit()
+{
+    if (!Engine::Interpreter::IsJitSupported())
+    {
+        std::cout << "\n--- 템플릿 JIT ---\n  (생략) JIT 미지원 빌드" << std::endl;
+        return;
+    }
+
+    _PrintHeader("템플릿 JIT", "switch", "jit");
+
+    std::vector<Programs::EngineProgram> programs = {
+        {"BasicArithmetic", Programs::BasicArithmetic(), 55},
+        {"FunctionCall", Programs::FunctionCall(), 42},
+        {"SumLoop(100)", Programs::SumLoop(100), 5050},
+        {"CountdownLoop(100)", Programs::CountdownLoop(100), 0}
+    };
+
+    _BenchPrograms(programs,
+        [](Engine::Interpreter& interpreter) { interpreter.SetExecutionMode(Engine::ExecutionMode::Portable); },
+        [](Engine::Interpreter& interpreter) { interpreter.SetExecutionMode(Engine::ExecutionMode::Jit); });
+}
+
+void EngineBenchmark::BenchTiered()
+{
+    if (!Engine::Interpreter::IsJitSupported())
+    {
+        std::cout << "\n--- 계층 실행 ---\n  (생략) JIT 미지원 빌드" << std::endl;
+        return;
+    }
+
+    _PrintHeader("계층 실행", "switch", "tiered");
+
+    std::vector<Programs::EngineProgram> programs = {
+        {"BasicArithmetic", Programs::BasicArithmetic(), 55},
+        {"FunctionCall", Programs::FunctionCall(), 42},
+        {"SumLoop(100)", Programs::SumLoop(100), 5050},
+        {"CountdownLoop(100)", Programs::CountdownLoop(100), 0}
+    };
+
+    _BenchPrograms(programs,
+        [](Engine::Interpreter& interpreter) { interpreter.SetExecutionMode(Engine::ExecutionMode::Portable); },
+        [](Engine::Interpreter& interpreter) { interpreter.SetExecutionMode(Engine::ExecutionMode::Tiered); });
+
+    // 처음 한 번 실행할 때 티어별 시간 분포 (컴파일 비용 포함)
+    auto sumLoop = Programs::SumLoop(1000);
+    Engine::Interpreter interpreter;
+    interpreter.SetExecutionMode(Engine::ExecutionMode::Tiered);
+    interpreter.LoadBytecode(sumLoop.data(), sumLoop.size());
+    interpreter.Execute();
+
+    const auto& stats = interpreter.GetTieringStats();
+    std::cout << "  SumLoop(1000) 첫 실행: 기준(루프/호출)=" << stats.backEdgeThreshold << "/" << stats.callThreshold
+              << ", 컴파일 영역=" << stats.tierUpCount << ", 기계어 진입=" << stats.jitEntryCount
+              << ", 인터프리터=" << stats.interpreterNanoseconds / 1000.0 << "us"
+              << ", 기계어=" << stats.jitNanoseconds / 1000.0 << "us" << std::endl;
+}
+
+void EngineBenchmark::BenchBatch()
+{
+    _PrintHeader("일괄 실행 (입력 1개당)", "load+exec", "batch");
+
+    // 인자 (n) → n * n + n
+    const std::vector<uint8_t> program = {
+        static_cast<uint8_t>(Engine::Opcode::DUP),
+        static_cast<uint8_t>(Engine::Opcode::DUP),
+        static_cast<uint8_t>(Engine::Opcode::MUL),
+        static_cast<uint8_t>(Engine::Opcode::ADD),
+        static_cast<uint8_t>(Engine::Opcode::HALT)
+    };
+
+    const size_t runCount = 100000;
+    std::vector<uint64_t> args(runCount);
+    for (size_t i = 0; i < runCount; ++i)
+    {
+        args[i] = i;
+    }
+    std::vector<uint64_t> results(runCount);
+
+    Engine::Interpreter loader;
+    double loadNs = _MeasurePerRun(runCount, [&]()
+    {
+        for (size_t i = 0; i < runCount; ++i)
+        {
+            loader.LoadBytecode(program.data(), program.size());
+            loader.PushParameter(args[i]);
+            loader.Execute();
+            results[i] = loader.GetReturnValue();
+        }
+    });
+
+    Engine::Interpreter batch;
+    batch.SetLaneParallelEnabled(false);
+    batch.LoadBytecode(program.data(), program.size());
+
+    const size_t threadCount = std::max(2u, std::min(8u, std::thread::hardware_concurrency()));
+    for (size_t threads : {size_t{1}, threadCount})
+    {
+        BenchResult result;
+        result.name = "ExecuteBatch(" + std::to_string(threads) + " thread)";
+        result.baselineNs = loadNs;
+        result.optimizedNs = _MeasurePerRun(runCount, [&]() { batch.ExecuteBatch(args, 1, results, threads); });
+
+        if (results[runCount - 1] != (runCount - 1) * (runCount - 1) + (runCount - 1))
+        {
+            std::cout << "  (주의) " << result.name << " 결과 불일치" << std::endl;
+        }
+
+        _PrintResult(result);
+        _results.push_back(result);
+    }
+}
+
+void EngineBenchmark::BenchLanes()
+{
+    _PrintHeader("SIMD 레인 (입력 1개당)", "scalar", "lanes");
+
+    using Engine::Opcode;
+    auto emit = [](std::vector<uint8_t>& code, Opcode op, std::initializer_list<uint8_t> operands = {})
+    {
+        code.push_back(static_cast<uint8_t>(op));
+        code.insert(code.end(), operands);
+    };
+
+    // 인자 x에 xorshift64 라운드 4번 (x ^= x << 13; x ^= x >> 7; x ^= x << 17; x *= 0x2545F491)
+    std::vector<uint8_t> xorshift;
+    for (int round = 0; round < 4; ++round)
+    {
+        for (auto [shift, left] : {std::pair<uint8_t, bool>{13, true}, {7, false}, {17, true}})
+        {
+            emit(xorshift, Opcode::DUP);
+            emit(xorshift, Opcode::PUSH8, {shift});
+            emit(xorshift, left ? Opcode::SHL : Opcode::SHR);
+            emit(xorshift, Opcode::XOR);
+        }
+        emit(xorshift, Opcode::PUSH32, {0x91, 0xF4, 0x45, 0x25});
+        emit(xorshift, Opcode::MUL);
+    }
+    emit(xorshift, Opcode::HALT);
+
+    // 같은 계산 앞에 x가 홀수인지에 따라 갈라지는 분기 (묶음마다 레인이 갈라져 모두 스칼라로 대체)
+    std::vector<uint8_t> divergent;
+    emit(divergent, Opcode::DUP);
+    emit(divergent, Opcode::PUSH8, {1});
+    emit(divergent, Opcode::AND);
+    emit(divergent, Opcode::JZ, {0x03, 0x00});
+    emit(divergent, Opcode::PUSH8, {1});
+    emit(divergent, Opcode::ADD);      // 짝수는 JZ로 건너뜀, 홀수는 +1
+    divergent.insert(divergent.end(), xorshift.begin(), xorshift.end());
+
+    const size_t runCount = 100000;
+    std::vector<uint64_t> args(runCount);
+    for (size_t i = 0; i < runCount; ++i)
+    {
+        args[i] = i * 0x9E3779B97F4A7C15ULL;
+    }
+
+    const std::vector<std::pair<std::string, std::vector<uint8_t>>> kernels = {
+        {"XorShift(4 rounds)", xorshift},
+        {"DivergentBranch", divergent}
+    };
+
+    for (const auto& [name, code] : kernels)
+    {
+        Engine::Interpreter scalar;
+        scalar.SetLaneParallelEnabled(false);
+        scalar.LoadBytecode(code.data(), code.size());
+
+        Engine::Interpreter lanes;
+        lanes.LoadBytecode(code.data(), code.size());
+
+        std::vector<uint64_t> expected(runCount);
+        std::vector<uint64_t> results(runCount);
+
+        BenchResult result;
+        result.name = name;
+        result.baselineNs = _MeasurePerRun(runCount, [&]() { scalar.ExecuteBatch(args, 1, expected); });
+        result.optimizedNs = _MeasurePerRun(runCount, [&]() { lanes.ExecuteBatch(args, 1, results); });
+
+        if (!lanes.IsLaneParallelEligible() || results != expected)
+        {
+            std::cout << "  (주의) " << name << " 결과 불일치" << std::endl;
+        }
+
+        _PrintResult(result);
+        _results.push_back(result);
+    }
+}
+
+void EngineBenchmark::BenchVerified()
+{
+    _PrintHeader("로드 시점 검증", "checked", "verified");
+
+    std::vector<Programs::EngineProgram> programs = {
+        {"BasicArithmetic", Programs::BasicArithmetic(), 55},
+        {"LargeNumbers", Programs::LargeNumbers(), 3000000},
+        {"CountdownLoop(100)", Programs::CountdownLoop(100), 0}
+    };
+
+    _BenchPrograms(programs,
+        [](Engine::Interpreter& interpreter) { interpreter.SetExecutionMode(Engine::ExecutionMode::Portable); },
+        [](Engine::Interpreter& interpreter)
+        {
+            interpreter.SetExecutionMode(Engine::ExecutionMode::Portable);
+            interpreter.SetVerificationEnabled(true);
+        });
+}
+
+void EngineBenchmark::BenchStackGuard()
+{
+    // 가드는 켜야 쓰고, 검증을 통과한 코드에만 적용
+    const auto probeProgram = Programs::BasicArithmetic();
+    Engine::Interpreter probe;
+    probe.SetStackGuardEnabled(true);
+    probe.LoadBytecode(probeProgram.data(), probeProgram.size());
+    if (!probe.IsStackGuarded())
+    {
+        std::cout << "\n--- 가드 페이지 스택 ---\n  (생략) 이 빌드는 가드 페이지 스택을 지원하지 않음" << std::endl;
+        return;
+    }
+
+    _PrintHeader("가드 페이지 스택", "checked", "guarded");
+
+    // 푸시/팝 처리량: 스택 관리자(뮤텍스 + 범위 검사 두 번) vs 가드 범위 안의 포인터 이동
+    {
+        const size_t depth = 4096;
+        const size_t rounds = 64;
+        Memory::MemoryManager memory(64 * 1024, 1024 * 1024, 64 * 1024);
+        auto& stackSegment = memory.GetSegment(Memory::MemorySegmentType::STACK);
+        uint64_t sink = 0;
+
+        BenchResult result;
+        result.name = "push/pop 4096x64";
+        result.baselineNs = _MeasurePerRun(depth * rounds * 2, [&]()
+        {
+            for (size_t round = 0; round < rounds; ++round)
+            {
+                for (uint64_t value = 0; value < depth; ++value)
+                {
+                    memory.PushStack(value);
+                }
+                for (size_t i = 0; i < depth; ++i)
+                {
+                    sink += memory.PopStack();
+                }
+            }
+        });
+        result.optimizedNs = _MeasurePerRun(depth * rounds * 2, [&]()
+        {
+            Memory::StackGuard guard(stackSegment);
+            uint64_t* const stackEnd = reinterpret_cast<uint64_t*>(stackSegment.GetData() + stackSegment.GetSize());
+            for (size_t round = 0; round < rounds; ++round)
+            {
+                uint64_t* sp = stackEnd;
+                for (uint64_t value = 0; value < depth; ++value)
+                {
+                    *--sp = value;
+                    std::atomic_signal_fence(std::memory_order_seq_cst);
+                }
+                for (size_t i = 0; i < depth; ++i)
+                {
+                    sink += *sp++;
+                    std::atomic_signal_fence(std::memory_order_seq_cst);
+                }
+            }
+        });
+
+        _PrintResult(result);
+        _results.push_back(result);
+        if (sink == 0)
+        {
+            std::cout << "  (주의) push/pop 합계 0" << std::endl;
+        }
+    }
+
+    // 검증은 통과했지만 진입 시 범위 확인을 쓰지 않는 실행 (검증 끔): 검사하는 루프 vs 가드 범위 안의 포인터 이동
+    std::vector<Programs::EngineProgram> programs = {
+        {"BasicArithmetic", Programs::BasicArithmetic(), 55},
+        {"LargeNumbers", Programs::LargeNumbers(), 3000000},
+        {"CountdownLoop(100)", Programs::CountdownLoop(100), 0}
+    };
+
+    _BenchPrograms(programs,
+        [](Engine::Interpreter& interpreter)
+        {
+            interpreter.SetExecutionMode(Engine::ExecutionMode::Portable);
+            interpreter.SetVerificationEnabled(false);
+        },
+        [](Engine::Interpreter& interpreter)
+        {
+            interpreter.SetExecutionMode(Engine::ExecutionMode::Portable);
+            interpreter.SetVerificationEnabled(false);
+            interpreter.SetStackGuardEnabled(true);
+        });
+}
+
+void EngineBenchmark::BenchPool()
+{
+    _PrintHeader("인스턴스 풀", "new+load", "pooled");
+
+    // 기본 세그먼트 크기(코드 64KB, 스택/힙 1MB)로 짧은 실행 반복
+    std::vector<Programs::EngineProgram> programs = {
+        {"BasicArithmetic", Programs::BasicArithmetic(), 55},
+        {"SumLoop(10)", Programs::SumLoop(10), 55}
+    };
+
+    const size_t runCount = 200;
+    Engine::InterpreterPool pool;
+
+    for (const auto& program : programs)
+    {
+        uint64_t value = 0;
+
+        BenchResult result;
+        result.name = program.name;
+        result.baselineNs = _MeasurePerRun(runCount, [&]()
+        {
+            for (size_t run = 0; run < runCount; ++run)
+            {
+                Engine::Interpreter interpreter;
+                interpreter.LoadBytecode(program.bytecode.data(), program.bytecode.size());
+                interpreter.Execute();
+                value = interpreter.GetReturnValue();
+            }
+        });
+
+        uint64_t scrubbedBefore = pool.GetStats().scrubbedBytes;
+        result.optimizedNs = _MeasurePerRun(runCount, [&]()
+        {
+            for (size_t run = 0; run < runCount; ++run)
+            {
+                auto lease = pool.Acquire(program.bytecode.data(), program.bytecode.size());
+                lease->Execute();
+                value = lease->GetReturnValue();
+            }
+        });
+
+        if (value != program.expectedResult)
+        {
+            std::cout << "  (주의) " << program.name << " 결과 불일치: 예상값=" << program.expectedResult
+                      << ", 실제값=" << value << std::endl;
+        }
+
+        _PrintResult(result);
+        _results.push_back(result);
+
+        std::cout << "  반납당 지운 바이트: " << (pool.GetStats().scrubbedBytes - scrubbedBefore) / (2 * runCount) << std::endl;
+    }
+
+    auto stats = pool.GetStats();
+    std::cout << "  생성=" << stats.createdCount << ", 재사용=" << stats.reusedCount
+              << ", 모듈=" << stats.moduleCount << ", 공유 로드=" << stats.sharedLoadCount << std::endl;
+}
+
+void EngineBenchmark::BenchMappedSegments()
+{
+    if (Memory::MemorySegment::GetDefaultBacking() != Memory::MemoryBacking::Mapped)
+    {
+        std::cout << "\n--- mmap 세그먼트 ---\n  (생략) 이 빌드는 mmap 세그먼트를 지원하지 않음" << std::endl;
+        return;
+    }
+
+    _PrintHeader("mmap 세그먼트", "heap", "mapped");
+
+    // 스택/힙 크기별 MemoryManager 생성 + 스택 푸시 100회 + 해제
+    struct SizeCase
+    {
+        std::string name;
+        size_t segmentSize;
+        size_t runCount;
+    };
+    const SizeCase cases[] = {
+        {"1MB 스택/힙", 1024 * 1024, 50},
+        {"64MB 스택/힙", 64 * 1024 * 1024, 3}
+    };
+
+    for (const auto& sizeCase : cases)
+    {
+        size_t committed = 0;
+        auto run = [&](Memory::MemoryBacking backing)
+        {
+            for (size_t i = 0; i < sizeCase.runCount; ++i)
+            {
+                Memory::MemoryManager memory(64 * 1024, sizeCase.segmentSize, sizeCase.segmentSize, backing);
+                for (uint64_t value = 0; value < 100; ++value)
+                {
+                    memory.PushStack(value);
+                }
+                committed = memory.GetCommittedBytes();
+            }
+        };
+
+        BenchResult result;
+        result.name = sizeCase.name;
+        result.baselineNs = _MeasurePerRun(sizeCase.runCount, [&]() { run(Memory::MemoryBacking::Heap); });
+        result.optimizedNs = _MeasurePerRun(sizeCase.runCount, [&]() { run(Memory::MemoryBacking::Mapped); });
+
+        _PrintResult(result);
+        _results.push_back(result);
+
+        std::cout << "  mapped 커밋: " << committed / 1024 << "KB / 예약 "
+                  << (64 * 1024 + 2 * sizeCase.segmentSize + 1024) / 1024 << "KB" << std::endl;
+    }
+}
+
+namespace
+{
+
+// 이전 HeapMemory 방식: 선형 할당 + std::map 블록 기록 + 뮤텍스 (해제한 공간은 재사용하지 않음)
+class BumpMapHeap
+{
+public:
+    explicit BumpMapHeap(size_t capacity)
+        : _segment(Memory::MemorySegmentType::HEAP, capacity, static_cast<uint8_t>(Memory::MemoryAccessFlags::READ) |
+                                                  static_cast<uint8_t>(Memory::MemoryAccessFlags::WRITE))
+    {
+    }
+
+    size_t Allocate(size_t size)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        size_t aligned = (size + 7) & ~size_t(7);
+        if (_next + aligned > _segment.GetSize())
+        {
+            throw std::runtime_error("BumpMapHeap: out of memory");
+        }
+        size_t address = _next;
+        _next += aligned;
+        _blocks[address] = aligned;
+        return address;
+    }
+
+    void Free(size_t address)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _blocks.erase(address);
+    }
+
+    void Write(size_t address, uint64_t value)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _blocks.upper_bound(address);
+        if (it == _blocks.begin() || address + sizeof(value) > std::prev(it)->first + std::prev(it)->second)
+        {
+            throw std::out_of_range("BumpMapHeap: access out of bounds");
+        }
+        _segment.Write(address, sizeof(value), &value);
+    }
+
+    void Reset()
+    {
+        _blocks.clear();
+        _next = 0;
+    }
+
+    size_t GetUsedBytes() const { return _next; }
+
+private:
+    Memory::MemorySegment _segment;
+    std::map<size_t, size_t> _blocks;
+    size_t _next = 0;
+    std::mutex _mutex;
+};
+
+// ALLOC/FREE 기록: size가 0이면 slot의 블록 해제, 아니면 slot에 size 바이트 할당
+struct HeapOp
+{
+    uint32_t slot;
+    uint32_t size;
+};
+
+/**
+ * @brief 살아 있는 블록을 slotCount개 이하로 유지하며 할당/해제를 섞은 기록 생성
+ *
+ * @param lifo true면 가장 최근 블록부터 해제 (함수 지역 버퍼 형태), false면 임의 슬롯 해제
+ */
+std::vector<HeapOp> MakeHeapTrace(size_t opCount, size_t slotCount, uint32_t minSize, uint32_t maxSize, bool lifo)
+{
+    std::vector<HeapOp> trace;
+    std::vector<bool> live(slotCount, false);
+    std::vector<uint32_t> stack;
+    uint64_t seed = 0x9E3779B97F4A7C15ull;
+    auto next = [&]() { seed = seed * 6364136223846793005ull + 1442695040888963407ull; return static_cast<uint32_t>(seed >> 33); };
+
+    while (trace.size() < opCount)
+    {
+        uint32_t slot = lifo ? static_cast<uint32_t>(stack.size()) : next() % slotCount;
+        bool release = lifo ? (!stack.empty() && (stack.size() == slotCount || next() % 2 == 0)) : live[slot];
+        if (release)
+        {
+            slot = lifo ? stack.back() : slot;
+            if (lifo)
+            {
+                stack.pop_back();
+            }
+            live[slot] = false;
+            trace.push_back({slot, 0});
+        }
+        else
+        {
+            live[slot] = true;
+            if (lifo)
+            {
+                stack.push_back(slot);
+            }
+            trace.push_back({slot, minSize + next() % (maxSize - minSize + 1)});
+        }
+    }
+
+    // 끝에 남은 블록 해제
+    for (uint32_t slot = 0; slot < slotCount; ++slot)
+    {
+        if (live[slot])
+        {
+            trace.push_back({slot, 0});
+        }
+    }
+    return trace;
+}
+
+// 이전 MemorySegment::HasAccess가 접근마다 만들던 로그 (레벨에 걸러져도 문자열은 만들었음)
+void LegacyAccessLog(const Memory::MemorySegment& segment, Memory::MemoryAccessFlags flag)
+{
+    std::string flagName = Memory::ToString(flag);
+    std::string typeName = Memory::ToString(segment.GetType());
+    bool result = segment.HasAccess(flag);
+    Logger::Debug("MemorySegment", "세그먼트=" + typeName + ", 권한체크=" + flagName +
+                  ", 현재권한=" + std::to_string(static_cast<int>(flag)) + ", 결과=" + (result ? "허용" : "거부"));
+}
+
+// 이전 MemoryManager::ReadUInt64/WriteUInt64가 호출마다 만들던 로그
+void LegacyManagerLog(const char* operation, size_t address, size_t offset)
+{
+    Logger::Debug("MemoryManager", std::string(operation) + " 호출 - 주소=0x" + std::to_string(address));
+    std::string segTypeName = Memory::ToString(Memory::MemorySegmentType::HEAP);
+    Logger::Debug("MemoryManager", "주소 변환 결과 - 세그먼트=" + segTypeName + ", 오프셋=0x" + std::to_string(offset));
+}
+
+} // namespace
+
+void EngineBenchmark::BenchHeapAllocator()
+{
+    _PrintHeader("힙 할당기", "bump+map", "size-class");
+
+    // 1MB 힙 기준 기록 (선형 할당은 누적 할당량만큼의 공간을 따로 잡아 두고 실행)
+    struct TraceCase
+    {
+        std::string name;
+        std::vector<HeapOp> trace;
+    };
+    const TraceCase cases[] = {
+        {"작은 블록 (8~256B)", MakeHeapTrace(20000, 256, 8, 256, false)},
+        {"혼합 크기 (8B~4KB)", MakeHeapTrace(20000, 128, 8, 4096, false)},
+        {"LIFO 큰 블록 (1~16KB)", MakeHeapTrace(20000, 32, 1024, 16384, true)}
+    };
+
+    for (const auto& traceCase : cases)
+    {
+        const auto& trace = traceCase.trace;
+        size_t totalBytes = 0;
+        for (const auto& op : trace)
+        {
+            totalBytes += (op.size + 7) & ~size_t(7);
+        }
+
+        BumpMapHeap bump(totalBytes);
+        Memory::MemoryManager memory(64 * 1024, 64 * 1024, 1024 * 1024);
+        Memory::HeapMemory& heap = memory.GetHeapMemory();
+        std::vector<size_t> addresses(256, 0);
+
+        const size_t runCount = 5;
+        BenchResult result;
+        result.name = traceCase.name;
+        result.baselineNs = _MeasurePerRun(runCount, [&]()
+        {
+            for (size_t run = 0; run < runCount; ++run)
+            {
+                bump.Reset();
+                for (const auto& op : trace)
+                {
+                    if (op.size == 0)
+                    {
+                        bump.Free(addresses[op.slot]);
+                        continue;
+                    }
+                    addresses[op.slot] = bump.Allocate(op.size);
+                    bump.Write(addresses[op.slot], op.slot);
+                }
+            }
+        }) / static_cast<double>(trace.size());
+        result.optimizedNs = _MeasurePerRun(runCount, [&]()
+        {
+            for (size_t run = 0; run < runCount; ++run)
+            {
+                heap.Reset();
+                for (const auto& op : trace)
+                {
+                    if (op.size == 0)
+                    {
+                        heap.Free(addresses[op.slot]);
+                        continue;
+                    }
+                    addresses[op.slot] = heap.Allocate(op.size);
+                    uint64_t value = op.slot;
+                    heap.WriteHeap(addresses[op.slot], &value, sizeof(value));
+                }
+            }
+        }) / static_cast<double>(trace.size());
+
+        // 마지막 실행의 통계 (기록 끝에서 모두 해제되므로 최대치 위주)
+        Memory::HeapStats stats = heap.GetStats();
+
+        _PrintResult(result);
+        _results.push_back(result);
+
+        std::cout << "  연산 " << trace.size() << "회 (1회당 ns), 필요한 힙: bump+map " << bump.GetUsedBytes() / 1024
+                  << "KB / size-class " << stats.peakUsedBytes / 1024 << "KB (최대 사용 중 "
+                  << stats.peakLiveBytes / 1024 << "KB)" << std::endl;
+    }
+
+    // 중간 상태 단편화: 혼합 크기 기록을 절반만 실행한 뒤
+    {
+        const auto& trace = cases[1].trace;
+        Memory::MemoryManager memory(64 * 1024, 64 * 1024, 1024 * 1024);
+        Memory::HeapMemory& heap = memory.GetHeapMemory();
+        std::vector<size_t> addresses(256, 0);
+        for (size_t i = 0; i < trace.size() / 2; ++i)
+        {
+            if (trace[i].size == 0)
+            {
+                heap.Free(addresses[trace[i].slot]);
+            }
+            else
+            {
+                addresses[trace[i].slot] = heap.Allocate(trace[i].size);
+            }
+        }
+
+        Memory::HeapStats stats = heap.GetStats();
+        std::cout << "  혼합 크기 중간 상태: 사용 중 " << stats.liveBlocks << "블록 " << stats.liveBytes / 1024
+                  << "KB, 빈 블록 " << stats.freeBytes / 1024 << "KB, 단편화 " << std::fixed << std::setprecision(3)
+                  << stats.fragmentation << std::defaultfloat << std::endl;
+    }
+}
+
+void EngineBenchmark::BenchHeapGrowth()
+{
+    _PrintHeader("힙 확장", "고정 32MB", "확장");
+
+    // 64KB 블록으로 targetBytes만큼 할당 (매 실행 Reset: 확장 힙은 1MB로 돌아갔다가 다시 늘어남)
+    const size_t blockSize = 64 * 1024;
+    auto fill = [blockSize](Memory::MemoryManager& memory, size_t targetBytes)
+    {
+        Memory::HeapMemory& heap = memory.GetHeapMemory();
+        heap.Reset();
+        for (size_t allocated = 0; allocated < targetBytes; allocated += blockSize)
+        {
+            size_t address = heap.Allocate(blockSize);
+            uint64_t value = allocated;
+            heap.WriteHeap(address, &value, sizeof(value));
+        }
+    };
+
+    struct GrowthCase
+    {
+        std::string name;
+        Memory::MemoryBacking backing;
+        size_t targetBytes;
+    };
+    const GrowthCase cases[] = {
+        {"Heap 방식, 512KB 사용", Memory::MemoryBacking::Heap, 512 * 1024},
+        {"Heap 방식, 16MB 사용", Memory::MemoryBacking::Heap, 16 * 1024 * 1024},
+        {"기본 방식, 512KB 사용", Memory::MemorySegment::GetDefaultBacking(), 512 * 1024},
+        {"기본 방식, 16MB 사용", Memory::MemorySegment::GetDefaultBacking(), 16 * 1024 * 1024}
+    };
+
+    const size_t fixedSize = 32 * 1024 * 1024;
+    for (const auto& growthCase : cases)
+    {
+        // 기준: 최악의 경우에 맞춰 처음부터 32MB (늘리지 않음)
+        Memory::HeapGrowthPolicy fixedPolicy;
+        fixedPolicy.initialSize = fixedSize;
+        fixedPolicy.maxSize = fixedSize;
+
+        const size_t runCount = 10;
+        std::unique_ptr<Memory::MemoryManager> lastFixed;
+        std::unique_ptr<Memory::MemoryManager> lastGrowing;
+
+        // 인스턴스 생성부터 포함 (고정 크기는 생성 시 전체를 잡음)
+        BenchResult result;
+        result.name = growthCase.name;
+        result.baselineNs = _MeasurePerRun(runCount, [&]()
+        {
+            for (size_t run = 0; run < runCount; ++run)
+            {
+                lastFixed = std::make_unique<Memory::MemoryManager>(64 * 1024, 64 * 1024, fixedSize, growthCase.backing);
+                lastFixed->SetHeapGrowthPolicy(fixedPolicy);
+                fill(*lastFixed, growthCase.targetBytes);
+            }
+        });
+        result.optimizedNs = _MeasurePerRun(runCount, [&]()
+        {
+            for (size_t run = 0; run < runCount; ++run)
+            {
+                lastGrowing = std::make_unique<Memory::MemoryManager>(64 * 1024, 64 * 1024, 1024 * 1024, growthCase.backing);
+                fill(*lastGrowing, growthCase.targetBytes);
+            }
+        });
+
+        _PrintResult(result);
+        _results.push_back(result);
+
+        Memory::HeapStats stats = lastGrowing->GetHeapMemory().GetStats();
+        std::cout << "  힙 크기 고정 " << fixedSize / 1024 << "KB / 확장 " << stats.heapSize / 1024
+                  << "KB (늘린 횟수 " << stats.growthCount << ", 옮긴 횟수 " << stats.relocationCount
+                  << "), 커밋: 고정 " << lastFixed->GetCommittedBytes() / 1024 << "KB / 확장 "
+                  << lastGrowing->GetCommittedBytes() / 1024 << "KB" << std::endl;
+    }
+}
+
+void EngineBenchmark::BenchArena()
+{
+    _PrintHeader("아레나 할당", "ALLOC/FREE", "ARENA");
+
+    // 요청 하나 = 임시 블록 count개 할당 후 모두 해제 (크기는 고정 시드로 minSize~maxSize)
+    struct ScratchCase
+    {
+        std::string name;
+        size_t count;
+        size_t minSize;
+        size_t maxSize;
+    };
+    const ScratchCase cases[] = {
+        {"임시 32개 (8~64B)", 32, 8, 64},
+        {"임시 256개 (16~256B)", 256, 16, 256},
+        {"임시 64개 (256B~2KB)", 64, 256, 2048}
+    };
+
+    for (const auto& scratchCase : cases)
+    {
+        std::vector<size_t> sizes(scratchCase.count);
+        uint64_t seed = 0x5EED;
+        for (auto& size : sizes)
+        {
+            seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+            size = scratchCase.minSize + (seed >> 33) % (scratchCase.maxSize - scratchCase.minSize + 1);
+        }
+
+        Memory::MemoryManager memory(64 * 1024, 64 * 1024, 1024 * 1024);
+        Memory::HeapMemory& heap = memory.GetHeapMemory();
+        Memory::ArenaMemory& arena = memory.GetArenaMemory();
+        std::vector<size_t> addresses(sizes.size());
+
+        const size_t requestCount = 2000;
+        BenchResult result;
+        result.name = scratchCase.name;
+        result.baselineNs = _MeasurePerRun(requestCount, [&]()
+        {
+            for (size_t request = 0; request < requestCount; ++request)
+            {
+                for (size_t i = 0; i < sizes.size(); ++i)
+                {
+                    addresses[i] = heap.Allocate(sizes[i]);
+                    uint64_t value = i;
+                    heap.WriteHeap(addresses[i], &value, sizeof(value));
+                }
+                for (size_t address : addresses)
+                {
+                    heap.Free(address);
+                }
+            }
+        });
+        result.optimizedNs = _MeasurePerRun(requestCount, [&]()
+        {
+            for (size_t request = 0; request < requestCount; ++request)
+            {
+                arena.Begin();
+                for (size_t i = 0; i < sizes.size(); ++i)
+                {
+                    addresses[i] = arena.Allocate(sizes[i]);
+                    uint64_t value = i;
+                    heap.WriteHeap(addresses[i], &value, sizeof(value));
+                }
+                arena.Reset();
+            }
+        });
+
+        _PrintResult(result);
+        _results.push_back(result);
+    }
+
+    Memory::MemoryManager memory(64 * 1024, 64 * 1024, 1024 * 1024);
+    Memory::ArenaMemory& arena = memory.GetArenaMemory();
+    arena.Begin();
+    for (size_t i = 0; i < 256; ++i)
+    {
+        arena.Allocate(16 + i % 241);
+    }
+    std::cout << "  임시 256개 요청 1회: 힙 블록 " << memory.GetHeapMemory().GetStats().liveBlocks
+              << "개 (ALLOC은 256개), 청크 " << arena.GetStats().chunkBytes / 1024 << "KB" << std::endl;
+    arena.Reset();
+}
+
+void EngineBenchmark::BenchTracing()
+{
+    _PrintHeader("메모리 접근 추적 로그", "문자열 생성", "레벨 확인");
+
+    // 기본 로그 레벨(INFO)에서 DEBUG 추적 로그는 출력되지 않음: 이전에는 문자열을 만든 뒤 버렸음
+    Memory::MemoryManager memory(64 * 1024, 64 * 1024, 1024 * 1024);
+    auto& heapSegment = memory.GetSegment(Memory::MemorySegmentType::HEAP);
+    const size_t heapBase = memory.GetBaseAddress(Memory::MemorySegmentType::HEAP);
+    const size_t opCount = 200000;
+    volatile uint64_t sink = 0;
+
+    BenchResult segmentResult;
+    segmentResult.name = "세그먼트 Read/Write 64비트";
+    segmentResult.baselineNs = _MeasurePerRun(opCount, [&]()
+    {
+        for (size_t i = 0; i < opCount; i += 2)
+        {
+            size_t offset = (i * 8) & 0xFFFF;
+            LegacyAccessLog(heapSegment, Memory::MemoryAccessFlags::WRITE);
+            heapSegment.WriteUInt64(offset, i);
+            LegacyAccessLog(heapSegment, Memory::MemoryAccessFlags::READ);
+            sink = sink + heapSegment.ReadUInt64(offset);
+        }
+    });
+    segmentResult.optimizedNs = _MeasurePerRun(opCount, [&]()
+    {
+        for (size_t i = 0; i < opCount; i += 2)
+        {
+            size_t offset = (i * 8) & 0xFFFF;
+            heapSegment.WriteUInt64(offset, i);
+            sink = sink + heapSegment.ReadUInt64(offset);
+        }
+    });
+    _PrintResult(segmentResult);
+    _results.push_back(segmentResult);
+
+    BenchResult managerResult;
+    managerResult.name = "주소 변환 Read/WriteUInt64";
+    managerResult.baselineNs = _MeasurePerRun(opCount, [&]()
+    {
+        for (size_t i = 0; i < opCount; i += 2)
+        {
+            size_t offset = (i * 8) & 0xFFFF;
+            LegacyManagerLog("WriteUInt64", heapBase + offset, offset);
+            LegacyAccessLog(heapSegment, Memory::MemoryAccessFlags::WRITE);
+            memory.WriteUInt64(heapBase + offset, i);
+            LegacyManagerLog("ReadUInt64", heapBase + offset, offset);
+            LegacyAccessLog(heapSegment, Memory::MemoryAccessFlags::READ);
+            sink = sink + memory.ReadUInt64(heapBase + offset);
+        }
+    });
+    managerResult.optimizedNs = _MeasurePerRun(opCount, [&]()
+    {
+        for (size_t i = 0; i < opCount; i += 2)
+        {
+            size_t offset = (i * 8) & 0xFFFF;
+            memory.WriteUInt64(heapBase + offset, i);
+            sink = sink + memory.ReadUInt64(heapBase + offset);
+        }
+    });
+    _PrintResult(managerResult);
+    _results.push_back(managerResult);
+
+    std::cout << "  (1회당 ns, 메모리 접근 " << opCount << "회) 현재 빌드 DMVM_TRACE=" << DMVM_TRACE << std::endl;
+}
+
+void EngineBenchmark::BenchStackSharing()
+{
+    _PrintHeader("VM 스택 공유 방식", "Synchronized", "Owned");
+
+    // 푸시/팝마다 StackMemory를 거치는 Portable 루프 (검사 생략/JIT 루프는 스택을 직접 다룸)
+    std::vector<Programs::EngineProgram> programs = {
+        {"LargeNumbers", Programs::LargeNumbers(), 3000000},
+        {"SumLoop(100)", Programs::SumLoop(100), 5050},
+        {"CountdownLoop(1000)", Programs::CountdownLoop(1000), 0}
+    };
+
+    _BenchPrograms(programs,
+        [](Engine::Interpreter& interpreter)
+        {
+            interpreter.SetExecutionMode(Engine::ExecutionMode::Portable);
+            interpreter.SetStackSharing(Memory::StackSharing::Synchronized);
+        },
+        [](Engine::Interpreter& interpreter) { interpreter.SetExecutionMode(Engine::ExecutionMode::Portable); });
+
+    std::cout << "  현재 빌드 DMVM_STACK_OWNER_CHECK=" << DMVM_STACK_OWNER_CHECK << std::endl;
+}
+
+void EngineBenchmark::BenchSnapshot()
+{
+    _PrintHeader("스냅샷 웜 스타트", "초기화 재실행", "스냅샷 복원");
+
+    using Engine::Opcode;
+    using Programs::Detail::Emit;
+    const uint64_t heapBase = Memory::MemoryManager::kHeapBaseAddress;
+
+    for (uint32_t tableKB : {256u, 2048u, 16384u})
+    {
+        // 초기화 (0번지): 힙에 8바이트 항목 표를 채움 (table[i] = 항목 주소)
+        const uint32_t count = tableKB * 1024 / 8;
+        std::vector<uint8_t> code;
+        Emit(code, Opcode::PUSH32, count, 4);
+        size_t loop = code.size();
+        Emit(code, Opcode::DUP);
+        Emit(code, Opcode::PUSH8, 3, 1);
+        Emit(code, Opcode::SHL);
+        Emit(code, Opcode::PUSH32, heapBase - 8, 4);
+        Emit(code, Opcode::ADD);
+        Emit(code, Opcode::DUP);
+        Emit(code, Opcode::STORE64);
+        Emit(code, Opcode::PUSH8, 1, 1);
+        Emit(code, Opcode::SUB);
+        Emit(code, Opcode::DUP);
+        Emit(code, Opcode::JNZ, static_cast<uint16_t>(static_cast<int16_t>(loop - (code.size() + 3))), 2);
+        Emit(code, Opcode::HALT);
+
+        // 요청: 표 가운데 항목 하나를 읽어 고쳐 쓰고 반환
+        const size_t request = code.size();
+        const uint64_t entry = heapBase + (count / 2) * 8;
+        Emit(code, Opcode::PUSH32, entry, 4);
+        Emit(code, Opcode::DUP);
+        Emit(code, Opcode::LOAD64);
+        Emit(code, Opcode::PUSH8, 1, 1);
+        Emit(code, Opcode::ADD);
+        Emit(code, Opcode::STORE64);
+        Emit(code, Opcode::PUSH32, entry, 4);
+        Emit(code, Opcode::LOAD64);
+        Emit(code, Opcode::HALT);
+
+        const size_t heapSize = std::max<size_t>(tableKB * 1024, 1024 * 1024);
+        Engine::Interpreter baseline(64 * 1024, 1024 * 1024, heapSize);
+        baseline.LoadBytecode(code.data(), code.size());
+
+        Engine::Interpreter optimized(64 * 1024, 1024 * 1024, heapSize);
+        optimized.LoadBytecode(code.data(), code.size());
+        optimized.Execute();
+        auto snapshot = optimized.Snapshot();
+
+        const size_t requestCount = tableKB >= 16384 ? 4 : 20;
+        uint64_t baselineValue = 0;
+        uint64_t optimizedValue = 0;
+        BenchResult result;
+        result.name = "표 " + std::to_string(tableKB) + "KB";
+        result.baselineNs = _MeasurePerRun(requestCount, [&]()
+        {
+            for (size_t i = 0; i < requestCount; ++i)
+            {
+                baseline.Recycle();
+                baseline.Execute();
+                baseline.Execute(request);
+                baselineValue = baseline.GetReturnValue();
+            }
+        });
+        result.optimizedNs = _MeasurePerRun(requestCount, [&]()
+        {
+            for (size_t i = 0; i < requestCount; ++i)
+            {
+                optimized.RestoreSnapshot(*snapshot);
+                optimized.Execute(request);
+                optimizedValue = optimized.GetReturnValue();
+            }
+        });
+
+        if (baselineValue != entry + 1 || optimizedValue != entry + 1)
+        {
+            std::cout << "  (주의) " << result.name << " 결과 불일치: 예상값=" << entry + 1
+                      << ", 실제값=" << baselineValue << "/" << optimizedValue << std::endl;
+        }
+
+        _PrintResult(result);
+        _results.push_back(result);
+
+        if (tableKB == 16384)
+        {
+            std::cout << "  (1요청당 ns) 이미지 " << snapshot->GetImageBytes() / 1024 << "KB, "
+                      << (snapshot->heap.IsFileBacked() ? "MAP_PRIVATE 매핑" : "복사") << " 복원" << std::endl;
+        }
+    }
+}
+
+void EngineBenchmark::_BenchPrograms(const std::vector<Programs::EngineProgram>& programs,
+                                     const Setup& baselineSetup, const Setup& optimizedSetup,
+                                     const Runner& baselineRun, const Runner& optimizedRun)
+{
+    auto execute = [](Engine::Interpreter& interpreter) { interpreter.Execute(); };
+    const Runner& runBaseline = baselineRun ? baselineRun : execute;
+    const Runner& runOptimized = optimizedRun ? optimizedRun : execute;
+
+    for (const auto& program : programs)
+    {
+        // Reset()은 힙을 초기화하지 않으므로 ALLOC을 쓰는 프로그램은 반복 실행 불가
+        if (std::find(program.bytecode.begin(), program.bytecode.end(),
+                      static_cast<uint8_t>(Engine::Opcode::ALLOC)) != program.bytecode.end())
+        {
+            std::cout << "  (생략) " << program.name << ": 반복 실행 시 힙 상태가 누적됨" << std::endl;
+            continue;
+        }
+
+        // 검사 생략 실행은 BenchVerified에서만 비교 (다른 비교는 검사하는 루프 기준)
+        Engine::Interpreter baseline;
+        baseline.SetVerificationEnabled(false);
+        baseline.SetStackGuardEnabled(false);
+        baselineSetup(baseline);
+        baseline.LoadBytecode(program.bytecode.data(), program.bytecode.size());
+
+        Engine::Interpreter optimized;
+        optimized.SetVerificationEnabled(false);
+        optimized.SetStackGuardEnabled(false);
+        optimizedSetup(optimized);
+        optimized.LoadBytecode(program.bytecode.data(), program.bytecode.size());
+
+        BenchResult result;
+        result.name = program.name;
+        result.baselineNs = _Measure([&]()
+        {
+            baseline.Reset();
+            runBaseline(baseline);
+        });
+        result.optimizedNs = _Measure([&]()
+        {
+            optimized.Reset();
+            runOptimized(optimized);
+        });
+
+        for (const Engine::Interpreter* interpreter : {&baseline, &optimized})
+        {
+            if (interpreter->GetReturnValue() != program.expectedResult)
+            {
+                std::cout << "  (주의) " << program.name << " 결과 불일치: 예상값=" << program.expectedResult
+                          << ", 실제값=" << interpreter->GetReturnValue() << std::endl;
+                break;
+            }
+        }
+
+        _PrintResult(result);
+        _results.push_back(result);
+    }
+}
+
+void EngineBenchmark::BenchBulkMemory()
+{
+    _PrintHeader("블록 메모리 복사", "LOAD64/STORE64 루프", "MEMCPY");
+
+    for (uint32_t bytes : {256u, 4096u, 32768u})
+    {
+        const auto scalar = Programs::ScalarCopyLoop(bytes);
+        const auto bulk = Programs::BulkCopy(bytes);
+
+        Engine::Interpreter baseline;
+        baseline.SetStackGuardEnabled(false);
+        baseline.LoadBytecode(scalar.data(), scalar.size());
+
+        Engine::Interpreter optimized;
+        optimized.SetStackGuardEnabled(false);
+        optimized.LoadBytecode(bulk.data(), bulk.size());
+
+        BenchResult result;
+        result.name = std::to_string(bytes) + "B 복사";
+        result.baselineNs = _Measure([&]()
+        {
+            baseline.Reset();
+            baseline.Execute();
+        });
+        result.optimizedNs = _Measure([&]()
+        {
+            optimized.Reset();
+            optimized.Execute();
+        });
+
+        const uint64_t expected = 0x5A5A5A5A5A5A5A5AULL;
+        if (baseline.GetReturnValue() != expected || optimized.GetReturnValue() != expected)
+        {
+            std::cout << "  (주의) " << result.name << " 결과 불일치: 실제값=" << baseline.GetReturnValue()
+                      << "/" << optimized.GetReturnValue() << std::endl;
+        }
+
+        _PrintResult(result);
+        _results.push_back(result);
+    }
+}
+
+void EngineBenchmark::BenchFrameLocals()
+{
+    _PrintHeader("변수 접근", "PUSH32+LOAD64", "LDLOC/STLOC");
+
+    for (uint16_t n : {100, 1000, 10000})
+    {
+        const auto absolute = Programs::SumLoop(n);
+        const auto frame = Programs::FrameSumLoop(n);
+
+        // 검증기가 CALL을 거부하므로 둘 다 검사하는 루프에서 비교
+        Engine::Interpreter baseline;
+        baseline.SetVerificationEnabled(false);
+        baseline.SetStackGuardEnabled(false);
+        baseline.LoadBytecode(absolute.data(), absolute.size());
+
+        Engine::Interpreter optimized;
+        optimized.SetVerificationEnabled(false);
+        optimized.SetStackGuardEnabled(false);
+        optimized.LoadBytecode(frame.data(), frame.size());
+
+        BenchResult result;
+        result.name = "합 루프 n=" + std::to_string(n);
+        result.baselineNs = _Measure([&]()
+        {
+            baseline.Reset();
+            baseline.Execute();
+        });
+        result.optimizedNs = _Measure([&]()
+        {
+            optimized.Reset();
+            optimized.Execute();
+        });
+
+        const uint64_t expected = static_cast<uint64_t>(n) * (n + 1) / 2;
+        if (baseline.GetReturnValue() != expected || optimized.GetReturnValue() != expected)
+        {
+            std::cout << "  (주의) " << result.name << " 결과 불일치: 실제값=" << baseline.GetReturnValue()
+                      << "/" << optimized.GetReturnValue() << std::endl;
+        }
+
+        _PrintResult(result);
+        _results.push_back(result);
+
+        if (n == 10000)
+        {
+            std::cout << "  (코드 크기) 절대 주소 " << absolute.size() << "바이트, 프레임 슬롯 " << frame.size() << "바이트" << std::endl;
+        }
+    }
+}
+
+void EngineBenchmark::BenchTailCall()
+{
+    _PrintHeader("깊은 재귀", "CALL+RET", "TAILCALL");
+
+    for (uint32_t n : {1000, 10000})
+    {
+        const auto nonTail = Programs::TailRecursiveSum(n, false);
+        const auto tail = Programs::TailRecursiveSum(n, true);
+
+        // 검증기가 CALL/TAILCALL을 거부하므로 둘 다 검사하는 루프에서 비교
+        Engine::Interpreter baseline;
+        baseline.SetVerificationEnabled(false);
+        baseline.SetStackGuardEnabled(false);
+        baseline.LoadBytecode(nonTail.data(), nonTail.size());
+
+        Engine::Interpreter optimized;
+        optimized.SetVerificationEnabled(false);
+        optimized.SetStackGuardEnabled(false);
+        optimized.LoadBytecode(tail.data(), tail.size());
+
+        BenchResult result;
+        result.name = "sum(n, acc) n=" + std::to_string(n);
+        result.baselineNs = _Measure([&]()
+        {
+            baseline.Reset();
+            baseline.Execute();
+        });
+        result.optimizedNs = _Measure([&]()
+        {
+            optimized.Reset();
+            optimized.Execute();
+        });
+
+        const uint64_t expected = static_cast<uint64_t>(n) * (n + 1) / 2;
+        if (baseline.GetReturnValue() != expected || optimized.GetReturnValue() != expected)
+        {
+            std::cout << "  (주의) " << result.name << " 결과 불일치: 실제값=" << baseline.GetReturnValue()
+                      << "/" << optimized.GetReturnValue() << std::endl;
+        }
+
+        _PrintResult(result);
+        _results.push_back(result);
+
+        // 스택 사용량: 각 최대 호출 깊이로 실행되는지 확인, VM 스택은 프레임마다 인자 2칸
+        auto fitsDepth = [](const std::vector<uint8_t>& code, size_t depth)
+        {
+            Engine::Interpreter interpreter;
+            interpreter.SetMaxCallDepth(depth);
+            interpreter.LoadBytecode(code.data(), code.size());
+            return interpreter.Execute() == 0;
+        };
+        const size_t callDepth = n + 1u;
+        const bool callMeasured = fitsDepth(nonTail, callDepth);
+        const bool tailMeasured = fitsDepth(tail, 1);
+        std::cout << "  (스택) 최대 호출 깊이 CALL " << (callMeasured ? std::to_string(callDepth) : "?")
+                  << " / TAILCALL " << (tailMeasured ? "1" : "?") << ", VM 스택 인자 CALL "
+                  << callDepth * 2 * sizeof(uint64_t) << "바이트 / TAILCALL " << 2 * sizeof(uint64_t) << "바이트" << std::endl;
+    }
+}
+
+EngineBenchmark::LegacyHandlerMap EngineBenchmark::_BuildLegacyHandlers()
+{
+    LegacyHandlerMap handlers;
+
+    for (size_t opcode = 0; opcode < Engine::Interpreter::_dispatchTable.size(); ++opcode)
+    {
+        Engine::Interpreter::OpcodeHandler handler = Engine::Interpreter::_dispatchTable[opcode];
+        if (handler == &Engine::Interpreter::_Handle_INVALID)
+        {
+            continue;
+        }
+
+        handlers[static_cast<uint8_t>(opcode)] = [handler](Engine::Interpreter* interpreter) { (interpreter->*handler)(); };
+    }
+
+    return handlers;
+}
+
+void EngineBenchmark::_ExecuteLegacy(Engine::Interpreter& interpreter, const LegacyHandlerMap& handlers)
+{
+    interpreter._ip = 0;
+    interpreter._running = true;
+
+    while (interpreter._running)
+    {
+        try
+        {
+            uint8_t opcode = interpreter._FetchByte();
+
+            auto it = handlers.find(opcode);
+            if (it == handlers.end())
+            {
+                throw std::runtime_error("알 수 없는 명령어");
+            }
+
+            it->second(&interpreter);
+        }
+        catch (const std::exception&)
+        {
+            interpreter._running = false;
+        }
+    }
+}
+
+void EngineBenchmark::_ExecuteTable(Engine::Interpreter& interpreter)
+{
+    interpreter._ip = 0;
+    interpreter._running = true;
+    interpreter._ExecuteBytecode();
+}
+
+double EngineBenchmark::_MeasurePerRun(size_t runCount, const std::function<void()>& fn) const
+{
+    // 한 번 호출이 runCount번 실행이므로 워밍업 1회 후 1회만 측정
+    fn();
+
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    return std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(runCount);
+}
+
+double EngineBenchmark::_Measure(const std::function<void()>& fn) const
+{
+    // 워밍업
+    for (size_t i = 0; i < _iterations / 10 + 1; ++i)
+    {
+        fn();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < _iterations; ++i)
+    {
+        fn();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    return std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(_iterations);
+}
+
+void EngineBenchmark::_PrintHeader(const std::string& title, const std::string& baseline, const std::string& optimized) const
+{
+    std::cout << "\n--- " << title << " ---" << std::endl;
+    std::cout << std::left << std::setw(24) << "프로그램"
+              << std::right << std::setw(16) << baseline + " ns"
+              << std::setw(16) << optimized + " ns"
+              << std::setw(10) << "배율" << std::endl;
+}
+
+void EngineBenchmark::_PrintResult(const BenchResult& result) const
+{
+    double speedup = result.optimizedNs > 0.0 ? result.baselineNs / result.optimizedNs : 0.0;
+
+    std::ostringstream line;
+    line << std::left << std::setw(24) << result.name
+         << std::right << std::fixed << std::setprecision(1)
+         << std::setw(16) << result.baselineNs
+         << std::setw(16) << result.optimizedNs
+         << std::setw(9) << std::setprecision(2) << speedup << "x";
+    std::cout << line.str() << std::endl;
+}
+
+} // namespace Tests
+} // namespace DarkMatterVM
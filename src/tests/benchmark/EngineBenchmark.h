@@ -0,0 +1,223 @@
+#pragma once
+
+#include "../../engine/Interpreter.h"
+#include "../../common/Logger.h"
+#include "../engine/EnginePrograms.h"
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace DarkMatterVM
+{
+namespace Tests
+{
+
+/**
+ * @brief Engine 성능 측정 클래스
+ *
+ * 최적화 전후 실행 경로를 같은 프로그램으로 반복 실행하여 비교
+ * 측정 중에는 로그 레벨을 WARNING으로 올려 로그 출력 비용을 제외
+ */
+class EngineBenchmark
+{
+public:
+    /**
+     * @brief 생성자
+     *
+     * @param iterations 프로그램당 반복 실행 횟수
+     */
+    explicit EngineBenchmark(size_t iterations = 20000);
+    ~EngineBenchmark() = default;
+
+    /**
+     * @brief 모든 벤치마크 실행
+     */
+    void RunAll();
+
+    /**
+     * @brief 디스패치 비교 (unordered_map + std::function vs 256 엔트리 테이블)
+     */
+    void BenchDispatch();
+
+    /**
+     * @brief 사전 디코딩 비교 (바이트 단위 fetch + 테이블 vs 명령어 스트림 switch 루프)
+     */
+    void BenchDecoded();
+
+    /**
+     * @brief 실행 모드 비교 (Portable switch 루프 vs Threaded computed goto)
+     */
+    void BenchThreaded();
+
+    /**
+     * @brief 코퍼스 n-gram 보고서 출력 후 슈퍼명령어 합치기 전후 비교
+     */
+    void BenchSuperinstructions();
+
+    /**
+     * @brief 스택 최상위 캐싱 비교 (Portable switch 루프 vs StackCached)
+     */
+    void BenchStackCached();
+
+    /**
+     * @brief 명령어 집합 비교 (스택 ISA Portable vs 변환된 레지스터 ISA)
+     */
+    void BenchRegister();
+
+    /**
+     * @brief 템플릿 JIT 비교 (Portable switch 루프 vs Jit)
+     */
+    void BenchJit();
+
+    /**
+     * @brief 계층 실행 비교 (Portable switch 루프 vs Tiered)
+     */
+    void BenchTiered();
+
+    /**
+     * @brief 일괄 실행 비교 (입력마다 LoadBytecode+Execute vs ExecuteBatch 순차/병렬)
+     */
+    void BenchBatch();
+
+    /**
+     * @brief SIMD 레인 실행 비교 (스칼라 ExecuteBatch vs 레인 ExecuteBatch)
+     */
+    void BenchLanes();
+
+    /**
+     * @brief 로드 시점 검증 비교 (명령어마다 스택 검사하는 Portable vs 검증된 코드의 검사 생략 루프)
+     */
+    void BenchVerified();
+
+    /**
+     * @brief 인스턴스 풀 비교 (실행마다 Interpreter 생성+LoadBytecode vs InterpreterPool 재사용)
+     */
+    void BenchPool();
+
+    /**
+     * @brief 세그먼트 메모리 확보 방식 비교 (make_shared 할당+0 채우기 vs 익명 mmap 예약)
+     */
+    void BenchMappedSegments();
+
+    /**
+     * @brief 가드 페이지 스택 비교 (스택 관리자 푸시/팝 + 일반 루프 vs 가드 범위 안의 포인터 이동)
+     */
+    void BenchStackGuard();
+
+    /**
+     * @brief 힙 할당기 비교 (선형 할당 + std::map 블록 기록 vs 크기 등급별 해제 리스트), ALLOC/FREE 기록 재생
+     */
+    void BenchHeapAllocator();
+
+    /**
+     * @brief 힙 확장 비교 (처음부터 큰 고정 크기 vs 1MB에서 필요할 때 확장), 인스턴스 생성 + 할당 시간과 커밋 바이트
+     */
+    void BenchHeapGrowth();
+
+    /**
+     * @brief 요청마다 임시 블록을 잡았다 모두 버리는 패턴: 블록별 ALLOC/FREE vs 아레나 (1요청당 ns)
+     */
+    void BenchArena();
+
+    /**
+     * @brief 메모리 접근 경로의 추적 로그 비교 (레벨에 걸러져도 문자열을 만들던 이전 방식 vs 레벨 확인 후 생성)
+     */
+    void BenchTracing();
+
+    /**
+     * @brief VM 스택 공유 방식 비교 (접근마다 뮤텍스를 잡는 Synchronized vs 락 없는 Owned, Portable 루프)
+     */
+    void BenchStackSharing();
+
+    /**
+     * @brief 초기화가 긴 루틴의 요청 시작 비교 (매번 초기화 재실행 vs 초기화 직후 스냅샷 복원)
+     */
+    void BenchSnapshot();
+
+    /**
+     * @brief 힙 블록 복사 비교 (8바이트씩 LOAD64/STORE64 루프 vs MEMCPY 한 번, 기본 실행 모드)
+     */
+    void BenchBulkMemory();
+
+    /**
+     * @brief 변수 접근 비교 (절대 주소 PUSH32 + LOAD64/STORE64 vs BP 상대 LDLOC/STLOC, 검사하는 Portable 루프)
+     */
+    void BenchFrameLocals();
+
+    /**
+     * @brief 깊은 재귀 비교 (CALL 후 RET vs 현재 프레임을 재사용하는 TAILCALL, 실행 시간과 호출 스택 깊이)
+     */
+    void BenchTailCall();
+
+private:
+    /**
+     * @brief 기존 디스패치 방식의 핸들러 맵 타입
+     */
+    using LegacyHandlerMap = std::unordered_map<uint8_t, std::function<void(Engine::Interpreter*)>>;
+
+    /**
+     * @brief 측정 전 인터프리터 설정 (LoadBytecode 이전에 호출)
+     */
+    using Setup = std::function<void(Engine::Interpreter&)>;
+
+    /**
+     * @brief Reset() 이후 1회 실행
+     */
+    using Runner = std::function<void(Engine::Interpreter&)>;
+
+    /**
+     * @brief 측정 결과
+     */
+    struct BenchResult
+    {
+        std::string name;
+        double baselineNs;   ///< 기존 경로 1회 실행 평균 (ns)
+        double optimizedNs;  ///< 최적화 경로 1회 실행 평균 (ns)
+    };
+
+    /**
+     * @brief 프로그램마다 기준/최적화 인터프리터를 따로 만들어 실행 시간 비교
+     *
+     * Runner를 비워두면 Execute() 사용, ALLOC을 쓰는 프로그램은 생략
+     */
+    void _BenchPrograms(const std::vector<Programs::EngineProgram>& programs,
+                        const Setup& baselineSetup, const Setup& optimizedSetup,
+                        const Runner& baselineRun = nullptr, const Runner& optimizedRun = nullptr);
+
+    /**
+     * @brief 디스패치 테이블로부터 기존 방식의 핸들러 맵 구성
+     */
+    static LegacyHandlerMap _BuildLegacyHandlers();
+
+    /**
+     * @brief 기존 Execute/Step 루프 재현 (명령어마다 해시 조회 + try/catch)
+     */
+    static void _ExecuteLegacy(Engine::Interpreter& interpreter, const LegacyHandlerMap& handlers);
+
+    /**
+     * @brief 바이트 단위 fetch + 디스패치 테이블 루프로 실행
+     */
+    static void _ExecuteTable(Engine::Interpreter& interpreter);
+
+    /**
+     * @brief fn을 반복 실행하고 1회 평균 시간(ns) 반환
+     */
+    double _Measure(const std::function<void()>& fn) const;
+
+    /**
+     * @brief 실행 runCount번을 한 번에 하는 함수의 실행 1회 평균 (ns)
+     */
+    double _MeasurePerRun(size_t runCount, const std::function<void()>& fn) const;
+
+    void _PrintHeader(const std::string& title, const std::string& baseline, const std::string& optimized) const;
+    void _PrintResult(const BenchResult& result) const;
+
+    size_t _iterations;
+    std::vector<BenchResult> _results;
+};
+
+} // namespace Tests
+} // namespace DarkMatterVM
@@ -0,0 +1,556 @@
+#pragma once
+
+#include <Opcodes.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace DarkMatterVM
+{
+namespace Tests
+{
+
+/**
+ * @brief Engine 테스트/벤치마크 공용 바이트코드 프로그램
+ *
+ * TestEngine과 EngineBenchmark가 같은 프로그램을 사용하도록 한 곳에 정의
+ */
+namespace Programs
+{
+
+/**
+ * @brief 이름, 바이트코드, 기대 결과값 묶음
+ */
+struct EngineProgram
+{
+    std::string name;
+    std::vector<uint8_t> bytecode;
+    uint64_t expectedResult;
+};
+
+// PUSH8 42, PUSH8 13, ADD, HALT
+inline std::vector<uint8_t> BasicArithmetic()
+{
+    return {
+        static_cast<uint8_t>(Engine::Opcode::PUSH8), 42,
+        static_cast<uint8_t>(Engine::Opcode::PUSH8), 13,
+        static_cast<uint8_t>(Engine::Opcode::ADD),
+        static_cast<uint8_t>(Engine::Opcode::HALT)
+    };
+}
+
+// PUSH8 1, PUSH8 2, DUP, ADD, HALT (결과: 1 + 2 + 2 = 5)
+inline std::vector<uint8_t> StackOperations()
+{
+    return {
+        static_cast<uint8_t>(Engine::Opcode::PUSH8), 1,
+        static_cast<uint8_t>(Engine::Opcode::PUSH8), 2,
+        static_cast<uint8_t>(Engine::Opcode::DUP),
+        static_cast<uint8_t>(Engine::Opcode::ADD),
+        static_cast<uint8_t>(Engine::Opcode::HALT)
+    };
+}
+
+// PUSH64 8, ALLOC, DUP, PUSH64 123, STORE64, LOAD64, HALT
+inline std::vector<uint8_t> MemoryOperations()
+{
+    return {
+        static_cast<uint8_t>(Engine::Opcode::PUSH64), 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        static_cast<uint8_t>(Engine::Opcode::ALLOC),
+        static_cast<uint8_t>(Engine::Opcode::DUP),
+        static_cast<uint8_t>(Engine::Opcode::PUSH64), 0x7B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        static_cast<uint8_t>(Engine::Opcode::STORE64),
+        static_cast<uint8_t>(Engine::Opcode::LOAD64),
+        static_cast<uint8_t>(Engine::Opcode::HALT)
+    };
+}
+
+// PUSH8 10, PUSH8 5, JG, PUSH8 100, HALT
+// 10 > 5 이므로 점프하여 100을 푸시
+inline std::vector<uint8_t> ControlFlow()
+{
+    return {
+        static_cast<uint8_t>(Engine::Opcode::PUSH8), 10,
+        static_cast<uint8_t>(Engine::Opcode::PUSH8), 5,
+        static_cast<uint8_t>(Engine::Opcode::JG), 0x02, 0x00, // 2바이트 점프
+        static_cast<uint8_t>(Engine::Opcode::PUSH8), 50,      // 건너뛸 코드
+        static_cast<uint8_t>(Engine::Opcode::PUSH8), 100,     // 점프 목적지
+        static_cast<uint8_t>(Engine::Opcode::HALT)
+    };
+}
+
+// PUSH64 1000000, PUSH64 2000000, ADD, HALT
+inline std::vector<uint8_t> LargeNumbers()
+{
+    return {
+        static_cast<uint8_t>(Engine::Opcode::PUSH64), 0x40, 0x42, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, // 1000000
+        static_cast<uint8_t>(Engine::Opcode::PUSH64), 0x80, 0x84, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, // 2000000
+        static_cast<uint8_t>(Engine::Opcode::ADD),
+        static_cast<uint8_t>(Engine::Opcode::HALT)
+    };
+}
+
+// main:
+//   PUSH8 0x04 (func addr)
+//   CALL
+//   HALT
+// func:
+//   PUSH8 42
+//   RET 0
+inline std::vector<uint8_t> FunctionCall()
+{
+    return {
+        // main
+        static_cast<uint8_t>(Engine::Opcode::PUSH8), 0x04,      // 함수 주소 (0x04)
+        static_cast<uint8_t>(Engine::Opcode::CALL),             // CALL (반환 주소/이전 BP로 프레임 생성)
+        static_cast<uint8_t>(Engine::Opcode::HALT),             // HALT (리턴 후 종료)
+
+        // func (offset 0x04)
+        static_cast<uint8_t>(Engine::Opcode::PUSH8), 42,        // 결과 값 푸시
+        static_cast<uint8_t>(Engine::Opcode::RET), 0            // RET (결과만 남기고 프레임 제거, 인자 0개)
+    };
+}
+
+// PUSH16 n
+// loop: PUSH8 1, SUB, DUP, JNZ loop
+// HALT (결과: 0)
+// 분기/산술 비중이 높은 디스패치 측정용 루프
+inline std::vector<uint8_t> CountdownLoop(uint16_t count)
+{
+    return {
+        static_cast<uint8_t>(Engine::Opcode::PUSH16), static_cast<uint8_t>(count & 0xFF), static_cast<uint8_t>(count >> 8),
+        static_cast<uint8_t>(Engine::Opcode::PUSH8), 1,         // loop (offset 0x03)
+        static_cast<uint8_t>(Engine::Opcode::SUB),
+        static_cast<uint8_t>(Engine::Opcode::DUP),
+        static_cast<uint8_t>(Engine::Opcode::JNZ), 0xF9, 0xFF,  // -7 → loop
+        static_cast<uint8_t>(Engine::Opcode::HALT)
+    };
+}
+
+namespace Detail
+{
+
+inline void Emit(std::vector<uint8_t>& code, Engine::Opcode op)
+{
+    code.push_back(static_cast<uint8_t>(op));
+}
+
+inline void Emit(std::vector<uint8_t>& code, Engine::Opcode op, uint64_t operand, size_t operandSize)
+{
+    code.push_back(static_cast<uint8_t>(op));
+    for (size_t i = 0; i < operandSize; ++i)
+    {
+        code.push_back(static_cast<uint8_t>(operand >> (i * 8)));
+    }
+}
+
+} // namespace Detail
+
+// Opcodes.h의 모든 명령어를 한 번 이상 실행 (HOSTCALL/THREAD는 콘솔 출력 발생)
+// 결과: 43 + 0x1234 + 16 + 9 + 1 = 4729
+inline std::vector<uint8_t> AllOpcodes()
+{
+    using Engine::Opcode;
+    using Detail::Emit;
+    
+    std::vector<uint8_t> code;
+    
+    // 스택/산술/비트 연산: 7 + ((((258 - 32) * 3 / 5 % 100) & 0x0F | 0x10) ^ 1) << 2 >> 1 = 43
+    Emit(code, Opcode::PUSH8, 7, 1);
+    Emit(code, Opcode::PUSH16, 258, 2);
+    Emit(code, Opcode::PUSH32, 16, 4);
+    Emit(code, Opcode::PUSH64, 3, 8);
+    Emit(code, Opcode::POP);
+    Emit(code, Opcode::DUP);
+    Emit(code, Opcode::SWAP);
+    Emit(code, Opcode::ADD);
+    Emit(code, Opcode::SUB);
+    Emit(code, Opcode::PUSH8, 3, 1);
+    Emit(code, Opcode::MUL);
+    Emit(code, Opcode::PUSH8, 5, 1);
+    Emit(code, Opcode::DIV);
+    Emit(code, Opcode::PUSH8, 100, 1);
+    Emit(code, Opcode::MOD);
+    Emit(code, Opcode::PUSH8, 0x0F, 1);
+    Emit(code, Opcode::AND);
+    Emit(code, Opcode::PUSH8, 0x10, 1);
+    Emit(code, Opcode::OR);
+    Emit(code, Opcode::PUSH8, 0x01, 1);
+    Emit(code, Opcode::XOR);
+    Emit(code, Opcode::NOT);
+    Emit(code, Opcode::NOT);
+    Emit(code, Opcode::PUSH8, 2, 1);
+    Emit(code, Opcode::SHL);
+    Emit(code, Opcode::PUSH8, 1, 1);
+    Emit(code, Opcode::SHR);
+    Emit(code, Opcode::ADD);
+    
+    // 힙 세그먼트 오프셋 기준 LOAD/STORE 8~32, 가상 주소 기준 LOAD64/STORE64
+    Emit(code, Opcode::PUSH8, 0x10, 1);
+    Emit(code, Opcode::PUSH8, 0xAB, 1);
+    Emit(code, Opcode::STORE8);
+    Emit(code, Opcode::PUSH8, 0x10, 1);
+    Emit(code, Opcode::LOAD8);
+    Emit(code, Opcode::POP);
+    Emit(code, Opcode::PUSH8, 0x20, 1);
+    Emit(code, Opcode::PUSH16, 0x1234, 2);
+    Emit(code, Opcode::STORE16);
+    Emit(code, Opcode::PUSH8, 0x20, 1);
+    Emit(code, Opcode::LOAD16);
+    Emit(code, Opcode::ADD);
+    Emit(code, Opcode::PUSH8, 0x30, 1);
+    Emit(code, Opcode::PUSH32, 16, 4);
+    Emit(code, Opcode::STORE32);
+    Emit(code, Opcode::PUSH8, 0x30, 1);
+    Emit(code, Opcode::LOAD32);
+    Emit(code, Opcode::ADD);
+    Emit(code, Opcode::PUSH32, 0x200040, 4);
+    Emit(code, Opcode::PUSH8, 9, 1);
+    Emit(code, Opcode::STORE64);
+    Emit(code, Opcode::PUSH32, 0x200040, 4);
+    Emit(code, Opcode::LOAD64);
+    Emit(code, Opcode::ADD);
+    
+    // 분기: 조건이 맞으면 PUSH8 0xEE(2바이트)를 건너뜀
+    Emit(code, Opcode::JMP, 2, 2);
+    Emit(code, Opcode::PUSH8, 0xEE, 1);
+    Emit(code, Opcode::PUSH8, 0, 1);
+    Emit(code, Opcode::JZ, 2, 2);
+    Emit(code, Opcode::PUSH8, 0xEE, 1);
+    Emit(code, Opcode::PUSH8, 1, 1);
+    Emit(code, Opcode::JNZ, 2, 2);
+    Emit(code, Opcode::PUSH8, 0xEE, 1);
+    Emit(code, Opcode::PUSH8, 1, 1);
+    Emit(code, Opcode::JZ, 0, 2);                   // 분기하지 않음
+    Emit(code, Opcode::PUSH8, 5, 1);
+    Emit(code, Opcode::PUSH8, 3, 1);
+    Emit(code, Opcode::JG, 2, 2);
+    Emit(code, Opcode::PUSH8, 0xEE, 1);
+    Emit(code, Opcode::PUSH8, 3, 1);
+    Emit(code, Opcode::PUSH8, 5, 1);
+    Emit(code, Opcode::JL, 2, 2);
+    Emit(code, Opcode::PUSH8, 0xEE, 1);
+    Emit(code, Opcode::PUSH8, 5, 1);
+    Emit(code, Opcode::PUSH8, 5, 1);
+    Emit(code, Opcode::JGE, 2, 2);
+    Emit(code, Opcode::PUSH8, 0xEE, 1);
+    Emit(code, Opcode::PUSH8, 5, 1);
+    Emit(code, Opcode::PUSH8, 5, 1);
+    Emit(code, Opcode::JLE, 2, 2);
+    Emit(code, Opcode::PUSH8, 0xEE, 1);
+    
+    // 힙 할당/해제, 호스트 호출, 스레드 (스레드 ID 0은 버림)
+    Emit(code, Opcode::PUSH8, 16, 1);
+    Emit(code, Opcode::ALLOC);
+    Emit(code, Opcode::FREE);
+    Emit(code, Opcode::PUSH8, 'A', 1);
+    Emit(code, Opcode::HOSTCALL, 1, 1);
+    Emit(code, Opcode::PUSH8, 0, 1);
+    Emit(code, Opcode::PUSH8, 0, 1);
+    Emit(code, Opcode::THREAD);
+    Emit(code, Opcode::POP);
+    
+    // 함수 호출: 누산값을 인자로 넘기고 func은 지역 변수에 인자 + 1을 담아 반환
+    size_t callSite = code.size();
+    Emit(code, Opcode::PUSH16, 0, 2);               // func 주소 (아래에서 패치)
+    Emit(code, Opcode::CALL);
+    Emit(code, Opcode::HALT);
+    
+    size_t func = code.size();
+    code[callSite + 1] = static_cast<uint8_t>(func & 0xFF);
+    code[callSite + 2] = static_cast<uint8_t>(func >> 8);
+    Emit(code, Opcode::PUSH8, 0, 1);                // 지역 변수 0 자리
+    Emit(code, Opcode::LDARG, 0, 1);
+    Emit(code, Opcode::PUSH8, 1, 1);
+    Emit(code, Opcode::ADD);
+    Emit(code, Opcode::STLOC, 0, 1);
+    Emit(code, Opcode::LDLOC, 0, 1);
+    Emit(code, Opcode::RET, 1, 1);
+    
+    return code;
+}
+
+// sum = 0; i = n; do { sum += i; } while (--i != 0); return sum;
+// 변수는 힙 가상 주소(0x200000~)에 두고 BytecodeBuilder와 같은 패턴으로 접근
+// 슈퍼명령어 패턴(LOADVAR/STOREVAR/ADDI/SUBI/PUSH_JZ) 확인용 (결과: n * (n + 1) / 2)
+inline std::vector<uint8_t> SumLoop(uint16_t n)
+{
+    using Engine::Opcode;
+    using Detail::Emit;
+    
+    constexpr uint64_t sumAddress = 0x200000;
+    constexpr uint64_t counterAddress = 0x200008;
+    
+    std::vector<uint8_t> code;
+    
+    // sum = 0; i = n;
+    Emit(code, Opcode::PUSH8, 0, 1);
+    Emit(code, Opcode::PUSH32, sumAddress, 4);
+    Emit(code, Opcode::SWAP);
+    Emit(code, Opcode::STORE64);
+    Emit(code, Opcode::PUSH16, n, 2);
+    Emit(code, Opcode::PUSH32, counterAddress, 4);
+    Emit(code, Opcode::SWAP);
+    Emit(code, Opcode::STORE64);
+    
+    // loop: sum = sum + i;
+    size_t loop = code.size();
+    Emit(code, Opcode::PUSH32, sumAddress, 4);
+    Emit(code, Opcode::LOAD64);
+    Emit(code, Opcode::PUSH32, counterAddress, 4);
+    Emit(code, Opcode::LOAD64);
+    Emit(code, Opcode::ADD);
+    Emit(code, Opcode::PUSH32, sumAddress, 4);
+    Emit(code, Opcode::SWAP);
+    Emit(code, Opcode::STORE64);
+    
+    // i = i - 1; if (i != 0) goto loop;
+    Emit(code, Opcode::PUSH32, counterAddress, 4);
+    Emit(code, Opcode::LOAD64);
+    Emit(code, Opcode::PUSH8, 1, 1);
+    Emit(code, Opcode::SUB);
+    Emit(code, Opcode::DUP);
+    Emit(code, Opcode::PUSH32, counterAddress, 4);
+    Emit(code, Opcode::SWAP);
+    Emit(code, Opcode::STORE64);
+    int16_t back = static_cast<int16_t>(loop - (code.size() + 3));
+    Emit(code, Opcode::JNZ, static_cast<uint16_t>(back), 2);
+    
+    // 상수 조건 분기 (항상 건너뜀) 후 sum 반환
+    Emit(code, Opcode::PUSH8, 0, 1);
+    Emit(code, Opcode::JZ, 2, 2);
+    Emit(code, Opcode::PUSH8, 0xEE, 1);
+    Emit(code, Opcode::PUSH32, sumAddress, 4);
+    Emit(code, Opcode::LOAD64);
+    Emit(code, Opcode::HALT);
+    
+    return code;
+}
+
+namespace Detail
+{
+
+constexpr uint32_t kCopySource = 0x201000;       ///< 블록 복사 원본 (힙 가상 주소)
+constexpr uint32_t kCopyDestination = 0x210000;  ///< 블록 복사 대상
+
+// 원본 bytes 바이트를 0x5A로 채움
+inline void EmitCopyPrologue(std::vector<uint8_t>& code, uint32_t bytes)
+{
+    Emit(code, Engine::Opcode::PUSH32, kCopySource, 4);
+    Emit(code, Engine::Opcode::PUSH8, 0x5A, 1);
+    Emit(code, Engine::Opcode::PUSH32, bytes, 4);
+    Emit(code, Engine::Opcode::MEMSET);
+}
+
+// 결과: 대상 마지막 8바이트 + MEMCMP(원본, 대상)
+inline void EmitCopyEpilogue(std::vector<uint8_t>& code, uint32_t bytes)
+{
+    Emit(code, Engine::Opcode::PUSH32, kCopyDestination + bytes - 8, 4);
+    Emit(code, Engine::Opcode::LOAD64);
+    Emit(code, Engine::Opcode::PUSH32, kCopySource, 4);
+    Emit(code, Engine::Opcode::PUSH32, kCopyDestination, 4);
+    Emit(code, Engine::Opcode::PUSH32, bytes, 4);
+    Emit(code, Engine::Opcode::MEMCMP);
+    Emit(code, Engine::Opcode::ADD);
+    Emit(code, Engine::Opcode::HALT);
+}
+
+} // namespace Detail
+
+// 힙의 bytes 바이트(8의 배수)를 8바이트씩 LOAD64/STORE64로 복사
+// for (i = 0; i < bytes; i += 8) dst[i] = src[i];
+// 블록 복사 비교 기준 (결과: 0x5A5A5A5A5A5A5A5A)
+inline std::vector<uint8_t> ScalarCopyLoop(uint32_t bytes)
+{
+    using Engine::Opcode;
+    using Detail::Emit;
+    
+    std::vector<uint8_t> code;
+    Detail::EmitCopyPrologue(code, bytes);
+    
+    Emit(code, Opcode::PUSH8, 0, 1);                        // i
+    Emit(code, Opcode::DUP);                                // loop: [i, i, i]
+    Emit(code, Opcode::DUP);
+    Emit(code, Opcode::PUSH32, Detail::kCopyDestination, 4);
+    Emit(code, Opcode::ADD);                                // [i, i, dst + i]
+    Emit(code, Opcode::SWAP);
+    Emit(code, Opcode::PUSH32, Detail::kCopySource, 4);
+    Emit(code, Opcode::ADD);
+    Emit(code, Opcode::LOAD64);                             // [i, dst + i, src[i]]
+    Emit(code, Opcode::STORE64);
+    Emit(code, Opcode::PUSH8, 8, 1);
+    Emit(code, Opcode::ADD);
+    Emit(code, Opcode::DUP);
+    Emit(code, Opcode::PUSH32, bytes, 4);
+    Emit(code, Opcode::JL, static_cast<uint16_t>(-29), 2);  // i < bytes → loop
+    Emit(code, Opcode::POP);
+    
+    Detail::EmitCopyEpilogue(code, bytes);
+    return code;
+}
+
+// ScalarCopyLoop과 같은 복사를 MEMCPY 한 번으로 (결과: 0x5A5A5A5A5A5A5A5A)
+inline std::vector<uint8_t> BulkCopy(uint32_t bytes)
+{
+    using Engine::Opcode;
+    using Detail::Emit;
+    
+    std::vector<uint8_t> code;
+    Detail::EmitCopyPrologue(code, bytes);
+    
+    Emit(code, Opcode::PUSH32, Detail::kCopyDestination, 4);
+    Emit(code, Opcode::PUSH32, Detail::kCopySource, 4);
+    Emit(code, Opcode::PUSH32, bytes, 4);
+    Emit(code, Opcode::MEMCPY);
+    
+    Detail::EmitCopyEpilogue(code, bytes);
+    return code;
+}
+
+// SumLoop과 같은 루프를 함수 안에서 지역 변수(LDLOC/STLOC)로
+// main: sum(n) 호출 / sum: 지역 변수 0 = 합, 1 = 카운터 (결과: n * (n + 1) / 2)
+inline std::vector<uint8_t> FrameSumLoop(uint16_t n)
+{
+    using Engine::Opcode;
+    using Detail::Emit;
+    
+    std::vector<uint8_t> code;
+    Emit(code, Opcode::PUSH16, n, 2);
+    Emit(code, Opcode::PUSH8, 7, 1);                        // sum 주소 (0x07)
+    Emit(code, Opcode::CALL);
+    Emit(code, Opcode::HALT);
+    
+    // sum = 0; i = n;
+    Emit(code, Opcode::PUSH8, 0, 1);
+    Emit(code, Opcode::LDARG, 0, 1);
+    
+    // loop: sum = sum + i;
+    size_t loop = code.size();
+    Emit(code, Opcode::LDLOC, 0, 1);
+    Emit(code, Opcode::LDLOC, 1, 1);
+    Emit(code, Opcode::ADD);
+    Emit(code, Opcode::STLOC, 0, 1);
+    
+    // i = i - 1; if (i != 0) goto loop;
+    Emit(code, Opcode::LDLOC, 1, 1);
+    Emit(code, Opcode::PUSH8, 1, 1);
+    Emit(code, Opcode::SUB);
+    Emit(code, Opcode::DUP);
+    Emit(code, Opcode::STLOC, 1, 1);
+    int16_t back = static_cast<int16_t>(loop - (code.size() + 3));
+    Emit(code, Opcode::JNZ, static_cast<uint16_t>(back), 2);
+    
+    Emit(code, Opcode::LDLOC, 0, 1);
+    Emit(code, Opcode::RET, 1, 1);
+    
+    return code;
+}
+
+// int sum(int n) { if (n == 0) return 0; return sum(n - 1) + n; }
+// 호출마다 VM 스택에 인자, 호출 스택에 반환 주소와 이전 BP를 쌓는 재귀 (결과: n * (n + 1) / 2)
+// suspendAtBase: 가장 깊은 곳(n == 0)에서 HALT로 멈춤, 그 다음 명령어부터 다시 실행하면 계속 진행
+inline std::vector<uint8_t> RecursiveSum(uint16_t n, bool suspendAtBase = false)
+{
+    using Engine::Opcode;
+    using Detail::Emit;
+    
+    std::vector<uint8_t> code;
+    Emit(code, Opcode::PUSH16, n, 2);
+    Emit(code, Opcode::PUSH8, 7, 1);                        // sum 주소 (0x07)
+    Emit(code, Opcode::CALL);
+    Emit(code, Opcode::HALT);
+    
+    size_t sum = code.size();
+    Emit(code, Opcode::LDARG, 0, 1);
+    Emit(code, Opcode::JZ, 13, 2);                          // n == 0 → base
+    Emit(code, Opcode::LDARG, 0, 1);
+    Emit(code, Opcode::PUSH8, 1, 1);
+    Emit(code, Opcode::SUB);
+    Emit(code, Opcode::PUSH8, sum, 1);
+    Emit(code, Opcode::CALL);
+    Emit(code, Opcode::LDARG, 0, 1);
+    Emit(code, Opcode::ADD);
+    Emit(code, Opcode::RET, 1, 1);
+    if (suspendAtBase) 
+    {
+        Emit(code, Opcode::PUSH8, 0, 1);                    // base: 반환 값 0으로 멈춤
+        Emit(code, Opcode::HALT);
+    }
+    Emit(code, Opcode::PUSH8, 0, 1);                        // base:
+    Emit(code, Opcode::RET, 1, 1);
+    
+    return code;
+}
+
+// int sum(int n, int acc) { if (n == 0) return acc; return sum(n - 1, acc + n); }
+// tailCall: 재귀 호출을 TAILCALL로 (현재 프레임 재사용), 아니면 CALL 후 RET 2 (결과: n * (n + 1) / 2)
+inline std::vector<uint8_t> TailRecursiveSum(uint32_t n, bool tailCall)
+{
+    using Engine::Opcode;
+    using Detail::Emit;
+    
+    std::vector<uint8_t> code;
+    Emit(code, Opcode::PUSH8, 0, 1);                        // acc
+    Emit(code, Opcode::PUSH32, n, 4);                       // n
+    Emit(code, Opcode::PUSH8, 11, 1);                       // sum 주소 (0x0B)
+    Emit(code, Opcode::CALL);
+    Emit(code, Opcode::HALT);
+    
+    size_t sum = code.size();
+    Emit(code, Opcode::LDARG, 0, 1);
+    Emit(code, Opcode::JZ, 15, 2);                          // n == 0 → base
+    Emit(code, Opcode::LDARG, 1, 1);
+    Emit(code, Opcode::LDARG, 0, 1);
+    Emit(code, Opcode::ADD);                                // acc + n
+    Emit(code, Opcode::LDARG, 0, 1);
+    Emit(code, Opcode::PUSH8, 1, 1);
+    Emit(code, Opcode::SUB);                                // n - 1
+    Emit(code, Opcode::PUSH8, sum, 1);
+    if (tailCall) 
+    {
+        Emit(code, Opcode::TAILCALL, 0x0202, 2);            // 새 인자 2개, 현재 인자 2개
+    }
+    else 
+    {
+        Emit(code, Opcode::CALL);
+        Emit(code, Opcode::RET, 2, 1);
+    }
+    Emit(code, Opcode::LDARG, 1, 1);                        // base:
+    Emit(code, Opcode::RET, 2, 1);
+    
+    return code;
+}
+
+// JMP +1로 PUSH8 오퍼랜드 바이트(0x01 = PUSH8) 위치에 착지
+// 명령어 경계가 아닌 곳으로의 분기 처리 확인용 (결과: 42)
+inline std::vector<uint8_t> MisalignedJump()
+{
+    return {
+        static_cast<uint8_t>(Engine::Opcode::JMP), 0x01, 0x00,
+        static_cast<uint8_t>(Engine::Opcode::PUSH8),
+        static_cast<uint8_t>(Engine::Opcode::PUSH8),            // 점프 목적지
+        42,
+        static_cast<uint8_t>(Engine::Opcode::HALT)
+    };
+}
+
+/**
+ * @brief 정상 종료하는 Engine 테스트 프로그램 전체 목록
+ *
+ * @return std::vector<EngineProgram> 프로그램 목록
+ */
+inline std::vector<EngineProgram> All()
+{
+    return {
+        {"BasicArithmetic", BasicArithmetic(), 55},
+        {"StackOperations", StackOperations(), 5},
+        {"MemoryOperations", MemoryOperations(), 123},
+        {"ControlFlow", ControlFlow(), 100},
+        {"LargeNumbers", LargeNumbers(), 3000000},
+        {"FunctionCall", FunctionCall(), 42}
+    };
+}
+
+} // namespace Programs
+} // namespace Tests
+} // namespace DarkMatterVM
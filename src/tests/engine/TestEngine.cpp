@@ -1,6 +1,20 @@
 #include "TestEngine.h"
+#include "EnginePrograms.h"
+#include "../../engine/decoder/OpcodeNgramMiner.h"
+#include "../../engine/StackCache.h"
+#include "../../engine/pool/InterpreterPool.h"
+#include "../../engine/register/StackToRegisterTranslator.h"
+#include "../../engine/register/RegisterInterpreter.h"
+#include "../../memory/ArenaMemory.h"
+#include "../../memory/HeapMemory.h"
+#include "../../memory/MemorySnapshot.h"
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <sstream>
+#include <thread>
 
 namespace DarkMatterVM 
 {
@@ -27,7 +41,31 @@ bool TestEngine::RunAllTests()
         {"오류 처리", [this]() { return TestErrorHandling(); }},
         {"메모리 세그먼트", [this]() { return TestMemorySegments(); }},
         {"인터프리터 상태", [this]() { return TestInterpreterState(); }},
-        {"함수 호출", [this]() { return TestFunctionCall(); }}
+        {"함수 호출", [this]() { return TestFunctionCall(); }},
+        {"실행 모드 일치", [this]() { return TestExecutionModes(); }},
+        {"명령어 스트림", [this]() { return TestInstructionStream(); }},
+        {"슈퍼명령어", [this]() { return TestSuperinstructions(); }},
+        {"스택 캐시", [this]() { return TestStackCache(); }},
+        {"레지스터 VM", [this]() { return TestRegisterVM(); }},
+        {"JIT", [this]() { return TestJit(); }},
+        {"계층 실행", [this]() { return TestTieredExecution(); }},
+        {"일괄 실행", [this]() { return TestBatchExecution(); }},
+        {"SIMD 레인 실행", [this]() { return TestLaneExecution(); }},
+        {"바이트코드 검증", [this]() { return TestVerifier(); }},
+        {"인터프리터 풀", [this]() { return TestInterpreterPool(); }},
+        {"mmap 세그먼트", [this]() { return TestMappedSegments(); }},
+        {"가드 페이지 스택", [this]() { return TestStackGuard(); }},
+        {"주소 공간", [this]() { return TestAddressSpace(); }},
+        {"힙 할당기", [this]() { return TestHeapAllocator(); }},
+        {"힙 확장", [this]() { return TestHeapGrowth(); }},
+        {"아레나 할당기", [this]() { return TestArenaAllocator(); }},
+        {"추적 로그", [this]() { return TestTraceGating(); }},
+        {"스택 소유 스레드", [this]() { return TestStackOwnership(); }},
+        {"스냅샷", [this]() { return TestSnapshot(); }},
+        {"블록 메모리 연산", [this]() { return TestBulkMemory(); }},
+        {"스택 프레임", [this]() { return TestStackFrames(); }},
+        {"호출 스택", [this]() { return TestCallStack(); }},
+        {"꼬리 호출", [this]() { return TestTailCall(); }}
     };
     
     for (const auto& test : tests) 
@@ -63,6 +101,30 @@ bool TestEngine::RunTest(const std::string& testName)
     if (testName == "메모리 세그먼트") return TestMemorySegments();
     if (testName == "인터프리터 상태") return TestInterpreterState();
     if (testName == "함수 호출") return TestFunctionCall();
+    if (testName == "실행 모드 일치") return TestExecutionModes();
+    if (testName == "명령어 스트림") return TestInstructionStream();
+    if (testName == "슈퍼명령어") return TestSuperinstructions();
+    if (testName == "스택 캐시") return TestStackCache();
+    if (testName == "레지스터 VM") return TestRegisterVM();
+    if (testName == "JIT") return TestJit();
+    if (testName == "계층 실행") return TestTieredExecution();
+    if (testName == "일괄 실행") return TestBatchExecution();
+    if (testName == "SIMD 레인 실행") return TestLaneExecution();
+    if (testName == "바이트코드 검증") return TestVerifier();
+    if (testName == "인터프리터 풀") return TestInterpreterPool();
+    if (testName == "mmap 세그먼트") return TestMappedSegments();
+    if (testName == "가드 페이지 스택") return TestStackGuard();
+    if (testName == "주소 공간") return TestAddressSpace();
+    if (testName == "힙 할당기") return TestHeapAllocator();
+    if (testName == "힙 확장") return TestHeapGrowth();
+    if (testName == "아레나 할당기") return TestArenaAllocator();
+    if (testName == "추적 로그") return TestTraceGating();
+    if (testName == "스택 소유 스레드") return TestStackOwnership();
+    if (testName == "스냅샷") return TestSnapshot();
+    if (testName == "블록 메모리 연산") return TestBulkMemory();
+    if (testName == "스택 프레임") return TestStackFrames();
+    if (testName == "호출 스택") return TestCallStack();
+    if (testName == "꼬리 호출") return TestTailCall();
     
     std::cout << "알 수 없는 테스트: " << testName << std::endl;
     return false;
@@ -92,74 +154,27 @@ void TestEngine::PrintResults() const
 // 테스트 케이스 구현들
 bool TestEngine::TestBasicArithmetic() 
 {
-    // PUSH8 42, PUSH8 13, ADD, HALT
-    std::vector<uint8_t> bytecode = {
-        static_cast<uint8_t>(Engine::Opcode::PUSH8), 42,
-        static_cast<uint8_t>(Engine::Opcode::PUSH8), 13,
-        static_cast<uint8_t>(Engine::Opcode::ADD),
-        static_cast<uint8_t>(Engine::Opcode::HALT)
-    };
-    
-    return ExecuteBytecode(bytecode, 55);
+    return ExecuteBytecode(Programs::BasicArithmetic(), 55);
 }
 
 bool TestEngine::TestStackOperations() 
 {
-    // PUSH8 1, PUSH8 2, DUP, ADD, HALT (결과: 1 + 2 + 2 = 5)
-    std::vector<uint8_t> bytecode = {
-        static_cast<uint8_t>(Engine::Opcode::PUSH8), 1,
-        static_cast<uint8_t>(Engine::Opcode::PUSH8), 2,
-        static_cast<uint8_t>(Engine::Opcode::DUP),
-        static_cast<uint8_t>(Engine::Opcode::ADD),
-        static_cast<uint8_t>(Engine::Opcode::HALT)
-    };
-    
-    return ExecuteBytecode(bytecode, 5);
+    return ExecuteBytecode(Programs::StackOperations(), 5);
 }
 
 bool TestEngine::TestMemoryOperations() 
 {
-    // PUSH64 8, ALLOC, DUP, PUSH64 123, STORE64, LOAD64, HALT
-    std::vector<uint8_t> bytecode = {
-        static_cast<uint8_t>(Engine::Opcode::PUSH64), 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        static_cast<uint8_t>(Engine::Opcode::ALLOC),
-        static_cast<uint8_t>(Engine::Opcode::DUP),
-        static_cast<uint8_t>(Engine::Opcode::PUSH64), 0x7B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        static_cast<uint8_t>(Engine::Opcode::STORE64),
-        static_cast<uint8_t>(Engine::Opcode::LOAD64),
-        static_cast<uint8_t>(Engine::Opcode::HALT)
-    };
-    
-    return ExecuteBytecode(bytecode, 123);
+    return ExecuteBytecode(Programs::MemoryOperations(), 123);
 }
 
 bool TestEngine::TestControlFlow() 
 {
-    // PUSH8 10, PUSH8 5, JG, PUSH8 100, HALT
-    // 10 > 5 이므로 점프하여 100을 푸시
-    std::vector<uint8_t> bytecode = {
-        static_cast<uint8_t>(Engine::Opcode::PUSH8), 10,
-        static_cast<uint8_t>(Engine::Opcode::PUSH8), 5,
-        static_cast<uint8_t>(Engine::Opcode::JG), 0x02, 0x00, // 2바이트 점프
-        static_cast<uint8_t>(Engine::Opcode::PUSH8), 50,      // 건너뛸 코드
-        static_cast<uint8_t>(Engine::Opcode::PUSH8), 100,     // 점프 목적지
-        static_cast<uint8_t>(Engine::Opcode::HALT)
-    };
-    
-    return ExecuteBytecode(bytecode, 100);
+    return ExecuteBytecode(Programs::ControlFlow(), 100);
 }
 
 bool TestEngine::TestLargeNumbers() 
 {
-    // PUSH64 1000000, PUSH64 2000000, ADD, HALT
-    std::vector<uint8_t> bytecode = {
-        static_cast<uint8_t>(Engine::Opcode::PUSH64), 0x40, 0x42, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, // 1000000
-        static_cast<uint8_t>(Engine::Opcode::PUSH64), 0x80, 0x84, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, // 2000000
-        static_cast<uint8_t>(Engine::Opcode::ADD),
-        static_cast<uint8_t>(Engine::Opcode::HALT)
-    };
-    
-    return ExecuteBytecode(bytecode, 3000000);
+    return ExecuteBytecode(Programs::LargeNumbers(), 3000000);
 }
 
 bool TestEngine::TestErrorHandling() 
@@ -251,28 +266,226 @@ bool TestEngine::TestInterpreterState()
     return true;
 }
 
-bool TestEngine::TestFunctionCall()
+bool TestEngine::TestFunctionCall() 
 {
-    // main:
-    //   PUSH8 0x04 (func addr)
-    //   CALL
-    //   HALT
-    // func:
-    //   PUSH8 42
-    //   RET
-    std::vector<uint8_t> bytecode = {
-        // main
-        static_cast<uint8_t>(Engine::Opcode::PUSH8), 0x04,      // 함수 주소 (0x04)
-        static_cast<uint8_t>(Engine::Opcode::CALL),             // CALL
-        static_cast<uint8_t>(Engine::Opcode::HALT),             // HALT (리턴 후 종료)
+    return ExecuteBytecode(Programs::FunctionCall(), 42);
+}
 
-        // func (offset 0x06)
-        static_cast<uint8_t>(Engine::Opcode::PUSH8), 42,        // 결과 값 푸시
-        static_cast<uint8_t>(Engine::Opcode::SWAP),             // returnIP <-> result 스왑
-        static_cast<uint8_t>(Engine::Opcode::RET)               // RET (returnIP pop)
+bool TestEngine::TestExecutionModes() 
+{
+    // 모든 프로그램을 실행 모드별로 실행하여 결과 코드, 반환값, 종료 시 스택 포인터 비교
+    auto programs = Programs::All();
+    programs.push_back({"CountdownLoop", Programs::CountdownLoop(50), 0});
+    programs.push_back({"AllOpcodes", Programs::AllOpcodes(), 4729});
+    programs.push_back({"MisalignedJump", Programs::MisalignedJump(), 42});
+    programs.push_back({"SumLoop", Programs::SumLoop(10), 55});
+    programs.push_back({"DivideByZero", {
+        static_cast<uint8_t>(Engine::Opcode::PUSH8), 1,
+        static_cast<uint8_t>(Engine::Opcode::PUSH8), 0,
+        static_cast<uint8_t>(Engine::Opcode::DIV),
+        static_cast<uint8_t>(Engine::Opcode::HALT)
+    }, 0});
+    programs.push_back({"LoadFault", {
+        static_cast<uint8_t>(Engine::Opcode::PUSH8), 7,
+        static_cast<uint8_t>(Engine::Opcode::PUSH32), 0xF0, 0xFF, 0xFF, 0xFF,
+        static_cast<uint8_t>(Engine::Opcode::LOAD64),
+        static_cast<uint8_t>(Engine::Opcode::HALT)
+    }, 0});
+    programs.push_back({"InvalidOpcode", {
+        static_cast<uint8_t>(Engine::Opcode::PUSH8), 1,
+        0xEE
+    }, 0});
+    // ARENA_BEGIN 없이 ARENA_ALLOC: 할당 오류 후 크기 오퍼랜드가 꺼내진 스택 포인터
+    programs.push_back({"ArenaAllocFault", {
+        static_cast<uint8_t>(Engine::Opcode::PUSH8), 1,
+        static_cast<uint8_t>(Engine::Opcode::PUSH8), 16,
+        static_cast<uint8_t>(Engine::Opcode::ARENA_ALLOC),
+        static_cast<uint8_t>(Engine::Opcode::HALT)
+    }, 0});
+    
+    // 기준: 슈퍼명령어 없는 Portable
+    struct ModeConfig 
+    {
+        const char* name;
+        Engine::ExecutionMode mode;
+        bool superinstructions;
+        bool verification = true;
+        bool stackGuard = true;
+    };
+    const ModeConfig configs[] = {
+        {"Portable", Engine::ExecutionMode::Portable, false, false, false},
+        {"Portable+Verified", Engine::ExecutionMode::Portable, false, true, false},
+        {"Portable+Guarded", Engine::ExecutionMode::Portable, false, false, true},
+        {"Portable+Fused", Engine::ExecutionMode::Portable, true},
+        {"Threaded", Engine::ExecutionMode::Threaded, false},
+        {"Threaded+Fused", Engine::ExecutionMode::Threaded, true},
+        {"StackCached", Engine::ExecutionMode::StackCached, false},
+        {"StackCached+Fused", Engine::ExecutionMode::StackCached, true},
+        {"Jit", Engine::ExecutionMode::Jit, false},
+        {"Tiered", Engine::ExecutionMode::Tiered, false}
     };
+    
+    for (const auto& program : programs) 
+    {
+        int referenceCode = 0;
+        uint64_t referenceValue = 0;
+        size_t referenceStackPointer = 0;
+        
+        for (const auto& config : configs) 
+        {
+            Engine::Interpreter interpreter;
+            interpreter.SetExecutionMode(config.mode);
+            interpreter.SetSuperinstructionsEnabled(config.superinstructions);
+            interpreter.SetVerificationEnabled(config.verification);
+            interpreter.SetStackGuardEnabled(config.stackGuard);
+            interpreter.LoadBytecode(program.bytecode.data(), program.bytecode.size());
+            int resultCode = interpreter.Execute();
+            
+            if (&config == &configs[0]) 
+            {
+                referenceCode = resultCode;
+                referenceValue = interpreter.GetReturnValue();
+                referenceStackPointer = interpreter.GetStackPointer();
+            }
+            else if (resultCode != referenceCode || interpreter.GetReturnValue() != referenceValue) 
+            {
+                LogTestResult("실행 모드 일치", false, program.name + ": Portable=" + std::to_string(referenceValue) + 
+                              "(" + std::to_string(referenceCode) + "), " + config.name + "=" + 
+                              std::to_string(interpreter.GetReturnValue()) + "(" + std::to_string(resultCode) + ")");
+                return false;
+            }
+            else if (interpreter.GetStackPointer() != referenceStackPointer) 
+            {
+                LogTestResult("실행 모드 일치", false, program.name + ": 스택 포인터 불일치 (" + config.name + "=" + 
+                              std::to_string(interpreter.GetStackPointer()) + ", 기준=" + std::to_string(referenceStackPointer) + ")");
+                return false;
+            }
+        }
+    }
+    
+    // 전체 opcode 프로그램은 기대값까지 확인
+    Engine::Interpreter interpreter;
+    auto allOpcodes = Programs::AllOpcodes();
+    interpreter.LoadBytecode(allOpcodes.data(), allOpcodes.size());
+    interpreter.Execute();
+    if (interpreter.GetReturnValue() != 4729) 
+    {
+        LogTestResult("실행 모드 일치", false, "AllOpcodes 결과 오류: " + std::to_string(interpreter.GetReturnValue()));
+        return false;
+    }
+    
+    LogTestResult("실행 모드 일치", true, Engine::Interpreter::IsThreadedDispatchSupported() ? 
+                  "Portable/Verified/Threaded/StackCached/Jit/Tiered 결과 일치" : "Threaded 미지원 빌드 (Portable로 대체)");
+    return true;
+}
+
+bool TestEngine::TestInstructionStream() 
+{
+    // CountdownLoop: PUSH16 n | PUSH8 1 | SUB | DUP | JNZ loop | HALT
+    auto bytecode = Programs::CountdownLoop(10);
+    
+    Engine::InstructionStream stream;
+    stream.Decode(bytecode.data(), bytecode.size());
+    
+    // 명령어 6개 + 코드 끝 EXIT 1개
+    if (stream.GetCount() != 7) 
+    {
+        LogTestResult("명령어 스트림", false, "명령어 개수 오류: " + std::to_string(stream.GetCount()));
+        return false;
+    }
+    
+    // JNZ(인덱스 4)의 즉시값은 절대 오프셋 3, 목적지는 PUSH8(인덱스 1)
+    if (stream.GetOpcodes()[4] != static_cast<uint8_t>(Engine::Opcode::JNZ) || 
+        stream.GetImmediates()[4] != 3 || stream.GetTargets()[4] != 1) 
+    {
+        LogTestResult("명령어 스트림", false, "분기 목적지 변환 오류");
+        return false;
+    }
+    
+    // 즉시값 확장과 명령어 경계 맵
+    if (stream.GetImmediates()[0] != 10 || stream.GetIndex(3) != 1 || 
+        stream.GetIndex(4) != Engine::InstructionStream::kNoIndex) 
+    {
+        LogTestResult("명령어 스트림", false, "즉시값 또는 오프셋 맵 오류");
+        return false;
+    }
+    
+    // 명령어 중간으로의 분기는 EXIT 항목으로 연결
+    auto misaligned = Programs::MisalignedJump();
+    stream.Decode(misaligned.data(), misaligned.size());
+    uint32_t exitIndex = stream.GetTargets()[0];
+    if (stream.GetOpcodes()[exitIndex] != Engine::InstructionStream::kExitOpcode || stream.GetImmediates()[exitIndex] != 4) 
+    {
+        LogTestResult("명령어 스트림", false, "경계 밖 분기 처리 오류");
+        return false;
+    }
+    
+    LogTestResult("명령어 스트림", true, "디코딩 및 분기 목적지 변환 정상");
+    return true;
+}
 
-    return ExecuteBytecode(bytecode, 42);
+bool TestEngine::TestSuperinstructions() 
+{
+    using Engine::FusedOpcode;
+    
+    auto bytecode = Programs::SumLoop(10);
+    
+    Engine::InstructionStream stream;
+    stream.Decode(bytecode.data(), bytecode.size());
+    const uint8_t* opcodes = stream.GetOpcodes();
+    
+    // SumLoop 명령어 인덱스별 기대 슈퍼명령어 (묶음 뒤쪽 명령어는 원래 opcode 유지)
+    const std::pair<size_t, FusedOpcode> expected[] = {
+        {1, FusedOpcode::STOREVAR},     // PUSH32 sum; SWAP; STORE64
+        {5, FusedOpcode::STOREVAR},     // PUSH32 i; SWAP; STORE64
+        {8, FusedOpcode::LOADVAR},      // PUSH32 sum; LOAD64
+        {10, FusedOpcode::LOADVAR},     // PUSH32 i; LOAD64
+        {13, FusedOpcode::STOREVAR},
+        {16, FusedOpcode::LOADVAR},
+        {18, FusedOpcode::SUBI},        // PUSH8 1; SUB
+        {21, FusedOpcode::STOREVAR},
+        {25, FusedOpcode::PUSH_JZ},     // PUSH8 0; JZ
+        {28, FusedOpcode::LOADVAR}
+    };
+    
+    for (const auto& [index, op] : expected) 
+    {
+        if (opcodes[index] != static_cast<uint8_t>(op)) 
+        {
+            LogTestResult("슈퍼명령어", false, "인덱스 " + std::to_string(index) + " 합치기 실패: 0x" + std::to_string(opcodes[index]));
+            return false;
+        }
+    }
+    
+    // 묶음 뒤쪽 명령어는 그대로, JNZ(인덱스 24)의 목적지는 루프 시작(인덱스 8)
+    if (opcodes[9] != static_cast<uint8_t>(Engine::Opcode::LOAD64) || stream.GetTargets()[24] != 8) 
+    {
+        LogTestResult("슈퍼명령어", false, "묶음 뒤쪽 명령어 또는 분기 목적지 오류");
+        return false;
+    }
+    
+    // DUP; JNZ는 CountdownLoop에서 합쳐짐
+    auto countdown = Programs::CountdownLoop(10);
+    stream.Decode(countdown.data(), countdown.size());
+    if (stream.GetOpcodes()[3] != static_cast<uint8_t>(FusedOpcode::DUP_JNZ) || stream.GetTargets()[3] != 1) 
+    {
+        LogTestResult("슈퍼명령어", false, "DUP_JNZ 합치기 실패");
+        return false;
+    }
+    
+    // n-gram 마이닝: SumLoop에서 가장 많은 2-gram은 PUSHn LOAD64 / PUSHn SWAP (각 4회)
+    Engine::OpcodeNgramMiner miner;
+    miner.AddProgram(bytecode.data(), bytecode.size());
+    auto top = miner.GetTop(2, 2);
+    if (top.size() != 2 || top[0].count != 4 || top[1].count != 4 || 
+        top[0].ToString() != "PUSHn SWAP" || top[1].ToString() != "PUSHn LOAD64") 
+    {
+        LogTestResult("슈퍼명령어", false, "n-gram 마이닝 결과 오류: " + miner.FormatReport(2, 2, 2));
+        return false;
+    }
+    
+    LogTestResult("슈퍼명령어", true, "패턴 합치기 및 n-gram 마이닝 정상");
+    return true;
 }
 
 // 헬퍼 메서드 구현들
@@ -326,5 +539,2031 @@ void TestEngine::LogTestResult(const std::string& testName, bool passed, const s
     }
 }
 
+bool TestEngine::TestStackCache() 
+{
+    Memory::MemoryManager memoryManager(1024, 1024, 1024);
+    auto& stackSegment = memoryManager.GetSegment(Memory::MemorySegmentType::STACK);
+    memoryManager.SetStackPointer(stackSegment.GetSize());
+    const size_t emptyStackPointer = memoryManager.GetStackPointer();
+    
+    Engine::StackCache cache(memoryManager);
+    
+    // 두 슬롯까지는 VM 스택에 쓰지 않음
+    cache.Push(1);
+    cache.Push(2);
+    if (cache.GetCachedCount() != 2 || memoryManager.GetStackPointer() != emptyStackPointer) 
+    {
+        LogTestResult("스택 캐시", false, "두 슬롯 푸시 중 VM 스택에 기록됨");
+        return false;
+    }
+    
+    // 세 번째 푸시는 가장 아래 캐시 슬롯만 내려 씀
+    cache.Push(3);
+    if (memoryManager.GetStackPointer() != emptyStackPointer - 8 || memoryManager.PeekStack() != 1) 
+    {
+        LogTestResult("스택 캐시", false, "세 번째 푸시 시 내려 쓴 값 오류");
+        return false;
+    }
+    
+    // 이항 연산은 캐시 안에서 처리
+    uint64_t b = cache.Pop();
+    cache.Top() += b;
+    if (cache.GetCachedCount() != 1 || cache.Top() != 5) 
+    {
+        LogTestResult("스택 캐시", false, "캐시 안 이항 연산 결과 오류: " + std::to_string(cache.Top()));
+        return false;
+    }
+    
+    // Flush 후 VM 스택 순서: 1 | 5 (최상위)
+    cache.Flush();
+    if (cache.GetCachedCount() != 0 || memoryManager.PopStack() != 5 || memoryManager.PopStack() != 1 || 
+        memoryManager.GetStackPointer() != emptyStackPointer) 
+    {
+        LogTestResult("스택 캐시", false, "Flush 후 VM 스택 순서 오류");
+        return false;
+    }
+    
+    // 캐시가 비면 VM 스택에서 채움
+    memoryManager.PushStack(7);
+    if (cache.Top() != 7 || memoryManager.GetStackPointer() != emptyStackPointer) 
+    {
+        LogTestResult("스택 캐시", false, "빈 캐시 Top() 채우기 오류");
+        return false;
+    }
+    
+    LogTestResult("스택 캐시", true, "푸시/팝/Flush 순서 정상");
+    return true;
+}
+
+bool TestEngine::TestRegisterVM() 
+{
+    // 변환 가능한 프로그램은 스택 인터프리터와 결과 코드, 반환값이 같아야 함
+    auto programs = Programs::All();
+    programs.push_back({"CountdownLoop", Programs::CountdownLoop(50), 0});
+    programs.push_back({"SumLoop", Programs::SumLoop(10), 55});
+    programs.push_back({"DivideByZero", {
+        static_cast<uint8_t>(Engine::Opcode::PUSH8), 1,
+        static_cast<uint8_t>(Engine::Opcode::PUSH8), 0,
+        static_cast<uint8_t>(Engine::Opcode::DIV),
+        static_cast<uint8_t>(Engine::Opcode::HALT)
+    }, 0});
+    
+    const std::string mustTranslate[] = {"BasicArithmetic", "ControlFlow", "LargeNumbers", "CountdownLoop", "SumLoop", "DivideByZero"};
+    
+    Engine::StackToRegisterTranslator translator;
+    for (const auto& program : programs) 
+    {
+        Engine::RegisterModule module;
+        if (!translator.Translate(program.bytecode.data(), program.bytecode.size(), module)) 
+        {
+            if (std::find(std::begin(mustTranslate), std::end(mustTranslate), program.name) != std::end(mustTranslate)) 
+            {
+                LogTestResult("레지스터 VM", false, program.name + " 변환 실패: " + translator.GetLastError());
+                return false;
+            }
+            continue;
+        }
+        
+        Engine::Interpreter stackInterpreter;
+        stackInterpreter.SetExecutionMode(Engine::ExecutionMode::Portable);
+        stackInterpreter.LoadBytecode(program.bytecode.data(), program.bytecode.size());
+        int stackCode = stackInterpreter.Execute();
+        
+        Engine::RegisterInterpreter registerInterpreter;
+        registerInterpreter.LoadModule(module);
+        int registerCode = registerInterpreter.Execute();
+        
+        if (stackCode != registerCode || stackInterpreter.GetReturnValue() != registerInterpreter.GetReturnValue()) 
+        {
+            LogTestResult("레지스터 VM", false, program.name + ": 스택=" + std::to_string(stackInterpreter.GetReturnValue()) + 
+                          "(" + std::to_string(stackCode) + "), 레지스터=" + std::to_string(registerInterpreter.GetReturnValue()) + 
+                          "(" + std::to_string(registerCode) + ")\n" + module.Disassemble());
+            return false;
+        }
+    }
+    
+    // 동적 목적지(CALL/RET)를 쓰는 모듈은 스택 ISA로 남음
+    Engine::RegisterModule module;
+    auto functionCall = Programs::FunctionCall();
+    if (translator.Translate(functionCall.data(), functionCall.size(), module)) 
+    {
+        LogTestResult("레지스터 VM", false, "CALL 포함 모듈이 변환됨");
+        return false;
+    }
+    
+    // PUSH/DUP/SWAP/POP이 사라지므로 명령어 수가 줄어야 함
+    auto sumLoop = Programs::SumLoop(10);
+    if (!translator.Translate(sumLoop.data(), sumLoop.size(), module) || 
+        module.code.size() >= translator.GetStackInstructionCount()) 
+    {
+        LogTestResult("레지스터 VM", false, "SumLoop 명령어 수가 줄지 않음: 레지스터=" + std::to_string(module.code.size()) + 
+                      ", 스택=" + std::to_string(translator.GetStackInstructionCount()));
+        return false;
+    }
+    
+    // 직렬화 왕복 및 손상된 모듈 거부
+    auto serialized = module.Serialize();
+    Engine::RegisterInterpreter registerInterpreter;
+    if (!registerInterpreter.LoadModule(serialized.data(), serialized.size()) || 
+        registerInterpreter.Execute() != 0 || registerInterpreter.GetReturnValue() != 55) 
+    {
+        LogTestResult("레지스터 VM", false, "직렬화 모듈 실행 결과 오류: " + std::to_string(registerInterpreter.GetReturnValue()));
+        return false;
+    }
+    
+    serialized[Engine::RegisterModule::kHeaderSize + module.constants.size() * 8 + 4] = 0xFF; // 첫 명령어 ext
+    serialized[Engine::RegisterModule::kHeaderSize + module.constants.size() * 8] = static_cast<uint8_t>(Engine::RegOpcode::JMP);
+    Engine::RegisterModule corrupted;
+    std::string error;
+    if (Engine::RegisterModule::Deserialize(serialized.data(), serialized.size(), corrupted, error)) 
+    {
+        LogTestResult("레지스터 VM", false, "범위를 벗어난 분기 목적지를 허용함");
+        return false;
+    }
+    
+    LogTestResult("레지스터 VM", true, "스택 ISA와 결과 일치, SumLoop 명령어 " + 
+                  std::to_string(translator.GetStackInstructionCount()) + " → " + std::to_string(module.code.size()));
+    return true;
+}
+
+bool TestEngine::TestJit() 
+{
+    if (!Engine::Interpreter::IsJitSupported()) 
+    {
+        LogTestResult("JIT", true, "JIT 미지원 빌드 (Portable로 대체)");
+        return true;
+    }
+    
+    using Engine::Opcode;
+    
+    // 기계어 안에서 오류 조건을 만나면 그 명령어 직전 상태로 탈출하여 인터프리터와 같은 결과를 내야 함
+    std::vector<Programs::EngineProgram> programs = {
+        {"SumLoop", Programs::SumLoop(100), 5050},
+        {"CountdownLoop", Programs::CountdownLoop(1000), 0},
+        {"HeapOutOfRange", {
+            static_cast<uint8_t>(Opcode::PUSH8), 7,
+            static_cast<uint8_t>(Opcode::PUSH32), 0xFC, 0xFF, 0x0F, 0x00,    // 힙 끝 - 4 (상대 오프셋)
+            static_cast<uint8_t>(Opcode::SWAP),
+            static_cast<uint8_t>(Opcode::STORE32),
+            static_cast<uint8_t>(Opcode::PUSH32), 0xFC, 0xFF, 0x2F, 0x00,    // 힙 가상 주소 창 끝 - 4
+            static_cast<uint8_t>(Opcode::LOAD64),
+            static_cast<uint8_t>(Opcode::HALT)
+        }, 0},
+        {"StackUnderflow", {
+            static_cast<uint8_t>(Opcode::PUSH8), 1,
+            static_cast<uint8_t>(Opcode::ADD),
+            static_cast<uint8_t>(Opcode::HALT)
+        }, 0},
+        {"ModByZero", {
+            static_cast<uint8_t>(Opcode::PUSH8), 9,
+            static_cast<uint8_t>(Opcode::PUSH8), 5,
+            static_cast<uint8_t>(Opcode::PUSH8), 0,
+            static_cast<uint8_t>(Opcode::MOD),
+            static_cast<uint8_t>(Opcode::HALT)
+        }, 0}
+    };
+    
+    for (const auto& program : programs) 
+    {
+        Engine::Interpreter reference;
+        reference.SetExecutionMode(Engine::ExecutionMode::Portable);
+        reference.LoadBytecode(program.bytecode.data(), program.bytecode.size());
+        int referenceCode = reference.Execute();
+        
+        Engine::Interpreter jit;
+        jit.SetExecutionMode(Engine::ExecutionMode::Jit);
+        jit.LoadBytecode(program.bytecode.data(), program.bytecode.size());
+        int jitCode = jit.Execute();
+        
+        if (jitCode != referenceCode || jit.GetReturnValue() != reference.GetReturnValue() || 
+            jit.GetStackPointer() != reference.GetStackPointer()) 
+        {
+            LogTestResult("JIT", false, program.name + ": Portable=" + std::to_string(reference.GetReturnValue()) + 
+                          "(" + std::to_string(referenceCode) + ", SP=" + std::to_string(reference.GetStackPointer()) + "), Jit=" + 
+                          std::to_string(jit.GetReturnValue()) + "(" + std::to_string(jitCode) + ", SP=" + 
+                          std::to_string(jit.GetStackPointer()) + ")");
+            return false;
+        }
+        
+        if (jit.GetJitCompiler().GetBlockCount() == 0) 
+        {
+            LogTestResult("JIT", false, program.name + ": 컴파일된 블록 없음");
+            return false;
+        }
+    }
+    
+    // CountdownLoop: PUSH16 | PUSH8 SUB DUP JNZ | HALT → 블록 2개, 명령어 5개
+    Engine::Interpreter interpreter;
+    interpreter.SetExecutionMode(Engine::ExecutionMode::Jit);
+    auto countdown = Programs::CountdownLoop(10);
+    interpreter.LoadBytecode(countdown.data(), countdown.size());
+    interpreter.Execute();
+    const auto& compiler = interpreter.GetJitCompiler();
+    if (compiler.GetBlockCount() != 2 || compiler.GetCompiledInstructionCount() != 5 || 
+        compiler.GetEntry(0) == nullptr || compiler.GetEntry(3) == nullptr || compiler.GetEntry(1) != nullptr) 
+    {
+        LogTestResult("JIT", false, "CountdownLoop 블록 구성 오류: 블록=" + std::to_string(compiler.GetBlockCount()) + 
+                      ", 명령어=" + std::to_string(compiler.GetCompiledInstructionCount()));
+        return false;
+    }
+    
+    LogTestResult("JIT", true, "Portable과 결과/스택 포인터 일치, 탈출 시 상태 보존");
+    return true;
+}
+
+bool TestEngine::TestTieredExecution() 
+{
+    if (!Engine::Interpreter::IsJitSupported()) 
+    {
+        LogTestResult("계층 실행", true, "Jit 미지원 빌드 (Portable로 대체)");
+        return true;
+    }
+    
+    // 루프 헤더가 기준에 도달하면 실행 중에 기계어로 전환되고 결과는 그대로
+    {
+        Engine::Interpreter interpreter;
+        interpreter.SetExecutionMode(Engine::ExecutionMode::Tiered);
+        interpreter.SetTierUpThresholds(10, 10);
+        auto countdown = Programs::CountdownLoop(300);
+        interpreter.LoadBytecode(countdown.data(), countdown.size());
+        
+        int resultCode = interpreter.Execute();
+        const auto& stats = interpreter.GetTieringStats();
+        const auto& compiler = interpreter.GetTieredCompiler();
+        
+        // 루프 헤더(0x03)에서 닿는 블록만 컴파일되고 진입 블록(0x00)은 인터프리터로 남음
+        if (resultCode != 0 || interpreter.GetReturnValue() != 0 || stats.tierUpCount != 1 || stats.jitEntryCount == 0 || 
+            compiler.GetEntry(3) == nullptr || compiler.GetEntry(0) != nullptr || compiler.GetRegionCount() != 1) 
+        {
+            LogTestResult("계층 실행", false, "CountdownLoop 전환 오류: 결과=" + std::to_string(interpreter.GetReturnValue()) + 
+                          ", 컴파일=" + std::to_string(stats.tierUpCount) + ", 진입=" + std::to_string(stats.jitEntryCount));
+            return false;
+        }
+    }
+    
+    // 기준에 도달하지 않으면 컴파일하지 않음
+    {
+        Engine::Interpreter interpreter;
+        interpreter.SetExecutionMode(Engine::ExecutionMode::Tiered);
+        interpreter.SetTierUpThresholds(100, 10);
+        auto countdown = Programs::CountdownLoop(50);
+        interpreter.LoadBytecode(countdown.data(), countdown.size());
+        interpreter.Execute();
+        
+        if (interpreter.GetTieringStats().tierUpCount != 0 || interpreter.GetTieredCompiler().GetBlockCount() != 0) 
+        {
+            LogTestResult("계층 실행", false, "기준 미달 루프가 컴파일됨");
+            return false;
+        }
+    }
+    
+    // CALL 목적지 기준: 함수 본문(0x04)이 컴파일됨
+    {
+        Engine::Interpreter interpreter;
+        interpreter.SetExecutionMode(Engine::ExecutionMode::Tiered);
+        interpreter.SetTierUpThresholds(0, 1);
+        auto program = Programs::FunctionCall();
+        interpreter.LoadBytecode(program.data(), program.size());
+        int resultCode = interpreter.Execute();
+        
+        if (resultCode != 0 || interpreter.GetReturnValue() != 42 || interpreter.GetTieringStats().tierUpCount != 1 || 
+            interpreter.GetTieredCompiler().GetEntry(4) == nullptr) 
+        {
+            LogTestResult("계층 실행", false, "FunctionCall 함수 컴파일 오류: 결과=" + std::to_string(interpreter.GetReturnValue()));
+            return false;
+        }
+    }
+    
+    LogTestResult("계층 실행", true, "루프 헤더/함수 단위 전환, 기준 미달 시 인터프리터 유지");
+    return true;
+}
+
+bool TestEngine::TestBatchExecution() 
+{
+    using Engine::Opcode;
+    
+    // 인자 (a, b) → a + b * b
+    const std::vector<uint8_t> program = {
+        static_cast<uint8_t>(Opcode::DUP),
+        static_cast<uint8_t>(Opcode::MUL),
+        static_cast<uint8_t>(Opcode::ADD),
+        static_cast<uint8_t>(Opcode::HALT)
+    };
+    
+    // PushParameter는 나중에 푸시한 값이 최상위
+    {
+        Engine::Interpreter interpreter;
+        interpreter.LoadBytecode(program.data(), program.size());
+        interpreter.PushParameter(3);
+        interpreter.PushParameter(4);
+        if (interpreter.Execute() != 0 || interpreter.GetReturnValue() != 19) 
+        {
+            LogTestResult("일괄 실행", false, "PushParameter 결과 오류: " + std::to_string(interpreter.GetReturnValue()));
+            return false;
+        }
+    }
+    
+    const size_t runCount = 1000;
+    std::vector<uint64_t> args;
+    for (uint64_t i = 0; i < runCount; ++i) 
+    {
+        args.push_back(i);
+        args.push_back(i % 17);
+    }
+    
+    for (size_t threadCount : {1, 4}) 
+    {
+        Engine::Interpreter interpreter;
+        interpreter.LoadBytecode(program.data(), program.size());
+        
+        std::vector<uint64_t> results(runCount, ~0ULL);
+        if (interpreter.ExecuteBatch(args, 2, results, threadCount) != 0) 
+        {
+            LogTestResult("일괄 실행", false, "ExecuteBatch 실패 (스레드 " + std::to_string(threadCount) + ")");
+            return false;
+        }
+        
+        for (uint64_t i = 0; i < runCount; ++i) 
+        {
+            uint64_t expected = i + (i % 17) * (i % 17);
+            if (results[i] != expected) 
+            {
+                LogTestResult("일괄 실행", false, "스레드 " + std::to_string(threadCount) + ", 실행 " + std::to_string(i) + 
+                              ": 예상값=" + std::to_string(expected) + ", 실제값=" + std::to_string(results[i]));
+                return false;
+            }
+        }
+    }
+    
+    // 인자 수가 맞지 않으면 실행하지 않음, 인자가 모자란 실행은 그 실행만 실패
+    {
+        Engine::Interpreter interpreter;
+        interpreter.LoadBytecode(program.data(), program.size());
+        
+        std::vector<uint64_t> results(2, ~0ULL);
+        const uint64_t oddArgs[] = {1, 2, 3};
+        if (interpreter.ExecuteBatch(oddArgs, 2, results) != -1 || results[0] != ~0ULL) 
+        {
+            LogTestResult("일괄 실행", false, "인자 배열 크기 검사 실패");
+            return false;
+        }
+        
+        const uint64_t singleArgs[] = {5, 6};
+        if (interpreter.ExecuteBatch(singleArgs, 1, results) != -1 || results[0] != 0 || results[1] != 0) 
+        {
+            LogTestResult("일괄 실행", false, "스택 부족 실행이 실패로 처리되지 않음");
+            return false;
+        }
+    }
+    
+    LogTestResult("일괄 실행", true, "PushParameter 순서, 순차/병렬 결과 일치, 실패 실행 처리");
+    return true;
+}
+
+bool TestEngine::TestLaneExecution() 
+{
+    using Engine::Opcode;
+    
+    // 로드 시점 대상 판별: 분기 없는 산술/분기 코드만 대상, 메모리/호출이 있으면 제외
+    struct EligibilityCase 
+    {
+        std::string name;
+        std::vector<uint8_t> bytecode;
+        bool eligible;
+    };
+    const std::vector<EligibilityCase> eligibilityCases = {
+        {"BasicArithmetic", Programs::BasicArithmetic(), true},
+        {"CountdownLoop", Programs::CountdownLoop(10), true},
+        {"FunctionCall", Programs::FunctionCall(), false},
+        {"MemoryOperations", Programs::MemoryOperations(), false}
+    };
+    for (const auto& testCase : eligibilityCases) 
+    {
+        Engine::Interpreter interpreter;
+        interpreter.LoadBytecode(testCase.bytecode.data(), testCase.bytecode.size());
+        if (interpreter.IsLaneParallelEligible() != testCase.eligible) 
+        {
+            LogTestResult("SIMD 레인 실행", false, testCase.name + ": 대상 판별 오류");
+            return false;
+        }
+    }
+    
+    // 인자 (a, b) 커널: 산술, 레인별 0 나누기, 레인마다 갈라지는 분기
+    struct KernelCase 
+    {
+        std::string name;
+        std::vector<uint8_t> bytecode;
+    };
+    const std::vector<KernelCase> kernels = {
+        // ((b ^ (b << 3)) - ~(a * a)) | 0x55
+        {"Arithmetic", {
+            static_cast<uint8_t>(Opcode::DUP),
+            static_cast<uint8_t>(Opcode::PUSH8), 3, static_cast<uint8_t>(Opcode::SHL),
+            static_cast<uint8_t>(Opcode::XOR), static_cast<uint8_t>(Opcode::SWAP),
+            static_cast<uint8_t>(Opcode::DUP), static_cast<uint8_t>(Opcode::MUL),
+            static_cast<uint8_t>(Opcode::NOT), static_cast<uint8_t>(Opcode::SUB),
+            static_cast<uint8_t>(Opcode::PUSH8), 0x55, static_cast<uint8_t>(Opcode::OR),
+            static_cast<uint8_t>(Opcode::HALT)
+        }},
+        // a / (b % 5) : b % 5 == 0인 레인은 실패
+        {"DivideByZeroLane", {
+            static_cast<uint8_t>(Opcode::PUSH8), 5, static_cast<uint8_t>(Opcode::MOD),
+            static_cast<uint8_t>(Opcode::DIV),
+            static_cast<uint8_t>(Opcode::HALT)
+        }},
+        // b가 홀수면 a * 3, 아니면 a + 7
+        {"DivergentBranch", {
+            static_cast<uint8_t>(Opcode::PUSH8), 1, static_cast<uint8_t>(Opcode::AND),
+            static_cast<uint8_t>(Opcode::JNZ), 0x04, 0x00,                             // → odd
+            static_cast<uint8_t>(Opcode::PUSH8), 7, static_cast<uint8_t>(Opcode::ADD),
+            static_cast<uint8_t>(Opcode::HALT),
+            static_cast<uint8_t>(Opcode::PUSH8), 3, static_cast<uint8_t>(Opcode::MUL), // odd
+            static_cast<uint8_t>(Opcode::HALT)
+        }}
+    };
+    
+    // 레인 수로 나누어떨어지지 않는 실행 횟수
+    const size_t runCount = 37;
+    std::vector<uint64_t> args;
+    for (uint64_t i = 0; i < runCount; ++i) 
+    {
+        args.push_back(0x123456789ULL * (i + 1));
+        args.push_back(i);
+    }
+    
+    for (const auto& kernel : kernels) 
+    {
+        Engine::Interpreter scalar;
+        scalar.SetLaneParallelEnabled(false);
+        scalar.LoadBytecode(kernel.bytecode.data(), kernel.bytecode.size());
+        std::vector<uint64_t> expected(runCount);
+        int expectedCode = scalar.ExecuteBatch(args, 2, expected);
+        
+        Engine::Interpreter lanes;
+        lanes.LoadBytecode(kernel.bytecode.data(), kernel.bytecode.size());
+        std::vector<uint64_t> results(runCount);
+        int resultCode = lanes.ExecuteBatch(args, 2, results);
+        
+        if (!lanes.IsLaneParallelEligible() || resultCode != expectedCode || results != expected || 
+            (kernel.name == "Arithmetic" && expectedCode != 0)) 
+        {
+            LogTestResult("SIMD 레인 실행", false, kernel.name + ": 스칼라 일괄 실행과 결과 불일치");
+            return false;
+        }
+    }
+    
+    // 같은 방향으로만 분기하면 끝까지 벡터, 갈라지면 해당 묶음만 레인별 스칼라 실행
+    {
+        const auto& divergent = kernels[2].bytecode;
+        Engine::Interpreter interpreter;
+        interpreter.LoadBytecode(divergent.data(), divergent.size());
+        
+        std::vector<uint64_t> uniformArgs;
+        for (uint64_t i = 0; i < 16; ++i) 
+        {
+            uniformArgs.push_back(i);
+            uniformArgs.push_back(1);
+        }
+        std::vector<uint64_t> results(16);
+        interpreter.ExecuteBatch(uniformArgs, 2, results);
+        
+        const auto& stats = interpreter.GetLaneExecutor().GetStats();
+        if (stats.groupCount != 2 || stats.vectorLaneCount != 16 || stats.fallbackLaneCount != 0 || results[15] != 45) 
+        {
+            LogTestResult("SIMD 레인 실행", false, "분기 방향이 같은 묶음이 스칼라로 실행됨: 스칼라 레인=" + 
+                          std::to_string(stats.fallbackLaneCount));
+            return false;
+        }
+    }
+    
+    LogTestResult("SIMD 레인 실행", true, "로드 시점 대상 판별, 스칼라와 결과 일치, 분기/0 나누기 레인별 대체");
+    return true;
+}
+
+bool TestEngine::TestVerifier() 
+{
+    using Engine::Opcode;
+    
+    // 로드 시점 검증 결과
+    struct VerifyCase 
+    {
+        std::string name;
+        std::vector<uint8_t> bytecode;
+        bool verified;
+    };
+    const std::vector<VerifyCase> verifyCases = {
+        {"BasicArithmetic", Programs::BasicArithmetic(), true},
+        {"CountdownLoop", Programs::CountdownLoop(10), true},
+        // 상수 조건 JZ가 건너뛰는 PUSH8 때문에 합류 지점 깊이가 다름 (검사하는 루프로 실행)
+        {"SumLoop", Programs::SumLoop(10), false},
+        {"MemoryOperations", Programs::MemoryOperations(), true},
+        // 도달하는 명령어끼리는 겹치지 않으므로 통과 (목적지는 디코딩 스트림 밖이라 바이트 단위로 실행)
+        {"MisalignedJump", Programs::MisalignedJump(), true},
+        {"FunctionCall", Programs::FunctionCall(), false},
+        {"InvalidOpcode", {
+            static_cast<uint8_t>(Opcode::PUSH8), 1,
+            0xEE
+        }, false},
+        // PUSH16 오퍼랜드 안의 PUSH8로 되돌아가는 루프
+        {"OverlappingJump", {
+            static_cast<uint8_t>(Opcode::PUSH16), static_cast<uint8_t>(Opcode::PUSH8), 42,
+            static_cast<uint8_t>(Opcode::POP),
+            static_cast<uint8_t>(Opcode::JMP), 0xFA, 0xFF
+        }, false},
+        // 분기 여부에 따라 합류 지점 깊이가 다름
+        {"InconsistentDepth", {
+            static_cast<uint8_t>(Opcode::PUSH8), 1,
+            static_cast<uint8_t>(Opcode::JNZ), 0x02, 0x00,
+            static_cast<uint8_t>(Opcode::PUSH8), 5,
+            static_cast<uint8_t>(Opcode::HALT)
+        }, false},
+        {"FallOffEnd", {
+            static_cast<uint8_t>(Opcode::PUSH8), 1,
+            static_cast<uint8_t>(Opcode::POP)
+        }, false},
+        {"UnknownHostCall", {
+            static_cast<uint8_t>(Opcode::PUSH8), 1,
+            static_cast<uint8_t>(Opcode::HOSTCALL), 9,
+            static_cast<uint8_t>(Opcode::HALT)
+        }, false}
+    };
+    for (const auto& testCase : verifyCases) 
+    {
+        Engine::Interpreter interpreter;
+        interpreter.LoadBytecode(testCase.bytecode.data(), testCase.bytecode.size());
+        if (interpreter.IsVerified() != testCase.verified) 
+        {
+            LogTestResult("바이트코드 검증", false, testCase.name + ": 검증 결과 오류 (" + 
+                          interpreter.GetVerifier().GetLastError() + ")");
+            return false;
+        }
+    }
+    
+    // 인자 두 개를 읽는 코드: 필요한 진입 깊이와 최대 증가량
+    const std::vector<uint8_t> addArgs = {
+        static_cast<uint8_t>(Opcode::DUP),
+        static_cast<uint8_t>(Opcode::POP),
+        static_cast<uint8_t>(Opcode::ADD),
+        static_cast<uint8_t>(Opcode::HALT)
+    };
+    Engine::Interpreter withArgs;
+    withArgs.LoadBytecode(addArgs.data(), addArgs.size());
+    const auto& verifier = withArgs.GetVerifier();
+    if (!verifier.IsVerified() || verifier.GetRequiredEntryDepth() != 2 || verifier.GetMaxStackGrowth() != 1) 
+    {
+        LogTestResult("바이트코드 검증", false, "진입 깊이/최대 증가량 오류: " + 
+                      std::to_string(verifier.GetRequiredEntryDepth()) + ", " + std::to_string(verifier.GetMaxStackGrowth()));
+        return false;
+    }
+    
+    // 검사 생략 실행과 검사하는 실행의 결과 코드, 반환값, 스택 포인터 비교 (오류 경로와 인자 부족 포함)
+    struct RunCase 
+    {
+        std::string name;
+        std::vector<uint8_t> bytecode;
+        std::vector<uint64_t> args;
+    };
+    const std::vector<RunCase> runCases = {
+        {"AddArgs", addArgs, {40, 2}},
+        {"MissingArgs", addArgs, {}},
+        {"SumLoop", Programs::SumLoop(100), {}},
+        {"MisalignedJump", Programs::MisalignedJump(), {}},
+        {"DivideByZero", {
+            static_cast<uint8_t>(Opcode::PUSH8), 7,
+            static_cast<uint8_t>(Opcode::PUSH8), 0,
+            static_cast<uint8_t>(Opcode::MOD),
+            static_cast<uint8_t>(Opcode::HALT)
+        }, {}},
+        // 힙 범위 밖 STORE8, 범위 안 STORE16/LOAD16
+        {"HeapOutOfRange", {
+            static_cast<uint8_t>(Opcode::PUSH32), 0x00, 0x00, 0x20, 0x00,
+            static_cast<uint8_t>(Opcode::PUSH8), 1,
+            static_cast<uint8_t>(Opcode::STORE8),
+            static_cast<uint8_t>(Opcode::HALT)
+        }, {}},
+        {"HeapInRange", {
+            static_cast<uint8_t>(Opcode::PUSH8), 0x10,
+            static_cast<uint8_t>(Opcode::PUSH32), 0x34, 0x12, 0x01, 0x00,
+            static_cast<uint8_t>(Opcode::STORE16),
+            static_cast<uint8_t>(Opcode::PUSH8), 0x10,
+            static_cast<uint8_t>(Opcode::LOAD16),
+            static_cast<uint8_t>(Opcode::HALT)
+        }, {}}
+    };
+    for (const auto& runCase : runCases) 
+    {
+        int codes[2];
+        uint64_t values[2];
+        size_t stackPointers[2];
+        for (int verified = 0; verified < 2; ++verified) 
+        {
+            Engine::Interpreter interpreter;
+            interpreter.SetExecutionMode(Engine::ExecutionMode::Portable);
+            interpreter.SetVerificationEnabled(verified != 0);
+            interpreter.SetStackGuardEnabled(false);
+            interpreter.LoadBytecode(runCase.bytecode.data(), runCase.bytecode.size());
+            for (uint64_t arg : runCase.args) 
+            {
+                interpreter.PushParameter(arg);
+            }
+            codes[verified] = interpreter.Execute();
+            values[verified] = interpreter.GetReturnValue();
+            stackPointers[verified] = interpreter.GetStackPointer();
+        }
+        
+        if (codes[0] != codes[1] || values[0] != values[1] || stackPointers[0] != stackPointers[1]) 
+        {
+            LogTestResult("바이트코드 검증", false, runCase.name + ": 검사 생략 실행 결과 불일치 (" + 
+                          std::to_string(values[1]) + "(" + std::to_string(codes[1]) + "), 기준=" + 
+                          std::to_string(values[0]) + "(" + std::to_string(codes[0]) + "))");
+            return false;
+        }
+    }
+    
+    LogTestResult("바이트코드 검증", true, "검증 통과/거부 판별, 검사 생략 실행 결과/오류/스택 포인터 일치");
+    return true;
+}
+
+bool TestEngine::TestInterpreterPool() 
+{
+    using Engine::Opcode;
+    
+    const size_t segmentSize = 64 * 1024;
+    Engine::InterpreterPool pool(segmentSize, segmentSize, segmentSize, 4);
+    
+    // 힙 0x200010에 0x77 기록 / 같은 위치 읽기
+    const std::vector<uint8_t> writer = {
+        static_cast<uint8_t>(Opcode::PUSH32), 0x10, 0x00, 0x20, 0x00,
+        static_cast<uint8_t>(Opcode::PUSH8), 0x77,
+        static_cast<uint8_t>(Opcode::STORE64),
+        static_cast<uint8_t>(Opcode::PUSH8), 1,
+        static_cast<uint8_t>(Opcode::HALT)
+    };
+    const std::vector<uint8_t> reader = {
+        static_cast<uint8_t>(Opcode::PUSH32), 0x10, 0x00, 0x20, 0x00,
+        static_cast<uint8_t>(Opcode::LOAD64),
+        static_cast<uint8_t>(Opcode::HALT)
+    };
+    const auto sumLoop = Programs::SumLoop(10);
+    
+    // 같은 모듈을 다시 빌리면 같은 인스턴스를 재사용하고 다시 올리지 않음
+    Engine::Interpreter* first = nullptr;
+    for (int run = 0; run < 2; ++run) 
+    {
+        auto lease = pool.Acquire(sumLoop.data(), sumLoop.size());
+        if (run == 0) 
+        {
+            first = lease.Get();
+        }
+        if (lease.Get() != first || lease->Execute() != 0 || lease->GetReturnValue() != 55) 
+        {
+            LogTestResult("인터프리터 풀", false, "같은 모듈 재사용 실패");
+            return false;
+        }
+    }
+    auto stats = pool.GetStats();
+    if (stats.createdCount != 1 || stats.reusedCount != 1 || stats.sharedLoadCount != 1 || stats.moduleCount != 1) 
+    {
+        LogTestResult("인터프리터 풀", false, "재사용 통계 오류");
+        return false;
+    }
+    
+    // 반납 시 쓴 구간만 지우므로 다음 사용자는 이전 힙 값을 볼 수 없음
+    uint64_t scrubbedBefore = pool.GetStats().scrubbedBytes;
+    {
+        auto lease = pool.Acquire(writer.data(), writer.size());
+        lease->Execute();
+    }
+    uint64_t scrubbed = pool.GetStats().scrubbedBytes - scrubbedBefore;
+    {
+        auto lease = pool.Acquire(reader.data(), reader.size());
+        if (lease.Get() != first || lease->Execute() != 0 || lease->GetReturnValue() != 0) 
+        {
+            LogTestResult("인터프리터 풀", false, "반납 후 힙 값이 남아 있음: " + std::to_string(lease->GetReturnValue()));
+            return false;
+        }
+    }
+    if (scrubbed == 0 || scrubbed > 256) 
+    {
+        LogTestResult("인터프리터 풀", false, "지운 바이트 수가 쓴 양과 맞지 않음: " + std::to_string(scrubbed));
+        return false;
+    }
+    
+    // 동시에 빌린 인스턴스는 코드 세그먼트를 공유하고, 한쪽이 다른 코드를 올려도 다른 쪽은 영향 없음
+    {
+        auto a = pool.Acquire(sumLoop.data(), sumLoop.size());
+        auto b = pool.Acquire(sumLoop.data(), sumLoop.size());
+        b->LoadBytecode(reader.data(), reader.size());
+        a->SetExecutionMode(Engine::ExecutionMode::StackCached);
+        if (a.Get() == b.Get() || a->Execute() != 0 || a->GetReturnValue() != 55 || b->Execute() != 0) 
+        {
+            LogTestResult("인터프리터 풀", false, "공유 코드 세그먼트 분리 실패");
+            return false;
+        }
+    }
+    stats = pool.GetStats();
+    if (stats.moduleCount != 3 || pool.GetIdleCount() != 2) 
+    {
+        LogTestResult("인터프리터 풀", false, "모듈/보관 인스턴스 수 오류");
+        return false;
+    }
+    
+    // 반납 시 바뀐 실행 설정은 기본값으로 되돌림
+    {
+        auto lease = pool.Acquire(sumLoop.data(), sumLoop.size());
+        Engine::Interpreter defaults;
+        if (lease->GetExecutionMode() != defaults.GetExecutionMode() || lease->Execute() != 0 || lease->GetReturnValue() != 55) 
+        {
+            LogTestResult("인터프리터 풀", false, "실행 설정이 다음 사용자에게 남음");
+            return false;
+        }
+    }
+    
+    LogTestResult("인터프리터 풀", true, "재사용, 쓴 구간만 지우기 (" + std::to_string(scrubbed) + "바이트), 코드 세그먼트 공유");
+    return true;
+}
+
+bool TestEngine::TestMappedSegments() 
+{
+    using Memory::MemoryBacking;
+    using Memory::MemorySegmentType;
+    
+    // Heap 방식은 생성 시 전체를 채우므로 예약 = 커밋
+    Memory::MemoryManager heapBacked(64 * 1024, 256 * 1024, 256 * 1024, MemoryBacking::Heap);
+    if (heapBacked.GetCommittedBytes() != heapBacked.GetReservedBytes()) 
+    {
+        LogTestResult("mmap 세그먼트", false, "Heap 방식 커밋 바이트 오류");
+        return false;
+    }
+    
+    if (Memory::MemorySegment::GetDefaultBacking() != MemoryBacking::Mapped) 
+    {
+        LogTestResult("mmap 세그먼트", true, "mmap 미지원 빌드 (Heap 방식만 확인)");
+        return true;
+    }
+    
+    // 큰 스택/힙을 예약해도 건드리기 전에는 커밋되지 않음
+    const size_t largeSize = 64 * 1024 * 1024;
+    Memory::MemoryManager mapped(64 * 1024, largeSize, largeSize);
+    auto& stack = mapped.GetSegment(MemorySegmentType::STACK);
+    auto& heap = mapped.GetSegment(MemorySegmentType::HEAP);
+    if (stack.GetBacking() != MemoryBacking::Mapped || mapped.GetReservedBytes() != 64 * 1024 + 2 * largeSize + 1024 || 
+        mapped.GetCommittedBytes() >= 1024 * 1024) 
+    {
+        LogTestResult("mmap 세그먼트", false, "예약만 한 상태의 커밋 바이트 오류: " + std::to_string(mapped.GetCommittedBytes()));
+        return false;
+    }
+    
+    // 스택 사용량만큼만 커밋
+    for (uint64_t i = 0; i < 1000; ++i) 
+    {
+        mapped.PushStack(i);
+    }
+    if (stack.GetCommittedBytes() < 1000 * sizeof(uint64_t) || stack.GetCommittedBytes() >= 1024 * 1024 || 
+        mapped.PopStack() != 999) 
+    {
+        LogTestResult("mmap 세그먼트", false, "스택 커밋 바이트 오류: " + std::to_string(stack.GetCommittedBytes()));
+        return false;
+    }
+    
+    // 넓게 쓴 힙을 지우면 페이지를 돌려주고 다시 읽으면 0
+    for (size_t offset = 0; offset < 4 * 1024 * 1024; offset += 4096) 
+    {
+        heap.WriteUInt64(offset, offset + 1);
+    }
+    size_t committedBeforeScrub = heap.GetCommittedBytes();
+    mapped.ScrubDirty();
+    if (committedBeforeScrub < 4 * 1024 * 1024 || heap.GetCommittedBytes() >= 64 * 1024 || 
+        heap.ReadUInt64(8192) != 0 || stack.ReadUInt64(largeSize - 8) != 0) 
+    {
+        LogTestResult("mmap 세그먼트", false, "ScrubDirty 후 커밋/내용 오류: " + std::to_string(heap.GetCommittedBytes()));
+        return false;
+    }
+    
+    LogTestResult("mmap 세그먼트", true, "예약 " + std::to_string(mapped.GetReservedBytes() / 1024) + "KB 중 커밋 " + 
+                  std::to_string(mapped.GetCommittedBytes() / 1024) + "KB");
+    return true;
+}
+
+bool TestEngine::TestStackGuard() 
+{
+    using Engine::Opcode;
+    
+    // 기본은 사용 안 함 (프로세스 전체 SIGSEGV 처리기를 등록하지 않음)
+    if (Engine::Interpreter().IsStackGuardEnabled()) 
+    {
+        LogTestResult("가드 페이지 스택", false, "가드 페이지 스택이 기본으로 켜져 있음");
+        return false;
+    }
+    
+    const auto basic = Programs::BasicArithmetic();
+    Engine::Interpreter probe;
+    probe.SetStackGuardEnabled(true);
+    probe.LoadBytecode(basic.data(), basic.size());
+    if (!probe.IsStackGuarded()) 
+    {
+        LogTestResult("가드 페이지 스택", true, "가드 페이지 미지원 빌드 (검사하는 루프만 사용)");
+        return true;
+    }
+    
+    // 검증은 통과하지만 진입 시 스택 범위를 증명하지 못하는 코드: 폴트 방향과 명령어 오프셋, 검사하는 루프와 같은 실패 코드와 스택 포인터
+    const size_t stackSize = 16 * 1024;
+    std::vector<uint8_t> overflow;
+    for (size_t i = 0; i < stackSize / sizeof(uint64_t) + 16; ++i) 
+    {
+        overflow.push_back(static_cast<uint8_t>(Opcode::PUSH8));
+        overflow.push_back(1);
+    }
+    overflow.push_back(static_cast<uint8_t>(Opcode::HALT));
+    
+    struct FaultCase 
+    {
+        std::string name;
+        std::vector<uint8_t> bytecode;
+        bool overflow;
+        size_t ip;
+    };
+    const FaultCase faultCases[] = {
+        // 스택 칸 수보다 16번 더 푸시 (최대 증가량이 스택 크기를 넘음)
+        {"Overflow", overflow, true, stackSize / sizeof(uint64_t) * 2},
+        // 진입 시 인자 1개가 필요한 코드를 빈 스택으로 실행
+        {"MulUnderflow", {
+            static_cast<uint8_t>(Opcode::PUSH8), 1,
+            static_cast<uint8_t>(Opcode::PUSH8), 2,
+            static_cast<uint8_t>(Opcode::MUL),
+            static_cast<uint8_t>(Opcode::MUL),
+            static_cast<uint8_t>(Opcode::HALT)
+        }, false, 5},
+        {"PopUnderflow", {
+            static_cast<uint8_t>(Opcode::POP),
+            static_cast<uint8_t>(Opcode::HALT)
+        }, false, 0}
+    };
+    for (const auto& faultCase : faultCases) 
+    {
+        Engine::Interpreter checked(64 * 1024, stackSize);
+        checked.SetExecutionMode(Engine::ExecutionMode::Portable);
+        checked.LoadBytecode(faultCase.bytecode.data(), faultCase.bytecode.size());
+        
+        Engine::Interpreter guarded(64 * 1024, stackSize);
+        guarded.SetExecutionMode(Engine::ExecutionMode::Portable);
+        guarded.SetStackGuardEnabled(true);
+        guarded.LoadBytecode(faultCase.bytecode.data(), faultCase.bytecode.size());
+        
+        int checkedCode = checked.Execute();
+        int guardedCode = guarded.Execute();
+        const auto& fault = guarded.GetLastStackFault();
+        if (!guarded.IsVerified() || checkedCode != -1 || guardedCode != -1 || guarded.GetStackFaultCount() != 1 || 
+            fault.overflow != faultCase.overflow || fault.ip != faultCase.ip) 
+        {
+            LogTestResult("가드 페이지 스택", false, faultCase.name + ": 폴트 보고 오류 (코드=" + std::to_string(guardedCode) + 
+                          ", IP=" + std::to_string(fault.ip) + ", 오버플로=" + std::to_string(fault.overflow) + ")");
+            return false;
+        }
+        if (guarded.GetStackPointer() != checked.GetStackPointer()) 
+        {
+            LogTestResult("가드 페이지 스택", false, faultCase.name + ": 폴트 후 스택 포인터 불일치 (" + 
+                          std::to_string(guarded.GetStackPointer()) + ", 기준=" + std::to_string(checked.GetStackPointer()) + ")");
+            return false;
+        }
+        
+        // 폴트 후에도 같은 인스턴스로 정상 실행
+        guarded.LoadBytecode(basic.data(), basic.size());
+        if (guarded.Execute() != 0 || guarded.GetReturnValue() != 55 || guarded.GetStackFaultCount() != 1) 
+        {
+            LogTestResult("가드 페이지 스택", false, faultCase.name + ": 폴트 후 재실행 실패");
+            return false;
+        }
+    }
+    
+    // 가드 대상이 아닌 코드(검증되지 않은 코드, HOSTCALL이 있는 코드)는 켜 두어도 검사하는 루프로 실행
+    std::vector<Programs::EngineProgram> programs = {
+        {"SumLoop(10)", Programs::SumLoop(10), 55},
+        {"FunctionCall", Programs::FunctionCall(), 42},
+        {"HostCallUnderflow", {
+            static_cast<uint8_t>(Opcode::PUSH8), 1,
+            static_cast<uint8_t>(Opcode::HOSTCALL), 0,
+            static_cast<uint8_t>(Opcode::POP),
+            static_cast<uint8_t>(Opcode::HALT)
+        }, 0}
+    };
+    for (const auto& program : programs) 
+    {
+        for (auto mode : {Engine::ExecutionMode::Portable, Engine::ExecutionMode::Threaded}) 
+        {
+            Engine::Interpreter checked;
+            checked.SetExecutionMode(mode);
+            checked.LoadBytecode(program.bytecode.data(), program.bytecode.size());
+            
+            Engine::Interpreter guarded;
+            guarded.SetExecutionMode(mode);
+            guarded.SetStackGuardEnabled(true);
+            guarded.LoadBytecode(program.bytecode.data(), program.bytecode.size());
+            
+            int checkedCode = checked.Execute();
+            int guardedCode = guarded.Execute();
+            if (guarded.IsStackGuarded() || guarded.GetStackFaultCount() != 0 || guardedCode != checkedCode || 
+                guarded.GetReturnValue() != program.expectedResult || guarded.GetReturnValue() != checked.GetReturnValue() || 
+                guarded.GetStackPointer() != checked.GetStackPointer()) 
+            {
+                LogTestResult("가드 페이지 스택", false, program.name + ": 가드 대상이 아닌 코드 결과 불일치 (" + 
+                              std::to_string(guarded.GetReturnValue()) + ", 기준=" + std::to_string(checked.GetReturnValue()) + ")");
+                return false;
+            }
+        }
+    }
+    
+    LogTestResult("가드 페이지 스택", true, "기본 꺼짐, 오버플로/언더플로 폴트를 명령어 오프셋과 함께 오류로 보고하고 스택 포인터 일치");
+    return true;
+}
+
+bool TestEngine::TestAddressSpace() 
+{
+    using Engine::Opcode;
+    using Memory::MemorySegmentType;
+    
+    // 기본 크기: 64KB 단위로 CODE, CONSTANT, STACK을 배치하고 힙은 기본 주소에 배치
+    Memory::MemoryManager defaults;
+    if (defaults.GetBaseAddress(MemorySegmentType::CODE) != 0 || 
+        defaults.GetBaseAddress(MemorySegmentType::CONSTANT) != 0x10000 || 
+        defaults.GetBaseAddress(MemorySegmentType::STACK) != 0x20000 || 
+        defaults.GetBaseAddress(MemorySegmentType::HEAP) != Memory::MemoryManager::kHeapBaseAddress) 
+    {
+        LogTestResult("주소 공간", false, "기본 세그먼트 시작 주소 오류");
+        return false;
+    }
+    
+    // 스택이 기본 힙 주소를 넘으면 힙은 스택 뒤로 밀려남
+    const size_t largeStack = 4 * 1024 * 1024;
+    const size_t heapSize = 2 * 1024 * 1024;
+    Memory::MemoryManager large(64 * 1024, largeStack, heapSize);
+    const size_t heapBase = large.GetBaseAddress(MemorySegmentType::HEAP);
+    if (heapBase != 0x20000 + largeStack || 
+        large.GetAddressSpaceSize() != heapBase + std::max(heapSize, Memory::HeapGrowthPolicy::kDefaultMaxSize)) 
+    {
+        LogTestResult("주소 공간", false, "큰 스택의 힙 시작 주소 오류: " + std::to_string(heapBase));
+        return false;
+    }
+    
+    // 힙 끝까지 읽고 쓰기, 주소로 세그먼트 찾기
+    large.WriteUInt64(heapBase + heapSize - 8, 0xDEADBEEF);
+    if (large.ReadUInt64(heapBase + heapSize - 8) != 0xDEADBEEF || 
+        large.GetSegmentByAddress(heapBase).GetType() != MemorySegmentType::HEAP || 
+        large.GetSegmentByAddress(0x20000 + largeStack - 8).GetType() != MemorySegmentType::STACK || 
+        large.GetSegmentByAddress(0x10000).GetType() != MemorySegmentType::CONSTANT) 
+    {
+        LogTestResult("주소 공간", false, "주소 변환 오류");
+        return false;
+    }
+    
+    // 세그먼트 사이의 빈 구간과 주소 공간 밖은 접근 오류
+    const size_t invalidAddresses[] = {0x10000 + 1024 + 8, heapBase + heapSize, SIZE_MAX - 8};
+    for (size_t address : invalidAddresses) 
+    {
+        try 
+        {
+            large.ReadUInt64(address);
+            LogTestResult("주소 공간", false, "잘못된 주소 접근이 성공함: " + std::to_string(address));
+            return false;
+        } 
+        catch (const Memory::MemoryAccessException&) 
+        {
+        }
+    }
+    
+    // 밀려난 힙 주소로 STORE64/LOAD64: 모든 모드가 같은 결과 (Jit/Tiered는 Portable로 대체)
+    auto push64 = [](std::vector<uint8_t>& code, uint64_t value) 
+    {
+        code.push_back(static_cast<uint8_t>(Opcode::PUSH64));
+        for (int i = 0; i < 8; ++i) 
+        {
+            code.push_back(static_cast<uint8_t>(value >> (i * 8)));
+        }
+    };
+    std::vector<uint8_t> bytecode;
+    push64(bytecode, heapBase + 256);
+    push64(bytecode, 0x123456789);
+    bytecode.push_back(static_cast<uint8_t>(Opcode::STORE64));
+    push64(bytecode, heapBase + 256);
+    bytecode.push_back(static_cast<uint8_t>(Opcode::LOAD64));
+    bytecode.push_back(static_cast<uint8_t>(Opcode::HALT));
+    
+    const Engine::ExecutionMode modes[] = {
+        Engine::ExecutionMode::Portable, Engine::ExecutionMode::Threaded, 
+        Engine::ExecutionMode::Jit, Engine::ExecutionMode::Tiered
+    };
+    for (auto mode : modes) 
+    {
+        Engine::Interpreter interpreter(64 * 1024, largeStack, heapSize);
+        interpreter.SetExecutionMode(mode);
+        interpreter.LoadBytecode(bytecode.data(), bytecode.size());
+        if (interpreter.Execute() != 0 || interpreter.GetReturnValue() != 0x123456789) 
+        {
+            LogTestResult("주소 공간", false, "밀려난 힙 주소 LOAD64/STORE64 실패 (모드 " + 
+                          std::to_string(static_cast<int>(mode)) + ")");
+            return false;
+        }
+    }
+    
+    LogTestResult("주소 공간", true, "큰 스택의 힙 시작 " + std::to_string(heapBase / 1024) + "KB");
+    return true;
+}
+
+bool TestEngine::TestHeapAllocator() 
+{
+    Memory::MemoryManager memory(64 * 1024, 64 * 1024, 1024 * 1024);
+    Memory::HeapMemory& heap = memory.GetHeapMemory();
+    
+    // 해제한 블록은 같은 크기 등급 할당에 바로 재사용
+    size_t first = memory.Allocate(24);
+    memory.Free(first);
+    if (memory.Allocate(24) != first || first % sizeof(uint64_t) != 0) 
+    {
+        LogTestResult("힙 할당기", false, "작은 블록 재사용 실패");
+        return false;
+    }
+    memory.Free(first);
+    
+    // 이웃한 큰 블록 병합: A, C, B 순서로 해제하면 세 블록이 한 블록이 됨 (D는 뒤쪽 미사용 공간과 분리용)
+    size_t a = memory.Allocate(4000);
+    size_t b = memory.Allocate(4000);
+    size_t c = memory.Allocate(4000);
+    size_t d = memory.Allocate(16);
+    memory.Free(a);
+    memory.Free(c);
+    memory.Free(b);
+    if (memory.Allocate(12000) != a) 
+    {
+        LogTestResult("힙 할당기", false, "큰 블록 병합 실패");
+        return false;
+    }
+    memory.Free(a);
+    memory.Free(d);
+    
+    // 모두 해제하면 빈 공간이 한 덩어리
+    Memory::HeapStats stats = heap.GetStats();
+    if (stats.liveBlocks != 0 || stats.liveBytes != 0 || stats.usedBytes != 0 || stats.fragmentation != 0.0 || 
+        stats.peakLiveBytes < 12000 || stats.allocationCount != stats.freeCount) 
+    {
+        LogTestResult("힙 할당기", false, "전부 해제 후 통계 오류");
+        return false;
+    }
+    
+    // 잘못된 해제: 두 번 해제, 블록 중간, 할당하지 않은 주소
+    size_t block = memory.Allocate(64);
+    memory.Allocate(64);
+    memory.Free(block);
+    const size_t invalidFrees[] = {block, block + 8, 512 * 1024};
+    for (size_t address : invalidFrees) 
+    {
+        try 
+        {
+            memory.Free(address);
+            LogTestResult("힙 할당기", false, "잘못된 해제가 성공함: " + std::to_string(address));
+            return false;
+        } 
+        catch (const std::runtime_error&) 
+        {
+        }
+    }
+    
+    // 게스트 STORE로 덮어쓴 메타데이터: 해제/할당이 예외로 끝나고 할당기 상태는 그대로
+    {
+        Memory::MemoryManager corrupted(64 * 1024, 64 * 1024, 64 * 1024);
+        Memory::HeapMemory& target = corrupted.GetHeapMemory();
+        auto writeWord = [&](size_t address, uint64_t value) { target.WriteHeap(address, &value, sizeof(value)); };
+        auto readWord = [&](size_t address) { uint64_t value = 0; target.ReadHeap(address, &value, sizeof(value)); return value; };
+        auto throws = [](auto&& action) 
+        {
+            try 
+            {
+                action();
+            } 
+            catch (const std::runtime_error&) 
+            {
+                return true;
+            }
+            return false;
+        };
+        
+        // 64바이트 블록 둘: b 헤더에 "앞 블록이 빈 블록" 표시를 넣고 a 끝(b의 앞 꼬리 크기 자리)에 힙 밖을 가리키는 크기
+        size_t blockA = corrupted.Allocate(64);
+        size_t blockB = corrupted.Allocate(64);
+        const uint64_t headerB = readWord(blockB - Memory::HeapMemory::kHeaderSize);
+        writeWord(blockB - Memory::HeapMemory::kHeaderSize, headerB | 2);
+        writeWord(blockB - 2 * Memory::HeapMemory::kHeaderSize, 0x4000000000ull);
+        bool rejected = throws([&]() { corrupted.Free(blockB); });
+        
+        // 꼬리 크기가 빈 블록이 아닌 블록(사용 중인 a)을 가리킴
+        writeWord(blockB - 2 * Memory::HeapMemory::kHeaderSize, blockB - blockA);
+        rejected = rejected && throws([&]() { corrupted.Free(blockB); });
+        writeWord(blockB - Memory::HeapMemory::kHeaderSize, headerB);
+        
+        // 해제 리스트에 있는 블록의 다음 링크를 힙 밖으로
+        size_t blockC = corrupted.Allocate(64);
+        corrupted.Allocate(64);
+        corrupted.Free(blockC);
+        const Memory::HeapStats before = target.GetStats();
+        const uint64_t link = readWord(blockC);
+        writeWord(blockC, 0x4000000000ull);
+        rejected = rejected && throws([&]() { corrupted.Allocate(64); }) && throws([&]() { corrupted.Free(blockB); }) && 
+                   throws([&]() { target.GetStats(); });
+        
+        // 링크를 되돌리면 그대로 이어서 사용
+        writeWord(blockC, link);
+        const Memory::HeapStats after = target.GetStats();
+        if (!rejected || after.liveBlocks != before.liveBlocks || after.freeBytes != before.freeBytes || 
+            after.usedBytes != before.usedBytes || corrupted.Allocate(64) != blockC) 
+        {
+            LogTestResult("힙 할당기", false, "손상된 블록 메타데이터를 받아들임");
+            return false;
+        }
+        corrupted.Free(blockB);
+        corrupted.Free(blockA);
+    }
+    
+    // 1MB 힙에서 누적 할당량이 힙의 수십 배인 할당/해제 반복 (선형 할당이면 메모리 부족)
+    memory.ScrubDirty();
+    std::vector<size_t> live(64, 0);
+    uint64_t seed = 12345;
+    size_t totalAllocated = 0;
+    for (size_t i = 0; i < 20000; ++i) 
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        size_t slot = (seed >> 33) % live.size();
+        if (live[slot] != 0) 
+        {
+            uint64_t value = 0;
+            heap.ReadHeap(live[slot], &value, sizeof(value));
+            if (value != slot) 
+            {
+                LogTestResult("힙 할당기", false, "블록 내용이 다른 할당에 덮어써짐");
+                return false;
+            }
+            memory.Free(live[slot]);
+            live[slot] = 0;
+            continue;
+        }
+        size_t size = 8 + (seed >> 40) % 8192;
+        live[slot] = memory.Allocate(size);
+        totalAllocated += size;
+        uint64_t value = slot;
+        heap.WriteHeap(live[slot], &value, sizeof(value));
+    }
+    
+    stats = heap.GetStats();
+    if (totalAllocated < 16 * 1024 * 1024 || stats.peakUsedBytes > 1024 * 1024 || 
+        stats.liveBytes + stats.freeBytes != stats.usedBytes) 
+    {
+        LogTestResult("힙 할당기", false, "할당/해제 반복 통계 오류");
+        return false;
+    }
+    
+    std::ostringstream message;
+    message << "누적 " << totalAllocated / 1024 << "KB 할당, 최대 " << stats.peakUsedBytes / 1024 << "KB 사용";
+    LogTestResult("힙 할당기", true, message.str());
+    return true;
+}
+
+bool TestEngine::TestHeapGrowth() 
+{
+    using Engine::Opcode;
+    using Memory::MemoryBacking;
+    using Memory::MemorySegmentType;
+    
+    // 두 방식 모두 1MB에서 시작해 늘어나고, 늘기 전에 쓴 값은 그대로 (Mapped는 예약 안에서 제자리)
+    for (MemoryBacking backing : {MemoryBacking::Heap, Memory::MemorySegment::GetDefaultBacking()}) 
+    {
+        Memory::MemoryManager memory(64 * 1024, 64 * 1024, 1024 * 1024, backing);
+        Memory::HeapMemory& heap = memory.GetHeapMemory();
+        
+        std::vector<size_t> blocks;
+        for (uint64_t i = 0; i < 12; ++i) 
+        {
+            blocks.push_back(memory.Allocate(512 * 1024));
+            heap.WriteHeap(blocks.back(), &i, sizeof(i));
+        }
+        for (uint64_t i = 0; i < blocks.size(); ++i) 
+        {
+            uint64_t value = 0;
+            heap.ReadHeap(blocks[i], &value, sizeof(value));
+            if (value != i) 
+            {
+                LogTestResult("힙 확장", false, "늘어난 뒤 이전 블록 내용이 바뀜");
+                return false;
+            }
+        }
+        
+        Memory::HeapStats stats = heap.GetStats();
+        bool inPlace = memory.GetSegment(MemorySegmentType::HEAP).GetBacking() == MemoryBacking::Mapped;
+        if (stats.growthCount == 0 || stats.heapSize < 6 * 1024 * 1024 || stats.peakHeapSize != stats.heapSize || 
+            (inPlace && stats.relocationCount != 0) || (!inPlace && stats.relocationCount != stats.growthCount)) 
+        {
+            LogTestResult("힙 확장", false, "확장 통계 오류 (늘린 횟수 " + std::to_string(stats.growthCount) + 
+                          ", 옮긴 횟수 " + std::to_string(stats.relocationCount) + ")");
+            return false;
+        }
+        
+        // 초기화하면 처음 크기로 돌아감
+        memory.ScrubDirty();
+        if (heap.GetStats().heapSize != 1024 * 1024) 
+        {
+            LogTestResult("힙 확장", false, "초기화 후 힙 크기가 돌아오지 않음");
+            return false;
+        }
+    }
+    
+    // 최대 크기에 막히면 메모리 부족, 최대 크기 = 처음 크기면 늘리지 않음
+    Memory::MemoryManager memory(64 * 1024, 64 * 1024, 256 * 1024);
+    Memory::HeapGrowthPolicy policy;
+    policy.initialSize = 256 * 1024;
+    policy.growthFactor = 1.5;
+    policy.maxSize = 1024 * 1024;
+    memory.SetHeapGrowthPolicy(policy);
+    
+    auto allocationFails = [&memory](size_t size) 
+    {
+        try 
+        {
+            memory.Allocate(size);
+            return false;
+        } 
+        catch (const std::runtime_error&) 
+        {
+            return true;
+        }
+    };
+    
+    size_t block = memory.Allocate(600 * 1024);
+    if (!allocationFails(600 * 1024) || memory.GetHeapMemory().GetStats().heapSize > policy.maxSize) 
+    {
+        LogTestResult("힙 확장", false, "최대 크기를 넘어 할당됨");
+        return false;
+    }
+    
+    // 할당된 블록이 있으면 정책을 바꿀 수 없음
+    try 
+    {
+        memory.SetHeapGrowthPolicy(Memory::HeapGrowthPolicy());
+        LogTestResult("힙 확장", false, "사용 중인 힙의 정책이 바뀜");
+        return false;
+    } 
+    catch (const std::runtime_error&) 
+    {
+    }
+    memory.Free(block);
+    
+    policy.maxSize = policy.initialSize;
+    memory.SetHeapGrowthPolicy(policy);
+    if (!allocationFails(300 * 1024) || memory.GetHeapMemory().GetStats().growthCount != 0) 
+    {
+        LogTestResult("힙 확장", false, "고정 크기 정책에서 힙이 늘어남");
+        return false;
+    }
+    
+    // ALLOC으로 1MB 힙을 넘겨 할당한 뒤 두 번째 블록에 STORE64/LOAD64: 모든 모드가 같은 결과
+    auto push64 = [](std::vector<uint8_t>& code, uint64_t value) 
+    {
+        code.push_back(static_cast<uint8_t>(Opcode::PUSH64));
+        for (int i = 0; i < 8; ++i) 
+        {
+            code.push_back(static_cast<uint8_t>(value >> (i * 8)));
+        }
+    };
+    
+    std::vector<uint8_t> bytecode;
+    push64(bytecode, 800 * 1000);
+    bytecode.push_back(static_cast<uint8_t>(Opcode::ALLOC));
+    bytecode.push_back(static_cast<uint8_t>(Opcode::POP));
+    push64(bytecode, 800 * 1000);
+    bytecode.push_back(static_cast<uint8_t>(Opcode::ALLOC));
+    push64(bytecode, Memory::MemoryManager::kHeapBaseAddress);
+    bytecode.push_back(static_cast<uint8_t>(Opcode::ADD));
+    bytecode.push_back(static_cast<uint8_t>(Opcode::DUP));
+    push64(bytecode, 0xC0FFEE);
+    bytecode.push_back(static_cast<uint8_t>(Opcode::STORE64));
+    bytecode.push_back(static_cast<uint8_t>(Opcode::LOAD64));
+    bytecode.push_back(static_cast<uint8_t>(Opcode::HALT));
+    
+    const Engine::ExecutionMode modes[] = {
+        Engine::ExecutionMode::Portable, Engine::ExecutionMode::Threaded, 
+        Engine::ExecutionMode::Jit, Engine::ExecutionMode::Tiered
+    };
+    for (auto mode : modes) 
+    {
+        Engine::Interpreter interpreter;
+        interpreter.SetExecutionMode(mode);
+        interpreter.LoadBytecode(bytecode.data(), bytecode.size());
+        if (interpreter.Execute() != 0 || interpreter.GetReturnValue() != 0xC0FFEE || 
+            interpreter.GetHeapStats().growthCount == 0) 
+        {
+            LogTestResult("힙 확장", false, "ALLOC 후 늘어난 힙 접근 실패 (모드 " + 
+                          std::to_string(static_cast<int>(mode)) + ")");
+            return false;
+        }
+    }
+    
+    LogTestResult("힙 확장", true, "1MB → 6MB 이상, 최대 크기 초과 시 메모리 부족");
+    return true;
+}
+
+bool TestEngine::TestArenaAllocator() 
+{
+    using Engine::Opcode;
+    
+    Memory::MemoryManager memory(64 * 1024, 64 * 1024, 1024 * 1024);
+    Memory::ArenaMemory& arena = memory.GetArenaMemory();
+    Memory::HeapMemory& heap = memory.GetHeapMemory();
+    
+    // 열린 아레나가 없으면 할당/해제 불가
+    for (int operation = 0; operation < 2; ++operation) 
+    {
+        try 
+        {
+            operation == 0 ? static_cast<void>(arena.Allocate(8)) : arena.Reset();
+            LogTestResult("아레나 할당기", false, "열린 아레나 없이 성공함");
+            return false;
+        } 
+        catch (const std::runtime_error&) 
+        {
+        }
+    }
+    
+    // 작은 할당 1000개: 8바이트 단위로 올려 붙어서 놓이고 힙 블록은 청크 하나뿐
+    arena.Begin();
+    size_t first = arena.Allocate(12);
+    size_t previous = first;
+    for (int i = 1; i < 1000; ++i) 
+    {
+        size_t address = arena.Allocate(24);
+        if (address % sizeof(uint64_t) != 0 || address != previous + (i == 1 ? 16 : 24)) 
+        {
+            LogTestResult("아레나 할당기", false, "아레나 주소 정렬/순서 오류");
+            return false;
+        }
+        uint64_t value = static_cast<uint64_t>(i);
+        heap.WriteHeap(address, &value, sizeof(value));
+        previous = address;
+    }
+    
+    Memory::ArenaStats stats = arena.GetStats();
+    if (heap.GetStats().liveBlocks != stats.chunkCount || stats.chunkCount > 1 || stats.allocationCount != 1000) 
+    {
+        LogTestResult("아레나 할당기", false, "힙 블록 수 오류: " + std::to_string(heap.GetStats().liveBlocks));
+        return false;
+    }
+    
+    // 중첩 아레나를 닫으면 열기 전 위치로 돌아가고, 그 안에서 받은 큰 청크는 힙에 돌려줌
+    arena.Begin();
+    size_t inner = arena.Allocate(64);
+    arena.Allocate(Memory::ArenaMemory::kDefaultChunkSize * 2);
+    if (arena.GetStats().chunkCount != 2) 
+    {
+        LogTestResult("아레나 할당기", false, "큰 할당에 새 청크를 받지 않음");
+        return false;
+    }
+    arena.Reset();
+    if (arena.Allocate(64) != inner || arena.GetStats().chunkCount != 1 || arena.GetDepth() != 1) 
+    {
+        LogTestResult("아레나 할당기", false, "중첩 아레나 해제 후 위치 오류");
+        return false;
+    }
+    
+    // 바깥 아레나를 닫으면 힙이 비어 있음
+    arena.Reset();
+    Memory::HeapStats heapStats = heap.GetStats();
+    if (heapStats.liveBlocks != 0 || heapStats.usedBytes != 0 || arena.GetStats().resetCount != 2) 
+    {
+        LogTestResult("아레나 할당기", false, "아레나 해제 후 힙이 비지 않음");
+        return false;
+    }
+    
+    // ARENA_BEGIN, ARENA_ALLOC 주소에 STORE64/LOAD64, ARENA_RESET: 모든 모드와 레지스터 VM이 같은 결과
+    auto push64 = [](std::vector<uint8_t>& code, uint64_t value) 
+    {
+        code.push_back(static_cast<uint8_t>(Opcode::PUSH64));
+        for (int i = 0; i < 8; ++i) 
+        {
+            code.push_back(static_cast<uint8_t>(value >> (i * 8)));
+        }
+    };
+    
+    std::vector<uint8_t> bytecode;
+    bytecode.push_back(static_cast<uint8_t>(Opcode::ARENA_BEGIN));
+    push64(bytecode, 40);
+    bytecode.push_back(static_cast<uint8_t>(Opcode::ARENA_ALLOC));
+    bytecode.push_back(static_cast<uint8_t>(Opcode::POP));
+    push64(bytecode, 16);
+    bytecode.push_back(static_cast<uint8_t>(Opcode::ARENA_ALLOC));
+    push64(bytecode, Memory::MemoryManager::kHeapBaseAddress);
+    bytecode.push_back(static_cast<uint8_t>(Opcode::ADD));
+    bytecode.push_back(static_cast<uint8_t>(Opcode::DUP));
+    push64(bytecode, 0xA4E7A);
+    bytecode.push_back(static_cast<uint8_t>(Opcode::STORE64));
+    bytecode.push_back(static_cast<uint8_t>(Opcode::LOAD64));
+    bytecode.push_back(static_cast<uint8_t>(Opcode::ARENA_RESET));
+    bytecode.push_back(static_cast<uint8_t>(Opcode::HALT));
+    
+    const Engine::ExecutionMode modes[] = {
+        Engine::ExecutionMode::Portable, Engine::ExecutionMode::Threaded, Engine::ExecutionMode::StackCached, 
+        Engine::ExecutionMode::Jit, Engine::ExecutionMode::Tiered
+    };
+    for (auto mode : modes) 
+    {
+        for (bool verification : {false, true}) 
+        {
+            Engine::Interpreter interpreter;
+            interpreter.SetExecutionMode(mode);
+            interpreter.SetVerificationEnabled(verification);
+            interpreter.LoadBytecode(bytecode.data(), bytecode.size());
+            Memory::ArenaStats arenaStats;
+            if (interpreter.Execute() != 0 || interpreter.GetReturnValue() != 0xA4E7A || 
+                (arenaStats = interpreter.GetArenaStats()).depth != 0 || arenaStats.allocationCount != 2 || 
+                arenaStats.resetCount != 1 || interpreter.GetHeapStats().liveBlocks != 0) 
+            {
+                LogTestResult("아레나 할당기", false, "ARENA_* 실행 결과 오류 (모드 " + 
+                              std::to_string(static_cast<int>(mode)) + ")");
+                return false;
+            }
+        }
+    }
+    
+    Engine::StackToRegisterTranslator translator;
+    Engine::RegisterModule module;
+    Engine::RegisterInterpreter registerInterpreter;
+    if (!translator.Translate(bytecode.data(), bytecode.size(), module) || !registerInterpreter.LoadModule(module) || 
+        registerInterpreter.Execute() != 0 || registerInterpreter.GetReturnValue() != 0xA4E7A) 
+    {
+        LogTestResult("아레나 할당기", false, "레지스터 VM ARENA_* 실행 결과 오류");
+        return false;
+    }
+    
+    LogTestResult("아레나 할당기", true, "할당 1000개에 힙 블록 " + std::to_string(stats.chunkCount) + "개");
+    return true;
+}
+
+bool TestEngine::TestTraceGating() 
+{
+    // 레벨에 걸리는 추적 로그는 메시지 식을 평가하지 않음
+    int evaluated = 0;
+    auto message = [&evaluated]() 
+    {
+        ++evaluated;
+        return std::string("추적 로그 메시지 평가됨");
+    };
+    
+    LogLevel previous = Logger::GetLevel();
+    Logger::SetLevel(LogLevel::INFO);
+    DMVM_TRACE_DEBUG("TestEngine", message());
+    DMVM_LOG(LogLevel::DEBUG, "TestEngine", message());
+    int filtered = evaluated;
+    DMVM_LOG(LogLevel::INFO, "TestEngine", message());
+    Logger::SetLevel(previous);
+    
+    if (filtered != 0 || evaluated != 1) 
+    {
+        LogTestResult("추적 로그", false, "레벨에 걸린 메시지가 평가됨: " + std::to_string(filtered));
+        return false;
+    }
+    
+    // 로그를 뺀 접근 검사: 권한, 범위, 오프셋 + 크기 넘침
+    Memory::MemoryManager memory(64 * 1024, 64 * 1024, 64 * 1024);
+    auto& heap = memory.GetSegment(Memory::MemorySegmentType::HEAP);
+    auto& code = memory.GetSegment(Memory::MemorySegmentType::CODE);
+    const size_t heapSize = heap.GetSize();
+    heap.WriteUInt64(heapSize - 8, 7);
+    
+    int rejected = 0;
+    auto expectViolation = [&rejected](auto access) 
+    {
+        try 
+        {
+            access();
+        } 
+        catch (const Memory::MemoryAccessException&) 
+        {
+            rejected++;
+        }
+    };
+    expectViolation([&]() { heap.ReadUInt64(heapSize - 4); });
+    expectViolation([&]() { heap.ReadUInt64(SIZE_MAX - 2); });
+    expectViolation([&]() { heap.WriteUInt64(heapSize, 1); });
+    expectViolation([&]() { code.WriteUInt64(0, 1); });
+    
+    if (rejected != 4 || heap.ReadUInt64(heapSize - 8) != 7) 
+    {
+        LogTestResult("추적 로그", false, "접근 검사 오류: 거부 " + std::to_string(rejected) + "/4");
+        return false;
+    }
+    
+    LogTestResult("추적 로그", true, "DMVM_TRACE=" + std::to_string(DMVM_TRACE) + ", 걸러진 메시지는 평가하지 않음");
+    return true;
+}
+
+bool TestEngine::TestStackOwnership() 
+{
+    auto loop = Programs::CountdownLoop(2000);
+    
+    Engine::Interpreter owned;
+    owned.SetExecutionMode(Engine::ExecutionMode::Portable);
+    owned.SetVerificationEnabled(false);
+    owned.SetStackGuardEnabled(false);
+    owned.LoadBytecode(loop.data(), loop.size());
+    
+    if (owned.GetStackSharing() != Memory::StackSharing::Owned || owned.Execute() != 0) 
+    {
+        LogTestResult("스택 소유 스레드", false, "기본 스택 실행 실패");
+        return false;
+    }
+    
+    // 소유 스레드가 아닌 스레드의 접근은 검사 빌드에서 거부
+    bool foreignRejected = false;
+    std::thread([&]() 
+    {
+        try 
+        {
+            owned.GetStackPointer();
+        } 
+        catch (const std::logic_error&) 
+        {
+            foreignRejected = true;
+        }
+    }).join();
+    
+    if (foreignRejected != (DMVM_STACK_OWNER_CHECK != 0)) 
+    {
+        LogTestResult("스택 소유 스레드", false, "다른 스레드 접근 검사 오류");
+        return false;
+    }
+    
+    // Reset() 후에는 다른 스레드가 넘겨받아 실행
+    owned.Reset();
+    int handedOver = -1;
+    std::thread([&]() { handedOver = owned.Execute(); }).join();
+    owned.Reset();
+    
+    if (handedOver != 0 || owned.GetReturnValue() != 0) 
+    {
+        LogTestResult("스택 소유 스레드", false, "Reset() 후 다른 스레드 실행 실패");
+        return false;
+    }
+    
+    // Synchronized: 실행 중인 스택을 다른 스레드에서 조회
+    constexpr size_t stackSize = 64 * 1024;
+    Engine::Interpreter shared(64 * 1024, stackSize, 64 * 1024);
+    shared.SetExecutionMode(Engine::ExecutionMode::Portable);
+    shared.SetVerificationEnabled(false);
+    shared.SetStackGuardEnabled(false);
+    shared.SetStackSharing(Memory::StackSharing::Synchronized);
+    shared.LoadBytecode(loop.data(), loop.size());
+    
+    std::atomic<bool> done{false};
+    int sharedResult = -1;
+    std::thread runner([&]() 
+    {
+        for (int run = 0; run < 20; ++run) 
+        {
+            shared.Reset();
+            sharedResult = shared.Execute();
+            if (sharedResult != 0) 
+            {
+                break;
+            }
+        }
+        done = true;
+    });
+    
+    size_t observations = 0;
+    bool inspectionFailed = false;
+    while (!done) 
+    {
+        try 
+        {
+            inspectionFailed |= shared.GetStackPointer() > stackSize;
+            observations++;
+        } 
+        catch (const std::exception&) 
+        {
+            inspectionFailed = true;
+        }
+    }
+    runner.join();
+    
+    if (sharedResult != 0 || inspectionFailed) 
+    {
+        LogTestResult("스택 소유 스레드", false, "Synchronized 스택 조회 실패");
+        return false;
+    }
+    
+    LogTestResult("스택 소유 스레드", true, "DMVM_STACK_OWNER_CHECK=" + std::to_string(DMVM_STACK_OWNER_CHECK) 
+                  + ", Synchronized 조회 " + std::to_string(observations) + "회");
+    return true;
+}
+
+bool TestEngine::TestSnapshot() 
+{
+    using Engine::Opcode;
+    using Programs::Detail::Emit;
+    
+    // 초기화 (0번지): 7, 8을 스택에 남기고 힙 블록 p에 0x1234를 쓴 뒤 p 반환
+    std::vector<uint8_t> code;
+    Emit(code, Opcode::PUSH8, 7, 1);
+    Emit(code, Opcode::PUSH8, 8, 1);
+    Emit(code, Opcode::PUSH8, 32, 1);
+    Emit(code, Opcode::ALLOC);
+    Emit(code, Opcode::DUP);
+    Emit(code, Opcode::PUSH32, Memory::MemoryManager::kHeapBaseAddress, 4);
+    Emit(code, Opcode::ADD);
+    Emit(code, Opcode::PUSH16, 0x1234, 2);
+    Emit(code, Opcode::STORE64);
+    Emit(code, Opcode::HALT);
+    
+    // 요청 (인자 p): 블록 값을 읽고 0x9999로 덮어쓴 뒤 7 + 8 + 값 반환
+    const size_t request = code.size();
+    Emit(code, Opcode::PUSH32, Memory::MemoryManager::kHeapBaseAddress, 4);
+    Emit(code, Opcode::ADD);
+    Emit(code, Opcode::DUP);
+    Emit(code, Opcode::LOAD64);
+    Emit(code, Opcode::SWAP);
+    Emit(code, Opcode::PUSH16, 0x9999, 2);
+    Emit(code, Opcode::STORE64);
+    Emit(code, Opcode::ADD);
+    Emit(code, Opcode::ADD);
+    Emit(code, Opcode::HALT);
+    
+    Engine::Interpreter interpreter;
+    interpreter.LoadBytecode(code.data(), code.size());
+    if (interpreter.Execute() != 0) 
+    {
+        LogTestResult("스냅샷", false, "초기화 실행 실패");
+        return false;
+    }
+    
+    const uint64_t block = interpreter.GetReturnValue();
+    const size_t stackPointer = interpreter.GetStackPointer();
+    auto snapshot = interpreter.Snapshot();
+    
+    // 요청이 힙을 덮어써도 매번 초기화 직후 상태에서 시작
+    for (int run = 0; run < 3; ++run) 
+    {
+        interpreter.RestoreSnapshot(*snapshot);
+        if (interpreter.GetStackPointer() != stackPointer || interpreter.GetHeapStats().liveBlocks != 1) 
+        {
+            LogTestResult("스냅샷", false, "복원 후 SP/힙 할당 상태 불일치");
+            return false;
+        }
+        
+        interpreter.PushParameter(block);
+        if (interpreter.Execute(request) != 0 || interpreter.GetReturnValue() != 15 + 0x1234) 
+        {
+            LogTestResult("스냅샷", false, "복원 후 요청 결과 불일치: " + std::to_string(interpreter.GetReturnValue()));
+            return false;
+        }
+    }
+    
+    // 복원 후 할당은 스냅샷의 블록과 겹치지 않음
+    interpreter.RestoreSnapshot(*snapshot);
+    size_t second = interpreter.GetHeapStats().usedBytes;
+    if (second == 0 || block >= second) 
+    {
+        LogTestResult("스냅샷", false, "힙 할당기 상태가 복원되지 않음");
+        return false;
+    }
+    
+    // 파일로 저장 → 코드를 로드하지 않은 새 인스턴스에서 복원
+    const std::string path = (std::filesystem::temp_directory_path() / "dmvm_snapshot_test.bin").string();
+    snapshot->SaveToFile(path);
+    auto loaded = Memory::MemorySnapshot::LoadFromFile(path);
+    
+    Engine::Interpreter restarted;
+    restarted.RestoreSnapshot(*loaded);
+    restarted.PushParameter(block);
+    bool fileOk = restarted.Execute(request) == 0 && restarted.GetReturnValue() == 15 + 0x1234;
+    
+    // 형식이 맞지 않는 파일은 거부
+    bool corruptRejected = false;
+    {
+        std::ofstream corrupt(path, std::ios::binary | std::ios::trunc);
+        corrupt << "not a snapshot";
+    }
+    try 
+    {
+        Memory::MemorySnapshot::LoadFromFile(path);
+    } 
+    catch (const std::runtime_error&) 
+    {
+        corruptRejected = true;
+    }
+    std::filesystem::remove(path);
+    
+    if (!fileOk || !corruptRejected) 
+    {
+        LogTestResult("스냅샷", false, fileOk ? "손상된 파일을 받아들임" : "파일 스냅샷 복원 실패");
+        return false;
+    }
+    
+    LogTestResult("스냅샷", true, "이미지 " + std::to_string(snapshot->GetImageBytes()) + "바이트, " + 
+                  (snapshot->heap.IsFileBacked() ? "MAP_PRIVATE 매핑" : "복사") + " 복원");
+    return true;
+}
+
+bool TestEngine::TestBulkMemory() 
+{
+    using Memory::MemoryManager;
+    
+    // 관리자 수준: 채우기, 겹치는 복사(memmove), 비교 부호
+    MemoryManager memory(64 * 1024, 64 * 1024, 64 * 1024);
+    const size_t base = MemoryManager::kHeapBaseAddress;
+    memory.FillMemory(base, 0x11, 64);
+    memory.WriteUInt64(base, 0x0807060504030201ULL);
+    memory.CopyMemory(base + 4, base, 16);
+    if (memory.ReadUInt64(base + 8) != 0x1111111108070605ULL || memory.ReadUInt64(base + 24) != 0x1111111111111111ULL || 
+        memory.CompareMemory(base + 32, base + 40, 16) != 0 || memory.CompareMemory(base, base + 32, 8) != -1 || 
+        memory.CompareMemory(base + 32, base, 8) != 1) 
+    {
+        LogTestResult("블록 메모리 연산", false, "CopyMemory/FillMemory/CompareMemory 결과 오류");
+        return false;
+    }
+    
+    // 구간이 세그먼트 끝을 넘으면 아무것도 쓰지 않고 거부
+    auto& heap = memory.GetSegment(Memory::MemorySegmentType::HEAP);
+    const size_t dirtyEnd = heap.GetDirtyEnd();
+    int rejected = 0;
+    for (int operation = 0; operation < 3; ++operation) 
+    {
+        try 
+        {
+            const size_t end = base + heap.GetSize();
+            operation == 0 ? memory.CopyMemory(end - 8, base, 16) : 
+            operation == 1 ? memory.CopyMemory(base, end - 8, 16) : 
+                             memory.FillMemory(end - 8, 0, SIZE_MAX);
+        } 
+        catch (const Memory::MemoryAccessException&) 
+        {
+            rejected++;
+        }
+    }
+    if (rejected != 3 || heap.GetDirtyEnd() != dirtyEnd) 
+    {
+        LogTestResult("블록 메모리 연산", false, "범위를 벗어난 블록 연산이 허용되거나 구간이 기록됨");
+        return false;
+    }
+    
+    // MEMSET/MEMCPY/MEMCMP: 모든 모드, 검증 경로, 레지스터 VM이 LOAD64/STORE64 루프와 같은 결과
+    const uint64_t expected = 0x5A5A5A5A5A5A5A5AULL;
+    const std::vector<uint8_t> programs[] = {Programs::ScalarCopyLoop(4096), Programs::BulkCopy(4096)};
+    const Engine::ExecutionMode modes[] = {
+        Engine::ExecutionMode::Portable, Engine::ExecutionMode::Threaded, Engine::ExecutionMode::StackCached, 
+        Engine::ExecutionMode::Jit, Engine::ExecutionMode::Tiered
+    };
+    for (const auto& bytecode : programs) 
+    {
+        for (auto mode : modes) 
+        {
+            for (bool verification : {false, true}) 
+            {
+                Engine::Interpreter interpreter;
+                interpreter.SetExecutionMode(mode);
+                interpreter.SetVerificationEnabled(verification);
+                interpreter.LoadBytecode(bytecode.data(), bytecode.size());
+                if (interpreter.Execute() != 0 || interpreter.GetReturnValue() != expected) 
+                {
+                    LogTestResult("블록 메모리 연산", false, "실행 결과 오류 (모드 " + 
+                                  std::to_string(static_cast<int>(mode)) + "): " + 
+                                  std::to_string(interpreter.GetReturnValue()));
+                    return false;
+                }
+            }
+        }
+        
+        Engine::StackToRegisterTranslator translator;
+        Engine::RegisterModule module;
+        Engine::RegisterInterpreter registerInterpreter;
+        if (!translator.Translate(bytecode.data(), bytecode.size(), module) || !registerInterpreter.LoadModule(module) || 
+            registerInterpreter.Execute() != 0 || registerInterpreter.GetReturnValue() != expected) 
+        {
+            LogTestResult("블록 메모리 연산", false, "레지스터 VM 실행 결과 오류");
+            return false;
+        }
+    }
+    
+    LogTestResult("블록 메모리 연산", true, "4KB 복사: 루프 " + std::to_string(programs[0].size()) + "바이트, MEMCPY " + 
+                  std::to_string(programs[1].size()) + "바이트 코드");
+    return true;
+}
+
+bool TestEngine::TestStackFrames() 
+{
+    using Engine::Opcode;
+    
+    // 재귀 호출(호출마다 새 프레임)과 지역 변수 루프: 모든 모드, 검증 경로에서 같은 결과, 끝나면 프레임이 모두 정리됨
+    const std::vector<Programs::EngineProgram> programs = {
+        {"RecursiveSum(1000)", Programs::RecursiveSum(1000), 500500},
+        {"FrameSumLoop(1000)", Programs::FrameSumLoop(1000), 500500},
+        {"FunctionCall", Programs::FunctionCall(), 42}
+    };
+    const Engine::ExecutionMode modes[] = {
+        Engine::ExecutionMode::Portable, Engine::ExecutionMode::Threaded, Engine::ExecutionMode::StackCached, 
+        Engine::ExecutionMode::Jit, Engine::ExecutionMode::Tiered
+    };
+    for (const auto& program : programs) 
+    {
+        for (auto mode : modes) 
+        {
+            for (bool verification : {false, true}) 
+            {
+                Engine::Interpreter interpreter;
+                interpreter.SetExecutionMode(mode);
+                interpreter.SetVerificationEnabled(verification);
+                interpreter.LoadBytecode(program.bytecode.data(), program.bytecode.size());
+                const size_t emptyStack = interpreter.GetStackPointer();
+                
+                // 같은 인스턴스로 두 번 실행 (재진입 후에도 BP/SP가 처음 상태)
+                for (int run = 0; run < 2; ++run) 
+                {
+                    interpreter.Reset();
+                    if (interpreter.Execute() != 0 || interpreter.GetReturnValue() != program.expectedResult || 
+                        interpreter.GetStackPointer() != emptyStack || interpreter.GetBasePointer() != 0) 
+                    {
+                        LogTestResult("스택 프레임", false, program.name + " 실행 결과 오류 (모드 " + 
+                                      std::to_string(static_cast<int>(mode)) + "): " + 
+                                      std::to_string(interpreter.GetReturnValue()) + ", SP=" + 
+                                      std::to_string(interpreter.GetStackPointer()) + ", BP=" + 
+                                      std::to_string(interpreter.GetBasePointer()));
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+    
+    // 프레임 밖의 RET/LDLOC, 확보하지 않은 지역 변수 슬롯(스택 포인터 아래)은 실행 오류
+    const std::vector<std::pair<std::string, std::vector<uint8_t>>> invalidPrograms = {
+        {"프레임 밖 RET", {
+            static_cast<uint8_t>(Opcode::PUSH8), 1,
+            static_cast<uint8_t>(Opcode::RET), 0
+        }},
+        {"프레임 밖 LDLOC", {
+            static_cast<uint8_t>(Opcode::LDLOC), 0,
+            static_cast<uint8_t>(Opcode::HALT)
+        }},
+        {"확보하지 않은 슬롯", {
+            static_cast<uint8_t>(Opcode::PUSH8), 0x04,
+            static_cast<uint8_t>(Opcode::CALL),
+            static_cast<uint8_t>(Opcode::HALT),
+            static_cast<uint8_t>(Opcode::PUSH8), 7,
+            static_cast<uint8_t>(Opcode::STLOC), 1,
+            static_cast<uint8_t>(Opcode::LDLOC), 1,
+            static_cast<uint8_t>(Opcode::RET), 0
+        }}
+    };
+    for (const auto& [name, bytecode] : invalidPrograms) 
+    {
+        for (auto mode : modes) 
+        {
+            Engine::Interpreter interpreter;
+            interpreter.SetExecutionMode(mode);
+            interpreter.LoadBytecode(bytecode.data(), bytecode.size());
+            if (interpreter.Execute() != -1) 
+            {
+                LogTestResult("스택 프레임", false, name + "이 허용됨 (모드 " + std::to_string(static_cast<int>(mode)) + ")");
+                return false;
+            }
+        }
+    }
+    
+    LogTestResult("스택 프레임", true, "재귀 1000단계, 지역 변수 루프, 프레임 밖 접근 거부");
+    return true;
+}
+
+bool TestEngine::TestCallStack() 
+{
+    // 가장 깊은 곳에서 멈춘 재귀: 호출 스택은 전용 배열에 있고 VM 스택에는 단계마다 인자 하나만 남음
+    const uint16_t depth = 200;
+    const auto bytecode = Programs::RecursiveSum(depth, true);
+    const size_t callSite = 6;                  // main의 CALL 다음
+    const size_t sumEntry = 7;
+    const size_t recursiveCallSite = 20;        // sum 안 CALL 다음
+    const Engine::ExecutionMode modes[] = {
+        Engine::ExecutionMode::Portable, Engine::ExecutionMode::Threaded, Engine::ExecutionMode::StackCached, 
+        Engine::ExecutionMode::Jit, Engine::ExecutionMode::Tiered
+    };
+    for (auto mode : modes) 
+    {
+        Engine::Interpreter interpreter;
+        interpreter.SetExecutionMode(mode);
+        interpreter.LoadBytecode(bytecode.data(), bytecode.size());
+        const size_t emptyStack = interpreter.GetStackPointer();
+        
+        bool walked = interpreter.Execute() == 0 && interpreter.GetCallStack().size() == depth + 1u;
+        for (size_t i = 0; walked && i < interpreter.GetCallStack().size(); ++i) 
+        {
+            const auto& frame = interpreter.GetCallStack()[i];
+            walked = frame.entry == sumEntry && frame.returnAddress == (i == 0 ? callSite : recursiveCallSite);
+        }
+        if (!walked || emptyStack - interpreter.GetStackPointer() != (depth + 1u) * sizeof(uint64_t)) 
+        {
+            LogTestResult("호출 스택", false, "멈춘 재귀의 호출 스택 오류 (모드 " + std::to_string(static_cast<int>(mode)) + 
+                          "): 깊이 " + std::to_string(interpreter.GetCallStack().size()) + ", VM 스택 " + 
+                          std::to_string((emptyStack - interpreter.GetStackPointer()) / sizeof(uint64_t)) + "칸");
+            return false;
+        }
+    }
+    
+    // 멈춘 상태를 파일 스냅샷으로 옮겨 새 인스턴스에서 이어서 실행 (호출 스택도 함께 복원)
+    Engine::Interpreter suspended;
+    suspended.LoadBytecode(bytecode.data(), bytecode.size());
+    suspended.Execute();
+    auto snapshot = suspended.Snapshot();
+    const std::string path = (std::filesystem::temp_directory_path() / "dmvm_callstack_test.bin").string();
+    snapshot->SaveToFile(path);
+    auto loaded = Memory::MemorySnapshot::LoadFromFile(path);
+    std::filesystem::remove(path);
+    
+    Engine::Interpreter resumed;
+    resumed.RestoreSnapshot(*loaded);
+    if (resumed.GetCallStack().size() != depth + 1u || 
+        resumed.Execute(static_cast<size_t>(loaded->instructionPointer)) != 0 || 
+        resumed.GetReturnValue() != depth * (depth + 1u) / 2 || !resumed.GetCallStack().empty() || resumed.GetBasePointer() != 0) 
+    {
+        LogTestResult("호출 스택", false, "스냅샷에서 이어 실행한 결과 오류: " + std::to_string(resumed.GetReturnValue()));
+        return false;
+    }
+    
+    // 최대 호출 깊이: 정확히 그 깊이까지는 실행, 한 단계 더 깊으면 실행 오류
+    const auto fits = Programs::RecursiveSum(99);
+    const auto overflows = Programs::RecursiveSum(100);
+    Engine::Interpreter limited;
+    limited.SetMaxCallDepth(100);
+    limited.LoadBytecode(fits.data(), fits.size());
+    bool fitOk = limited.Execute() == 0 && limited.GetReturnValue() == 4950;
+    limited.LoadBytecode(overflows.data(), overflows.size());
+    bool overflowRejected = limited.Execute() == -1;
+    if (!fitOk || !overflowRejected) 
+    {
+        LogTestResult("호출 스택", false, fitOk ? "최대 호출 깊이를 넘는 재귀가 실행됨" : "최대 깊이 안의 재귀가 실패");
+        return false;
+    }
+    
+    LogTestResult("호출 스택", true, "깊이 " + std::to_string(depth + 1) + " 순회, 스냅샷 이어 실행, 최대 깊이 100");
+    return true;
+}
+
+bool TestEngine::TestTailCall() 
+{
+    // 최대 호출 깊이(기본 16384)보다 깊은 재귀: CALL은 실패하고 TAILCALL은 프레임 하나로 끝까지 실행
+    const uint32_t n = 100000;
+    const uint64_t expected = static_cast<uint64_t>(n) * (n + 1) / 2;
+    const auto tail = Programs::TailRecursiveSum(n, true);
+    const auto nonTail = Programs::TailRecursiveSum(n, false);
+    const Engine::ExecutionMode modes[] = {
+        Engine::ExecutionMode::Portable, Engine::ExecutionMode::Threaded, Engine::ExecutionMode::StackCached, 
+        Engine::ExecutionMode::Jit, Engine::ExecutionMode::Tiered
+    };
+    for (auto mode : modes) 
+    {
+        // 최대 깊이 1: main이 부른 sum 프레임 하나만 허용
+        Engine::Interpreter interpreter;
+        interpreter.SetExecutionMode(mode);
+        interpreter.SetMaxCallDepth(1);
+        interpreter.LoadBytecode(tail.data(), tail.size());
+        const size_t emptyStack = interpreter.GetStackPointer();
+        if (interpreter.Execute() != 0 || static_cast<uint64_t>(interpreter.GetReturnValue()) != expected || 
+            interpreter.GetStackPointer() != emptyStack || !interpreter.GetCallStack().empty()) 
+        {
+            LogTestResult("꼬리 호출", false, "TAILCALL 재귀 실행 오류 (모드 " + std::to_string(static_cast<int>(mode)) + 
+                          "): " + std::to_string(interpreter.GetReturnValue()));
+            return false;
+        }
+        
+        Engine::Interpreter deep;
+        deep.SetExecutionMode(mode);
+        deep.LoadBytecode(nonTail.data(), nonTail.size());
+        if (deep.Execute() != -1) 
+        {
+            LogTestResult("꼬리 호출", false, "최대 호출 깊이를 넘는 CALL 재귀가 실행됨 (모드 " + 
+                          std::to_string(static_cast<int>(mode)) + ")");
+            return false;
+        }
+    }
+    
+    // 활성 프레임 밖의 TAILCALL은 실행 오류
+    const uint8_t orphan[] = {
+        static_cast<uint8_t>(Engine::Opcode::PUSH8), 0,
+        static_cast<uint8_t>(Engine::Opcode::TAILCALL), 0, 0,
+        static_cast<uint8_t>(Engine::Opcode::HALT)
+    };
+    Engine::Interpreter interpreter;
+    interpreter.LoadBytecode(orphan, sizeof(orphan));
+    if (interpreter.Execute() != -1) 
+    {
+        LogTestResult("꼬리 호출", false, "프레임 밖의 TAILCALL이 실행됨");
+        return false;
+    }
+    
+    LogTestResult("꼬리 호출", true, "sum(" + std::to_string(n) + ") 최대 깊이 1로 실행, CALL 재귀는 깊이 초과");
+    return true;
+}
+
 } // namespace Tests
 } // namespace DarkMatterVM
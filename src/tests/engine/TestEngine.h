@@ -55,6 +55,30 @@ private:
     bool TestMemorySegments();
     bool TestInterpreterState();
     bool TestFunctionCall();
+    bool TestExecutionModes();
+    bool TestInstructionStream();
+    bool TestSuperinstructions();
+    bool TestStackCache();
+    bool TestRegisterVM();
+    bool TestJit();
+    bool TestTieredExecution();
+    bool TestBatchExecution();
+    bool TestLaneExecution();
+    bool TestVerifier();
+    bool TestInterpreterPool();
+    bool TestMappedSegments();
+    bool TestStackGuard();
+    bool TestAddressSpace();
+    bool TestHeapAllocator();
+    bool TestHeapGrowth();
+    bool TestArenaAllocator();
+    bool TestTraceGating();
+    bool TestStackOwnership();
+    bool TestSnapshot();
+    bool TestBulkMemory();
+    bool TestStackFrames();
+    bool TestCallStack();
+    bool TestTailCall();
     
     // 헬퍼 메서드들
     bool ExecuteBytecode(const std::vector<uint8_t>& bytecode, uint64_t expectedResult = 0);
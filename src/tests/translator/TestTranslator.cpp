@@ -1,4 +1,5 @@
 #include "TestTranslator.h"
+#include "TranslatorPrograms.h"
 #include <iostream>
 #include <sstream>
 
@@ -29,6 +30,9 @@ bool TestTranslator::RunAllTests()
         {"바이트코드 실행", [this]() { return TestBytecodeExecution(); }},
         {"오류 처리", [this]() { return TestErrorHandling(); }},
         {"Visitor 파이프라인", [this]() { return TestVisitorPipeline(); }},
+        {"배열 초기화와 복사", [this]() { return TestArrayLowering(); }},
+        {"함수 지역 변수 프레임", [this]() { return TestFunctionFrames(); }},
+        {"꼬리 호출", [this]() { return TestTailCalls(); }},
         {"난독화 무결성", [this]() { return TestObfuscationIntegrity(); }}
     };
     
@@ -65,6 +69,9 @@ bool TestTranslator::RunTest(const std::string& testName)
     if (testName == "바이트코드 실행") return TestBytecodeExecution();
     if (testName == "오류 처리") return TestErrorHandling();
     if (testName == "Visitor 파이프라인") return TestVisitorPipeline();
+    if (testName == "배열 초기화와 복사") return TestArrayLowering();
+    if (testName == "함수 지역 변수 프레임") return TestFunctionFrames();
+    if (testName == "꼬리 호출") return TestTailCalls();
     std::cout << "알 수 없는 테스트: " << testName << std::endl;
     return false;
 }
@@ -318,6 +325,138 @@ bool TestTranslator::TestVisitorPipeline()
     return true;
 }
 
+bool TestTranslator::TestArrayLowering()
+{
+    std::string cppCode = R"(
+        int a[64] = 7;
+        int b[64] = a;
+        int c[16] = 0;
+        int d[3];
+        int x = 5;
+    )";
+
+    Translator::Translator cleanTr;
+    if (cleanTr.TranslateFromCpp(cppCode, "array_module") != Translator::TranslationResult::Success)
+    {
+        LogTestResult("배열 초기화와 복사", false, "번역 실패");
+        return false;
+    }
+
+    // 명령어 단위로 훑어 블록 명령어 수 확인 (a: 첫 원소 저장 후 MEMCPY 6번, b: MEMCPY 1번, c/d: MEMSET)
+    std::vector<uint8_t> bytecode = cleanTr.GetBytecode();
+    int copies = 0;
+    int fills = 0;
+    int scalarStores = 0;
+    for (size_t i = 0; i < bytecode.size(); i += 1 + Engine::GetOpcodeInfo(static_cast<Engine::Opcode>(bytecode[i])).operandSize)
+    {
+        copies += bytecode[i] == static_cast<uint8_t>(Engine::Opcode::MEMCPY);
+        fills += bytecode[i] == static_cast<uint8_t>(Engine::Opcode::MEMSET);
+        scalarStores += bytecode[i] == static_cast<uint8_t>(Engine::Opcode::STORE64);
+    }
+    if (copies != 7 || fills != 2 || scalarStores != 2)
+    {
+        LogTestResult("배열 초기화와 복사", false, "블록 명령어 수 오류: MEMCPY " + std::to_string(copies) + 
+                      ", MEMSET " + std::to_string(fills) + ", STORE64 " + std::to_string(scalarStores));
+        return false;
+    }
+
+    // 마지막 HALT 앞에서 b의 마지막 원소를 읽어 반환 값으로 확인
+    const auto& symbols = cleanTr.GetSymbolTable();
+    const uint64_t lastElement = symbols.at("b").address + 63 * 8;
+    bytecode.pop_back();
+    bytecode.push_back(static_cast<uint8_t>(Engine::Opcode::PUSH64));
+    for (int i = 0; i < 8; ++i)
+    {
+        bytecode.push_back(static_cast<uint8_t>(lastElement >> (i * 8)));
+    }
+    bytecode.push_back(static_cast<uint8_t>(Engine::Opcode::LOAD64));
+    bytecode.push_back(static_cast<uint8_t>(Engine::Opcode::HALT));
+
+    _interpreter->Reset();
+    if (!ExecuteBytecode(bytecode) || _interpreter->GetReturnValue() != 7 || symbols.at("x").address != symbols.at("d").address + 24)
+    {
+        LogTestResult("배열 초기화와 복사", false, "실행 결과 오류: " + std::to_string(_interpreter->GetReturnValue()));
+        return false;
+    }
+
+    // 배열은 값으로 쓸 수 없고, 크기가 다른 배열로 초기화할 수 없으며, 바이트 길이가 int32 범위를 넘을 수 없음 (2^28개 = 2GiB)
+    Translator::Translator rejectTr;
+    if (rejectTr.TranslateFromCpp("int a[4] = 0; int y = a;", "array_reject") == Translator::TranslationResult::Success ||
+        rejectTr.TranslateFromCpp("int a[4] = 0; int b[8] = a;", "array_reject") == Translator::TranslationResult::Success ||
+        rejectTr.TranslateFromCpp("int a[268435456] = 0;", "array_reject") == Translator::TranslationResult::Success)
+    {
+        LogTestResult("배열 초기화와 복사", false, "잘못된 배열 사용이 번역됨");
+        return false;
+    }
+
+    LogTestResult("배열 초기화와 복사", true, "MEMCPY " + std::to_string(copies) + "개, MEMSET " + std::to_string(fills) + "개");
+    return true;
+}
+
+bool TestTranslator::TestFunctionFrames()
+{
+    // sum(100): 재귀 호출마다 매개변수 n과 지역 변수 rest가 자기 프레임에 있어야 합이 맞음
+    const auto bytecode = Programs::GenerateRecursiveSum(100);
+
+    // 함수 안 변수는 BP 상대 슬롯으로만 접근 (절대 주소 LOAD64/STORE64 없음)
+    int frameAccesses = 0;
+    int absoluteAccesses = 0;
+    for (size_t i = 0; i < bytecode.size(); i += 1 + Engine::GetOpcodeInfo(static_cast<Engine::Opcode>(bytecode[i])).operandSize)
+    {
+        const auto opcode = static_cast<Engine::Opcode>(bytecode[i]);
+        frameAccesses += opcode == Engine::Opcode::LDLOC || opcode == Engine::Opcode::STLOC || opcode == Engine::Opcode::LDARG;
+        absoluteAccesses += opcode == Engine::Opcode::LOAD64 || opcode == Engine::Opcode::STORE64;
+    }
+    if (frameAccesses == 0 || absoluteAccesses != 0)
+    {
+        LogTestResult("함수 지역 변수 프레임", false, "프레임 접근 " + std::to_string(frameAccesses) + 
+                      "개, 절대 주소 접근 " + std::to_string(absoluteAccesses) + "개");
+        return false;
+    }
+
+    _interpreter->Reset();
+    if (!ExecuteBytecode(bytecode) || _interpreter->GetReturnValue() != 5050)
+    {
+        LogTestResult("함수 지역 변수 프레임", false, "실행 결과 오류: " + std::to_string(_interpreter->GetReturnValue()));
+        return false;
+    }
+
+    LogTestResult("함수 지역 변수 프레임", true, "sum(100)=5050, 프레임 접근 " + std::to_string(frameAccesses) + "개");
+    return true;
+}
+
+bool TestTranslator::TestTailCalls()
+{
+    // sum(100000, 0): 호출 스택 최대 깊이(기본 16384)보다 깊은 재귀도 꼬리 호출이면 프레임 하나로 실행
+    constexpr int64_t n = 100000;
+    const auto bytecode = Programs::GenerateTailRecursiveSum(n);
+
+    // return sum(...) 두 곳은 TAILCALL, main 진입만 CALL
+    int calls = 0;
+    int tailCalls = 0;
+    for (size_t i = 0; i < bytecode.size(); i += 1 + Engine::GetOpcodeInfo(static_cast<Engine::Opcode>(bytecode[i])).operandSize)
+    {
+        const auto opcode = static_cast<Engine::Opcode>(bytecode[i]);
+        calls += opcode == Engine::Opcode::CALL;
+        tailCalls += opcode == Engine::Opcode::TAILCALL;
+    }
+    if (calls != 1 || tailCalls != 2)
+    {
+        LogTestResult("꼬리 호출", false, "CALL " + std::to_string(calls) + "개, TAILCALL " + std::to_string(tailCalls) + "개");
+        return false;
+    }
+
+    _interpreter->Reset();
+    if (!ExecuteBytecode(bytecode) || _interpreter->GetReturnValue() != n * (n + 1) / 2)
+    {
+        LogTestResult("꼬리 호출", false, "실행 결과 오류: " + std::to_string(_interpreter->GetReturnValue()));
+        return false;
+    }
+
+    LogTestResult("꼬리 호출", true, "sum(100000)=" + std::to_string(_interpreter->GetReturnValue()) + ", TAILCALL " + std::to_string(tailCalls) + "개");
+    return true;
+}
+
 // 헬퍼 메서드 구현들
 bool TestTranslator::ExecuteBytecode(const std::vector<uint8_t>& bytecode) 
 {
@@ -57,6 +57,9 @@ private:
     bool TestErrorHandling();
     bool TestObfuscationIntegrity();
     bool TestVisitorPipeline();
+    bool TestArrayLowering();
+    bool TestFunctionFrames();
+    bool TestTailCalls();
     
     // 헬퍼 메서드들
     bool ExecuteBytecode(const std::vector<uint8_t>& bytecode);
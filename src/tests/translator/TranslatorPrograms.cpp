@@ -0,0 +1,86 @@
+#include "TranslatorPrograms.h"
+#include "../../translator/ast/ASTNodeFactory.h"
+#include "../../translator/ast/nodes/FunctionCallNode.h"
+#include "../../translator/ast/nodes/FunctionDeclNode.h"
+#include "../../translator/ast/nodes/IfStatementNode.h"
+#include "../../translator/ast/nodes/ReturnStatementNode.h"
+#include "../../translator/ast/visitor/BytecodeGeneratorVisitor.h"
+
+namespace DarkMatterVM
+{
+namespace Tests
+{
+namespace Programs
+{
+
+using namespace Translator;
+
+std::vector<uint8_t> GenerateRecursiveSum(int64_t n)
+{
+    // if (n) { int rest = sum(n - 1); return rest + n; }
+    std::vector<std::unique_ptr<ASTNode>> innerArgs;
+    innerArgs.push_back(ASTNodeFactory::CreateBinaryOp(BinaryOpType::Subtract, ASTNodeFactory::CreateVariable("n"),
+                                                       ASTNodeFactory::CreateIntegerLiteral(1)));
+    auto recurse = ASTNodeFactory::CreateBlock();
+    recurse->AddStatement(ASTNodeFactory::CreateVariableDecl("int", "rest",
+                          std::make_unique<FunctionCallNode>("sum", std::move(innerArgs))));
+    recurse->AddStatement(std::make_unique<ReturnStatementNode>(
+        ASTNodeFactory::CreateBinaryOp(BinaryOpType::Add, ASTNodeFactory::CreateVariable("rest"), ASTNodeFactory::CreateVariable("n"))));
+
+    auto sumBody = ASTNodeFactory::CreateBlock();
+    sumBody->AddStatement(std::make_unique<IfStatementNode>(ASTNodeFactory::CreateVariable("n"), std::move(recurse), nullptr));
+    sumBody->AddStatement(std::make_unique<ReturnStatementNode>(ASTNodeFactory::CreateIntegerLiteral(0)));
+
+    // return sum(n);
+    std::vector<std::unique_ptr<ASTNode>> mainArgs;
+    mainArgs.push_back(ASTNodeFactory::CreateIntegerLiteral(n));
+    auto mainBody = ASTNodeFactory::CreateBlock();
+    mainBody->AddStatement(std::make_unique<ReturnStatementNode>(std::make_unique<FunctionCallNode>("sum", std::move(mainArgs))));
+
+    auto program = ASTNodeFactory::CreateProgram();
+    program->AddDeclaration(std::make_unique<FunctionDeclNode>("int", "sum",
+                            std::vector<std::pair<std::string, std::string>>{{"int", "n"}}, std::move(sumBody)));
+    program->AddDeclaration(std::make_unique<FunctionDeclNode>("int", "main",
+                            std::vector<std::pair<std::string, std::string>>{}, std::move(mainBody)));
+
+    BytecodeGeneratorVisitor generator;
+    program->Accept(generator);
+    return generator.GetBytecode();
+}
+
+std::vector<uint8_t> GenerateTailRecursiveSum(int64_t n)
+{
+    // if (n) { return sum(n - 1, acc + n); }
+    std::vector<std::unique_ptr<ASTNode>> innerArgs;
+    innerArgs.push_back(ASTNodeFactory::CreateBinaryOp(BinaryOpType::Subtract, ASTNodeFactory::CreateVariable("n"),
+                                                       ASTNodeFactory::CreateIntegerLiteral(1)));
+    innerArgs.push_back(ASTNodeFactory::CreateBinaryOp(BinaryOpType::Add, ASTNodeFactory::CreateVariable("acc"),
+                                                       ASTNodeFactory::CreateVariable("n")));
+    auto recurse = ASTNodeFactory::CreateBlock();
+    recurse->AddStatement(std::make_unique<ReturnStatementNode>(std::make_unique<FunctionCallNode>("sum", std::move(innerArgs))));
+
+    auto sumBody = ASTNodeFactory::CreateBlock();
+    sumBody->AddStatement(std::make_unique<IfStatementNode>(ASTNodeFactory::CreateVariable("n"), std::move(recurse), nullptr));
+    sumBody->AddStatement(std::make_unique<ReturnStatementNode>(ASTNodeFactory::CreateVariable("acc")));
+
+    // return sum(n, 0);
+    std::vector<std::unique_ptr<ASTNode>> mainArgs;
+    mainArgs.push_back(ASTNodeFactory::CreateIntegerLiteral(n));
+    mainArgs.push_back(ASTNodeFactory::CreateIntegerLiteral(0));
+    auto mainBody = ASTNodeFactory::CreateBlock();
+    mainBody->AddStatement(std::make_unique<ReturnStatementNode>(std::make_unique<FunctionCallNode>("sum", std::move(mainArgs))));
+
+    auto program = ASTNodeFactory::CreateProgram();
+    program->AddDeclaration(std::make_unique<FunctionDeclNode>("int", "sum",
+                            std::vector<std::pair<std::string, std::string>>{{"int", "n"}, {"int", "acc"}}, std::move(sumBody)));
+    program->AddDeclaration(std::make_unique<FunctionDeclNode>("int", "main",
+                            std::vector<std::pair<std::string, std::string>>{}, std::move(mainBody)));
+
+    BytecodeGeneratorVisitor generator;
+    program->Accept(generator);
+    return generator.GetBytecode();
+}
+
+} // namespace Programs
+} // namespace Tests
+} // namespace DarkMatterVM
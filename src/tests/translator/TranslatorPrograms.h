@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace DarkMatterVM
+{
+namespace Tests
+{
+
+/**
+ * @brief Translator 테스트용 AST 프로그램
+ *
+ * 파서가 아직 만들지 않는 노드(함수 선언/호출/return/if)로 AST를 직접 구성해 BytecodeGeneratorVisitor로 생성
+ * (BytecodeGeneratorVisitor.h와 Translator.h는 같은 이름의 SymbolInfo를 정의하므로 별도 번역 단위에 둠)
+ */
+namespace Programs
+{
+
+/**
+ * @brief int sum(int n) { if (n) { int rest = sum(n - 1); return rest + n; } return 0; }
+ *        int main() { return sum(n); }
+ *
+ * @param n main이 넘기는 인자 (결과: n * (n + 1) / 2)
+ * @return std::vector<uint8_t> 생성된 바이트코드
+ */
+std::vector<uint8_t> GenerateRecursiveSum(int64_t n);
+
+/**
+ * @brief int sum(int n, int acc) { if (n) { return sum(n - 1, acc + n); } return acc; }
+ *        int main() { return sum(n, 0); }
+ *
+ * 두 return 문의 호출은 모두 꼬리 호출 (TAILCALL)
+ *
+ * @param n main이 넘기는 인자 (결과: n * (n + 1) / 2)
+ * @return std::vector<uint8_t> 생성된 바이트코드
+ */
+std::vector<uint8_t> GenerateTailRecursiveSum(int64_t n);
+
+} // namespace Programs
+
+} // namespace Tests
+} // namespace DarkMatterVM
@@ -103,7 +103,7 @@ std::vector<Token> TokenizeSimpleCpp(const std::string& code)
         {
             tokens.emplace_back(Token::NUMBER, word);
         } 
-        else if (std::regex_match(word, std::regex("[a-zA-Z_][a-zA-Z0-9_]*"))) 
+        else if (std::regex_match(word, std::regex("[a-zA-Z_][a-zA-Z0-9_]*(\\[\\d+\\])?"))) 
         {
             tokens.emplace_back(Token::IDENTIFIER, word);
         } 
@@ -211,7 +211,7 @@ public:
         throw std::runtime_error("예상하지 못한 토큰: " + CurrentToken().value);
     }
     
-    // 변수 선언 파싱 (int x = expression;)
+    // 변수 선언 파싱 (int x = expression; 또는 배열 int a[N] = expression;)
     std::unique_ptr<ASTNode> ParseVariableDeclaration() 
     {
         if (!Match(Token::INT_KEYWORD)) 
@@ -225,8 +225,23 @@ public:
         }
         
         std::string varName = CurrentToken().value;
+        std::string varType = "int";
         Advance();
         
+        // 배열 선언자는 타입에 원소 수를 붙임 (int[N])
+        std::smatch arrayMatch;
+        if (std::regex_match(varName, arrayMatch, std::regex("([a-zA-Z_][a-zA-Z0-9_]*)\\[(\\d+)\\]"))) 
+        {
+            varType = "int[" + arrayMatch[2].str() + "]";
+            varName = arrayMatch[1].str();
+            
+            // 배열은 초기화 식 없이 선언 가능 (0으로 채움)
+            if (Match(Token::SEMICOLON)) 
+            {
+                return std::make_unique<VariableDeclNode>(varType, varName);
+            }
+        }
+        
         if (!Match(Token::ASSIGN)) 
         {
             throw std::runtime_error("'=' 를 예상했습니다");
@@ -239,7 +254,7 @@ public:
             throw std::runtime_error("';' 를 예상했습니다");
         }
         
-        return std::make_unique<VariableDeclNode>("int", varName, std::move(initializer));
+        return std::make_unique<VariableDeclNode>(varType, varName, std::move(initializer));
     }
     
     // 프로그램 파싱 (여러 문장)
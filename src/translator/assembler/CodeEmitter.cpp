@@ -42,6 +42,9 @@ static const std::map<std::string, Engine::Opcode> s_opcodeMap =
     {"STORE16", Engine::Opcode::STORE16},
     {"STORE32", Engine::Opcode::STORE32},
     {"STORE64", Engine::Opcode::STORE64},
+    {"MEMCPY", Engine::Opcode::MEMCPY},
+    {"MEMSET", Engine::Opcode::MEMSET},
+    {"MEMCMP", Engine::Opcode::MEMCMP},
     
     {"JMP", Engine::Opcode::JMP},
     {"JZ", Engine::Opcode::JZ},
@@ -53,9 +56,16 @@ static const std::map<std::string, Engine::Opcode> s_opcodeMap =
     
     {"CALL", Engine::Opcode::CALL},
     {"RET", Engine::Opcode::RET},
+    {"TAILCALL", Engine::Opcode::TAILCALL},
+    {"LDLOC", Engine::Opcode::LDLOC},
+    {"STLOC", Engine::Opcode::STLOC},
+    {"LDARG", Engine::Opcode::LDARG},
     
     {"ALLOC", Engine::Opcode::ALLOC},
     {"FREE", Engine::Opcode::FREE},
+    {"ARENA_BEGIN", Engine::Opcode::ARENA_BEGIN},
+    {"ARENA_ALLOC", Engine::Opcode::ARENA_ALLOC},
+    {"ARENA_RESET", Engine::Opcode::ARENA_RESET},
     
     {"HOSTCALL", Engine::Opcode::HOSTCALL},
     {"THREAD", Engine::Opcode::THREAD},
@@ -3,18 +3,118 @@
 #include "../nodes/VariableNodes.h"
 #include "../nodes/OperatorNodes.h"
 #include "../nodes/ContainerNodes.h"
+#include "../nodes/FunctionDeclNode.h"
+#include "../nodes/FunctionCallNode.h"
+#include "../nodes/ReturnStatementNode.h"
+#include "../nodes/IfStatementNode.h"
+#include "../nodes/WhileLoopNode.h"
+#include "../nodes/ForLoopNode.h"
+#include <controlflow/FrameLayout.h>
 #include <iostream>
 #include <sstream>
 #include <iomanip>
 #include <cstring>
+#include <limits>
 
 namespace DarkMatterVM 
 {
 namespace Translator 
 {
 
+namespace 
+{
+
+// LDLOC/STLOC/LDARG 인덱스와 RET 인자 수는 1바이트
+constexpr size_t kMaxFrameSlots = std::numeric_limits<uint8_t>::max() + 1;
+
+/**
+ * @brief 함수 본문 사전 조사 (프롤로그에서 확보할 지역 변수 슬롯 수, 임시 할당 여부)
+ */
+class FrameScanner : public ASTVisitor 
+{
+public:
+	size_t localCount = 0;
+	bool allocates = false;
+	
+	void Visit(const StringLiteralNode*) override { allocates = true; }
+	void Visit(const VariableDeclNode* node) override 
+	{
+		localCount++;
+		Scan(node->GetInitializer());
+	}
+	void Visit(const BinaryOpNode* node) override 
+	{
+		Scan(node->GetLeft());
+		Scan(node->GetRight());
+	}
+	void Visit(const UnaryOpNode* node) override { Scan(node->GetOperand()); }
+	void Visit(const IfStatementNode* node) override 
+	{
+		Scan(node->GetCondition());
+		Scan(node->GetThenBlock());
+		Scan(node->GetElseBlock());
+	}
+	void Visit(const WhileLoopNode* node) override 
+	{
+		Scan(node->GetCondition());
+		Scan(node->GetBody());
+	}
+	void Visit(const ForLoopNode* node) override 
+	{
+		Scan(node->GetInitializer());
+		Scan(node->GetCondition());
+		Scan(node->GetIncrement());
+		Scan(node->GetBody());
+	}
+	void Visit(const ReturnStatementNode* node) override { Scan(node->GetExpr()); }
+	void Visit(const FunctionCallNode* node) override 
+	{
+		for (const auto& argument : node->GetArguments()) 
+		{
+			Scan(argument.get());
+		}
+	}
+	void Visit(const BlockNode* node) override 
+	{
+		for (const auto& stmt : node->GetStatements()) 
+		{
+			Scan(stmt.get());
+		}
+	}
+	
+private:
+	void Scan(const ASTNode* node) 
+	{
+		if (node) 
+		{
+			node->Accept(*this);
+		}
+	}
+};
+
+// 문장으로 쓰여 결과 값을 버려야 하는 식
+bool IsExpression(const ASTNode* node) 
+{
+	switch (node->GetType()) 
+	{
+		case NodeType::IntegerLiteral:
+		case NodeType::FloatLiteral:
+		case NodeType::StringLiteral:
+		case NodeType::BooleanLiteral:
+		case NodeType::Variable:
+		case NodeType::BinaryOp:
+		case NodeType::UnaryOp:
+		case NodeType::FunctionCall:
+			return true;
+		default:
+			return false;
+	}
+}
+
+} // namespace
+
 BytecodeGeneratorVisitor::BytecodeGeneratorVisitor() 
-	: _currentAddress(0) 
+	: _currentAddress(0), _currentFunction(nullptr), _localCount(0), _reservedLocals(0), _localAllocationDepth(0) 
 {
 	Reset();
 }
@@ -24,6 +124,13 @@ void BytecodeGeneratorVisitor::Reset()
 	_bytecode.clear();
 	_symbolTable.clear();
 	_currentAddress = 0;
+	_functions.clear();
+	_callFixups.clear();
+	_localSymbols.clear();
+	_currentFunction = nullptr;
+	_localCount = 0;
+	_reservedLocals = 0;
+	_localAllocationDepth = 0;
 }
 
 std::string BytecodeGeneratorVisitor::DumpBytecode() const 
@@ -98,30 +205,176 @@ void BytecodeGeneratorVisitor::EmitOpcode(DarkMatterVM::Engine::Opcode opcode)
 	EmitByte(static_cast<uint8_t>(opcode));
 }
 
+void BytecodeGeneratorVisitor::BeginLocalAllocations() 
+{
+	EmitOpcode(Engine::Opcode::ARENA_BEGIN);
+	_localAllocationDepth++;
+}
+
+void BytecodeGeneratorVisitor::EmitLocalAllocationsExit() 
+{
+	if (_localAllocationDepth == 0) 
+	{
+		throw std::runtime_error("열려 있는 지역 할당 구역이 없습니다.");
+	}
+	
+	EmitOpcode(Engine::Opcode::ARENA_RESET);
+}
+
+void BytecodeGeneratorVisitor::EndLocalAllocations() 
+{
+	if (_localAllocationDepth == 0) 
+	{
+		throw std::runtime_error("열려 있는 지역 할당 구역이 없습니다.");
+	}
+	
+	_localAllocationDepth--;
+}
+
+void BytecodeGeneratorVisitor::EmitAllocation() 
+{
+	// 함수 안의 임시 할당은 아레나에서 포인터 증가만으로 받고 함수를 나갈 때 한 번에 해제
+	EmitOpcode(_localAllocationDepth > 0 ? Engine::Opcode::ARENA_ALLOC : Engine::Opcode::ALLOC);
+}
+
 void BytecodeGeneratorVisitor::RegisterVariable(const std::string& name, const std::string& type) 
 {
+	// 함수 안: 프롤로그에서 확보한 다음 지역 변수 슬롯 (BP 기준)
+	if (_currentFunction) 
+	{
+		if (_localSymbols.find(name) != _localSymbols.end()) 
+		{
+			throw std::runtime_error("변수 '" + name + "'가 이미 정의되어 있습니다.");
+		}
+		if (_localCount >= _reservedLocals) 
+		{
+			throw std::runtime_error("함수 '" + _currentFunction->GetName() + "'의 지역 변수 슬롯이 부족합니다.");
+		}
+		
+		_localSymbols.emplace(name, SymbolInfo(name, type, _localCount++));
+		return;
+	}
+	
 	// 이미 존재하는 변수인지 확인
 	if (_symbolTable.find(name) != _symbolTable.end()) 
 	{
 		throw std::runtime_error("변수 '" + name + "'가 이미 정의되어 있습니다.");
 	}
 	
-	// 새 변수 등록
-	_symbolTable.emplace(name, SymbolInfo(name, type, _currentAddress));
+	// 새 전역 변수 등록
+	_symbolTable.emplace(name, SymbolInfo(name, type, _currentAddress, true));
 	
 	// 다음 변수를 위한 주소 업데이트 (8바이트 정렬)
 	_currentAddress += 8;
 }
 
-size_t BytecodeGeneratorVisitor::GetVariableAddress(const std::string& name) 
+const SymbolInfo& BytecodeGeneratorVisitor::GetVariable(const std::string& name) 
 {
+	auto local = _localSymbols.find(name);
+	if (local != _localSymbols.end()) 
+	{
+		return local->second;
+	}
+	
 	auto it = _symbolTable.find(name);
 	if (it == _symbolTable.end()) 
 	{
 		throw std::runtime_error("정의되지 않은 변수: " + name);
 	}
 	
-	return it->second.address;
+	return it->second;
+}
+
+size_t BytecodeGeneratorVisitor::GetVariableAddress(const std::string& name) 
+{
+	return GetVariable(name).address;
+}
+
+void BytecodeGeneratorVisitor::EmitStoreVariable(const SymbolInfo& symbol) 
+{
+	if (symbol.isArgument) 
+	{
+		throw std::runtime_error("매개변수 '" + symbol.name + "'에는 저장할 수 없습니다.");
+	}
+	
+	// 지역 변수: BP 기준 슬롯에 바로 저장 (주소 푸시 없음)
+	if (!symbol.isGlobal) 
+	{
+		EmitOpcode(Engine::Opcode::STLOC);
+		EmitByte(static_cast<uint8_t>(symbol.address));
+		return;
+	}
+	
+	EmitOpcode(Engine::Opcode::PUSH32);
+	EmitInt32(static_cast<int32_t>(symbol.address));
+	
+	// STORE64는 값 → 주소 순으로 pop 하므로 SWAP으로 순서 교환
+	EmitOpcode(Engine::Opcode::SWAP);
+	
+	// 값 저장 (64비트 변수 가정)
+	EmitOpcode(Engine::Opcode::STORE64);
+}
+
+void BytecodeGeneratorVisitor::EmitReturn() 
+{
+	if (!_currentFunction) 
+	{
+		throw std::runtime_error("함수 밖의 return 문은 지원하지 않습니다.");
+	}
+	
+	if (_localAllocationDepth > 0) 
+	{
+		EmitLocalAllocationsExit();
+	}
+	
+	// 반환값만 남기고 프레임(지역 변수 포함)과 호출자가 푸시한 인자 제거
+	EmitOpcode(Engine::Opcode::RET);
+	EmitByte(static_cast<uint8_t>(_currentFunction->GetParameters().size()));
+}
+
+size_t BytecodeGeneratorVisitor::EmitJump(DarkMatterVM::Engine::Opcode opcode) 
+{
+	EmitOpcode(opcode);
+	size_t operandOffset = _bytecode.size();
+	EmitInt16(0);
+	return operandOffset;
+}
+
+void BytecodeGeneratorVisitor::PatchJump(size_t operandOffset) 
+{
+	// 오프셋은 분기 명령어 끝 기준
+	int64_t relative = static_cast<int64_t>(_bytecode.size()) - static_cast<int64_t>(operandOffset + 2);
+	if (relative > std::numeric_limits<int16_t>::max()) 
+	{
+		throw std::runtime_error("분기 거리가 너무 깁니다.");
+	}
+	
+	_bytecode[operandOffset] = static_cast<uint8_t>(relative & 0xFF);
+	_bytecode[operandOffset + 1] = static_cast<uint8_t>((relative >> 8) & 0xFF);
+}
+
+void BytecodeGeneratorVisitor::ResolveCalls() 
+{
+	for (const auto& fixup : _callFixups) 
+	{
+		auto it = _functions.find(fixup.callee);
+		if (it == _functions.end()) 
+		{
+			throw std::runtime_error("정의되지 않은 함수: " + fixup.callee);
+		}
+		if (it->second.parameterCount != fixup.argumentCount) 
+		{
+			throw std::runtime_error("함수 '" + fixup.callee + "'의 인자 수가 맞지 않습니다.");
+		}
+		
+		uint32_t address = static_cast<uint32_t>(it->second.address);
+		for (int i = 0; i < 4; ++i) 
+		{
+			_bytecode[fixup.operandOffset + i] = static_cast<uint8_t>((address >> (i * 8)) & 0xFF);
+		}
+	}
+	
+	_callFixups.clear();
 }
 
 // 방문자 메서드 구현
@@ -131,19 +384,51 @@ void BytecodeGeneratorVisitor::Visit(const BlockNode* node)
 	for (const auto& stmt : node->GetStatements()) 
 	{
 		stmt->Accept(*this);
+		
+		// 문장으로 쓴 식의 결과는 버림 (함수 호출 등)
+		if (IsExpression(stmt.get())) 
+		{
+			EmitOpcode(Engine::Opcode::POP);
+		}
 	}
 }
 
 void BytecodeGeneratorVisitor::Visit(const ProgramNode* node) 
 {
-	// 프로그램의 모든 선언 및 문장을 처리
+	// 전역 선언 및 문장을 먼저 처리하고 함수 본문은 HALT 뒤에 배치
+	std::vector<const FunctionDeclNode*> functions;
 	for (const auto& decl : node->GetDeclarations()) 
 	{
+		if (decl->GetType() == NodeType::FunctionDecl) 
+		{
+			functions.push_back(static_cast<const FunctionDeclNode*>(decl.get()));
+			continue;
+		}
 		decl->Accept(*this);
 	}
 	
+	// main이 있으면 호출하고 반환값을 HALT의 결과로 남김
+	for (const FunctionDeclNode* function : functions) 
+	{
+		if (function->GetName() == "main") 
+		{
+			EmitOpcode(Engine::Opcode::PUSH32);
+			_callFixups.push_back({_bytecode.size(), "main", function->GetParameters().size()});
+			EmitInt32(0);
+			EmitOpcode(Engine::Opcode::CALL);
+			break;
+		}
+	}
+	
 	// 프로그램 종료 명령어 추가
 	EmitOpcode(Engine::Opcode::HALT);
+	
+	for (const FunctionDeclNode* function : functions) 
+	{
+		function->Accept(*this);
+	}
+	
+	ResolveCalls();
 }
 
 void BytecodeGeneratorVisitor::Visit(const IntegerLiteralNode* node) 
@@ -203,7 +488,7 @@ void BytecodeGeneratorVisitor::Visit(const StringLiteralNode* node)
 	EmitInt32(static_cast<int32_t>(len));
 	
 	// 메모리 할당
-	EmitOpcode(Engine::Opcode::ALLOC);
+	EmitAllocation();
 	
 	// 각 문자를 메모리에 저장 (문자열의 각 바이트를 저장)
 	// 이 부분은 실제로는 더 효율적으로 구현해야 함
@@ -219,8 +504,18 @@ void BytecodeGeneratorVisitor::Visit(const BooleanLiteralNode* node)
 
 void BytecodeGeneratorVisitor::Visit(const VariableNode* node) 
 {
-	// 변수 접근 - 주소를 찾아서 LOAD 명령어 생성
-	size_t address = GetVariableAddress(node->GetName());
+	const SymbolInfo& symbol = GetVariable(node->GetName());
+	
+	// 지역 변수/매개변수 - BP 기준 슬롯에서 바로 로드 (주소 푸시 없음)
+	if (!symbol.isGlobal) 
+	{
+		EmitOpcode(symbol.isArgument ? Engine::Opcode::LDARG : Engine::Opcode::LDLOC);
+		EmitByte(static_cast<uint8_t>(symbol.address));
+		return;
+	}
+	
+	// 전역 변수 접근 - 주소를 찾아서 LOAD 명령어 생성
+	size_t address = symbol.address;
 	
 	// 주소 푸시
 	EmitOpcode(Engine::Opcode::PUSH32);
@@ -242,12 +537,7 @@ void BytecodeGeneratorVisitor::Visit(const VariableDeclNode* node)
 		node->GetInitializer()->Accept(*this);
 		
 		// 계산된 값을 변수에 저장
-		size_t address = GetVariableAddress(node->GetName());
-		EmitOpcode(Engine::Opcode::PUSH32);
-		EmitInt32(static_cast<int32_t>(address));
-		
-		// 값 저장 (64비트 변수 가정)
-		EmitOpcode(Engine::Opcode::STORE64);
+		EmitStoreVariable(GetVariable(node->GetName()));
 	}
 }
 
@@ -397,13 +687,163 @@ void BytecodeGeneratorVisitor::Visit(const UnaryOpNode* node)
 	}
 }
 
+void BytecodeGeneratorVisitor::Visit(const FunctionDeclNode* node) 
+{
+	if (_currentFunction) 
+	{
+		throw std::runtime_error("중첩 함수 정의는 지원하지 않습니다: " + node->GetName());
+	}
+	if (_functions.find(node->GetName()) != _functions.end()) 
+	{
+		throw std::runtime_error("함수 '" + node->GetName() + "'가 이미 정의되어 있습니다.");
+	}
+	
+	const auto& parameters = node->GetParameters();
+	FrameScanner scanner;
+	if (node->GetBody()) 
+	{
+		node->GetBody()->Accept(scanner);
+	}
+	if (parameters.size() >= kMaxFrameSlots || scanner.localCount > kMaxFrameSlots) 
+	{
+		throw std::runtime_error("함수 '" + node->GetName() + "'의 매개변수/지역 변수가 너무 많습니다.");
+	}
+	
+	_functions[node->GetName()] = {_bytecode.size(), parameters.size()};
+	_currentFunction = node;
+	_localSymbols.clear();
+	_localCount = 0;
+	_reservedLocals = scanner.localCount;
+	
+	// 매개변수: 호출자가 마지막 인자부터 푸시하므로 i번째 매개변수는 BP + i*8 (LDARG i)
+	for (size_t i = 0; i < parameters.size(); ++i) 
+	{
+		if (!_localSymbols.emplace(parameters[i].second, SymbolInfo(parameters[i].second, parameters[i].first, i, false, true)).second) 
+		{
+			throw std::runtime_error("매개변수 '" + parameters[i].second + "'가 중복되었습니다.");
+		}
+	}
+	
+	// 프롤로그: 지역 변수 슬롯을 0으로 확보 (CALL 직후 푸시한 순서대로 LDLOC 0, 1, ...)
+	for (size_t i = 0; i < _reservedLocals; ++i) 
+	{
+		EmitOpcode(Engine::Opcode::PUSH8);
+		EmitByte(0);
+	}
+	
+	// 함수 안의 임시 할당은 함수 지역 구역에서
+	if (scanner.allocates) 
+	{
+		BeginLocalAllocations();
+	}
+	
+	if (node->GetBody()) 
+	{
+		node->GetBody()->Accept(*this);
+	}
+	
+	// 마지막 문장이 return이 아니면 0을 반환
+	const BlockNode* body = node->GetBody();
+	if (!body || body->GetStatements().empty() || 
+		body->GetStatements().back()->GetType() != NodeType::ReturnStatement) 
+	{
+		EmitOpcode(Engine::Opcode::PUSH8);
+		EmitByte(0);
+		EmitReturn();
+	}
+	
+	if (scanner.allocates) 
+	{
+		EndLocalAllocations();
+	}
+	
+	_currentFunction = nullptr;
+	_localSymbols.clear();
+	_localCount = 0;
+	_reservedLocals = 0;
+}
+
+void BytecodeGeneratorVisitor::Visit(const FunctionCallNode* node) 
+{
+	EmitCallTarget(node);
+	EmitOpcode(Engine::Opcode::CALL);
+}
+
+void BytecodeGeneratorVisitor::EmitCallTarget(const FunctionCallNode* node) 
+{
+	const auto& arguments = node->GetArguments();
+	if (arguments.size() >= kMaxFrameSlots) 
+	{
+		throw std::runtime_error("함수 '" + node->GetCallee() + "' 호출 인자가 너무 많습니다.");
+	}
+	
+	// 마지막 인자부터 푸시 (첫 번째 인자가 프레임 베이스 바로 위, LDARG 0)
+	for (auto it = arguments.rbegin(); it != arguments.rend(); ++it) 
+	{
+		(*it)->Accept(*this);
+	}
+	
+	// 함수 주소는 모든 함수를 생성한 뒤 채움 (뒤에 정의된 함수, 재귀 호출)
+	EmitOpcode(Engine::Opcode::PUSH32);
+	_callFixups.push_back({_bytecode.size(), node->GetCallee(), arguments.size()});
+	EmitInt32(0);
+}
+
+void BytecodeGeneratorVisitor::Visit(const IfStatementNode* node) 
+{
+	// 조건이 0이면 else(없으면 끝)로 분기
+	node->GetCondition()->Accept(*this);
+	size_t elseJump = EmitJump(Engine::Opcode::JZ);
+	
+	if (node->GetThenBlock()) 
+	{
+		node->GetThenBlock()->Accept(*this);
+	}
+	
+	if (node->GetElseBlock()) 
+	{
+		size_t endJump = EmitJump(Engine::Opcode::JMP);
+		PatchJump(elseJump);
+		node->GetElseBlock()->Accept(*this);
+		PatchJump(endJump);
+	}
+	else 
+	{
+		PatchJump(elseJump);
+	}
+}
+
+void BytecodeGeneratorVisitor::Visit(const ReturnStatementNode* node) 
+{
+	// 호출 결과를 그대로 반환하면 현재 프레임을 재사용 (지역 할당을 해제해야 하면 일반 호출 후 RET)
+	const ASTNode* expr = node->GetExpr();
+	if (expr && expr->GetType() == NodeType::FunctionCall && _currentFunction && _localAllocationDepth == 0) 
+	{
+		const auto* call = static_cast<const FunctionCallNode*>(expr);
+		EmitCallTarget(call);
+		EmitOpcode(Engine::Opcode::TAILCALL);
+		EmitByte(static_cast<uint8_t>(call->GetArguments().size()));
+		EmitByte(static_cast<uint8_t>(_currentFunction->GetParameters().size()));
+		return;
+	}
+	
+	// 반환값 (없으면 0)
+	if (node->GetExpr()) 
+	{
+		node->GetExpr()->Accept(*this);
+	}
+	else 
+	{
+		EmitOpcode(Engine::Opcode::PUSH8);
+		EmitByte(0);
+	}
+	
+	EmitReturn();
+}
+
 // 아직 구현되지 않은 노드들에 대한 Visit 메서드는 비워둠
-void BytecodeGeneratorVisitor::Visit(const FunctionDeclNode* node) {}
-void BytecodeGeneratorVisitor::Visit(const FunctionCallNode* node) {}
-void BytecodeGeneratorVisitor::Visit(const IfStatementNode* node) {}
 void BytecodeGeneratorVisitor::Visit(const WhileLoopNode* node) {}
 void BytecodeGeneratorVisitor::Visit(const ForLoopNode* node) {}
-void BytecodeGeneratorVisitor::Visit(const ReturnStatementNode* node) {}
 void BytecodeGeneratorVisitor::Visit(const BreakStatementNode* node) {}
 void BytecodeGeneratorVisitor::Visit(const ContinueStatementNode* node) {}
 void BytecodeGeneratorVisitor::Visit(const AssignmentOpNode* node) {}
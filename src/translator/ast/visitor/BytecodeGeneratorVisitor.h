@@ -14,6 +14,8 @@ namespace Translator
 
 /**
  * @brief 심볼 정보 (변수, 함수 등)
+ * 
+ * 전역 변수는 address가 절대 주소, 함수 안의 지역 변수/매개변수는 BP 기준 슬롯 인덱스(LDLOC/STLOC/LDARG 오퍼랜드)
  */
 struct SymbolInfo 
 {
@@ -21,15 +23,25 @@ struct SymbolInfo
 	std::string type;
 	size_t address;
 	bool isGlobal;
+	bool isArgument;
 	
-	SymbolInfo(const std::string& name, const std::string& type, size_t address, bool isGlobal = false)
-		: name(name), type(type), address(address), isGlobal(isGlobal) {}
+	SymbolInfo(const std::string& name, const std::string& type, size_t address, bool isGlobal = false, bool isArgument = false)
+		: name(name), type(type), address(address), isGlobal(isGlobal), isArgument(isArgument) {}
 
 	SymbolInfo()
-		: name(), type(), address(0), isGlobal(false)
+		: name(), type(), address(0), isGlobal(false), isArgument(false)
 	{}
 };
 
+/**
+ * @brief 함수 정보
+ */
+struct FunctionInfo 
+{
+	size_t address;			///< 함수 시작 바이트코드 오프셋 (CALL 목적지)
+	size_t parameterCount;	///< 매개변수 수 (RET이 제거할 인자 수)
+};
+
 /**
  * @brief 바이트코드 생성 방문자 클래스
  * 
@@ -104,9 +116,34 @@ private:
 	// 심볼 테이블 (변수/함수 이름 -> 심볼 정보)
 	std::unordered_map<std::string, SymbolInfo> _symbolTable;
 	
-	// 현재 데이터 주소 (메모리 할당용)
+	// 현재 데이터 주소 (전역 변수 메모리 할당용)
 	size_t _currentAddress;
 	
+	// 정의된 함수 (이름 -> 시작 주소/매개변수 수)
+	std::unordered_map<std::string, FunctionInfo> _functions;
+	
+	// 함수 주소를 나중에 채울 호출 지점 (PUSH32 오퍼랜드 위치, 함수 이름, 인자 수)
+	struct CallFixup 
+	{
+		size_t operandOffset;
+		std::string callee;
+		size_t argumentCount;
+	};
+	std::vector<CallFixup> _callFixups;
+	
+	// 생성 중인 함수의 지역 변수/매개변수 (함수 밖이면 비어 있음)
+	std::unordered_map<std::string, SymbolInfo> _localSymbols;
+	
+	// 생성 중인 함수 (함수 밖이면 nullptr)
+	const FunctionDeclNode* _currentFunction;
+	
+	// 현재 함수에서 배정한 지역 변수 슬롯 수와 프롤로그에서 확보한 슬롯 수
+	size_t _localCount;
+	size_t _reservedLocals;
+	
+	// 열려 있는 지역 할당 구역 수 (0보다 크면 임시 할당을 ARENA_ALLOC으로 생성)
+	size_t _localAllocationDepth;
+	
 	// 1바이트를 바이트코드에 추가
 	void EmitByte(uint8_t byte);
 	
@@ -122,11 +159,44 @@ private:
 	// VM 명령어(Opcode)를 바이트코드에 추가
 	void EmitOpcode(DarkMatterVM::Engine::Opcode opcode);
 	
-	// 새 변수 등록
+	// 함수 지역 할당 구역 시작 (ARENA_BEGIN), 함수 본문 앞에서 호출
+	void BeginLocalAllocations();
+	
+	// 함수에서 나가는 경로마다 RET 앞에서 지역 할당 해제 (ARENA_RESET)
+	void EmitLocalAllocationsExit();
+	
+	// 함수 지역 할당 구역 끝 (함수 본문 생성 후 호출, 명령어는 만들지 않음)
+	void EndLocalAllocations();
+	
+	// 임시 할당 명령어 생성 (지역 구역 안이면 ARENA_ALLOC, 밖이면 ALLOC)
+	void EmitAllocation();
+	
+	// 새 변수 등록 (함수 안이면 다음 지역 변수 슬롯, 밖이면 전역 주소)
 	void RegisterVariable(const std::string& name, const std::string& type);
 	
+	// 변수 찾기 (지역 변수/매개변수 먼저, 없으면 전역)
+	const SymbolInfo& GetVariable(const std::string& name);
+	
 	// 변수 주소 찾기
 	size_t GetVariableAddress(const std::string& name);
+	
+	// 스택 최상위 값을 변수에 저장 (지역 변수는 STLOC, 전역은 STORE64)
+	void EmitStoreVariable(const SymbolInfo& symbol);
+	
+	// 현재 함수에서 반환 (반환값은 스택 최상위, 지역 할당 해제 후 RET 인자 수)
+	void EmitReturn();
+	
+	// 호출 인자(마지막 인자부터)와 나중에 채울 함수 주소 푸시 (CALL/TAILCALL 앞부분)
+	void EmitCallTarget(const FunctionCallNode* node);
+	
+	// 상대 분기 명령어를 만들고 나중에 채울 오퍼랜드 위치 반환
+	size_t EmitJump(DarkMatterVM::Engine::Opcode opcode);
+	
+	// EmitJump로 만든 분기의 목적지를 현재 위치로 채움
+	void PatchJump(size_t operandOffset);
+	
+	// 호출 지점의 함수 주소 채우기 (모든 함수 생성 후)
+	void ResolveCalls();
 };
 
 } // namespace Translator
@@ -2,6 +2,8 @@
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
+#include <limits>
 #include "../ast/nodes/ContainerNodes.h"
 #include "../ast/nodes/LiteralNodes.h"
 #include "../ast/nodes/OperatorNodes.h"
@@ -229,6 +231,12 @@ void BytecodeBuilder::ProcessVariable(const VariableNode* node)
 	size_t address = GetVariableAddress(name);
 	Logger::Info("BytecodeBuilder", "    변수 주소: 0x" + std::to_string(address));
 	
+	// 배열은 같은 크기 배열의 초기화 식으로만 쓸 수 있음 (ProcessAggregateDecl)
+	if (GetTypeSize(_symbolTable[name].type) > 8) 
+	{
+		throw std::runtime_error("배열 '" + name + "'은 값으로 사용할 수 없습니다");
+	}
+	
 	// 변수 주소를 스택에 푸시
 	EmitOpcode(Engine::Opcode::PUSH64);
 	EmitInt64(static_cast<int64_t>(address));
@@ -248,6 +256,12 @@ void BytecodeBuilder::ProcessVariableDecl(const VariableDeclNode* node)
 	RegisterVariable(name, type);
 	Logger::Info("BytecodeBuilder", "    변수 등록 완료: 주소 0x" + std::to_string(_symbolTable[name].address));
 	
+	if (GetTypeSize(type) > 8) 
+	{
+		ProcessAggregateDecl(node);
+		return;
+	}
+	
 	// 초기화 값이 있으면 처리
 	if (const ASTNode* initializer = node->GetInitializer()) 
 	{
@@ -271,6 +285,84 @@ void BytecodeBuilder::ProcessVariableDecl(const VariableDeclNode* node)
 	}
 }
 
+void BytecodeBuilder::ProcessAggregateDecl(const VariableDeclNode* node) 
+{
+	const size_t address = _symbolTable[node->GetName()].address;
+	const size_t size = GetTypeSize(node->GetType());
+	const ASTNode* initializer = node->GetInitializer();
+	
+	// 초기화 식이 없으면 0으로 채움
+	if (!initializer) 
+	{
+		EmitBlockFill(address, 0, size);
+		return;
+	}
+	
+	// 같은 크기의 배열에서 복사: 원소마다 LOAD64/STORE64 대신 MEMCPY 한 번
+	if (initializer->GetType() == NodeType::Variable) 
+	{
+		auto it = _symbolTable.find(dynamic_cast<const VariableNode*>(initializer)->GetName());
+		if (it != _symbolTable.end() && GetTypeSize(it->second.type) > 8) 
+		{
+			if (GetTypeSize(it->second.type) != size) 
+			{
+				throw std::runtime_error("크기가 다른 배열 '" + it->first + "'로 '" + node->GetName() + "' 초기화");
+			}
+			
+			Logger::Info("BytecodeBuilder", "    배열 복사: " + std::to_string(size) + " 바이트");
+			EmitBlockCopy(address, it->second.address, size);
+			return;
+		}
+	}
+	
+	// 모든 바이트가 같은 값(0, -1 등)은 MEMSET 한 번
+	if (initializer->GetType() == NodeType::IntegerLiteral) 
+	{
+		uint64_t value = static_cast<uint64_t>(dynamic_cast<const IntegerLiteralNode*>(initializer)->GetValue());
+		if (value == (value & 0xFF) * 0x0101010101010101ULL) 
+		{
+			EmitBlockFill(address, static_cast<uint8_t>(value), size);
+			return;
+		}
+	}
+	
+	// 그 밖의 값은 첫 원소에 저장한 뒤 채운 구간을 두 배씩 복사 (MEMCPY log2(N)번)
+	ProcessNode(initializer);
+	EmitOpcode(Engine::Opcode::PUSH64);
+	EmitInt64(static_cast<int64_t>(address));
+	EmitOpcode(Engine::Opcode::SWAP);
+	EmitOpcode(Engine::Opcode::STORE64);
+	
+	for (size_t filled = 8; filled < size; ) 
+	{
+		size_t chunk = std::min(filled, size - filled);
+		EmitBlockCopy(address + filled, address, chunk);
+		filled += chunk;
+	}
+}
+
+void BytecodeBuilder::EmitBlockCopy(size_t destination, size_t source, size_t size) 
+{
+	EmitOpcode(Engine::Opcode::PUSH64);
+	EmitInt64(static_cast<int64_t>(destination));
+	EmitOpcode(Engine::Opcode::PUSH64);
+	EmitInt64(static_cast<int64_t>(source));
+	EmitOpcode(Engine::Opcode::PUSH32);
+	EmitInt32(static_cast<int32_t>(size));
+	EmitOpcode(Engine::Opcode::MEMCPY);
+}
+
+void BytecodeBuilder::EmitBlockFill(size_t destination, uint8_t value, size_t size) 
+{
+	EmitOpcode(Engine::Opcode::PUSH64);
+	EmitInt64(static_cast<int64_t>(destination));
+	EmitOpcode(Engine::Opcode::PUSH8);
+	EmitByte(value);
+	EmitOpcode(Engine::Opcode::PUSH32);
+	EmitInt32(static_cast<int32_t>(size));
+	EmitOpcode(Engine::Opcode::MEMSET);
+}
+
 void BytecodeBuilder::ProcessBinaryOp(const BinaryOpNode* node) 
 {
 	// 이항 연산자 처리
@@ -355,11 +447,11 @@ void BytecodeBuilder::RegisterVariable(const std::string& name, const std::strin
 	
 	Logger::Debug("BytecodeBuilder", "변수 등록 - 이름=" + name + ", 타입=" + type + ", 주소=0x" + std::to_string(_currentAddress));
 	
-	// 새 변수 등록 (8바이트 공간 할당 - int64_t 기준)
+	// 새 변수 등록 (원소당 8바이트 공간 할당 - int64_t 기준)
 	_symbolTable.emplace(name, SymbolInfo(name, type, _currentAddress));
 	
 	// 주소 업데이트 (다음 변수를 위한 공간 확보)
-	_currentAddress += 8;
+	_currentAddress += GetTypeSize(type);
 }
 
 size_t BytecodeBuilder::GetVariableAddress(const std::string& name) 
@@ -373,5 +465,22 @@ size_t BytecodeBuilder::GetVariableAddress(const std::string& name)
 	return it->second.address;
 }
 
+size_t BytecodeBuilder::GetTypeSize(const std::string& type) 
+{
+	size_t bracket = type.find('[');
+	if (bracket == std::string::npos) 
+	{
+		return 8;
+	}
+	
+	// 바이트 길이는 MEMCPY/MEMSET의 PUSH32 오퍼랜드로 나가므로 int32 범위 안이어야 함
+	size_t count = std::stoull(type.substr(bracket + 1));
+	if (count == 0 || count > static_cast<size_t>(std::numeric_limits<int32_t>::max()) / 8) 
+	{
+		throw std::runtime_error("지원하지 않는 배열 크기: " + type);
+	}
+	return count * 8;
+}
+
 } // namespace Translator
 } // namespace DarkMatterVM
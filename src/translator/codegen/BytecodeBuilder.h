@@ -125,6 +125,13 @@ private:
 	void ProcessVariableDecl(const VariableDeclNode* node);
 	void ProcessBinaryOp(const BinaryOpNode* node);
 	
+	// 배열 변수 선언 처리 (복사는 MEMCPY, 초기화는 MEMSET 또는 첫 원소를 두 배씩 복사)
+	void ProcessAggregateDecl(const VariableDeclNode* node);
+	
+	// 블록 복사/채우기 명령어 생성 (주소와 길이는 즉시값)
+	void EmitBlockCopy(size_t destination, size_t source, size_t size);
+	void EmitBlockFill(size_t destination, uint8_t value, size_t size);
+	
 	// 일반 노드 처리 함수
 	void ProcessNode(const ASTNode* node);
 	
@@ -133,6 +140,9 @@ private:
 	
 	// 변수 주소 찾기
 	size_t GetVariableAddress(const std::string& name);
+	
+	// 타입 크기 (int는 8바이트, int[N]은 8 * N바이트)
+	static size_t GetTypeSize(const std::string& type);
 };
 
 } // namespace Translator